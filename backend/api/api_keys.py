@@ -1,6 +1,9 @@
 """API Key management endpoints."""
 
+import asyncio
 import hashlib
+import hmac
+import logging
 import secrets
 from datetime import datetime
 
@@ -8,8 +11,19 @@ from db import get_db
 from fastapi import APIRouter, Header, HTTPException
 from pydantic import BaseModel
 
+logger = logging.getLogger(__name__)
 router = APIRouter(prefix="/api-keys", tags=["api-keys"])
 
+# Validation index: key_hash -> permissions of enabled keys (None = not loaded).
+# Rebuilt from the database after any create/update/delete.
+_key_index: dict[str, dict] | None = None
+_key_index_db = None  # Database the index was loaded from
+_key_index_generation = 0  # Bumped by every invalidation
+
+# last_used timestamps not yet written: key_id -> timestamp
+_pending_last_used: dict[int, int] = {}
+LAST_USED_FLUSH_INTERVAL = 60.0  # seconds
+
 
 # === Schemas ===
 
@@ -68,14 +82,99 @@ def generate_api_key() -> tuple[str, str, str]:
     # Generate a secure random API key with prefix
     full_key = f"sb_{secrets.token_urlsafe(32)}"
     # Use SHA256 for hashing (simple and fast for API key validation)
-    key_hash = hashlib.sha256(full_key.encode()).hexdigest()
+    key_hash = hash_api_key(full_key)
     key_prefix = full_key[:8]
     return full_key, key_hash, key_prefix
 
 
+def hash_api_key(key: str) -> str:
+    """SHA256 hash of an API key, as stored in api_keys.key_hash."""
+    return hashlib.sha256(key.encode()).hexdigest()
+
+
 def verify_api_key(key: str, key_hash: str) -> bool:
     """Verify an API key against its hash."""
-    return hashlib.sha256(key.encode()).hexdigest() == key_hash
+    return hmac.compare_digest(hash_api_key(key), key_hash)
+
+
+def _invalidate_key_index() -> None:
+    """Drop the validation index so it is reloaded on next use."""
+    global _key_index, _key_index_generation
+    _key_index = None
+    _key_index_generation += 1
+
+
+async def _get_key_index(db) -> dict[str, dict]:
+    """Get the validation index, loading it from the database if needed.
+
+    A key change while the query runs invalidates what was read, so the load
+    is repeated rather than installing an index that still has the old key.
+    """
+    global _key_index, _key_index_db
+
+    while _key_index is None or _key_index_db is not db:
+        generation = _key_index_generation
+        async with db.conn.execute(
+            """
+            SELECT id, name, key_hash, can_read, can_write, can_control
+            FROM api_keys
+            WHERE enabled = 1
+            """
+        ) as cursor:
+            rows = await cursor.fetchall()
+
+        if generation != _key_index_generation:
+            continue
+        _key_index = {
+            key_hash: {
+                "id": key_id,
+                "name": name,
+                "can_read": bool(can_read),
+                "can_write": bool(can_write),
+                "can_control": bool(can_control),
+            }
+            for key_id, name, key_hash, can_read, can_write, can_control in rows
+        }
+        _key_index_db = db
+    return _key_index
+
+
+async def flush_api_key_usage(db=None) -> int:
+    """Write pending last_used timestamps in one batch.
+
+    Returns:
+        Number of keys updated.
+    """
+    if not _pending_last_used:
+        return 0
+
+    pending = dict(_pending_last_used)
+    _pending_last_used.clear()
+
+    try:
+        if db is None:
+            db = await get_db()
+        await db.conn.executemany(
+            "UPDATE api_keys SET last_used = ? WHERE id = ?",
+            [(last_used, key_id) for key_id, last_used in pending.items()],
+        )
+        await db.conn.commit()
+    except Exception:
+        # Keep them for the next flush; uses recorded meanwhile are newer
+        for key_id, last_used in pending.items():
+            _pending_last_used.setdefault(key_id, last_used)
+        raise
+    return len(pending)
+
+
+async def api_key_usage_flusher() -> None:
+    """Background task: periodically persist last_used timestamps."""
+    while True:
+        await asyncio.sleep(LAST_USED_FLUSH_INTERVAL)
+        try:
+            await flush_api_key_usage()
+        except Exception as e:
+            logger.warning(f"Failed to write API key usage: {e}")
 
 
 # === API Endpoints ===
@@ -85,6 +184,7 @@ def verify_api_key(key: str, key_hash: str) -> bool:
 async def list_api_keys():
     """List all API keys (without full key values)."""
     db = await get_db()
+    await flush_api_key_usage(db)
     async with db.conn.execute(
         """
         SELECT id, name, key_prefix, can_read, can_write, can_control,
@@ -130,6 +230,7 @@ async def create_api_key(data: APIKeyCreate):
         (data.name, key_hash, key_prefix, data.can_read, data.can_write, data.can_control, created_at),
     )
     await db.conn.commit()
+    _invalidate_key_index()
     key_id = cursor.lastrowid
 
     return APIKeyCreateResponse(
@@ -150,6 +251,7 @@ async def create_api_key(data: APIKeyCreate):
 async def get_api_key_by_id(key_id: int):
     """Get an API key by ID."""
     db = await get_db()
+    await flush_api_key_usage(db)
     async with db.conn.execute(
         """
         SELECT id, name, key_prefix, can_read, can_write, can_control,
@@ -214,6 +316,7 @@ async def update_api_key(key_id: int, data: APIKeyUpdate):
         params,
     )
     await db.conn.commit()
+    _invalidate_key_index()
 
     return await get_api_key_by_id(key_id)
 
@@ -228,6 +331,8 @@ async def delete_api_key(key_id: int):
 
     await db.conn.execute("DELETE FROM api_keys WHERE id = ?", (key_id,))
     await db.conn.commit()
+    _invalidate_key_index()
+    _pending_last_used.pop(key_id, None)
 
     return {"message": "API key deleted"}
 
@@ -258,34 +363,13 @@ async def validate_api_key(
             detail="API key required. Provide 'X-API-Key' header or 'Authorization: Bearer <key>'",
         )
 
-    # Get all enabled API keys and check them
+    # One hash + dict lookup; last_used is written in batches by the flusher
     db = await get_db()
-    async with db.conn.execute(
-        """
-        SELECT id, name, key_hash, can_read, can_write, can_control
-        FROM api_keys
-        WHERE enabled = 1
-        """
-    ) as cursor:
-        rows = await cursor.fetchall()
-
-    for row in rows:
-        key_id, name, key_hash, can_read, can_write, can_control = row
-        if verify_api_key(api_key_value, key_hash):
-            # Update last_used timestamp
-            await db.conn.execute(
-                "UPDATE api_keys SET last_used = ? WHERE id = ?",
-                (int(datetime.now().timestamp()), key_id),
-            )
-            await db.conn.commit()
-
-            return {
-                "id": key_id,
-                "name": name,
-                "can_read": bool(can_read),
-                "can_write": bool(can_write),
-                "can_control": bool(can_control),
-            }
+    key_index = await _get_key_index(db)
+    api_key = key_index.get(hash_api_key(api_key_value))
+    if api_key:
+        _pending_last_used[api_key["id"]] = int(datetime.now().timestamp())
+        return dict(api_key)
 
     raise HTTPException(status_code=401, detail="Invalid API key")
 
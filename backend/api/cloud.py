@@ -5,11 +5,14 @@ Handles authentication and fetching slicer presets from Bambu Cloud.
 Credentials are persisted to the database for persistence across restarts.
 """
 
+import asyncio
+import hashlib
 import logging
 import time
 
 from db import get_db
-from fastapi import APIRouter, HTTPException
+from fastapi import APIRouter, HTTPException, Query, Request
+from fastapi.responses import Response
 from models import (
     CloudAuthStatus,
     CloudLoginRequest,
@@ -24,6 +27,7 @@ from services.bambu_cloud import (
     BambuCloudError,
     get_cloud_service,
 )
+from services.preset_feed import FEED_FORMAT, build_feed
 
 logger = logging.getLogger(__name__)
 router = APIRouter(prefix="/cloud", tags=["cloud"])
@@ -32,6 +36,11 @@ router = APIRouter(prefix="/cloud", tags=["cloud"])
 _settings_cache: SlicerSettingsResponse | None = None
 _settings_cache_time: float = 0
 _settings_cache_ttl: float = 300.0  # 5 minutes cache TTL
+_presets_version_max_age: float = 3600.0  # Refresh behind a display's version check after 1 hour
+_presets_refresh_task: asyncio.Task | None = None
+
+# Compact feeds built from the cached settings: (filament_version, limit) -> bytes
+_compact_feed_cache: dict[tuple[str | None, int | None], bytes] = {}
 
 # Database keys for cloud credentials
 CLOUD_TOKEN_KEY = "cloud_access_token"
@@ -71,9 +80,49 @@ def _clear_settings_cache() -> None:
     global _settings_cache, _settings_cache_time
     _settings_cache = None
     _settings_cache_time = 0
+    _compact_feed_cache.clear()
     logger.info("[Cloud] Settings cache cleared")
 
 
+def _filament_presets_version(presets: list[SlicerPreset]) -> str:
+    """Content version of a filament preset list."""
+    digest = hashlib.sha1()
+    for p in presets:
+        digest.update(f"{p.setting_id}\0{p.name}\0{p.type}\0{int(p.is_custom)}\n".encode())
+    return digest.hexdigest()[:16]
+
+
+async def _refresh_presets() -> None:
+    try:
+        await get_slicer_settings(refresh=True)
+    except Exception as e:
+        logger.warning(f"[Cloud] Background preset refresh failed: {e}")
+
+
+def get_presets_version() -> str | None:
+    """Version of the filament preset catalog, reported to displays on heartbeat.
+
+    Displays keep the catalog in flash and only re-download it when this
+    changes. Never waits on Bambu Cloud: old cached settings are refreshed
+    in the background and the new version goes out on a later heartbeat.
+    Returns None until presets have been fetched.
+    """
+    global _presets_refresh_task
+
+    if _settings_cache is None:
+        return None
+
+    if time.time() - _settings_cache_time > _presets_version_max_age and (
+        _presets_refresh_task is None or _presets_refresh_task.done()
+    ):
+        try:
+            _presets_refresh_task = asyncio.get_running_loop().create_task(_refresh_presets())
+        except RuntimeError:
+            pass  # No running loop
+
+    return _settings_cache.filament_version
+
+
 @router.get("/status", response_model=CloudAuthStatus)
 async def get_auth_status():
     """Get current cloud authentication status."""
@@ -278,6 +327,8 @@ async def get_slicer_settings(version: str = "02.04.00.70", refresh: bool = Fals
 
             setattr(result, our_type, parsed)
 
+        result.filament_version = _filament_presets_version(result.filament)
+
         # Cache the result
         _settings_cache = result
         _settings_cache_time = time.time()
@@ -332,3 +383,33 @@ async def get_filament_presets():
     """
     settings = await get_slicer_settings()
     return settings.filament
+
+
+@router.get("/filaments/compact")
+async def get_compact_filament_presets(request: Request, limit: int | None = Query(default=None, ge=1, le=65535)):
+    """
+    Get filament presets as a compact binary feed for displays.
+
+    Brand, material and temperature range are resolved here, and entries are
+    deduplicated, sorted (custom first) and packed into fixed-width records,
+    see services/preset_feed.py for the layout. The ETag is
+    "<version>.<format>.<limit>", where version is the filament catalog
+    version reported on display heartbeat; a matching If-None-Match gets 304.
+    """
+    settings = await get_slicer_settings()
+    etag = f'"{settings.filament_version}.{FEED_FORMAT}.{limit or 0}"'
+    headers = {"ETag": etag, "Cache-Control": "no-cache"}
+
+    if request.headers.get("if-none-match") == etag:
+        return Response(status_code=304, headers=headers)
+
+    key = (settings.filament_version, limit)
+    feed = _compact_feed_cache.get(key)
+    if feed is None:
+        if any(k[0] != settings.filament_version for k in _compact_feed_cache):
+            _compact_feed_cache.clear()
+        feed = build_feed(settings.filament, limit)
+        _compact_feed_cache[key] = feed
+        logger.info(f"[Cloud] Built compact preset feed: {len(feed)} bytes (limit={limit})")
+
+    return Response(content=feed, media_type="application/octet-stream", headers=headers)
@@ -1,13 +1,16 @@
 """Color catalog API endpoints."""
 
+import asyncio
 import json
 import logging
+import time
 
 import httpx
 from db.database import get_db
-from fastapi import APIRouter, HTTPException
+from fastapi import APIRouter, HTTPException, Query
 from fastapi.responses import StreamingResponse
 from pydantic import BaseModel
+from services.color_index import ColorIndex, hex_to_lab
 
 logger = logging.getLogger(__name__)
 router = APIRouter(prefix="/colors", tags=["colors"])
@@ -15,6 +18,38 @@ router = APIRouter(prefix="/colors", tags=["colors"])
 # FilamentColors.xyz API
 FILAMENT_COLORS_API = "https://filamentcolors.xyz/api"
 
+# In-memory index of the color_catalog table, loaded on first use and kept
+# in step by the write endpoints below
+_color_index = ColorIndex()
+_color_index_db = None  # Database the index was loaded from
+_color_index_lock = asyncio.Lock()
+
+
+async def get_color_index() -> ColorIndex:
+    """Get the color index, loading it from the database if needed."""
+    global _color_index, _color_index_db
+    db = await get_db()
+    if _color_index_db is db:
+        return _color_index
+
+    async with _color_index_lock:
+        if _color_index_db is not db:
+            entries = await db.get_color_catalog()
+            index = ColorIndex()
+            # A synced catalog has tens of thousands of rows - index off the event loop
+            await asyncio.to_thread(index.load, entries)
+            _color_index = index
+            _color_index_db = db
+            logger.info(f"Color index loaded: {len(index)} entries")
+    return _color_index
+
+
+def _clear_color_index() -> None:
+    """Drop the in-memory color index (reloaded on next use)."""
+    global _color_index, _color_index_db
+    _color_index = ColorIndex()
+    _color_index_db = None
+
 
 class ColorEntry(BaseModel):
     """Color catalog entry."""
@@ -46,6 +81,12 @@ class ColorEntryUpdate(BaseModel):
     material: str | None = None
 
 
+class ColorMatch(ColorEntry):
+    """Color catalog entry with a match score."""
+
+    score: float
+
+
 class ColorLookupResult(BaseModel):
     """Result of color lookup."""
 
@@ -69,6 +110,7 @@ async def add_color_entry(entry: ColorEntryCreate) -> ColorEntry:
     result = await db.add_color_catalog_entry(entry.manufacturer, entry.color_name, entry.hex_color, entry.material)
     if not result:
         raise HTTPException(status_code=500, detail="Failed to add entry")
+    (await get_color_index()).upsert(result)
     return ColorEntry(**result)
 
 
@@ -81,6 +123,7 @@ async def update_color_entry(entry_id: int, entry: ColorEntryUpdate) -> ColorEnt
     )
     if not result:
         raise HTTPException(status_code=404, detail="Entry not found")
+    (await get_color_index()).upsert(result)
     return ColorEntry(**result)
 
 
@@ -91,6 +134,7 @@ async def delete_color_entry(entry_id: int) -> dict:
     success = await db.delete_color_catalog_entry(entry_id)
     if not success:
         raise HTTPException(status_code=404, detail="Entry not found")
+    (await get_color_index()).remove(entry_id)
     return {"status": "deleted"}
 
 
@@ -99,56 +143,54 @@ async def reset_color_catalog() -> dict:
     """Reset color catalog to defaults."""
     db = await get_db()
     await db.reset_color_catalog()
+    _clear_color_index()
     return {"status": "reset"}
 
 
 @router.get("/lookup")
 async def lookup_color(manufacturer: str, color_name: str, material: str | None = None) -> ColorLookupResult:
-    """Look up a color by manufacturer and color name."""
-    db = await get_db()
-    result = await db.lookup_color(manufacturer, color_name, material)
+    """Look up a color by manufacturer and color name (case-insensitive)."""
+    index = await get_color_index()
+    result = index.lookup(manufacturer, color_name, material)
     if result:
         return ColorLookupResult(found=True, hex_color=result["hex_color"], material=result["material"])
     return ColorLookupResult(found=False)
 
 
 @router.get("/search")
-async def search_colors(manufacturer: str | None = None, material: str | None = None) -> list[ColorEntry]:
-    """Search colors by manufacturer and/or material."""
-    db = await get_db()
-
-    # Build query based on provided filters
-    query = (
-        "SELECT id, manufacturer, color_name, hex_color, material, is_default, created_at FROM color_catalog WHERE 1=1"
-    )
-    params: list = []
-
-    if manufacturer:
-        # Case-insensitive partial match for manufacturer
-        query += " AND LOWER(manufacturer) LIKE LOWER(?)"
-        params.append(f"%{manufacturer}%")
-
-    if material:
-        # Case-insensitive partial match for material
-        query += " AND LOWER(material) LIKE LOWER(?)"
-        params.append(f"%{material}%")
-
-    query += " ORDER BY manufacturer, color_name LIMIT 100"
-
-    async with db.conn.execute(query, params) as cursor:
-        rows = await cursor.fetchall()
-        return [
-            ColorEntry(
-                id=row[0],
-                manufacturer=row[1],
-                color_name=row[2],
-                hex_color=row[3],
-                material=row[4],
-                is_default=bool(row[5]),
-                created_at=row[6],
-            )
-            for row in rows
-        ]
+async def search_colors(
+    manufacturer: str | None = None,
+    material: str | None = None,
+    q: str | None = None,
+    limit: int = Query(default=100, ge=1, le=500),
+) -> list[ColorEntry]:
+    """Search colors by manufacturer and/or material (partial, case-insensitive).
+
+    With q, entries are ranked by fuzzy similarity of q to
+    "manufacturer color_name material" instead of sorted by name.
+    """
+    index = await get_color_index()
+    if q:
+        return [ColorEntry(**e) for e, _ in index.search(q, limit, manufacturer, material)]
+    return [ColorEntry(**e) for e in index.filter(manufacturer, material, limit)]
+
+
+@router.get("/nearest")
+async def nearest_colors(
+    hex_color: str,
+    material: str | None = None,
+    limit: int = Query(default=5, ge=1, le=50),
+) -> list[ColorMatch]:
+    """Find the catalog colors perceptually closest to hex_color.
+
+    score is the CIE76 color difference (delta E); below ~2.3 is barely
+    distinguishable.
+    """
+    if hex_to_lab(hex_color) is None:
+        raise HTTPException(status_code=400, detail="Invalid hex color")
+    index = await get_color_index()
+    matches = index.nearest(hex_color, limit, material)
+    return [ColorMatch(**e, score=round(d, 2)) for e, d in matches]
 
 
 class SyncResult(BaseModel):
@@ -167,6 +209,7 @@ async def sync_from_filamentcolors():
 
     async def generate():
         db = await get_db()
+        index = await get_color_index()
         added = 0
         skipped = 0
         total_fetched = 0
@@ -228,6 +271,17 @@ async def sync_from_filamentcolors():
                             )
                             if cursor.rowcount > 0:
                                 added += 1
+                                index.upsert(
+                                    {
+                                        "id": cursor.lastrowid,
+                                        "manufacturer": manufacturer_name,
+                                        "color_name": color_name,
+                                        "hex_color": hex_color.upper(),
+                                        "material": material,
+                                        "is_default": 0,
+                                        "created_at": int(time.time()),
+                                    }
+                                )
                             else:
                                 skipped += 1
                         except Exception as e:
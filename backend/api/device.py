@@ -1,16 +1,19 @@
 """ESP32 Device Connection API.
 
-Handles device discovery, connection management, and emergency recovery.
+Handles device discovery, connection management, device logs, and emergency recovery.
 """
 
 import asyncio
 import ipaddress
 import logging
 import socket
+import time
 from datetime import datetime
 
-from fastapi import APIRouter, HTTPException
+import psutil
+from fastapi import APIRouter, HTTPException, Query, WebSocket, WebSocketDisconnect
 from pydantic import BaseModel
+from services import device_logs
 
 logger = logging.getLogger(__name__)
 
@@ -65,6 +68,8 @@ class DiscoveryResult(BaseModel):
 
     devices: list[DeviceInfo]
     scan_duration_ms: int
+    cached: bool = False
+    partial: bool = False  # A discovery method failed or the subnet scan ran out of time
 
 
 # Global state for device connection
@@ -73,6 +78,21 @@ _device_config: DeviceConfig | None = None
 _last_error: str | None = None
 _reconnect_attempts: int = 0
 
+# Subnet discovery tuning
+DISCOVERY_CONCURRENCY = 32  # Probes in flight at once
+DISCOVERY_CACHE_TTL = 30.0  # seconds a discovery result is reused
+RECENT_DEVICE_TTL = 3600.0  # seconds an address stays "recently seen" (probed first)
+MAX_SCAN_PREFIX = 24  # Wider interface networks are scanned as the /24 around the host
+PROBE_TIMEOUT_INITIAL = 0.5  # TCP connect timeout before any host has answered
+PROBE_TIMEOUT_MIN = 0.15
+PROBE_TIMEOUT_MAX = 2.0
+
+# Discovery cache: (monotonic time, devices) of the last scan
+_discovery_cache: tuple[float, list[DeviceInfo]] | None = None
+_discovery_lock = asyncio.Lock()
+# ip -> monotonic time a device was last found there
+_recent_devices: dict[str, float] = {}
+
 
 @router.get("/status", response_model=ConnectionStatus)
 async def get_connection_status():
@@ -154,38 +174,60 @@ async def disconnect_device():
 
 
 @router.post("/discover", response_model=DiscoveryResult)
-async def discover_devices(timeout_ms: int = 3000):
+async def discover_devices(timeout_ms: int = 3000, refresh: bool = False):
     """Discover SpoolBuddy devices on the local network.
 
-    Uses mDNS/DNS-SD to find devices advertising _spoolbuddy._tcp.
-    Falls back to subnet scan if mDNS fails.
+    Runs mDNS/DNS-SD (_spoolbuddy._tcp) and a subnet scan together and merges
+    the results. A complete result is reused for DISCOVERY_CACHE_TTL seconds,
+    and a request arriving while a scan runs waits for that scan instead of
+    starting another. Partial results (a method failed, or the subnet scan
+    hit the timeout before probing every address) are returned but not
+    cached.
 
     Args:
         timeout_ms: Discovery timeout in milliseconds
+        refresh: Ignore the cached result and scan again
     """
+    global _discovery_cache
+
     start_time = datetime.now()
-    devices: list[DeviceInfo] = []
 
-    # Try mDNS discovery first
-    try:
-        mdns_devices = await _discover_mdns(timeout_ms / 1000)
-        devices.extend(mdns_devices)
-    except Exception as e:
-        logger.warning(f"mDNS discovery failed: {e}")
+    async with _discovery_lock:
+        if not refresh and _discovery_cache and time.monotonic() - _discovery_cache[0] < DISCOVERY_CACHE_TTL:
+            return DiscoveryResult(
+                devices=_discovery_cache[1],
+                scan_duration_ms=int((datetime.now() - start_time).total_seconds() * 1000),
+                cached=True,
+            )
 
-    # If no devices found, try common ports on local subnet
-    if not devices:
-        try:
-            subnet_devices = await _discover_subnet(timeout_ms / 1000)
-            devices.extend(subnet_devices)
-        except Exception as e:
-            logger.warning(f"Subnet discovery failed: {e}")
+        partial = False
+        mdns_result, subnet_result = await asyncio.gather(
+            _discover_mdns(timeout_ms / 1000),
+            _discover_subnet(timeout_ms / 1000),
+            return_exceptions=True,
+        )
+        if isinstance(mdns_result, BaseException):
+            logger.warning(f"mDNS discovery failed: {mdns_result}")
+            mdns_result = []
+            partial = True
+        if isinstance(subnet_result, BaseException):
+            logger.warning(f"Subnet discovery failed: {subnet_result}")
+            subnet_result = ([], False)
+        subnet_devices, subnet_complete = subnet_result
+        partial = partial or not subnet_complete
+
+        devices = _merge_devices(mdns_result, subnet_devices)
+        now = time.monotonic()
+        for device in devices:
+            _recent_devices[device.ip] = now
+        _discovery_cache = None if partial else (now, devices)
 
     elapsed_ms = int((datetime.now() - start_time).total_seconds() * 1000)
 
     return DiscoveryResult(
         devices=devices,
         scan_duration_ms=elapsed_ms,
+        partial=partial,
     )
 
 
@@ -278,6 +320,121 @@ async def scale_reset():
     return {"success": True, "message": "Scale calibration reset command queued"}
 
 
+@router.post("/scale/deadband")
+async def scale_deadband(grams: float = Query(ge=0, le=100)):
+    """Set how far the weight must move before the device reports it.
+
+    Args:
+        grams: Weight change in grams; smaller moves are treated as scale noise
+    """
+    from main import is_display_connected, queue_display_command
+
+    if not is_display_connected():
+        raise HTTPException(status_code=400, detail="No device connected")
+
+    queue_display_command(f"state_deadband:{grams:.1f}")
+    return {"success": True, "message": f"Deadband command queued ({grams}g)"}
+
+
+def _log_filters(device: str | None, level: str | None, tag: str | None, q: str | None) -> dict:
+    try:
+        device_logs.levels_at_or_above(level)
+    except ValueError as e:
+        raise HTTPException(status_code=400, detail=str(e))
+    return {"device": device, "level": level, "tag": tag, "contains": q}
+
+
+@router.get("/logs")
+async def get_device_logs(
+    since: int | None = None,
+    limit: int = Query(200, ge=1, le=5000),
+    device: str | None = None,
+    level: str | None = None,
+    tag: str | None = None,
+    q: str | None = None,
+):
+    """Device logs received over UDP.
+
+    Without since: the newest `limit` matching lines. With since: matching
+    lines after that cursor, oldest first; pass the returned cursor to the
+    next call. "dropped" counts lines that were overwritten before being read.
+
+    Args:
+        since: Cursor from a previous response
+        limit: Maximum lines returned
+        device: Sender IP address
+        level: Minimum severity (E, W, I, D, V or ERROR, WARN, ...)
+        tag: ESP-IDF log tag
+        q: Substring the message must contain
+    """
+    store = device_logs.device_log_store
+    filters = _log_filters(device, level, tag, q)
+    if since is None:
+        entries, cursor, dropped = store.tail(limit, **filters), store.cursor, 0
+    else:
+        entries, cursor, dropped = store.since(since, limit, **filters)
+    return {
+        "entries": [entry.to_dict() for entry in entries],
+        "cursor": cursor,
+        "dropped": dropped,
+        "devices": store.devices(),
+    }
+
+
+@router.websocket("/logs/ws")
+async def device_logs_websocket(
+    websocket: WebSocket,
+    device: str | None = None,
+    level: str | None = None,
+    tag: str | None = None,
+    q: str | None = None,
+    backlog: int = 200,
+):
+    """Live device logs.
+
+    Sends {"type": "logs", "entries": [...], "cursor": N, "dropped": N}: first
+    the newest `backlog` matching lines, then new lines in batches as they
+    arrive. A client that reads slowly gets larger batches, and "dropped"
+    counts lines it missed entirely.
+    """
+    await websocket.accept()
+    store = device_logs.device_log_store
+    try:
+        filters = _log_filters(device, level, tag, q)
+    except HTTPException as e:
+        await websocket.send_json({"type": "error", "message": e.detail})
+        await websocket.close()
+        return
+
+    cursor = store.cursor
+    backlog_entries = store.tail(max(0, min(backlog, 5000)), **filters) if backlog > 0 else []
+    await websocket.send_json(
+        {"type": "logs", "entries": [e.to_dict() for e in backlog_entries], "cursor": cursor, "dropped": 0}
+    )
+
+    async def wait_closed():
+        while (await websocket.receive())["type"] != "websocket.disconnect":
+            pass
+
+    closed = asyncio.create_task(wait_closed())
+    try:
+        while True:
+            waiter = asyncio.create_task(store.wait_for_entries(cursor))
+            await asyncio.wait({waiter, closed}, return_when=asyncio.FIRST_COMPLETED)
+            if closed.done():
+                waiter.cancel()
+                break
+            entries, cursor, dropped = store.since(cursor, **filters)
+            if entries or dropped:
+                await websocket.send_json(
+                    {"type": "logs", "entries": [e.to_dict() for e in entries], "cursor": cursor, "dropped": dropped}
+                )
+    except (WebSocketDisconnect, RuntimeError):
+        pass
+    finally:
+        closed.cancel()
+
+
 class RecoveryInfo(BaseModel):
     """USB recovery information."""
 
@@ -320,14 +477,31 @@ async def _probe_device(ip: str, port: int) -> DeviceInfo | None:
         logger.warning(f"Refusing to probe non-private IP: {ip}")
         return None
 
+    device = await _fetch_device_info(ip, port)
+    if device:
+        return device
+
+    # Try simple TCP connect as fallback
+    if await _tcp_connect_time(ip, port, 1.0) is not None:
+        return DeviceInfo(
+            ip=ip,
+            last_seen=datetime.now().isoformat(),
+        )
+
+    return None
+
+
+async def _fetch_device_info(ip: str, port: int, timeout: float = 2.0) -> DeviceInfo | None:
+    """Read /api/info from a device; None if it doesn't answer like a SpoolBuddy."""
     try:
-        # Try HTTP endpoint
         import httpx
 
-        async with httpx.AsyncClient(timeout=2.0) as client:
+        async with httpx.AsyncClient(timeout=timeout) as client:
             response = await client.get(f"http://{ip}:{port}/api/info")
             if response.status_code == 200:
                 data = response.json()
+                if not isinstance(data, dict):
+                    return None
                 return DeviceInfo(
                     ip=ip,
                     hostname=data.get("hostname"),
@@ -339,22 +513,44 @@ async def _probe_device(ip: str, port: int) -> DeviceInfo | None:
                 )
     except Exception:
         pass
+    return None
 
-    # Try simple TCP connect as fallback
+
+async def _tcp_connect_time(ip: str, port: int, timeout: float) -> float | None:
+    """Seconds a TCP connect to ip:port took, or None if it failed or timed out."""
+    start = time.monotonic()
     try:
-        sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-        sock.settimeout(1.0)
-        result = sock.connect_ex((ip, port))
-        sock.close()
-        if result == 0:
-            return DeviceInfo(
-                ip=ip,
-                last_seen=datetime.now().isoformat(),
-            )
-    except Exception:
+        _, writer = await asyncio.wait_for(asyncio.open_connection(ip, port), timeout)
+    except (OSError, TimeoutError):
+        return None
+    elapsed = time.monotonic() - start
+    writer.close()
+    try:
+        await writer.wait_closed()
+    except OSError:
         pass
+    return elapsed
 
-    return None
+
+class _AdaptiveTimeout:
+    """Connect timeout that follows how fast hosts on this network answer.
+
+    Starts at PROBE_TIMEOUT_INITIAL; each answering host updates a moving
+    average of connect times and the timeout becomes a multiple of it, so dead
+    addresses on a fast LAN are given up on quickly.
+    """
+
+    def __init__(self):
+        self.average: float | None = None
+
+    def observe(self, rtt: float):
+        self.average = rtt if self.average is None else 0.8 * self.average + 0.2 * rtt
+
+    @property
+    def value(self) -> float:
+        if self.average is None:
+            return PROBE_TIMEOUT_INITIAL
+        return min(PROBE_TIMEOUT_MAX, max(PROBE_TIMEOUT_MIN, self.average * 4))
 
 
 async def _discover_mdns(timeout: float) -> list[DeviceInfo]:
@@ -400,38 +596,113 @@ async def _discover_mdns(timeout: float) -> list[DeviceInfo]:
     return devices
 
 
-async def _discover_subnet(timeout: float) -> list[DeviceInfo]:
-    """Discover devices by scanning local subnet."""
-    devices = []
-
-    # Get local IP to determine subnet
-    try:
-        s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
-        s.connect(("8.8.8.8", 80))
-        local_ip = s.getsockname()[0]
-        s.close()
-    except Exception:
-        return devices
-
-    # Scan common IP range (last octet 1-254)
-    subnet = ".".join(local_ip.split(".")[:-1])
-
-    async def check_ip(ip: str):
-        device = await _probe_device(ip, 80)
-        if device:
-            devices.append(device)
-
-    # Scan in parallel with limited concurrency
-    tasks = []
-    for i in range(1, 255):
-        ip = f"{subnet}.{i}"
-        if ip != local_ip:
-            tasks.append(check_ip(ip))
-
-    # Run with timeout
+def _local_networks() -> list[tuple[ipaddress.IPv4Address, ipaddress.IPv4Network]]:
+    """(address, network to scan) for each private IPv4 interface of this host."""
+    networks = []
+    for addrs in psutil.net_if_addrs().values():
+        for addr in addrs:
+            if addr.family != socket.AF_INET or not addr.netmask:
+                continue
+            try:
+                interface = ipaddress.IPv4Interface(f"{addr.address}/{addr.netmask}")
+            except ValueError:
+                continue
+            ip = interface.ip
+            if ip.is_loopback or ip.is_link_local or not ip.is_private:
+                continue
+            network = interface.network
+            if network.prefixlen < MAX_SCAN_PREFIX:
+                network = ipaddress.IPv4Network(f"{ip}/{MAX_SCAN_PREFIX}", strict=False)
+            networks.append((ip, network))
+    return networks
+
+
+def _arp_neighbors() -> list[str]:
+    """Addresses with a resolved entry in the kernel ARP table (Linux only)."""
     try:
-        await asyncio.wait_for(asyncio.gather(*tasks, return_exceptions=True), timeout=timeout)
-    except TimeoutError:
-        pass
+        with open("/proc/net/arp") as f:
+            lines = f.readlines()[1:]
+    except OSError:
+        return []
+    neighbors = []
+    for line in lines:
+        fields = line.split()
+        # IP address, HW type, Flags, HW address, Mask, Device; flag 0x2 = complete
+        if len(fields) >= 4 and int(fields[2], 16) & 0x2:
+            neighbors.append(fields[0])
+    return neighbors
+
+
+def _scan_candidates(networks: list[tuple[ipaddress.IPv4Address, ipaddress.IPv4Network]]) -> list[str]:
+    """Addresses to probe, most likely first: recently seen, ARP neighbors, the rest."""
+    now = time.monotonic()
+    recent = sorted(
+        (ip for ip, seen in _recent_devices.items() if now - seen < RECENT_DEVICE_TTL),
+        key=lambda ip: _recent_devices[ip],
+        reverse=True,
+    )
+    if _device_config:
+        recent.insert(0, _device_config.ip)
+
+    local = {str(ip) for ip, _ in networks}
+    in_scope = {str(host) for _, network in networks for host in network.hosts()} - local
+    ordered = dict.fromkeys(ip for ip in (*recent, *_arp_neighbors()) if ip in in_scope)
+    for _, network in networks:
+        ordered.update(dict.fromkeys(ip for ip in map(str, network.hosts()) if ip not in local))
+    return list(ordered)
+
+
+async def _discover_subnet(
+    timeout: float,
+    networks: list[tuple[ipaddress.IPv4Address, ipaddress.IPv4Network]] | None = None,
+    port: int = 80,
+) -> tuple[list[DeviceInfo], bool]:
+    """Discover devices by scanning the local subnets.
+
+    At most DISCOVERY_CONCURRENCY probes run at once. Each probe is a TCP
+    connect with an adaptive timeout, followed by an /api/info request only
+    for hosts that accept; hosts that don't answer it are not SpoolBuddy
+    devices and are left out. Whatever was found when timeout expires is
+    returned, with False as the second value if not every address was probed.
+    """
+    if networks is None:
+        networks = _local_networks()
+    candidates = [ip for ip in _scan_candidates(networks) if _is_private_ip(ip)]
+    if not candidates:
+        return [], True
 
-    return devices
+    devices: list[DeviceInfo] = []
+    timeouts = _AdaptiveTimeout()
+    pending = iter(candidates)
+
+    async def worker():
+        for ip in pending:
+            rtt = await _tcp_connect_time(ip, port, timeouts.value)
+            if rtt is None:
+                continue
+            timeouts.observe(rtt)
+            device = await _fetch_device_info(ip, port)
+            if device:
+                devices.append(device)
+
+    workers = [asyncio.create_task(worker()) for _ in range(min(DISCOVERY_CONCURRENCY, len(candidates)))]
+    _, still_running = await asyncio.wait(workers, timeout=timeout)
+    for task in still_running:
+        task.cancel()
+    await asyncio.gather(*still_running, return_exceptions=True)
+
+    return devices, not still_running
+
+
+def _merge_devices(*sources: list[DeviceInfo]) -> list[DeviceInfo]:
+    """Combine device lists by IP; earlier sources win, later ones fill in missing fields."""
+    merged: dict[str, DeviceInfo] = {}
+    for devices in sources:
+        for device in devices:
+            existing = merged.get(device.ip)
+            if existing is None:
+                merged[device.ip] = device
+            else:
+                missing = {k: v for k, v in device.model_dump().items() if getattr(existing, k) is None}
+                merged[device.ip] = existing.model_copy(update=missing)
+    return list(merged.values())
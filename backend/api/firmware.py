@@ -4,6 +4,7 @@ ESP32 Firmware OTA Update API Routes
 Handles firmware version checking and OTA binary serving for the SpoolBuddy device.
 """
 
+import asyncio
 import hashlib
 import logging
 import re
@@ -15,6 +16,7 @@ from config import GITHUB_REPO, settings
 from fastapi import APIRouter, File, Form, HTTPException, UploadFile
 from fastapi.responses import FileResponse
 from pydantic import BaseModel
+from services.firmware_delta import make_delta
 
 logger = logging.getLogger(__name__)
 router = APIRouter(prefix="/firmware", tags=["firmware"])
@@ -22,6 +24,9 @@ router = APIRouter(prefix="/firmware", tags=["firmware"])
 # Firmware releases directory
 FIRMWARE_DIR = settings.project_root / "firmware" / "releases"
 
+# Deltas larger than this fraction of the full image aren't worth keeping
+MAX_DELTA_RATIO = 0.8
+
 # Cache for GitHub firmware checks
 _firmware_cache: dict | None = None
 _firmware_cache_time: datetime | None = None
@@ -69,6 +74,51 @@ def _get_local_firmware() -> list[FirmwareVersion]:
     return firmware_files
 
 
+def _delta_path(from_version: str, to_version: str):
+    """Stored delta rebuilding to_version's image from from_version's."""
+    return FIRMWARE_DIR / "deltas" / f"spoolbuddy-{from_version}-to-{to_version}.delta"
+
+
+def _find_local_firmware(version: str) -> FirmwareVersion | None:
+    """Local firmware matching version, comparing parsed versions (0.1.1-beta.11 == 0.1.1b11)."""
+    wanted = _parse_version(version.lstrip("v"))
+    for fw in _get_local_firmware():
+        if fw.version == version or (wanted and _parse_version(fw.version) == wanted):
+            return fw
+    return None
+
+
+def _build_deltas(version: str, content: bytes) -> list[str]:
+    """Precompute deltas between a newly stored image and every other stored version.
+
+    Older versions get a delta up to this one, newer versions one from it.
+    Returns the versions that can now update to this one by delta.
+    """
+    new_parsed = _parse_version(version) or (0, 0, 0, 0, 0)
+    sources = []
+    for fw in _get_local_firmware():
+        if fw.version == version:
+            continue
+        other = (FIRMWARE_DIR / fw.filename).read_bytes()
+        if (_parse_version(fw.version) or (0, 0, 0, 0, 0)) < new_parsed:
+            from_version, to_version, source, target = fw.version, version, other, content
+        else:
+            from_version, to_version, source, target = version, fw.version, content, other
+
+        path = _delta_path(from_version, to_version)
+        delta = make_delta(source, target)
+        if len(delta) > len(target) * MAX_DELTA_RATIO:
+            path.unlink(missing_ok=True)
+            logger.info(f"Delta {from_version} -> {to_version} too large ({len(delta)} bytes), not kept")
+            continue
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_bytes(delta)
+        logger.info(f"Delta {from_version} -> {to_version}: {len(delta)} bytes ({len(target)} full)")
+        if to_version == version:
+            sources.append(from_version)
+    return sources
+
+
 def _parse_version(v: str):
     """Parse version string supporting semver and PEP 440 pre-releases.
 
@@ -299,6 +349,48 @@ async def get_ota_firmware(version: str | None = None):
     )
 
 
+@router.get("/ota/delta")
+async def get_ota_delta(from_version: str, version: str | None = None):
+    """
+    ESP32 delta OTA endpoint.
+
+    Returns a precomputed binary delta from the device's running version to the
+    latest (or requested) version. 404 when no delta exists - the device then
+    falls back to /ota for the full image.
+
+    Args:
+        from_version: Version the device is running
+        version: Optional specific target version
+    """
+    firmware_list = _get_local_firmware()
+    if not firmware_list:
+        raise HTTPException(status_code=404, detail="No firmware available")
+
+    target = _find_local_firmware(version) if version else firmware_list[0]
+    if not target:
+        raise HTTPException(status_code=404, detail=f"Version {version} not found")
+    source = _find_local_firmware(from_version)
+    if not source:
+        raise HTTPException(status_code=404, detail=f"Version {from_version} not stored, no delta available")
+    if source.version == target.version:
+        raise HTTPException(status_code=404, detail="Already on this version")
+
+    filepath = _delta_path(source.version, target.version)
+    if not filepath.exists():
+        raise HTTPException(status_code=404, detail=f"No delta from {source.version} to {target.version}")
+
+    return FileResponse(
+        filepath,
+        media_type="application/octet-stream",
+        filename=filepath.name,
+        headers={
+            "Content-Length": str(filepath.stat().st_size),
+            "X-Firmware-Version": target.version,
+            "X-Delta-From": source.version,
+        },
+    )
+
+
 # ESP32 firmware magic bytes and structure
 ESP32_IMAGE_MAGIC = 0xE9
 ESP32_APP_DESC_MAGIC = 0xABCD5432
@@ -417,6 +509,7 @@ class FirmwareUploadResponse(BaseModel):
     filename: str | None = None
     size: int | None = None
     checksum: str | None = None
+    delta_from: list[str] = []  # Versions that can update to this one by delta
 
 
 @router.post("/upload", response_model=FirmwareUploadResponse)
@@ -504,6 +597,13 @@ async def upload_firmware(
 
     logger.info(f"Uploaded firmware {firmware_version}: {filename} ({len(content)} bytes)")
 
+    # Precompute deltas to/from the other stored versions (CPU-bound)
+    delta_from = []
+    try:
+        delta_from = await asyncio.to_thread(_build_deltas, firmware_version, content)
+    except Exception as e:
+        logger.warning(f"Failed to build firmware deltas for {firmware_version}: {e}")
+
     return FirmwareUploadResponse(
         success=True,
         message=f"Firmware {firmware_version} uploaded successfully",
@@ -511,6 +611,7 @@ async def upload_firmware(
         filename=filename,
         size=len(content),
         checksum=checksum,
+        delta_from=delta_from,
     )
 
 
@@ -531,6 +632,9 @@ async def delete_firmware(version: str):
 
     try:
         filepath.unlink()
+        for delta in (FIRMWARE_DIR / "deltas").glob("*.delta"):
+            if delta.name.startswith(f"spoolbuddy-{version}-to-") or delta.name.endswith(f"-to-{version}.delta"):
+                delta.unlink()
         logger.info(f"Deleted firmware {version}")
         return {"success": True, "message": f"Firmware {version} deleted"}
     except Exception as e:
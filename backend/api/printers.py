@@ -4,8 +4,9 @@ import re
 import zipfile
 
 from db import get_db
-from fastapi import APIRouter, HTTPException
+from fastapi import APIRouter, HTTPException, Query
 from fastapi.responses import Response
+from metrics import COVER_CACHE
 from models import (
     AmsFilamentSettingRequest,
     AssignSpoolRequest,
@@ -14,6 +15,7 @@ from models import (
     PrinterUpdate,
     PrinterWithStatus,
     SetCalibrationRequest,
+    UsageDay,
 )
 from PIL import Image
 from pydantic import BaseModel
@@ -497,7 +499,7 @@ async def assign_spool_to_tray(serial: str, ams_id: int, tray_id: int, request:
         logger.info(
             f"✓ Assigned spool {spool.id} ({spool.material}) to {serial} AMS {ams_id} tray {tray_id} in inventory (STAGED)"
         )
-        
+
         # Determine message based on whether slot has wrong spool or is empty
         needs_replacement = tray_has_spool and not tray_matches_spool
         if needs_replacement:
@@ -659,7 +661,8 @@ async def get_calibrations(serial: str, nozzle_diameter: str = "0.4"):
     """Get available calibration profiles (K-profiles) for a printer.
 
     Returns list of calibration profiles with cali_idx, name, k_value, filament_id.
-    Uses async request with retry logic to reliably fetch profiles from printer.
+    Profiles are served from the K-profile store and revalidated in the background;
+    only a nozzle that was never fetched waits on the printer.
     """
     import logging
 
@@ -668,11 +671,26 @@ async def get_calibrations(serial: str, nozzle_diameter: str = "0.4"):
     if not _printer_manager:
         raise HTTPException(status_code=500, detail="Printer manager not available")
 
+    stored = None
+    if not _printer_manager.has_kprofiles(serial, nozzle_diameter):
+        db = await get_db()
+        stored = await db.get_printer_kprofiles(serial, nozzle_diameter)
+        if stored:
+            _printer_manager.seed_kprofiles(serial, nozzle_diameter, stored[0], stored[1])
+
     if not _printer_manager.is_connected(serial):
+        if _printer_manager.has_kprofiles(serial, nozzle_diameter):
+            # Cached in memory (or just seeded from the store): served without the printer
+            calibrations = await _printer_manager.get_kprofiles(serial, nozzle_diameter)
+            logger.info(f"[API] get_calibrations({serial}): offline, returning {len(calibrations)} cached K-profiles")
+            return calibrations
+        if stored:
+            logger.info(f"[API] get_calibrations({serial}): offline, returning {len(stored[0])} stored K-profiles")
+            return stored[0]
         logger.warning(f"[API] get_calibrations: printer {serial} not connected")
         raise HTTPException(status_code=400, detail="Printer not connected")
 
-    # Use async method with retry logic
+    # Cached/stored profiles return immediately; a cold nozzle uses the retrying request
     calibrations = await _printer_manager.get_kprofiles(serial, nozzle_diameter)
     logger.info(f"[API] get_calibrations({serial}): returning {len(calibrations)} K-profiles")
     return calibrations
@@ -720,8 +738,10 @@ async def get_printer_cover(serial: str, format: str = "rgb565"):
     # Check cache (include format in key)
     cache_key = (subtask_name, plate_num, format)
     if serial in _cover_cache and cache_key in _cover_cache[serial]:
+        COVER_CACHE.inc("hit")
         media_type = "image/png" if format == "png" else "application/octet-stream"
         return Response(content=_cover_cache[serial][cache_key], media_type=media_type)
+    COVER_CACHE.inc("miss")
 
     # Build 3MF filename
     filename = subtask_name
@@ -868,3 +888,18 @@ async def get_ams_history(serial: str, ams_id: int, hours: int = 24):
         max_temperature=stats.get("max_temperature"),
         avg_temperature=stats.get("avg_temperature"),
     )
+
+
+@router.get("/{serial}/usage/daily", response_model=list[UsageDay])
+async def get_printer_usage_daily(serial: str, days: int = Query(default=30, ge=1, le=3660)):
+    """Get filament used per day on a printer, for charts.
+
+    Only days with usage are listed, oldest first.
+    """
+    db = await get_db()
+
+    printer = await db.get_printer(serial)
+    if not printer:
+        raise HTTPException(status_code=404, detail="Printer not found")
+
+    return await db.get_usage_daily(printer_serial=serial, days=days)
@@ -4,7 +4,10 @@ Provides server-side serial port access that works in any browser.
 """
 
 import asyncio
+import codecs
 import logging
+import os
+import threading
 from typing import Optional
 
 from fastapi import APIRouter, HTTPException, WebSocket, WebSocketDisconnect
@@ -48,9 +51,201 @@ class SerialConfig(BaseModel):
     timeout: float = 0.1
 
 
+# Console output is coalesced into frames of up to FRAME_MAX_BYTES, sent at most
+# FRAME_INTERVAL seconds after the first byte of the frame arrived
+FRAME_MAX_BYTES = 16 * 1024
+FRAME_INTERVAL = 0.02
+
+# Output held while the browser is slow; beyond this the oldest bytes are dropped
+BUFFER_MAX_BYTES = 256 * 1024
+
+READ_CHUNK_SIZE = 4096
+
+
+class SerialSubscriber:
+    """One consumer of a SerialBridge, handing its output over in frames.
+
+    Bytes land in a bounded buffer that keeps the newest output: if the
+    consumer can't keep up, the oldest bytes are discarded and counted so the
+    client can show the gap. A slow subscriber only loses its own output.
+    """
+
+    def __init__(
+        self,
+        buffer_max: int = BUFFER_MAX_BYTES,
+        frame_max: int = FRAME_MAX_BYTES,
+        frame_interval: float = FRAME_INTERVAL,
+    ):
+        self.buffer_max = buffer_max
+        self.frame_max = frame_max
+        self.frame_interval = frame_interval
+        self.error: Exception | None = None
+        self._buffer = bytearray()
+        self._dropped = 0
+        self._ready = asyncio.Event()
+
+    def _push(self, data: bytes):
+        self._buffer += data
+        overflow = len(self._buffer) - self.buffer_max
+        if overflow > 0:
+            del self._buffer[:overflow]
+            self._dropped += overflow
+        self._ready.set()
+
+    def _fail(self, error: Exception):
+        self.error = error
+        self._ready.set()
+
+    async def next_frame(self) -> tuple[bytes, int]:
+        """Wait for output; returns (frame, bytes dropped before it).
+
+        Raises the read error once buffered output is exhausted.
+        """
+        await self._ready.wait()
+        if len(self._buffer) < self.frame_max and self.error is None:
+            # Let the rest of a burst arrive so it goes out as one frame
+            await asyncio.sleep(self.frame_interval)
+
+        frame = bytes(self._buffer[: self.frame_max])
+        del self._buffer[: self.frame_max]
+        dropped, self._dropped = self._dropped, 0
+        if not self._buffer and self.error is None:
+            self._ready.clear()
+        if not frame and self.error is not None:
+            raise self.error
+        return frame, dropped
+
+
+class SerialBridge:
+    """Reads a serial port without polling and fans its output out to subscribers.
+
+    On POSIX the port's file descriptor is registered with the event loop;
+    where that isn't possible (Windows) a reader thread blocks on port.read().
+    The event loop keeps one reader per fd, so there is one bridge per open
+    port and every WebSocket client subscribes to it.
+    """
+
+    def __init__(
+        self,
+        port,
+        buffer_max: int = BUFFER_MAX_BYTES,
+        frame_max: int = FRAME_MAX_BYTES,
+        frame_interval: float = FRAME_INTERVAL,
+    ):
+        self.port = port
+        self.buffer_max = buffer_max
+        self.frame_max = frame_max
+        self.frame_interval = frame_interval
+        self.error: Exception | None = None
+        self.subscribers: set[SerialSubscriber] = set()
+        self._loop: asyncio.AbstractEventLoop | None = None
+        self._fd: int | None = None
+        self._stopped = False
+
+    def start(self):
+        """Start reading; must be called from the event loop."""
+        self._loop = asyncio.get_running_loop()
+        try:
+            fd = self.port.fileno()
+            self._loop.add_reader(fd, self._on_readable)
+            self._fd = fd
+        except (AttributeError, OSError, NotImplementedError):
+            threading.Thread(target=self._read_thread, name="serial-reader", daemon=True).start()
+
+    def stop(self, error: Exception | None = None):
+        """Stop reading. The port itself is left open.
+
+        With an error, subscribers get it once their buffered output is read.
+        """
+        self._stopped = True
+        if self._fd is not None:
+            self._loop.remove_reader(self._fd)
+            self._fd = None
+        if error is not None and self.error is None:
+            self._fail(error)
+
+    def subscribe(self) -> SerialSubscriber:
+        subscriber = SerialSubscriber(self.buffer_max, self.frame_max, self.frame_interval)
+        if self.error is not None:
+            subscriber._fail(self.error)
+        self.subscribers.add(subscriber)
+        return subscriber
+
+    def unsubscribe(self, subscriber: SerialSubscriber):
+        self.subscribers.discard(subscriber)
+
+    def _on_readable(self):
+        try:
+            data = os.read(self._fd, READ_CHUNK_SIZE)
+        except BlockingIOError:
+            return
+        except OSError as e:
+            self._fail(e)
+            return
+        if not data:
+            self._fail(EOFError("Serial port closed"))
+            return
+        self._push(data)
+
+    def _read_thread(self):
+        while not self._stopped:
+            try:
+                # Blocks for up to the port's read timeout
+                data = self.port.read(max(1, self.port.in_waiting))
+            except Exception as e:
+                if not self._stopped:
+                    self._loop.call_soon_threadsafe(self._fail, e)
+                return
+            if data and not self._stopped:
+                self._loop.call_soon_threadsafe(self._push, data)
+
+    def _push(self, data: bytes):
+        for subscriber in self.subscribers:
+            subscriber._push(data)
+
+    def _fail(self, error: Exception):
+        self.stop()
+        self.error = error
+        for subscriber in self.subscribers:
+            subscriber._fail(error)
+
+
 # Global state
 _active_port: Optional["serial.Serial"] = None
 _active_config: SerialConfig | None = None
+_active_bridge: SerialBridge | None = None
+
+
+def _subscribe() -> SerialSubscriber:
+    """Subscribe to the active port, starting its bridge for the first client."""
+    global _active_bridge
+
+    if _active_bridge is None or _active_bridge.error is not None:
+        _active_bridge = SerialBridge(_active_port)
+        _active_bridge.start()
+    return _active_bridge.subscribe()
+
+
+def _unsubscribe(subscriber: SerialSubscriber):
+    """Drop a client; the bridge stops reading when the last one is gone."""
+    global _active_bridge
+
+    bridge = _active_bridge
+    if bridge is None or subscriber not in bridge.subscribers:
+        return
+    bridge.unsubscribe(subscriber)
+    if not bridge.subscribers:
+        bridge.stop()
+        _active_bridge = None
+
+
+def _stop_bridge():
+    """Stop reading the active port before it is closed."""
+    global _active_bridge
+
+    if _active_bridge is not None:
+        _active_bridge.stop(EOFError("Serial port disconnected"))
+        _active_bridge = None
 
 
 @router.get("/ports", response_model=list[SerialPortInfo])
@@ -104,6 +299,7 @@ async def connect_serial(config: SerialConfig):
         raise HTTPException(status_code=501, detail="pyserial not installed on server")
 
     # Close existing connection
+    _stop_bridge()
     if _active_port and _active_port.is_open:
         _active_port.close()
 
@@ -135,6 +331,7 @@ async def disconnect_serial():
     """Disconnect from serial port."""
     global _active_port, _active_config
 
+    _stop_bridge()
     if _active_port and _active_port.is_open:
         _active_port.close()
         logger.info("Disconnected from serial port")
@@ -162,7 +359,8 @@ async def serial_websocket(websocket: WebSocket):
     """WebSocket endpoint for real-time serial communication.
 
     Messages from client: {"type": "send", "data": "command"}
-    Messages to client: {"type": "data", "data": "output"} or {"type": "error", "message": "..."}
+    Messages to client: {"type": "data", "data": "output", "dropped": N} or {"type": "error", "message": "..."}
+    ("dropped" only appears when output was discarded because the client fell behind)
     """
     await websocket.accept()
 
@@ -179,7 +377,8 @@ async def serial_websocket(websocket: WebSocket):
         return
 
     # Start read task
-    read_task = asyncio.create_task(read_serial_loop(websocket))
+    subscriber = _subscribe()
+    read_task = asyncio.create_task(forward_serial_output(subscriber, websocket))
 
     try:
         while True:
@@ -197,6 +396,7 @@ async def serial_websocket(websocket: WebSocket):
     except Exception as e:
         logger.error(f"Serial WebSocket error: {e}")
     finally:
+        _unsubscribe(subscriber)
         read_task.cancel()
         try:
             await read_task
@@ -204,21 +404,28 @@ async def serial_websocket(websocket: WebSocket):
             pass
 
 
-async def read_serial_loop(websocket: WebSocket):
-    """Background task to read from serial and send to WebSocket."""
-    while True:
-        try:
-            if _active_port and _active_port.is_open and _active_port.in_waiting:
-                data = _active_port.read(_active_port.in_waiting)
-                if data:
-                    try:
-                        text = data.decode("utf-8", errors="replace")
-                        await websocket.send_json({"type": "data", "data": text})
-                    except Exception:
-                        pass
-            await asyncio.sleep(0.05)  # 50ms polling
-        except asyncio.CancelledError:
-            break
-        except Exception as e:
-            logger.error(f"Serial read error: {e}")
-            await asyncio.sleep(0.5)
+async def forward_serial_output(subscriber: SerialSubscriber, websocket: WebSocket):
+    """Background task sending serial output frames to the WebSocket.
+
+    Each send waits for the client, which is the backpressure: output that
+    arrives meanwhile collects in the subscriber, and what overflows it is
+    reported as "dropped" on the next data message.
+    """
+    # Incremental so multi-byte characters split across frames decode intact
+    decoder = codecs.getincrementaldecoder("utf-8")(errors="replace")
+    try:
+        while True:
+            try:
+                data, dropped = await subscriber.next_frame()
+            except Exception as e:
+                logger.error(f"Serial read error: {e}")
+                await websocket.send_json({"type": "error", "message": f"Serial read error: {e}"})
+                return
+
+            message = {"type": "data", "data": decoder.decode(data)}
+            if dropped:
+                message["dropped"] = dropped
+            await websocket.send_json(message)
+    except (WebSocketDisconnect, RuntimeError):
+        # Client went away mid-send; the receive side handles cleanup
+        pass
@@ -1,6 +1,15 @@
 from db import get_db
-from fastapi import APIRouter, HTTPException, Query
-from models import Spool, SpoolCreate, SpoolUpdate
+from fastapi import APIRouter, HTTPException, Query, Request, Response
+from models import (
+    Spool,
+    SpoolBatchCreate,
+    SpoolBatchResult,
+    SpoolChanges,
+    SpoolCreate,
+    SpoolUpdate,
+    UsageDay,
+    UsageTotals,
+)
 from pydantic import BaseModel
 
 
@@ -48,11 +57,39 @@ class LinkTagRequest(BaseModel):
 router = APIRouter(prefix="/spools", tags=["spools"])
 
 
-@router.get("", response_model=list[Spool])
-async def list_spools():
-    """Get all spools."""
+@router.get("", response_model=list[Spool] | SpoolChanges)
+async def list_spools(
+    request: Request,
+    response: Response,
+    since: int | None = Query(default=None, ge=0, description="Only return changes after this revision"),
+):
+    """Get all spools, or only what changed since a revision.
+
+    The ETag is the spool list revision; send it back as If-None-Match to
+    get 304 Not Modified while nothing changed.
+
+    With ?since=<revision> (from a previous ETag or SpoolChanges.revision)
+    the response is a SpoolChanges object instead of a list: spools created
+    or changed after that revision, plus ids of deleted spools. If since is
+    newer than the current revision (e.g. the database was replaced) or older
+    than the kept deletion history, the full list is returned with full=true.
+    """
     db = await get_db()
-    return await db.get_spools()
+    revision = await db.get_spool_revision()
+    etag = f'"{revision}"'
+    if request.headers.get("if-none-match") == etag:
+        return Response(status_code=304, headers={"ETag": etag})
+
+    response.headers["ETag"] = etag
+    response.headers["Cache-Control"] = "no-cache"
+
+    if since is None:
+        return await db.get_spools()
+    if since > revision or since < await db.get_spool_tombstone_horizon():
+        return SpoolChanges(revision=revision, full=True, spools=await db.get_spools())
+
+    spools, deleted = await db.get_spool_changes(since)
+    return SpoolChanges(revision=revision, spools=spools, deleted=deleted)
 
 
 @router.get("/untagged", response_model=list[Spool])
@@ -66,6 +103,21 @@ async def list_untagged_spools():
     return await db.get_untagged_spools()
 
 
+@router.get("/known-tags", response_model=list[str])
+async def list_known_tags(tag_ids: str = Query(description="Comma separated tag ids")):
+    """Which of the given tag ids already belong to a spool (archived included).
+
+    Lets the display check every tag of an NFC inventory round in one request
+    instead of downloading the spool list per tag. Answers in request order.
+    """
+    requested = [t for t in tag_ids.split(",") if t]
+    if len(requested) > 100:
+        raise HTTPException(status_code=400, detail="At most 100 tag ids per request")
+    db = await get_db()
+    known = await db.get_known_tag_ids(requested)
+    return [t for t in dict.fromkeys(requested) if t in known]
+
+
 @router.get("/{spool_id}", response_model=Spool)
 async def get_spool(spool_id: str):
     """Get a single spool."""
@@ -83,6 +135,21 @@ async def create_spool(spool: SpoolCreate):
     return await db.create_spool(spool)
 
 
+@router.post("/batch", response_model=SpoolBatchResult, status_code=201)
+async def create_spools_batch(batch: SpoolBatchCreate):
+    """Create several spools at once (bulk NFC registration from the display).
+
+    All spools are inserted in one transaction. A spool whose tag_id already
+    belongs to a spool (archived included), or repeats one earlier in the
+    batch, is skipped and listed in `skipped` instead of failing the whole
+    batch. Only the ids of the created spools are returned, so the display
+    does not have to buffer full spool objects to count them.
+    """
+    db = await get_db()
+    created, skipped = await db.create_spools(batch.spools)
+    return SpoolBatchResult(created=created, skipped=skipped)
+
+
 @router.put("/{spool_id}", response_model=Spool)
 async def update_spool(spool_id: str, spool: SpoolUpdate):
     """Update an existing spool."""
@@ -195,11 +262,53 @@ async def log_manual_usage(spool_id: str, request: LogUsageRequest):
     return updated
 
 
+def _parse_history_cursor(cursor: str | None) -> tuple[int, int] | None:
+    """Parse an X-Next-Cursor value ("<timestamp>:<id>")."""
+    if cursor is None:
+        return None
+    try:
+        timestamp, usage_id = cursor.split(":")
+        return int(timestamp), int(usage_id)
+    except ValueError:
+        raise HTTPException(status_code=400, detail="Invalid cursor") from None
+
+
+def _set_history_cursor(response: Response, rows: list[dict], limit: int):
+    """Point X-Next-Cursor at the next page if this one was full."""
+    if len(rows) == limit:
+        last = rows[-1]
+        response.headers["X-Next-Cursor"] = f"{last['timestamp']}:{last['id']}"
+
+
+@router.get("/usage/history")
+async def get_all_usage_history(
+    response: Response,
+    limit: int = Query(default=100, le=500),
+    cursor: str | None = Query(default=None, description="X-Next-Cursor of the previous page"),
+):
+    """Get global usage history across all spools.
+
+    Returns recent print jobs with spool info and weight consumed, newest
+    first. If there may be more, the X-Next-Cursor header holds the cursor
+    for the next page.
+    """
+    db = await get_db()
+    rows = await db.get_usage_history(limit=limit, before=_parse_history_cursor(cursor))
+    _set_history_cursor(response, rows, limit)
+    return rows
+
+
 @router.get("/{spool_id}/history")
-async def get_spool_usage_history(spool_id: str, limit: int = Query(default=50, le=500)):
+async def get_spool_usage_history(
+    spool_id: str,
+    response: Response,
+    limit: int = Query(default=50, le=500),
+    cursor: str | None = Query(default=None, description="X-Next-Cursor of the previous page"),
+):
     """Get usage history for a specific spool.
 
-    Returns recent print jobs that used this spool with weight consumed.
+    Returns recent print jobs that used this spool with weight consumed,
+    paged like /usage/history.
     """
     db = await get_db()
 
@@ -207,17 +316,36 @@ async def get_spool_usage_history(spool_id: str, limit: int = Query(default=50,
     if not spool:
         raise HTTPException(status_code=404, detail="Spool not found")
 
-    return await db.get_usage_history(spool_id=spool_id, limit=limit)
+    rows = await db.get_usage_history(spool_id=spool_id, limit=limit, before=_parse_history_cursor(cursor))
+    _set_history_cursor(response, rows, limit)
+    return rows
 
 
-@router.get("/usage/history")
-async def get_all_usage_history(limit: int = Query(default=100, le=500)):
-    """Get global usage history across all spools.
+@router.get("/{spool_id}/usage/daily", response_model=list[UsageDay])
+async def get_spool_usage_daily(spool_id: str, days: int = Query(default=30, ge=1, le=3660)):
+    """Get filament used per day for a spool, for charts.
 
-    Returns recent print jobs with spool info and weight consumed.
+    Only days with usage are listed, oldest first.
     """
     db = await get_db()
-    return await db.get_usage_history(limit=limit)
+
+    spool = await db.get_spool(spool_id)
+    if not spool:
+        raise HTTPException(status_code=404, detail="Spool not found")
+
+    return await db.get_usage_daily(spool_id=spool_id, days=days)
+
+
+@router.get("/{spool_id}/usage/totals", response_model=UsageTotals)
+async def get_spool_usage_totals(spool_id: str):
+    """Get all-time print count and filament used for a spool."""
+    db = await get_db()
+
+    spool = await db.get_spool(spool_id)
+    if not spool:
+        raise HTTPException(status_code=404, detail="Spool not found")
+
+    return await db.get_usage_totals(spool_id)
 
 
 @router.get("/{spool_id}/k-profiles")
@@ -8,12 +8,17 @@ Provides endpoints for:
 - System information
 """
 
+import asyncio
 import io
+import json
 import logging
+import os
 import platform
 import re
 import time
 import zipfile
+from collections.abc import AsyncIterator
+from contextlib import aclosing
 from datetime import datetime
 from pathlib import Path
 
@@ -33,6 +38,11 @@ _start_time = time.time()
 # Log file path
 LOG_FILE = Path("spoolbuddy.log")
 
+# Support bundle: only the newest part of the log is included, read and
+# compressed in chunks of about BUNDLE_CHUNK_SIZE
+BUNDLE_LOG_MAX_BYTES = 10 * 1024 * 1024
+BUNDLE_CHUNK_SIZE = 256 * 1024
+
 
 # ============ Models ============
 
@@ -274,24 +284,31 @@ def _read_log_entries(
     return entries[:limit], total_count, filtered_count
 
 
-def _sanitize_log_content(content: str) -> str:
-    """Sanitize sensitive data from log content."""
+# (pattern, replacement) pairs for redacting sensitive data from logs
+_SANITIZE_PATTERNS = [
     # IP addresses (IPv4)
-    content = re.sub(r"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b", "[IP]", content)
+    (re.compile(r"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b"), "[IP]"),
     # Email addresses
-    content = re.sub(r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b", "[EMAIL]", content)
+    (re.compile(r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b"), "[EMAIL]"),
     # Access codes (8 digit codes commonly used by Bambu printers)
-    content = re.sub(r"\b\d{8}\b", "[CODE]", content)
+    (re.compile(r"\b\d{8}\b"), "[CODE]"),
     # Serial numbers (15+ character alphanumeric, common for printers)
-    content = re.sub(r"\b[A-Z0-9]{15,}\b", "[SERIAL]", content)
+    (re.compile(r"\b[A-Z0-9]{15,}\b"), "[SERIAL]"),
     # Long hex strings that might be tokens (32+ chars)
-    content = re.sub(r"\b[a-fA-F0-9]{32,}\b", "[TOKEN]", content)
+    (re.compile(r"\b[a-fA-F0-9]{32,}\b"), "[TOKEN]"),
     # Paths with usernames
-    content = re.sub(r"/home/[^/\s]+/", "/home/[user]/", content)
-    content = re.sub(r"/Users/[^/\s]+/", "/Users/[user]/", content)
-    content = re.sub(r"/opt/[^/\s]+/", "/opt/[user]/", content)
+    (re.compile(r"/home/[^/\s]+/"), "/home/[user]/"),
+    (re.compile(r"/Users/[^/\s]+/"), "/Users/[user]/"),
+    (re.compile(r"/opt/[^/\s]+/"), "/opt/[user]/"),
     # Windows paths with usernames
-    content = re.sub(r"C:\\Users\\[^\\]+\\", "C:\\Users\\[user]\\", content)
+    (re.compile(r"C:\\Users\\[^\\]+\\"), r"C:\\Users\\[user]\\"),
+]
+
+
+def _sanitize_log_content(content: str) -> str:
+    """Sanitize sensitive data from log content."""
+    for pattern, replacement in _SANITIZE_PATTERNS:
+        content = pattern.sub(replacement, content)
     return content
 
 
@@ -334,6 +351,100 @@ async def _collect_support_info() -> dict:
     }
 
 
+class _ZipSink(io.RawIOBase):
+    """Unseekable ZipFile target that hands compressed output over for streaming.
+
+    ZipFile detects that it can't seek and writes data descriptors after each
+    entry instead of patching local headers, so nothing is buffered beyond
+    the chunk in flight.
+    """
+
+    def __init__(self):
+        self._chunks: list[bytes] = []
+
+    def writable(self) -> bool:
+        return True
+
+    def write(self, data) -> int:
+        self._chunks.append(bytes(data))
+        return len(data)
+
+    def drain(self) -> bytes:
+        data = b"".join(self._chunks)
+        self._chunks.clear()
+        return data
+
+
+def _seek_log_tail(f, max_bytes: int) -> int:
+    """Position f at the first whole line of its last max_bytes; returns the current size."""
+    size = os.fstat(f.fileno()).st_size
+    if size > max_bytes:
+        f.seek(size - max_bytes)
+        f.readline()  # Skip partial line
+    return size
+
+
+def _read_lines(f, size: int, end: int) -> bytes:
+    """Read about size bytes up to a line boundary, stopping at end."""
+    remaining = end - f.tell()
+    if remaining <= 0:
+        return b""
+    data = f.read(min(size, remaining))
+    if data and not data.endswith(b"\n") and f.tell() < end:
+        data += f.readline(end - f.tell())
+    return data
+
+
+async def _read_log_chunks(path: Path, max_bytes: int) -> AsyncIterator[str]:
+    """Yield the tail of a log file as line-aligned text chunks, reading off the event loop.
+
+    Stops at the size the file had when opened - the log grows while the bundle streams.
+    """
+    f = await asyncio.to_thread(path.open, "rb")
+    try:
+        end = await asyncio.to_thread(_seek_log_tail, f, max_bytes)
+        while chunk := await asyncio.to_thread(_read_lines, f, BUNDLE_CHUNK_SIZE, end):
+            yield chunk.decode("utf-8", errors="replace")
+    finally:
+        f.close()
+
+
+def _write_sanitized(entry, text: str):
+    entry.write(_sanitize_log_content(text).encode("utf-8"))
+
+
+async def _stream_support_bundle(support_info: dict) -> AsyncIterator[bytes]:
+    """Generate the support bundle ZIP incrementally.
+
+    Logs are read, sanitized and compressed a chunk at a time in worker
+    threads, so memory use and event-loop stalls don't grow with log size.
+    """
+    sink = _ZipSink()
+    zf = zipfile.ZipFile(sink, "w", zipfile.ZIP_DEFLATED)
+
+    # Add support info JSON
+    zf.writestr("support-info.json", json.dumps(support_info, indent=2))
+    yield sink.drain()
+
+    # Add sanitized logs (newest BUNDLE_LOG_MAX_BYTES)
+    if LOG_FILE.exists():
+        error = None
+        try:
+            async with aclosing(_read_log_chunks(LOG_FILE, BUNDLE_LOG_MAX_BYTES)) as chunks:
+                with zf.open("spoolbuddy.log", "w") as entry:
+                    async for text in chunks:
+                        await asyncio.to_thread(_write_sanitized, entry, text)
+                        if data := sink.drain():
+                            yield data
+        except Exception as e:
+            error = e
+        if error is not None:
+            zf.writestr("log_error.txt", f"Failed to read logs: {error}")
+
+    zf.close()
+    yield sink.drain()
+
+
 def init_debug_logging():
     """Initialize debug logging state on startup."""
     enabled, _ = _get_debug_setting()
@@ -437,39 +548,12 @@ async def download_support_bundle():
     # Collect support info
     support_info = await _collect_support_info()
 
-    # Create ZIP in memory
-    buffer = io.BytesIO()
-    with zipfile.ZipFile(buffer, "w", zipfile.ZIP_DEFLATED) as zf:
-        # Add support info JSON
-        import json
-
-        zf.writestr("support-info.json", json.dumps(support_info, indent=2))
-
-        # Add sanitized logs (last 10MB max)
-        if LOG_FILE.exists():
-            try:
-                file_size = LOG_FILE.stat().st_size
-                max_size = 10 * 1024 * 1024  # 10MB
-
-                with open(LOG_FILE, encoding="utf-8", errors="replace") as f:
-                    if file_size > max_size:
-                        f.seek(file_size - max_size)
-                        f.readline()  # Skip partial line
-                    log_content = f.read()
-
-                sanitized_logs = _sanitize_log_content(log_content)
-                zf.writestr("spoolbuddy.log", sanitized_logs)
-            except Exception as e:
-                zf.writestr("log_error.txt", f"Failed to read logs: {e}")
-
-    buffer.seek(0)
-
     # Generate filename with timestamp
     timestamp = datetime.now().strftime("%Y%m%d-%H%M%S")
     filename = f"spoolbuddy-support-{timestamp}.zip"
 
     return StreamingResponse(
-        buffer,
+        _stream_support_bundle(support_info),
         media_type="application/zip",
         headers={"Content-Disposition": f'attachment; filename="{filename}"'},
     )
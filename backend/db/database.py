@@ -1,9 +1,12 @@
+import json
+import re
 import time
 import uuid
 from pathlib import Path
 
 import aiosqlite
 from config import settings
+from metrics import DB_QUERY_SECONDS
 from models import Printer, PrinterCreate, PrinterUpdate, Spool, SpoolCreate, SpoolUpdate
 
 SCHEMA = """
@@ -36,7 +39,8 @@ CREATE TABLE IF NOT EXISTS spools (
     ext_has_k INTEGER DEFAULT 0,
     archived_at INTEGER,
     created_at INTEGER DEFAULT (strftime('%s', 'now')),
-    updated_at INTEGER DEFAULT (strftime('%s', 'now'))
+    updated_at INTEGER DEFAULT (strftime('%s', 'now')),
+    revision INTEGER NOT NULL DEFAULT 0
 );
 
 -- Printers table
@@ -67,6 +71,15 @@ CREATE TABLE IF NOT EXISTS k_profiles (
     created_at INTEGER DEFAULT (strftime('%s', 'now'))
 );
 
+-- Printer K-profile store (last extrusion_cali_get result per printer and nozzle)
+CREATE TABLE IF NOT EXISTS printer_kprofiles (
+    printer_serial TEXT NOT NULL REFERENCES printers(serial) ON DELETE CASCADE,
+    nozzle_diameter TEXT NOT NULL,
+    profiles TEXT NOT NULL,
+    fetched_at INTEGER NOT NULL,
+    PRIMARY KEY (printer_serial, nozzle_diameter)
+);
+
 -- Usage history table
 CREATE TABLE IF NOT EXISTS usage_history (
     id INTEGER PRIMARY KEY AUTOINCREMENT,
@@ -143,11 +156,24 @@ CREATE TABLE IF NOT EXISTS api_keys (
     created_at INTEGER DEFAULT (strftime('%s', 'now'))
 );
 
+-- Change counters (spool list revision for conditional/incremental fetches)
+CREATE TABLE IF NOT EXISTS revisions (
+    name TEXT PRIMARY KEY,
+    value INTEGER NOT NULL
+);
+
+-- Deleted spools, so incremental fetches can report removals
+CREATE TABLE IF NOT EXISTS spool_tombstones (
+    spool_id TEXT PRIMARY KEY,
+    revision INTEGER NOT NULL
+);
+
 -- Indexes
 CREATE INDEX IF NOT EXISTS idx_spools_tag_id ON spools(tag_id);
 CREATE INDEX IF NOT EXISTS idx_spools_material ON spools(material);
 CREATE INDEX IF NOT EXISTS idx_k_profiles_spool ON k_profiles(spool_id);
-CREATE INDEX IF NOT EXISTS idx_usage_history_spool ON usage_history(spool_id);
+CREATE INDEX IF NOT EXISTS idx_usage_history_spool_time ON usage_history(spool_id, timestamp, id);
+CREATE INDEX IF NOT EXISTS idx_usage_history_time ON usage_history(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_spool_assignments_slot ON spool_assignments(printer_serial, ams_id, tray_id);
 CREATE INDEX IF NOT EXISTS idx_ams_sensor_history_lookup ON ams_sensor_history(printer_serial, ams_id, recorded_at);
 """
@@ -396,16 +422,195 @@ DEFAULT_COLOR_CATALOG = [
 ]
 
 
+# Spool revision tracking, applied after migrations (needs spools.revision).
+# Every insert, update or delete of a spool - and every usage record, which
+# changes last_used_time - takes the next value of the "spools" counter, so
+# clients can ask for everything changed after the revision they last saw.
+# The "spool_tombstones" counter is the revision up to which tombstones have
+# been pruned; changes since an older revision can no longer be listed.
+SPOOL_REVISION_SCHEMA = """
+INSERT OR IGNORE INTO revisions (name, value) VALUES ('spools', (SELECT COALESCE(MAX(revision), 0) FROM spools));
+INSERT OR IGNORE INTO revisions (name, value) VALUES ('spool_tombstones', 0);
+
+CREATE INDEX IF NOT EXISTS idx_spools_revision ON spools(revision);
+CREATE INDEX IF NOT EXISTS idx_spool_tombstones_revision ON spool_tombstones(revision);
+
+CREATE TRIGGER IF NOT EXISTS trg_spools_revision_insert AFTER INSERT ON spools
+BEGIN
+    UPDATE revisions SET value = value + 1 WHERE name = 'spools';
+    UPDATE spools SET revision = (SELECT value FROM revisions WHERE name = 'spools') WHERE id = NEW.id;
+    DELETE FROM spool_tombstones WHERE spool_id = NEW.id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_spools_revision_update AFTER UPDATE ON spools
+WHEN NEW.revision = OLD.revision
+BEGIN
+    UPDATE revisions SET value = value + 1 WHERE name = 'spools';
+    UPDATE spools SET revision = (SELECT value FROM revisions WHERE name = 'spools') WHERE id = NEW.id;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_spools_revision_delete AFTER DELETE ON spools
+BEGIN
+    UPDATE revisions SET value = value + 1 WHERE name = 'spools';
+    INSERT OR REPLACE INTO spool_tombstones (spool_id, revision)
+        VALUES (OLD.id, (SELECT value FROM revisions WHERE name = 'spools'));
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_usage_history_spool_revision AFTER INSERT ON usage_history
+BEGIN
+    UPDATE spools SET revision = revision WHERE id = NEW.spool_id;
+END;
+"""
+
+# Tombstones are kept for this many spool revisions
+SPOOL_TOMBSTONE_RETENTION = 1000
+
+
+# Daily usage per spool and per printer (day = UTC days since epoch), kept
+# by triggers in the same transaction as the usage_history row, so totals
+# and charts never scan the raw history. Rows without a spool/printer are
+# counted under ''.
+USAGE_AGGREGATE_SCHEMA = """
+CREATE TABLE IF NOT EXISTS usage_daily_spool (
+    spool_id TEXT NOT NULL,
+    day INTEGER NOT NULL,
+    prints INTEGER NOT NULL DEFAULT 0,
+    weight_used REAL NOT NULL DEFAULT 0,
+    PRIMARY KEY (spool_id, day)
+) WITHOUT ROWID;
+
+CREATE TABLE IF NOT EXISTS usage_daily_printer (
+    printer_serial TEXT NOT NULL,
+    day INTEGER NOT NULL,
+    prints INTEGER NOT NULL DEFAULT 0,
+    weight_used REAL NOT NULL DEFAULT 0,
+    PRIMARY KEY (printer_serial, day)
+) WITHOUT ROWID;
+
+CREATE TRIGGER IF NOT EXISTS trg_usage_history_aggregate_insert AFTER INSERT ON usage_history
+BEGIN
+    INSERT INTO usage_daily_spool (spool_id, day, prints, weight_used)
+        VALUES (COALESCE(NEW.spool_id, ''), NEW.timestamp / 86400, 1, COALESCE(NEW.weight_used, 0))
+        ON CONFLICT (spool_id, day) DO UPDATE
+        SET prints = prints + 1, weight_used = weight_used + excluded.weight_used;
+    INSERT INTO usage_daily_printer (printer_serial, day, prints, weight_used)
+        VALUES (COALESCE(NEW.printer_serial, ''), NEW.timestamp / 86400, 1, COALESCE(NEW.weight_used, 0))
+        ON CONFLICT (printer_serial, day) DO UPDATE
+        SET prints = prints + 1, weight_used = weight_used + excluded.weight_used;
+END;
+
+CREATE TRIGGER IF NOT EXISTS trg_usage_history_aggregate_delete AFTER DELETE ON usage_history
+BEGIN
+    UPDATE usage_daily_spool SET prints = prints - 1, weight_used = weight_used - COALESCE(OLD.weight_used, 0)
+        WHERE spool_id = COALESCE(OLD.spool_id, '') AND day = OLD.timestamp / 86400;
+    DELETE FROM usage_daily_spool
+        WHERE spool_id = COALESCE(OLD.spool_id, '') AND day = OLD.timestamp / 86400 AND prints <= 0;
+    UPDATE usage_daily_printer SET prints = prints - 1, weight_used = weight_used - COALESCE(OLD.weight_used, 0)
+        WHERE printer_serial = COALESCE(OLD.printer_serial, '') AND day = OLD.timestamp / 86400;
+    DELETE FROM usage_daily_printer
+        WHERE printer_serial = COALESCE(OLD.printer_serial, '') AND day = OLD.timestamp / 86400 AND prints <= 0;
+END;
+"""
+
+USAGE_AGGREGATE_BACKFILL = """
+INSERT INTO usage_daily_spool (spool_id, day, prints, weight_used)
+    SELECT COALESCE(spool_id, ''), timestamp / 86400, COUNT(*), COALESCE(SUM(weight_used), 0)
+    FROM usage_history GROUP BY 1, 2;
+INSERT INTO usage_daily_printer (printer_serial, day, prints, weight_used)
+    SELECT COALESCE(printer_serial, ''), timestamp / 86400, COUNT(*), COALESCE(SUM(weight_used), 0)
+    FROM usage_history GROUP BY 1, 2;
+"""
+
+
+_STATEMENT_TABLE = re.compile(
+    r"^\s*(?:(SELECT|DELETE)\b.*?\bFROM|(INSERT|REPLACE)\b.*?\bINTO|(UPDATE))\s+(\w+)",
+    re.IGNORECASE | re.DOTALL,
+)
+_PARENTHESIZED = re.compile(r"\([^()]*\)")
+_statement_labels: dict[str, str] = {}
+
+
+def statement_label(sql: str) -> str:
+    """Metric label for a SQL statement: "SELECT spools", "INSERT usage_history", ...
+
+    Subqueries are ignored, so the label names the outer statement's table.
+    Statements are string constants, so labels are memoized by SQL text.
+    """
+    label = _statement_labels.get(sql)
+    if label is None:
+        outer, nested = sql, 1
+        while nested:
+            outer, nested = _PARENTHESIZED.subn(" ", outer)
+        match = _STATEMENT_TABLE.match(outer)
+        if match:
+            verb = match.group(1) or match.group(2) or match.group(3)
+            label = f"{verb.upper()} {match.group(4)}"
+        else:
+            label = sql.split(None, 1)[0].upper() if sql.strip() else "EMPTY"
+        if len(_statement_labels) < 1024:
+            _statement_labels[sql] = label
+    return label
+
+
+class _TimedQuery:
+    """Wraps aiosqlite's execute() result, timing the statement; supports await and async with."""
+
+    __slots__ = ("_query", "_label")
+
+    def __init__(self, query, label: str):
+        self._query = query
+        self._label = label
+
+    def __await__(self):
+        start = time.perf_counter()
+        try:
+            return (yield from self._query.__await__())
+        finally:
+            DB_QUERY_SECONDS.observe(time.perf_counter() - start, self._label)
+
+    async def __aenter__(self):
+        start = time.perf_counter()
+        try:
+            return await self._query.__aenter__()
+        finally:
+            DB_QUERY_SECONDS.observe(time.perf_counter() - start, self._label)
+
+    async def __aexit__(self, *exc):
+        return await self._query.__aexit__(*exc)
+
+
+class _TimedConnection:
+    """aiosqlite connection proxy recording statement latency in DB_QUERY_SECONDS."""
+
+    def __init__(self, connection: aiosqlite.Connection):
+        self._connection = connection
+
+    def execute(self, sql: str, parameters=None):
+        return _TimedQuery(self._connection.execute(sql, parameters), statement_label(sql))
+
+    def executemany(self, sql: str, parameters):
+        return _TimedQuery(self._connection.executemany(sql, parameters), statement_label(sql))
+
+    def __getattr__(self, name):
+        return getattr(self._connection, name)
+
+    def __setattr__(self, name, value):
+        if name == "_connection":
+            object.__setattr__(self, name, value)
+        else:
+            setattr(self._connection, name, value)
+
+
 class Database:
     """Async SQLite database wrapper."""
 
     def __init__(self, db_path: Path):
         self.db_path = db_path
-        self._connection: aiosqlite.Connection | None = None
+        self._connection: _TimedConnection | None = None
 
     async def connect(self):
         """Connect to database and run migrations."""
-        self._connection = await aiosqlite.connect(self.db_path)
+        self._connection = _TimedConnection(await aiosqlite.connect(self.db_path))
         self._connection.row_factory = aiosqlite.Row
         await self._connection.executescript(SCHEMA)
         await self._connection.commit()
@@ -459,6 +664,30 @@ class Database:
             await self.conn.execute("ALTER TABLE spools ADD COLUMN archived_at INTEGER")
             await self.conn.commit()
 
+        if "revision" not in columns:
+            await self.conn.execute("ALTER TABLE spools ADD COLUMN revision INTEGER NOT NULL DEFAULT 0")
+            # Existing spools all count as changed at revision 1
+            await self.conn.execute("UPDATE spools SET revision = 1")
+            await self.conn.commit()
+
+        await self.conn.executescript(SPOOL_REVISION_SCHEMA)
+        await self.conn.commit()
+
+        # Usage aggregates: build from the existing history on first start
+        async with self.conn.execute(
+            "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'usage_daily_spool'"
+        ) as cursor:
+            has_aggregates = await cursor.fetchone() is not None
+        if has_aggregates:
+            await self.conn.executescript(USAGE_AGGREGATE_SCHEMA)
+        else:
+            # One transaction: tables without the backfill would be taken as
+            # already built on the next start
+            await self.conn.executescript(f"BEGIN;\n{USAGE_AGGREGATE_SCHEMA}\n{USAGE_AGGREGATE_BACKFILL}\nCOMMIT;")
+        # Replaced by idx_usage_history_spool_time
+        await self.conn.execute("DROP INDEX IF EXISTS idx_usage_history_spool")
+        await self.conn.commit()
+
         # Check printers table for nozzle_count
         async with self.conn.execute("PRAGMA table_info(printers)") as cursor:
             printer_columns = [row["name"] for row in await cursor.fetchall()]
@@ -494,54 +723,138 @@ class Database:
             rows = await cursor.fetchall()
             return [Spool(**dict(row)) for row in rows]
 
+    async def get_spool_revision(self) -> int:
+        """Current spool list revision (bumped by every spool change)."""
+        async with self.conn.execute("SELECT value FROM revisions WHERE name = 'spools'") as cursor:
+            row = await cursor.fetchone()
+            return row[0] if row else 0
+
+    async def get_spool_changes(self, since: int) -> tuple[list[Spool], list[str]]:
+        """Spools changed and spool ids deleted after revision `since`."""
+        query = """
+            SELECT s.*, (
+                SELECT MAX(uh.timestamp) FROM usage_history uh WHERE uh.spool_id = s.id
+            ) as last_used_time
+            FROM spools s
+            WHERE s.revision > ?
+            ORDER BY s.revision
+        """
+        async with self.conn.execute(query, (since,)) as cursor:
+            spools = [Spool(**dict(row)) for row in await cursor.fetchall()]
+        async with self.conn.execute(
+            "SELECT spool_id FROM spool_tombstones WHERE revision > ? ORDER BY revision", (since,)
+        ) as cursor:
+            deleted = [row[0] for row in await cursor.fetchall()]
+        return spools, deleted
+
+    async def get_spool_tombstone_horizon(self) -> int:
+        """Oldest revision get_spool_changes can answer for (older tombstones are pruned)."""
+        async with self.conn.execute("SELECT value FROM revisions WHERE name = 'spool_tombstones'") as cursor:
+            row = await cursor.fetchone()
+            return row[0] if row else 0
+
+    async def prune_spool_tombstones(self, keep: int = SPOOL_TOMBSTONE_RETENTION) -> int:
+        """Delete tombstones more than `keep` revisions old and move the horizon up."""
+        horizon = await self.get_spool_revision() - keep
+        if horizon <= await self.get_spool_tombstone_horizon():
+            return 0
+        cursor = await self.conn.execute("DELETE FROM spool_tombstones WHERE revision <= ?", (horizon,))
+        await self.conn.execute("UPDATE revisions SET value = ? WHERE name = 'spool_tombstones'", (horizon,))
+        await self.conn.commit()
+        return cursor.rowcount
+
     async def get_spool(self, spool_id: str) -> Spool | None:
         """Get a single spool by ID."""
         async with self.conn.execute("SELECT * FROM spools WHERE id = ?", (spool_id,)) as cursor:
             row = await cursor.fetchone()
             return Spool(**dict(row)) if row else None
 
+    _SPOOL_INSERT = """INSERT INTO spools (id, spool_number, tag_id, material, subtype, color_name, rgba, brand,
+               label_weight, core_weight, weight_new, weight_current, slicer_filament, slicer_filament_name,
+               location, note, data_origin, tag_type, ext_has_k, created_at, updated_at)
+               VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"""
+
+    @staticmethod
+    def _spool_row(spool_id: str, spool_number: int, spool: SpoolCreate, now: int) -> tuple:
+        return (
+            spool_id,
+            spool_number,
+            spool.tag_id,
+            spool.material,
+            spool.subtype,
+            spool.color_name,
+            spool.rgba,
+            spool.brand,
+            spool.label_weight,
+            spool.core_weight,
+            spool.weight_new,
+            spool.weight_current,
+            spool.slicer_filament,
+            spool.slicer_filament_name,
+            spool.location,
+            spool.note,
+            spool.data_origin,
+            spool.tag_type,
+            1 if spool.ext_has_k else 0,
+            now,
+            now,
+        )
+
+    async def _next_spool_number(self) -> int:
+        async with self.conn.execute("SELECT COALESCE(MAX(spool_number), 0) + 1 FROM spools") as cursor:
+            row = await cursor.fetchone()
+            return row[0]
+
     async def create_spool(self, spool: SpoolCreate) -> Spool:
         """Create a new spool."""
         spool_id = str(uuid.uuid4())
         now = int(time.time())
 
         # Get next spool_number (max + 1)
-        async with self.conn.execute("SELECT COALESCE(MAX(spool_number), 0) + 1 FROM spools") as cursor:
-            row = await cursor.fetchone()
-            spool_number = row[0]
+        spool_number = await self._next_spool_number()
 
-        await self.conn.execute(
-            """INSERT INTO spools (id, spool_number, tag_id, material, subtype, color_name, rgba, brand,
-               label_weight, core_weight, weight_new, weight_current, slicer_filament, slicer_filament_name,
-               location, note, data_origin, tag_type, ext_has_k, created_at, updated_at)
-               VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)""",
-            (
-                spool_id,
-                spool_number,
-                spool.tag_id,
-                spool.material,
-                spool.subtype,
-                spool.color_name,
-                spool.rgba,
-                spool.brand,
-                spool.label_weight,
-                spool.core_weight,
-                spool.weight_new,
-                spool.weight_current,
-                spool.slicer_filament,
-                spool.slicer_filament_name,
-                spool.location,
-                spool.note,
-                spool.data_origin,
-                spool.tag_type,
-                1 if spool.ext_has_k else 0,
-                now,
-                now,
-            ),
-        )
+        await self.conn.execute(self._SPOOL_INSERT, self._spool_row(spool_id, spool_number, spool, now))
         await self.conn.commit()
         return await self.get_spool(spool_id)
 
+    async def get_known_tag_ids(self, tag_ids: list[str]) -> set[str]:
+        """Tag ids of the given list that belong to a spool (archived ones too)."""
+        tag_ids = list(set(tag_ids))
+        if not tag_ids:
+            return set()
+        placeholders = ", ".join("?" * len(tag_ids))
+        async with self.conn.execute(f"SELECT tag_id FROM spools WHERE tag_id IN ({placeholders})", tag_ids) as cursor:
+            return {row[0] for row in await cursor.fetchall()}
+
+    async def create_spools(self, spools: list[SpoolCreate]) -> tuple[list[str], list[str]]:
+        """Create several spools in one transaction (bulk tag registration).
+
+        Spools whose tag_id already belongs to a spool (archived ones too,
+        tag_id is unique), or repeats an earlier one in the batch, are
+        skipped. Returns the ids of the created spools (in request order)
+        and the skipped tag_ids.
+        """
+        now = int(time.time())
+        spool_number = await self._next_spool_number()
+        created = []
+        skipped = []
+        # Tags taken meanwhile (e.g. by a concurrent request) are skipped by
+        # the insert itself instead of failing the batch halfway
+        try:
+            for spool in spools:
+                row = self._spool_row(str(uuid.uuid4()), spool_number, spool, now)
+                cursor = await self.conn.execute(self._SPOOL_INSERT + " ON CONFLICT(tag_id) DO NOTHING", row)
+                if cursor.rowcount == 0:
+                    skipped.append(spool.tag_id)
+                    continue
+                created.append(row[0])
+                spool_number += 1
+            await self.conn.commit()
+        except Exception:
+            await self.conn.rollback()
+            raise
+        return created, skipped
+
     async def update_spool(self, spool_id: str, spool: SpoolUpdate) -> Spool | None:
         """Update an existing spool."""
         existing = await self.get_spool(spool_id)
@@ -574,7 +887,10 @@ class Database:
         """Delete a spool."""
         cursor = await self.conn.execute("DELETE FROM spools WHERE id = ?", (spool_id,))
         await self.conn.commit()
-        return cursor.rowcount > 0
+        deleted = cursor.rowcount > 0
+        if deleted:
+            await self.prune_spool_tombstones()
+        return deleted
 
     async def archive_spool(self, spool_id: str) -> Spool | None:
         """Archive a spool by setting archived_at timestamp."""
@@ -748,7 +1064,7 @@ class Database:
 
     async def assign_spool_to_slot(self, spool_id: str, printer_serial: str, ams_id: int, tray_id: int) -> bool:
         """Assign a spool to an AMS slot (upsert).
-        
+
         If the spool is already assigned to a different slot on the same printer,
         the old assignment will be deleted and replaced with this new one.
         """
@@ -759,7 +1075,7 @@ class Database:
                 "DELETE FROM spool_assignments WHERE printer_serial = ? AND spool_id = ?",
                 (printer_serial, spool_id),
             )
-            
+
             # Now insert the new assignment
             cursor = await self.conn.execute(
                 """INSERT INTO spool_assignments (spool_id, printer_serial, ams_id, tray_id, assigned_at)
@@ -768,11 +1084,13 @@ class Database:
             )
             await self.conn.commit()
             import logging
+
             logger = logging.getLogger(__name__)
             logger.info(f"DB: Saved assignment - spool {spool_id} to {printer_serial} AMS {ams_id} tray {tray_id}")
             return True
         except Exception as e:
             import logging
+
             logger = logging.getLogger(__name__)
             logger.error(f"DB: Failed to save assignment: {e}")
             return False
@@ -798,9 +1116,10 @@ class Database:
     async def get_slot_assignments(self, printer_serial: str) -> list[dict]:
         """Get all spool assignments for a printer."""
         import logging
+
         logger = logging.getLogger(__name__)
         logger.info(f"DB: Getting assignments for printer {printer_serial}")
-        
+
         async with self.conn.execute(
             """SELECT sa.*, s.material, s.color_name, s.rgba, s.brand
                FROM spool_assignments sa
@@ -816,7 +1135,11 @@ class Database:
     # ============ Usage History Operations ============
 
     async def log_usage(self, spool_id: str, printer_serial: str, print_name: str, weight_used: float) -> int:
-        """Log filament usage for a print job."""
+        """Log filament usage for a print job.
+
+        The daily spool/printer aggregates are updated by trigger in the same
+        transaction.
+        """
         cursor = await self.conn.execute(
             """INSERT INTO usage_history (spool_id, printer_serial, print_name, weight_used)
                VALUES (?, ?, ?, ?)""",
@@ -825,26 +1148,69 @@ class Database:
         await self.conn.commit()
         return cursor.lastrowid
 
-    async def get_usage_history(self, spool_id: str | None = None, limit: int = 100) -> list[dict]:
-        """Get usage history, optionally filtered by spool."""
+    async def get_usage_history(
+        self, spool_id: str | None = None, limit: int = 100, before: tuple[int, int] | None = None
+    ) -> list[dict]:
+        """Get usage history, newest first, optionally filtered by spool.
+
+        Pages by keyset: pass the (timestamp, id) of the last row of the
+        previous page as before. Each page is an index range scan, so deep
+        pages cost the same as the first.
+        """
+        conditions = []
+        params: list = []
         if spool_id:
-            query = """SELECT uh.*, s.material, s.color_name, s.brand
-                       FROM usage_history uh
-                       LEFT JOIN spools s ON uh.spool_id = s.id
-                       WHERE uh.spool_id = ?
-                       ORDER BY uh.timestamp DESC LIMIT ?"""
-            params = (spool_id, limit)
-        else:
-            query = """SELECT uh.*, s.material, s.color_name, s.brand
-                       FROM usage_history uh
-                       LEFT JOIN spools s ON uh.spool_id = s.id
-                       ORDER BY uh.timestamp DESC LIMIT ?"""
-            params = (limit,)
+            conditions.append("uh.spool_id = ?")
+            params.append(spool_id)
+        if before:
+            conditions.append("(uh.timestamp, uh.id) < (?, ?)")
+            params.extend(before)
+        where = f"WHERE {' AND '.join(conditions)}" if conditions else ""
+        query = f"""SELECT uh.*, s.material, s.color_name, s.brand
+                    FROM usage_history uh
+                    LEFT JOIN spools s ON uh.spool_id = s.id
+                    {where}
+                    ORDER BY uh.timestamp DESC, uh.id DESC LIMIT ?"""
+        params.append(limit)
 
         async with self.conn.execute(query, params) as cursor:
             rows = await cursor.fetchall()
             return [dict(row) for row in rows]
 
+    async def get_usage_daily(
+        self, spool_id: str | None = None, printer_serial: str | None = None, days: int = 30
+    ) -> list[dict]:
+        """Daily usage totals for the last `days` days (UTC), oldest first.
+
+        Only days with usage are returned. Filter by spool or by printer.
+        """
+        if spool_id is not None:
+            table, column, key = "usage_daily_spool", "spool_id", spool_id
+        elif printer_serial is not None:
+            table, column, key = "usage_daily_printer", "printer_serial", printer_serial
+        else:
+            raise ValueError("spool_id or printer_serial required")
+
+        since_day = int(time.time()) // 86400 - days + 1
+        async with self.conn.execute(
+            f"""SELECT date(day * 86400, 'unixepoch') AS day, prints, weight_used
+                FROM {table} WHERE {column} = ? AND day >= ? ORDER BY day""",
+            (key, since_day),
+        ) as cursor:
+            return [dict(row) for row in await cursor.fetchall()]
+
+    async def get_usage_totals(self, spool_id: str) -> dict:
+        """All-time usage totals of a spool, from the daily aggregates."""
+        async with self.conn.execute(
+            """SELECT COALESCE(SUM(prints), 0) AS prints,
+                      COALESCE(SUM(weight_used), 0) AS weight_used,
+                      date(MIN(day) * 86400, 'unixepoch') AS first_day,
+                      date(MAX(day) * 86400, 'unixepoch') AS last_day
+               FROM usage_daily_spool WHERE spool_id = ?""",
+            (spool_id,),
+        ) as cursor:
+            return dict(await cursor.fetchone())
+
     async def update_spool_consumption(
         self, spool_id: str, weight_used: float, new_weight: int | None = None
     ) -> Spool | None:
@@ -1001,6 +1367,34 @@ class Database:
         await self.conn.execute("DELETE FROM k_profiles WHERE spool_id = ?", (spool_id,))
         await self.conn.commit()
 
+    async def get_printer_kprofiles(self, serial: str, nozzle_diameter: str) -> tuple[list[dict], int] | None:
+        """Get the stored K-profiles of a printer for a nozzle diameter.
+
+        Returns:
+            (profiles, fetched_at) or None if nothing has been stored yet
+        """
+        async with self.conn.execute(
+            "SELECT profiles, fetched_at FROM printer_kprofiles WHERE printer_serial = ? AND nozzle_diameter = ?",
+            (serial, nozzle_diameter),
+        ) as cursor:
+            row = await cursor.fetchone()
+            if not row:
+                return None
+            return json.loads(row["profiles"]), row["fetched_at"]
+
+    async def save_printer_kprofiles(
+        self, serial: str, nozzle_diameter: str, profiles: list[dict], fetched_at: int | None = None
+    ) -> None:
+        """Store the K-profiles of a printer for a nozzle diameter (replaces existing)."""
+        await self.conn.execute(
+            """INSERT INTO printer_kprofiles (printer_serial, nozzle_diameter, profiles, fetched_at)
+               VALUES (?, ?, ?, ?)
+               ON CONFLICT(printer_serial, nozzle_diameter) DO UPDATE SET
+                   profiles = excluded.profiles, fetched_at = excluded.fetched_at""",
+            (serial, nozzle_diameter, json.dumps(profiles), fetched_at or int(time.time())),
+        )
+        await self.conn.commit()
+
     # ============ Spool Catalog Operations ============
 
     async def seed_spool_catalog(self) -> None:
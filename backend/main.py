@@ -21,7 +21,7 @@ from api import (
     tags_router,
     updates_router,
 )
-from api.cloud import router as cloud_router
+from api.cloud import get_presets_version, router as cloud_router
 from api.printers import set_printer_manager
 from api.settings import router as settings_router
 from api.support import init_debug_logging
@@ -29,9 +29,18 @@ from config import settings
 from db import get_db
 from fastapi import FastAPI, WebSocket, WebSocketDisconnect
 from fastapi.middleware.cors import CORSMiddleware
+from fastapi.responses import PlainTextResponse
 from fastapi.staticfiles import StaticFiles
+from metrics import (
+    WEBSOCKET_CLIENTS,
+    WEBSOCKET_SEND_SECONDS,
+    RequestMetricsMiddleware,
+    event_loop_lag_monitor,
+    registry,
+)
 from models import PrinterState
 from mqtt import PrinterManager
+from services.device_logs import UDP_LOG_PORT, DeviceLogReceiver, device_log_store, open_log_socket
 from tags import TagDecoder
 from usage_tracker import UsageTracker, estimate_weight_from_percent
 from zeroconf import ServiceInfo
@@ -334,31 +343,11 @@ def pop_display_command() -> str | None:
 
 
 async def udp_log_listener():
-    """Listen for UDP log messages from ESP32 firmware."""
-    UDP_LOG_PORT = 5555
-
-    # Create UDP socket
-    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
-    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
-    sock.bind(("0.0.0.0", UDP_LOG_PORT))
-    sock.setblocking(False)
-
+    """Receive UDP log lines from ESP32 firmware into the device log store."""
+    sock = open_log_socket()
+    DeviceLogReceiver(device_log_store, sock).start()
     logger.info(f"UDP log listener started on port {UDP_LOG_PORT}")
 
-    loop = asyncio.get_event_loop()
-    while True:
-        try:
-            data, addr = await loop.run_in_executor(None, lambda: sock.recvfrom(4096))
-            message = data.decode("utf-8", errors="replace").strip()
-            if message:
-                # Print with ESP32 prefix for clarity
-                print(f"[ESP32] {message}")
-        except BlockingIOError:
-            await asyncio.sleep(0.01)
-        except Exception as e:
-            logger.error(f"UDP listener error: {e}")
-            await asyncio.sleep(1)
-
 
 async def check_display_timeout():
     """Background task to check for display timeout and broadcast disconnect."""
@@ -381,14 +370,18 @@ async def broadcast_message(message: dict):
     text = json.dumps(message)
     disconnected = set()
 
-    for     http://172.16.15.7:8000/api/printersws in websocket_clients:
+    for ws in websocket_clients:
         try:
+            start = time.perf_counter()
             await ws.send_text(text)
+            WEBSOCKET_SEND_SECONDS.observe(time.perf_counter() - start)
         except Exception:
             disconnected.add(ws)
 
     # Clean up disconnected clients
-    websocket_clients.difference_update(disconnected)
+    if disconnected:
+        websocket_clients.difference_update(disconnected)
+        WEBSOCKET_CLIENTS.set(value=len(websocket_clients))
 
 
 async def on_usage_logged(serial: str, print_name: str, tray_usage: dict):
@@ -561,6 +554,20 @@ def on_nozzle_count_update(serial: str, nozzle_count: int):
         pass  # No running loop
 
 
+def on_kprofiles_update(serial: str, nozzle_diameter: str, profiles: list):
+    """Persist K-profiles a printer reported, so they can be served while it is slow or offline."""
+
+    async def update_db():
+        db = await get_db()
+        await db.save_printer_kprofiles(serial, nozzle_diameter, profiles)
+
+    try:
+        loop = asyncio.get_running_loop()
+        loop.create_task(update_db())
+    except RuntimeError:
+        pass  # No running loop
+
+
 # Store recent assignment completions for polling (used by simulator)
 # Format: [(timestamp, serial, ams_id, tray_id, spool_id, success), ...]
 _assignment_completions: list[tuple] = []
@@ -685,6 +692,7 @@ async def lifespan(app: FastAPI):
     printer_manager.set_assignment_complete_callback(on_assignment_complete)
     printer_manager.set_tray_reading_callback(on_tray_reading_change)
     printer_manager.set_nozzle_count_callback(on_nozzle_count_update)
+    printer_manager.set_kprofiles_callback(on_kprofiles_update)
 
     # Register mDNS service for device discovery
     # Service type must be <= 15 chars, using "_spbuddy-srv" (12 chars)
@@ -717,6 +725,14 @@ async def lifespan(app: FastAPI):
     # Start UDP log listener for ESP32 logs
     asyncio.create_task(udp_log_listener())
 
+    # Persist API key last_used timestamps in batches
+    from api.api_keys import api_key_usage_flusher
+
+    asyncio.create_task(api_key_usage_flusher())
+
+    # Sample event-loop lag for /metrics
+    asyncio.create_task(event_loop_lag_monitor())
+
     yield
 
     # Shutdown
@@ -733,6 +749,14 @@ async def lifespan(app: FastAPI):
 
     await printer_manager.disconnect_all()
 
+    # Write API key usage not yet flushed
+    from api.api_keys import flush_api_key_usage
+
+    try:
+        await flush_api_key_usage()
+    except Exception as e:
+        logger.warning(f"Failed to write API key usage: {e}")
+
 
 # Create FastAPI app
 app = FastAPI(
@@ -754,6 +778,8 @@ app.add_middleware(
     allow_headers=["*"],
 )
 
+app.add_middleware(RequestMetricsMiddleware)
+
 # API routes
 app.include_router(spools_router, prefix="/api")
 app.include_router(printers_router, prefix="/api")
@@ -780,6 +806,12 @@ async def get_server_time():
     return {"hour": now.hour, "minute": now.minute, "second": now.second, "timestamp": int(now.timestamp())}
 
 
+@app.get("/metrics", include_in_schema=False)
+async def get_metrics():
+    """Runtime metrics in Prometheus text format."""
+    return PlainTextResponse(registry.render(), media_type="text/plain; version=0.0.4")
+
+
 @app.get("/api/display/heartbeat")
 async def display_heartbeat(
     version: str | None = None,
@@ -826,11 +858,18 @@ async def display_heartbeat(
     if wifi_rssi is not None:
         _device_wifi_rssi = wifi_rssi
 
+    response = {"ok": True}
+
+    # Displays re-download their flash preset catalog when this changes
+    presets_version = get_presets_version()
+    if presets_version:
+        response["presets_version"] = presets_version
+
     cmd = pop_display_command()
     if cmd:
         logger.info(f"Sending command to display: {cmd}")
-        return {"ok": True, "command": cmd}
-    return {"ok": True}
+        response["command"] = cmd
+    return response
 
 
 def get_display_firmware_version() -> str | None:
@@ -886,8 +925,13 @@ async def update_device_state(
     wifi_ssid: str | None = None,
     wifi_ip: str | None = None,
     wifi_rssi: int | None = None,
+    partial: bool = False,
 ):
-    """HTTP endpoint for device to update state (alternative to WebSocket)."""
+    """HTTP endpoint for device to update state (alternative to WebSocket).
+
+    With partial=true the device only sends fields that changed; missing fields
+    keep their last value, and an empty tag_id reports that the tag was removed.
+    """
     global _device_wifi_state, _device_wifi_ssid, _device_wifi_ip, _device_wifi_rssi
 
     update_display_heartbeat()
@@ -921,12 +965,13 @@ async def update_device_state(
     # (not just defaulting to None from missing query param)
     message = {
         "weight": weight,
-        "stable": stable if stable is not None else False,
+        "stable": stable if stable is not None or partial else False,
+        "partial": partial,
     }
     # Only include tag_id if tag-related params were provided
     # (device sends tag_id when reporting tag status, omits it for weight-only updates)
     if tag_id is not None or tag_vendor is not None:
-        message["tag_id"] = tag_id
+        message["tag_id"] = tag_id or None
         message["tag_data"] = tag_data
 
     await handle_device_state(message)
@@ -1112,12 +1157,18 @@ async def handle_device_state(message: dict):
     Uses the staging system: when a tag is detected, it's staged for 30s.
     Flaky NFC reads (tag_id=None) don't clear staging - only timeout or new tag does.
     Tag removal is debounced to avoid false triggers from flaky NFC reads.
+
+    Partial messages (change-driven device reports) only carry what changed:
+    a missing tag_id means the tag is unchanged, and an explicit null tag_id is
+    a removal the device has already debounced (TAG_REMOVAL_MISSES empty scans
+    in a row, see nfc_bridge_manager.rs).
     """
     global _device_last_weight, _device_weight_stable, _device_current_tag_id, _device_tag_data
     global _tag_last_seen_time, _confirmed_tag_id
 
     weight = message.get("weight")
     stable = message.get("stable", False)
+    partial = message.get("partial", False)
     provided_tag_data = message.get("tag_data")
 
     # Check if tag_id is explicitly present in message (vs just missing)
@@ -1132,7 +1183,7 @@ async def handle_device_state(message: dict):
         _device_last_weight = weight
         state_changed = True
 
-    if stable != _device_weight_stable:
+    if stable is not None and stable != _device_weight_stable:
         _device_weight_stable = stable
         state_changed = True
 
@@ -1159,7 +1210,7 @@ async def handle_device_state(message: dict):
         _confirmed_tag_id = None
         _device_current_tag_id = None
         state_changed = True
-    elif not has_tag_field and _confirmed_tag_id is not None:
+    elif not has_tag_field and _confirmed_tag_id is not None and not partial:
         # Message has no tag_id field - check for staleness timeout
         # If device stops sending tag_id for a while, assume tag was removed
         time_since_last_seen = now - _tag_last_seen_time
@@ -1189,7 +1240,7 @@ async def handle_device_state(message: dict):
                 logger.debug(
                     f"Tag null, time_since_last_seen={time_since_last_seen:.2f}s, debounce={_tag_removal_debounce}"
                 )
-                if time_since_last_seen >= _tag_removal_debounce:
+                if partial or time_since_last_seen >= _tag_removal_debounce:
                     logger.info(f"Tag removal confirmed after debounce (was {_confirmed_tag_id})")
                     _confirmed_tag_id = None
                     state_changed = True
@@ -1375,6 +1426,7 @@ async def websocket_endpoint(websocket: WebSocket):
     global _device_current_tag_id, _device_tag_data
     await websocket.accept()
     websocket_clients.add(websocket)
+    WEBSOCKET_CLIENTS.set(value=len(websocket_clients))
     logger.info("WebSocket client connected")
 
     # Send initial state to new client
@@ -1425,6 +1477,7 @@ async def websocket_endpoint(websocket: WebSocket):
         logger.error(f"WebSocket error: {e}")
     finally:
         websocket_clients.discard(websocket)
+        WEBSOCKET_CLIENTS.set(value=len(websocket_clients))
 
 
 # Mount static files (frontend) - must be last
@@ -0,0 +1,254 @@
+"""
+Runtime metrics registry, exposed in Prometheus text format at /metrics.
+
+Metrics are plain in-process counters, gauges and fixed-bucket histograms:
+recording a sample is a dict lookup plus a list increment, cheap enough for
+per-message and per-query hot paths. Samples may be recorded from any
+thread (paho-mqtt callbacks, aiosqlite worker); updates are not locked, so
+a concurrent increment can very rarely be lost - acceptable for monitoring.
+
+    REQUESTS = registry.counter("spoolbuddy_requests_total", "Requests", ("route",))
+    REQUESTS.inc("/api/spools")
+
+    start = time.perf_counter()
+    ...
+    LATENCY.observe(time.perf_counter() - start, "/api/spools")
+
+    registry.render()  # text exposition format
+"""
+
+import asyncio
+import math
+import time
+from bisect import bisect_left
+
+from starlette.routing import Mount
+
+# Latency buckets in seconds: 0.1 ms .. 10 s
+LATENCY_BUCKETS = (0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 10.0)
+
+
+def _escape(value: str) -> str:
+    return value.replace("\\", "\\\\").replace("\n", "\\n").replace('"', '\\"')
+
+
+def _label_text(names: tuple[str, ...], values: tuple, extra: str = "") -> str:
+    parts = [f'{name}="{_escape(str(value))}"' for name, value in zip(names, values, strict=True)]
+    if extra:
+        parts.append(extra)
+    return "{" + ",".join(parts) + "}" if parts else ""
+
+
+def _number(value: float) -> str:
+    if value == math.inf:
+        return "+Inf"
+    if float(value).is_integer():
+        return str(int(value))
+    return repr(float(value))
+
+
+class Counter:
+    """Monotonically increasing count per label set."""
+
+    kind = "counter"
+
+    def __init__(self, name: str, documentation: str, labelnames: tuple[str, ...] = ()):
+        self.name = name
+        self.documentation = documentation
+        self.labelnames = tuple(labelnames)
+        self._values: dict[tuple, float] = {}
+
+    def inc(self, *labels, amount: float = 1.0):
+        values = self._values
+        values[labels] = values.get(labels, 0.0) + amount
+
+    def value(self, *labels) -> float:
+        return self._values.get(labels, 0.0)
+
+    def samples(self):
+        for labels, value in sorted(self._values.items()):
+            yield self.name, _label_text(self.labelnames, labels), value
+
+
+class Gauge(Counter):
+    """Current value per label set."""
+
+    kind = "gauge"
+
+    def set(self, *labels, value: float):
+        self._values[labels] = value
+
+
+class Histogram:
+    """Cumulative fixed-bucket histogram per label set."""
+
+    kind = "histogram"
+
+    def __init__(
+        self,
+        name: str,
+        documentation: str,
+        labelnames: tuple[str, ...] = (),
+        buckets: tuple[float, ...] = LATENCY_BUCKETS,
+    ):
+        self.name = name
+        self.documentation = documentation
+        self.labelnames = tuple(labelnames)
+        self.buckets = tuple(sorted(buckets))
+        # labels -> [count per bucket..., +Inf count, sum]
+        self._series: dict[tuple, list] = {}
+
+    def observe(self, value: float, *labels):
+        try:
+            series = self._series[labels]
+        except KeyError:
+            series = self._series.setdefault(labels, [0] * (len(self.buckets) + 1) + [0.0])
+        series[bisect_left(self.buckets, value)] += 1
+        series[-1] += value
+
+    def count(self, *labels) -> int:
+        series = self._series.get(labels)
+        return sum(series[:-1]) if series else 0
+
+    def total(self, *labels) -> float:
+        series = self._series.get(labels)
+        return series[-1] if series else 0.0
+
+    def samples(self):
+        for labels, series in sorted(self._series.items()):
+            cumulative = 0
+            for bound, count in zip((*self.buckets, math.inf), series[:-1], strict=True):
+                cumulative += count
+                yield f"{self.name}_bucket", _label_text(self.labelnames, labels, f'le="{_number(bound)}"'), cumulative
+            yield f"{self.name}_count", _label_text(self.labelnames, labels), cumulative
+            yield f"{self.name}_sum", _label_text(self.labelnames, labels), series[-1]
+
+
+class Registry:
+    """Named collection of metrics rendered together."""
+
+    def __init__(self):
+        self._metrics: dict[str, Counter | Gauge | Histogram] = {}
+
+    def _register(self, metric):
+        if metric.name in self._metrics:
+            raise ValueError(f"Metric already registered: {metric.name}")
+        self._metrics[metric.name] = metric
+        return metric
+
+    def counter(self, name: str, documentation: str, labelnames: tuple[str, ...] = ()) -> Counter:
+        return self._register(Counter(name, documentation, labelnames))
+
+    def gauge(self, name: str, documentation: str, labelnames: tuple[str, ...] = ()) -> Gauge:
+        return self._register(Gauge(name, documentation, labelnames))
+
+    def histogram(
+        self,
+        name: str,
+        documentation: str,
+        labelnames: tuple[str, ...] = (),
+        buckets: tuple[float, ...] = LATENCY_BUCKETS,
+    ) -> Histogram:
+        return self._register(Histogram(name, documentation, labelnames, buckets))
+
+    def get(self, name: str):
+        return self._metrics.get(name)
+
+    def render(self) -> str:
+        """Prometheus text exposition format (version 0.0.4)."""
+        lines = []
+        for metric in self._metrics.values():
+            lines.append(f"# HELP {metric.name} {metric.documentation}")
+            lines.append(f"# TYPE {metric.name} {metric.kind}")
+            for name, labels, value in metric.samples():
+                lines.append(f"{name}{labels} {_number(value)}")
+        return "\n".join(lines) + "\n"
+
+
+registry = Registry()
+
+# ============ Backend metrics ============
+
+HTTP_REQUEST_SECONDS = registry.histogram(
+    "spoolbuddy_http_request_seconds", "HTTP request latency by route template", ("method", "route", "status")
+)
+
+MQTT_MESSAGES = registry.counter("spoolbuddy_mqtt_messages_total", "MQTT messages received per printer", ("printer",))
+MQTT_PARSE_SECONDS = registry.histogram(
+    "spoolbuddy_mqtt_parse_seconds", "Time to decode and apply one MQTT message", ("printer",)
+)
+
+WEBSOCKET_CLIENTS = registry.gauge("spoolbuddy_websocket_clients", "Connected WebSocket clients")
+WEBSOCKET_SEND_SECONDS = registry.histogram(
+    "spoolbuddy_websocket_send_seconds", "Time to send one broadcast message to one WebSocket client"
+)
+
+DB_QUERY_SECONDS = registry.histogram(
+    "spoolbuddy_db_query_seconds", "SQLite statement latency by statement kind and table", ("statement",)
+)
+
+COVER_CACHE = registry.counter("spoolbuddy_cover_cache_total", "Print cover image cache lookups", ("result",))
+
+EVENT_LOOP_LAG_SECONDS = registry.histogram("spoolbuddy_event_loop_lag_seconds", "How late the event loop ran a timer")
+
+
+def _route_label(scope) -> str:
+    """Template of the matched route ("/api/spools/{spool_id}").
+
+    Everything served by a mount (the frontend's StaticFiles at "/") shares
+    the "static" label, so static URLs and scanner probes can't add series.
+    """
+    route = scope.get("route")
+    if isinstance(route, Mount) or (route is None and scope.get("endpoint") is not None):
+        # Newer FastAPI routers record the mounted app as endpoint only
+        return "static"
+    if route is None:
+        return "unmatched"
+    path_regex = getattr(route, "path_regex", None)
+    if path_regex is not None and path_regex.match(scope["path"]):
+        return route.path
+    # Route of a router included under a prefix: its template lacks the prefix
+    path = scope["path"]
+    for name, value in scope.get("path_params", {}).items():
+        path = path.replace(f"/{value}", f"/{{{name}}}", 1)
+    return path
+
+
+class RequestMetricsMiddleware:
+    """ASGI middleware timing HTTP requests into HTTP_REQUEST_SECONDS.
+
+    Requests are labelled by route template ("/api/spools/{spool_id}") so path
+    parameters don't create a series per id. Streaming responses are timed
+    until their last body chunk is sent.
+    """
+
+    def __init__(self, app):
+        self.app = app
+
+    async def __call__(self, scope, receive, send):
+        if scope["type"] != "http":
+            await self.app(scope, receive, send)
+            return
+
+        start = time.perf_counter()
+        status = 500
+
+        async def send_wrapper(message):
+            nonlocal status
+            if message["type"] == "http.response.start":
+                status = message["status"]
+            await send(message)
+
+        try:
+            await self.app(scope, receive, send_wrapper)
+        finally:
+            HTTP_REQUEST_SECONDS.observe(time.perf_counter() - start, scope["method"], _route_label(scope), status)
+
+
+async def event_loop_lag_monitor(interval: float = 0.5):
+    """Sample event-loop lag: how much later than requested a sleep wakes up."""
+    loop = asyncio.get_running_loop()
+    while True:
+        start = loop.time()
+        await asyncio.sleep(interval)
+        EVENT_LOOP_LAG_SECONDS.observe(max(0.0, loop.time() - start - interval))
@@ -1,4 +1,4 @@
-from pydantic import BaseModel
+from pydantic import BaseModel, Field
 
 # ============ Spool Models ============
 
@@ -44,11 +44,51 @@ class Spool(SpoolBase):
     created_at: int | None = None
     updated_at: int | None = None
     last_used_time: int | None = None  # From usage_history table
+    revision: int | None = None  # Spool list revision of the last change
 
     class Config:
         from_attributes = True
 
 
+class SpoolBatchCreate(BaseModel):
+    """Spools to create in one request (POST /spools/batch)."""
+
+    spools: list[SpoolCreate] = Field(min_length=1, max_length=100)
+
+
+class SpoolBatchResult(BaseModel):
+    """Result of POST /spools/batch."""
+
+    created: list[str]  # Ids of the created spools, in request order
+    skipped: list[str] = []  # tag_ids already in the inventory (or repeated in the batch)
+
+
+class SpoolChanges(BaseModel):
+    """Spool list changes after a given revision (GET /spools?since=)."""
+
+    revision: int  # Pass as ?since= on the next request
+    full: bool = False  # True if spools is the whole list (since was unknown) - replace, don't merge
+    spools: list[Spool]  # Created or changed, including archived/restored
+    deleted: list[str] = []  # Ids of deleted spools
+
+
+class UsageDay(BaseModel):
+    """Filament used on one day (UTC), per spool or per printer."""
+
+    day: str  # YYYY-MM-DD
+    prints: int
+    weight_used: float  # Grams
+
+
+class UsageTotals(BaseModel):
+    """All-time usage of a spool."""
+
+    prints: int
+    weight_used: float  # Grams
+    first_day: str | None = None  # YYYY-MM-DD, null if never used
+    last_day: str | None = None
+
+
 # ============ Printer Models ============
 
 
@@ -267,3 +307,4 @@ class SlicerSettingsResponse(BaseModel):
     filament: list[SlicerPreset] = []
     printer: list[SlicerPreset] = []
     process: list[SlicerPreset] = []
+    filament_version: str | None = None  # Content version of the filament list (displays cache it in flash)
@@ -8,6 +8,7 @@ from dataclasses import dataclass, field
 from typing import Any
 
 import paho.mqtt.client as mqtt
+from metrics import MQTT_MESSAGES, MQTT_PARSE_SECONDS
 from models import AmsTray, AmsUnit, PrinterState
 
 logger = logging.getLogger(__name__)
@@ -100,6 +101,9 @@ class Calibration:
 # Grace period before reporting printer as disconnected (handles brief MQTT interruptions)
 DISCONNECT_GRACE_PERIOD_SEC = 5.0
 
+# Bambu printers serve MQTT over TLS on this port
+MQTT_PORT = 8883
+
 
 @dataclass
 class PendingAssignment:
@@ -125,6 +129,7 @@ class PrinterConnection:
     ip_address: str
     access_code: str
     name: str | None = None
+    port: int = MQTT_PORT
 
     _client: mqtt.Client | None = field(default=None, repr=False)
     _connected: bool = field(default=False, repr=False)
@@ -139,6 +144,11 @@ class PrinterConnection:
     _kprofile_lock: asyncio.Lock | None = field(default=None, repr=False)  # Lock to prevent concurrent requests
     _kprofile_cache: dict = field(default_factory=dict, repr=False)  # nozzle_diameter -> (profiles, timestamp)
     _kprofile_cache_ttl: float = field(default=30.0, repr=False)  # Cache TTL in seconds
+    _kprofile_stale: set = field(default_factory=set, repr=False)  # Nozzles whose profiles changed on the printer
+    _kprofile_refresh_tasks: dict = field(default_factory=dict, repr=False)  # nozzle_diameter -> background refresh
+    _on_kprofiles_update: Callable[[str, str, list], None] | None = field(
+        default=None, repr=False
+    )  # (serial, nozzle_diameter, profiles)
     _pending_assignments: dict = field(default_factory=dict, repr=False)  # (ams_id, tray_id) -> PendingAssignment
     _on_assignment_complete: Callable[[str, int, int, str, bool], None] | None = field(
         default=None, repr=False
@@ -207,7 +217,7 @@ class PrinterConnection:
 
         # Connect
         try:
-            self._client.connect(self.ip_address, 8883, keepalive=60)
+            self._client.connect(self.ip_address, self.port, keepalive=60)
             self._client.loop_start()
             logger.info(f"Connecting to printer {self.serial} at {self.ip_address}")
         except Exception as e:
@@ -337,6 +347,7 @@ class PrinterConnection:
                     f"Set calibration on {self.serial}: AMS {ams_id}, tray {tray_id}, "
                     f"slot_id={slot_id}, cali_idx={cali_idx}"
                 )
+                self._invalidate_kprofiles(nozzle_diameter)
                 return True
             else:
                 logger.error(f"Failed to publish calibration setting: {result.rc}")
@@ -409,6 +420,7 @@ class PrinterConnection:
         try:
             result = self._client.publish(topic, payload_json)
             if result.rc == mqtt.MQTT_ERR_SUCCESS:
+                self._invalidate_kprofiles(nozzle_diameter)
                 return True
             else:
                 logger.error(f"Failed to publish extrusion_cali_set: {result.rc}")
@@ -420,11 +432,13 @@ class PrinterConnection:
     async def get_kprofiles(
         self, nozzle_diameter: str = "0.4", timeout: float = 5.0, max_retries: int = 3
     ) -> list[dict]:
-        """Request K-profiles from printer with retry logic.
+        """Get K-profiles for a nozzle diameter, stale-while-revalidate.
 
-        Bambu printers sometimes ignore the first request, so we retry.
-        Uses a lock to prevent concurrent requests from interfering.
-        Results are cached for 30 seconds to avoid hammering the printer.
+        Profiles are kept per nozzle diameter, filled from the broadcasts that
+        follow the on-connect fetch and from any extrusion_cali_get response.
+        Cached profiles are returned immediately; if they are older than the
+        TTL or were invalidated by a calibration change, a background refresh
+        is started. Only a nozzle with nothing cached waits on the printer.
 
         Args:
             nozzle_diameter: Filter by nozzle diameter (e.g., "0.4")
@@ -434,33 +448,60 @@ class PrinterConnection:
         Returns:
             List of K-profile dicts
         """
+        cached = self._kprofile_cache.get(nozzle_diameter)
+        if cached:
+            profiles, timestamp = cached
+            if self._kprofiles_need_refresh(nozzle_diameter, timestamp) and self._client and self._connected:
+                self._schedule_kprofile_refresh(nozzle_diameter, timeout, max_retries)
+            return profiles
+
         if not self._client or not self._connected:
             logger.warning(f"[{self.serial}] Cannot get K-profiles: not connected")
             return []
 
-        # Check cache first
-        cached = self._kprofile_cache.get(nozzle_diameter)
-        if cached:
-            profiles, timestamp = cached
-            if time.time() - timestamp < self._kprofile_cache_ttl:
-                logger.debug(f"[{self.serial}] Returning cached K-profiles for nozzle {nozzle_diameter}")
-                return profiles
+        return await self._fetch_kprofiles(nozzle_diameter, timeout, max_retries)
+
+    def _kprofiles_need_refresh(self, nozzle_diameter: str, timestamp: float) -> bool:
+        if nozzle_diameter in self._kprofile_stale:
+            return True
+        return time.time() - timestamp >= self._kprofile_cache_ttl
+
+    def _schedule_kprofile_refresh(self, nozzle_diameter: str, timeout: float = 5.0, max_retries: int = 3):
+        """Start a background refresh for a nozzle unless one is already running."""
+        task = self._kprofile_refresh_tasks.get(nozzle_diameter)
+        if task and not task.done():
+            return
 
+        async def refresh():
+            try:
+                await self._fetch_kprofiles(nozzle_diameter, timeout, max_retries)
+            finally:
+                self._kprofile_refresh_tasks.pop(nozzle_diameter, None)
+
+        loop = self._loop or asyncio.get_event_loop()
+        self._kprofile_refresh_tasks[nozzle_diameter] = loop.create_task(refresh())
+
+    async def _fetch_kprofiles(self, nozzle_diameter: str, timeout: float, max_retries: int) -> list[dict]:
+        """Request K-profiles from printer with retry logic.
+
+        Bambu printers sometimes ignore the first request, so we retry.
+        Uses a lock to prevent concurrent requests from interfering.
+        """
         # Initialize lock lazily (must be done in async context)
         if self._kprofile_lock is None:
             self._kprofile_lock = asyncio.Lock()
 
         # Use lock to prevent concurrent requests
         async with self._kprofile_lock:
-            # Check cache again (another request may have populated it while we waited)
+            # Another request (or a broadcast) may have refreshed it while we waited
             cached = self._kprofile_cache.get(nozzle_diameter)
-            if cached:
-                profiles, timestamp = cached
-                if time.time() - timestamp < self._kprofile_cache_ttl:
-                    logger.debug(f"[{self.serial}] Returning cached K-profiles (post-lock)")
-                    return profiles
+            if cached and not self._kprofiles_need_refresh(nozzle_diameter, cached[1]):
+                logger.debug(f"[{self.serial}] Returning cached K-profiles (post-lock)")
+                return cached[0]
 
             for attempt in range(max_retries):
+                if not self._client or not self._connected:
+                    break
                 try:
                     # Create event for waiting
                     self._pending_kprofile_response = asyncio.Event()
@@ -470,12 +511,10 @@ class PrinterConnection:
                     # Send the request
                     self._fetch_calibrations(nozzle_diameter)
 
-                    # Wait for response with timeout
+                    # Wait for response with timeout (the response handler stores the result)
                     try:
                         await asyncio.wait_for(self._pending_kprofile_response.wait(), timeout=timeout)
                         logger.info(f"[{self.serial}] Got K-profiles response on attempt {attempt + 1}")
-                        # Cache the result
-                        self._kprofile_cache[nozzle_diameter] = (self._kprofiles, time.time())
                         return self._kprofiles
                     except TimeoutError:
                         logger.warning(
@@ -487,11 +526,42 @@ class PrinterConnection:
                     self._pending_kprofile_response = None
                     self._expected_kprofile_nozzle = None
 
-            # If all retries failed, cache empty result to avoid hammering printer
+            # Keep serving what we had; otherwise cache an empty result to avoid hammering the printer
+            if cached:
+                logger.warning(f"[{self.serial}] K-profile refresh failed, keeping {len(cached[0])} cached profiles")
+                self._kprofile_cache[nozzle_diameter] = (cached[0], time.time())
+                return cached[0]
             logger.warning(f"[{self.serial}] All K-profile retries failed, caching empty result")
             self._kprofile_cache[nozzle_diameter] = ([], time.time())
             return []
 
+    def _store_kprofiles(self, nozzle_diameter: str, profiles: list[dict]):
+        """Cache profiles received from the printer and report changes for persistence."""
+        previous = self._kprofile_cache.get(nozzle_diameter)
+        self._kprofile_cache[nozzle_diameter] = (profiles, time.time())
+        self._kprofile_stale.discard(nozzle_diameter)
+
+        if previous is not None and previous[0] == profiles:
+            return
+        if self._on_kprofiles_update and self._loop:
+            self._loop.call_soon_threadsafe(lambda: self._on_kprofiles_update(self.serial, nozzle_diameter, profiles))
+
+    def _invalidate_kprofiles(self, nozzle_diameter: str):
+        """Mark a nozzle's profiles as changed on the printer and refresh them in the background."""
+        self._kprofile_stale.add(nozzle_diameter)
+        if self._loop and self._loop.is_running():
+            self._loop.call_soon_threadsafe(self._schedule_kprofile_refresh, nozzle_diameter)
+
+    def seed_kprofiles(self, nozzle_diameter: str, profiles: list[dict], fetched_at: float):
+        """Seed the cache with persisted profiles; they are revalidated on first use."""
+        if nozzle_diameter in self._kprofile_cache:
+            return
+        self._kprofile_cache[nozzle_diameter] = (profiles, fetched_at)
+        self._kprofile_stale.add(nozzle_diameter)
+
+    def has_kprofiles(self, nozzle_diameter: str) -> bool:
+        return nozzle_diameter in self._kprofile_cache
+
     def set_filament(
         self,
         ams_id: int,
@@ -724,6 +794,8 @@ class PrinterConnection:
 
     def _on_message(self, client, userdata, msg):
         """MQTT message callback."""
+        MQTT_MESSAGES.inc(self.serial)
+        start = time.perf_counter()
         try:
             payload = json.loads(msg.payload.decode())
             # Debug: log messages that might contain calibration data or command responses
@@ -741,6 +813,8 @@ class PrinterConnection:
             logger.debug(f"Failed to parse message: {e}")
         except Exception as e:
             logger.error(f"Error handling message from {self.serial}: {e}")
+        finally:
+            MQTT_PARSE_SECONDS.observe(time.perf_counter() - start, self.serial)
 
     def _send_pushall(self):
         """Request full printer state."""
@@ -943,12 +1017,8 @@ class PrinterConnection:
             f"[{self.serial}] K-profile response: nozzle={response_nozzle}, {len(filaments)} profiles, pending={has_pending_request}, expected={expected_nozzle}"
         )
 
-        # If waiting for specific nozzle and this doesn't match, ignore (it's a broadcast)
-        if has_pending_request and expected_nozzle and response_nozzle != expected_nozzle:
-            logger.debug(
-                f"[{self.serial}] Ignoring broadcast: got nozzle={response_nozzle}, waiting for {expected_nozzle}"
-            )
-            return
+        # If waiting for specific nozzle and this doesn't match, it's a broadcast: only store it
+        is_broadcast = has_pending_request and expected_nozzle and response_nozzle != expected_nozzle
 
         # Parse all profiles
         profiles = []
@@ -985,6 +1055,15 @@ class PrinterConnection:
                 }
             )
 
+        if response_nozzle is not None:
+            self._store_kprofiles(str(response_nozzle), profiles)
+
+        if is_broadcast:
+            logger.debug(
+                f"[{self.serial}] Cached broadcast: got nozzle={response_nozzle}, waiting for {expected_nozzle}"
+            )
+            return
+
         # Update kprofiles list
         self._kprofiles = profiles
         logger.info(f"[{self.serial}] Stored {len(profiles)} K-profiles for nozzle {response_nozzle}")
@@ -999,42 +1078,42 @@ class PrinterConnection:
 
     def _handle_ams_filament_setting_response(self, response_data: dict):
         """Handle successful ams_filament_setting command response.
-        
+
         After setting filament on a tray, update the tray data in state
         so the UI reflects the changes even before RFID is read.
         """
         try:
             ams_id = response_data.get("ams_id")
             tray_id = response_data.get("tray_id")
-            
+
             if ams_id is None or tray_id is None:
                 logger.debug(f"[{self.serial}] ams_filament_setting response missing ams_id or tray_id")
                 return
-            
+
             logger.info(f"[{self.serial}] Handling ams_filament_setting response for AMS {ams_id}, tray {tray_id}")
-            
+
             # Find existing AMS unit
             ams_unit = None
             for unit in self._state.ams_units:
                 if unit.id == ams_id:
                     ams_unit = unit
                     break
-            
+
             if not ams_unit:
                 logger.debug(f"[{self.serial}] AMS {ams_id} not found in state")
                 return
-            
+
             # Find existing tray
             tray_idx = None
             for idx, t in enumerate(ams_unit.trays):
                 if t.tray_id == tray_id:
                     tray_idx = idx
                     break
-            
+
             if tray_idx is None:
                 logger.debug(f"[{self.serial}] Tray {tray_id} not found in AMS {ams_id}")
                 return
-            
+
             # Update tray with response data - preserve RFID data (remain, k_value)
             old_tray = ams_unit.trays[tray_idx]
             updated_tray = AmsTray(
@@ -1050,18 +1129,18 @@ class PrinterConnection:
                 remain=old_tray.remain,  # Keep existing remain value from RFID
             )
             ams_unit.trays[tray_idx] = updated_tray
-            
+
             logger.info(
                 f"[{self.serial}] Updated tray ({ams_id}, {tray_id}): "
                 f"type={updated_tray.tray_type}, color={updated_tray.tray_color}, "
                 f"remain={updated_tray.remain}%"
             )
-            
+
             # Request full state refresh to ensure printer sends updated AMS data
             # This is critical so the UI and usage tracker can see the assigned filament
             logger.info(f"[{self.serial}] Requesting state refresh after ams_filament_setting")
             self._send_pushall()
-            
+
         except Exception as e:
             logger.error(f"[{self.serial}] Error handling ams_filament_setting response: {e}", exc_info=True)
 
@@ -1250,6 +1329,7 @@ class PrinterManager:
         self._on_assignment_complete: Callable[[str, int, int, str, bool], None] | None = None
         self._on_tray_reading_change: Callable[[str, int | None, int], None] | None = None
         self._on_nozzle_count_update: Callable[[str, int], None] | None = None
+        self._on_kprofiles_update: Callable[[str, str, list], None] | None = None
 
     def set_state_callback(self, callback: Callable[[str, PrinterState], None]):
         """Set callback for printer state updates."""
@@ -1295,7 +1375,20 @@ class PrinterManager:
         for conn in self._connections.values():
             conn._on_nozzle_count_update = callback
 
-    async def connect(self, serial: str, ip_address: str, access_code: str, name: str | None = None):
+    def set_kprofiles_callback(self, callback: Callable[[str, str, list], None]):
+        """Set callback for when a printer reports changed K-profiles.
+
+        Callback receives: (serial, nozzle_diameter, profiles)
+        Used to persist the K-profile store.
+        """
+        self._on_kprofiles_update = callback
+        # Also set on existing connections
+        for conn in self._connections.values():
+            conn._on_kprofiles_update = callback
+
+    async def connect(
+        self, serial: str, ip_address: str, access_code: str, name: str | None = None, port: int = MQTT_PORT
+    ):
         """Connect to a printer."""
         if serial in self._connections:
             logger.warning(f"Printer {serial} already connected")
@@ -1306,6 +1399,7 @@ class PrinterManager:
             ip_address=ip_address,
             access_code=access_code,
             name=name,
+            port=port,
         )
 
         # Set assignment callback if configured
@@ -1320,6 +1414,10 @@ class PrinterManager:
         if self._on_nozzle_count_update:
             conn._on_nozzle_count_update = self._on_nozzle_count_update
 
+        # Set K-profile store callback if configured
+        if self._on_kprofiles_update:
+            conn._on_kprofiles_update = self._on_kprofiles_update
+
         try:
             conn.connect(self._handle_state_update, self._handle_disconnect, self._handle_connect)
             self._connections[serial] = conn
@@ -1499,6 +1597,17 @@ class PrinterManager:
 
         return await conn.get_kprofiles(nozzle_diameter)
 
+    def has_kprofiles(self, serial: str, nozzle_diameter: str) -> bool:
+        """Check whether K-profiles for a nozzle are cached in memory."""
+        conn = self._connections.get(serial)
+        return conn is not None and conn.has_kprofiles(nozzle_diameter)
+
+    def seed_kprofiles(self, serial: str, nozzle_diameter: str, profiles: list[dict], fetched_at: float):
+        """Seed a connection's K-profile cache from the persisted store."""
+        conn = self._connections.get(serial)
+        if conn:
+            conn.seed_kprofiles(nozzle_diameter, profiles, fetched_at)
+
     def get_nozzle_diameter(self, serial: str, extruder_id: int = 0) -> str:
         """Get nozzle diameter for a printer's extruder."""
         conn = self._connections.get(serial)
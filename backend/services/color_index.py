@@ -0,0 +1,318 @@
+"""
+In-memory color catalog index.
+
+The color catalog is small enough to keep in memory (tens of thousands of
+rows after a FilamentColors.xyz sync), and lookups happen on every tag scan
+and slot configure. The index mirrors the color_catalog table and answers:
+
+- exact lookups by normalized (manufacturer, color name[, material])
+- partial manufacturer/material filters (as the SQL LIKE search did)
+- fuzzy text search, ranked by trigram similarity
+- nearest colors to a hex value, by CIE76 distance in CIELAB space
+
+It is kept in step with the table by calling upsert()/remove() after each
+write; load() replaces everything.
+"""
+
+import heapq
+import math
+import re
+from collections import Counter
+from functools import lru_cache
+
+# CIELAB grid cell edge for nearest-color search. Lab spans roughly
+# L 0..100, a/b -128..127, so this gives at most ~21 x 52 x 52 cells.
+LAB_CELL = 5.0
+
+# Minimum trigram similarity for a fuzzy search hit
+MIN_SIMILARITY = 0.3
+
+_WHITESPACE = re.compile(r"\s+")
+
+
+def normalize(value: str | None) -> str:
+    """Casefold and collapse whitespace ("Bambu  Lab " -> "bambu lab")."""
+    if not value:
+        return ""
+    return _WHITESPACE.sub(" ", value).strip().casefold()
+
+
+def trigrams(text: str) -> set[str]:
+    """Word-padded trigrams of normalized text ("pla" -> {"  p", " pl", "pla", "la "})."""
+    result: set[str] = set()
+    for word in normalize(text).split(" "):
+        if word:
+            result |= _word_trigrams(word)
+    return result
+
+
+@lru_cache(maxsize=4096)
+def _word_trigrams(word: str) -> frozenset[str]:
+    # Catalog text repeats a small vocabulary (brands, materials, color words)
+    padded = f"  {word} "
+    return frozenset(padded[i : i + 3] for i in range(len(padded) - 2))
+
+
+def hex_to_lab(hex_color: str) -> tuple[float, float, float] | None:
+    """Convert #RRGGBB (or RRGGBBAA) to CIELAB under D65; None if unparseable."""
+    value = hex_color.lstrip("#")
+    if len(value) not in (6, 8):
+        return None
+    try:
+        rgb = [int(value[i : i + 2], 16) / 255.0 for i in (0, 2, 4)]
+    except ValueError:
+        return None
+
+    # sRGB -> linear
+    r, g, b = (c / 12.92 if c <= 0.04045 else ((c + 0.055) / 1.055) ** 2.4 for c in rgb)
+
+    # linear RGB -> XYZ, normalized to the D65 white point
+    x = (0.4124 * r + 0.3576 * g + 0.1805 * b) / 0.95047
+    y = 0.2126 * r + 0.7152 * g + 0.0722 * b
+    z = (0.0193 * r + 0.1192 * g + 0.9505 * b) / 1.08883
+
+    def f(t: float) -> float:
+        return t ** (1 / 3) if t > 0.008856 else 7.787 * t + 16 / 116
+
+    fx, fy, fz = f(x), f(y), f(z)
+    return (116 * fy - 16, 500 * (fx - fy), 200 * (fy - fz))
+
+
+def _cell(lab: tuple[float, float, float]) -> tuple[int, int, int]:
+    return (int(lab[0] // LAB_CELL), int(lab[1] // LAB_CELL), int(lab[2] // LAB_CELL))
+
+
+class ColorIndex:
+    """Color catalog entries indexed for exact, fuzzy and nearest-color lookups.
+
+    Entries are the dicts returned by the database (id, manufacturer,
+    color_name, hex_color, material, is_default, created_at).
+    """
+
+    def __init__(self):
+        self.clear()
+
+    def clear(self) -> None:
+        self._entries: dict[int, dict] = {}
+        self._by_name: dict[tuple[str, str], list[int]] = {}  # (manufacturer, color_name) -> ids
+        self._by_manufacturer: dict[str, set[int]] = {}
+        self._by_material: dict[str, set[int]] = {}
+        self._trigrams: dict[str, set[int]] = {}
+        self._entry_trigrams: dict[int, int] = {}  # id -> trigram count, for similarity
+        self._cells: dict[tuple[int, int, int], set[int]] = {}
+        self._labs: dict[int, tuple[float, float, float]] = {}
+        self._sorted: list[int] | None = None  # ids by (manufacturer, color_name), built on demand
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def load(self, entries: list[dict]) -> None:
+        """Replace the index contents."""
+        self.clear()
+        for entry in entries:
+            self.upsert(entry)
+
+    def get(self, entry_id: int) -> dict | None:
+        return self._entries.get(entry_id)
+
+    def upsert(self, entry: dict) -> None:
+        """Add an entry, or re-index it if its id is already present."""
+        entry_id = entry["id"]
+        if entry_id in self._entries:
+            self.remove(entry_id)
+
+        entry = dict(entry)
+        self._entries[entry_id] = entry
+        self._sorted = None
+
+        manufacturer = normalize(entry["manufacturer"])
+        ids = self._by_name.setdefault((manufacturer, normalize(entry["color_name"])), [])
+        ids.append(entry_id)
+        ids.sort()
+        self._by_manufacturer.setdefault(manufacturer, set()).add(entry_id)
+        self._by_material.setdefault(normalize(entry.get("material")), set()).add(entry_id)
+
+        tris = self._document_trigrams(entry)
+        for tri in tris:
+            self._trigrams.setdefault(tri, set()).add(entry_id)
+        self._entry_trigrams[entry_id] = len(tris)
+
+        lab = hex_to_lab(entry["hex_color"])
+        if lab:
+            self._labs[entry_id] = lab
+            self._cells.setdefault(_cell(lab), set()).add(entry_id)
+
+    def remove(self, entry_id: int) -> None:
+        entry = self._entries.pop(entry_id, None)
+        if entry is None:
+            return
+        self._sorted = None
+
+        manufacturer = normalize(entry["manufacturer"])
+        name_key = (manufacturer, normalize(entry["color_name"]))
+        self._by_name[name_key].remove(entry_id)
+        if not self._by_name[name_key]:
+            del self._by_name[name_key]
+        _discard(self._by_manufacturer, manufacturer, entry_id)
+        _discard(self._by_material, normalize(entry.get("material")), entry_id)
+
+        for tri in self._document_trigrams(entry):
+            _discard(self._trigrams, tri, entry_id)
+        del self._entry_trigrams[entry_id]
+
+        lab = self._labs.pop(entry_id, None)
+        if lab:
+            _discard(self._cells, _cell(lab), entry_id)
+
+    @staticmethod
+    def _document_trigrams(entry: dict) -> set[str]:
+        return trigrams(f"{entry['manufacturer']} {entry['color_name']} {entry.get('material') or ''}")
+
+    def lookup(self, manufacturer: str, color_name: str, material: str | None = None) -> dict | None:
+        """Exact (normalized) match; the oldest entry wins when several materials match."""
+        ids = self._by_name.get((normalize(manufacturer), normalize(color_name)))
+        if not ids:
+            return None
+        if material:
+            wanted = normalize(material)
+            ids = [i for i in ids if normalize(self._entries[i].get("material")) == wanted]
+            if not ids:
+                return None
+        return self._entries[ids[0]]
+
+    def _candidates(self, manufacturer: str | None, material: str | None) -> set[int] | None:
+        """Ids whose manufacturer/material contain the given text (case-insensitive); None if unfiltered."""
+        candidates: set[int] | None = None
+        if manufacturer:
+            candidates = _substring_union(self._by_manufacturer, normalize(manufacturer))
+        if material:
+            by_material = _substring_union(self._by_material, normalize(material))
+            candidates = by_material if candidates is None else candidates & by_material
+        return candidates
+
+    def filter(self, manufacturer: str | None = None, material: str | None = None, limit: int = 100) -> list[dict]:
+        """Entries whose manufacturer/material contain the given text, ordered by manufacturer and name."""
+        candidates = self._candidates(manufacturer, material)
+        if candidates is None:
+            ids = self._sorted_ids()[:limit]
+        else:
+            ids = heapq.nsmallest(limit, candidates, key=self._sort_key)
+        return [self._entries[i] for i in ids]
+
+    def search(
+        self, query: str, limit: int = 20, manufacturer: str | None = None, material: str | None = None
+    ) -> list[tuple[dict, float]]:
+        """Fuzzy text search over manufacturer, color name and material.
+
+        Returns (entry, similarity) pairs, best first. Similarity is the
+        Jaccard index of query and entry trigrams. manufacturer/material
+        restrict results as in filter().
+        """
+        query_tris = trigrams(query)
+        if not query_tris:
+            return []
+
+        hits: Counter[int] = Counter()
+        for tri in query_tris:
+            hits.update(self._trigrams.get(tri, ()))
+
+        candidates = self._candidates(manufacturer, material)
+        scored = []
+        for entry_id, shared in hits.items():
+            similarity = shared / (len(query_tris) + self._entry_trigrams[entry_id] - shared)
+            if similarity < MIN_SIMILARITY:
+                continue
+            if candidates is not None and entry_id not in candidates:
+                continue
+            scored.append((similarity, entry_id))
+
+        best = heapq.nsmallest(limit, scored, key=lambda s: (-s[0], self._sort_key(s[1])))
+        return [(self._entries[i], similarity) for similarity, i in best]
+
+    def nearest(self, hex_color: str, limit: int = 5, material: str | None = None) -> list[tuple[dict, float]]:
+        """Entries closest to hex_color, as (entry, delta E) pairs, closest first.
+
+        material restricts results as in filter(). Walks the Lab grid outwards from the query cell and stops once no
+        unvisited cell can hold anything closer than the current results.
+        """
+        lab = hex_to_lab(hex_color)
+        if lab is None or limit <= 0:
+            return []
+
+        candidates = self._candidates(None, material)
+        center = _cell(lab)
+        best: list[tuple[float, int]] = []  # max-heap of (-distance, id)
+        visited = 0
+        ring = 0
+
+        while visited < len(self._cells):
+            # Any cell in this ring is at least (ring - 1) cells away on some axis
+            if len(best) == limit and -best[0][0] <= (ring - 1) * LAB_CELL:
+                break
+
+            # Enumerating a large shell is wasteful for a sparse catalog
+            if (2 * ring + 1) ** 3 > len(self._cells):
+                cells = [c for c in self._cells if _ring(c, center) >= ring]
+                visited = len(self._cells)
+            else:
+                cells = [c for c in _shell(center, ring) if c in self._cells]
+                visited += len(cells)
+
+            for cell in cells:
+                for entry_id in self._cells[cell]:
+                    if candidates is not None and entry_id not in candidates:
+                        continue
+                    distance = math.dist(lab, self._labs[entry_id])
+                    if len(best) < limit:
+                        heapq.heappush(best, (-distance, entry_id))
+                    elif distance < -best[0][0]:
+                        heapq.heapreplace(best, (-distance, entry_id))
+            ring += 1
+
+        return [(self._entries[i], -d) for d, i in sorted(best, key=lambda b: (-b[0], b[1]))]
+
+    def _sort_key(self, entry_id: int) -> tuple[str, str, int]:
+        entry = self._entries[entry_id]
+        return (entry["manufacturer"], entry["color_name"], entry_id)
+
+    def _sorted_ids(self) -> list[int]:
+        if self._sorted is None:
+            self._sorted = sorted(self._entries, key=self._sort_key)
+        return self._sorted
+
+
+def _discard(index: dict, key, entry_id: int) -> None:
+    ids = index.get(key)
+    if ids is not None:
+        ids.discard(entry_id)
+        if not ids:
+            del index[key]
+
+
+def _substring_union(index: dict[str, set[int]], needle: str) -> set[int]:
+    """Union of ids for keys containing needle (keys are few - one per manufacturer/material)."""
+    result: set[int] = set()
+    for key, ids in index.items():
+        if needle in key:
+            result |= ids
+    return result
+
+
+def _ring(cell: tuple[int, int, int], center: tuple[int, int, int]) -> int:
+    return max(abs(cell[0] - center[0]), abs(cell[1] - center[1]), abs(cell[2] - center[2]))
+
+
+def _shell(center: tuple[int, int, int], ring: int):
+    """Cells at exactly Chebyshev distance ring from center."""
+    cx, cy, cz = center
+    if ring == 0:
+        yield center
+        return
+    for dx in range(-ring, ring + 1):
+        for dy in range(-ring, ring + 1):
+            if abs(dx) == ring or abs(dy) == ring:
+                for dz in range(-ring, ring + 1):
+                    yield (cx + dx, cy + dy, cz + dz)
+            else:
+                yield (cx + dx, cy + dy, cz - ring)
+                yield (cx + dx, cy + dy, cz + ring)
@@ -0,0 +1,345 @@
+"""
+Device log ingestion and in-memory log store.
+
+The display firmware sends its log lines to UDP port 5555, one line per
+datagram. DeviceLogReceiver drains every datagram already queued on the
+socket per event-loop wakeup (Python has no recvmmsg, so this is the
+equivalent batch read). Each line is parsed once into a LogEntry, and the
+batch is appended to a LogStore.
+
+LogStore is a fixed-size ring of entries numbered by a global sequence. It
+keeps per-device and per-level indexes so filtered queries don't scan the
+whole ring:
+
+    store.tail(100, device="192.168.1.50", level="W")  # newest 100 warnings+errors
+    entries, cursor, dropped = store.since(cursor)     # everything after cursor
+
+Cursors are sequence numbers. A reader that falls more than the ring size
+behind gets "dropped" = the number of entries it missed.
+"""
+
+import asyncio
+import heapq
+import logging
+import re
+import socket
+import sys
+import time
+from bisect import bisect_right
+from collections import deque
+from dataclasses import dataclass
+from itertools import islice
+
+logger = logging.getLogger(__name__)
+
+UDP_LOG_PORT = 5555
+
+# Entries kept in memory
+LOG_STORE_CAPACITY = 20_000
+
+# Datagrams read per wakeup before yielding back to the event loop
+MAX_DATAGRAMS_PER_BATCH = 512
+MAX_DATAGRAM_SIZE = 4096
+
+# Severity order, most severe first (ESP-IDF letters)
+LEVELS = "EWIDV"
+_LEVEL_NAMES = {"ERROR": "E", "WARN": "W", "WARNING": "W", "INFO": "I", "DEBUG": "D", "TRACE": "V", "VERBOSE": "V"}
+
+# ESP-IDF format, optionally wrapped in ANSI colour: "I (12345) spoolbuddy::backend_client: message"
+_ESP_LINE = re.compile(r"(?:\x1b\[[0-9;]*m)?([EWIDV]) \((\d+)\) (\S+?): (.*?)(?:\x1b\[0m)?$", re.DOTALL)
+# udp_logger macros: "[WARN] message"
+_BRACKET_LINE = re.compile(r"\[(ERROR|WARN|WARNING|INFO|DEBUG|TRACE|VERBOSE)\] (.*)$", re.DOTALL)
+
+
+@dataclass(slots=True)
+class LogEntry:
+    """One parsed device log line."""
+
+    seq: int
+    received: float  # Backend wall-clock time.time()
+    device: str  # Sender IP address
+    level: str  # One of LEVELS
+    tag: str | None  # Module/tag for ESP-IDF lines
+    uptime_ms: int | None  # Device timestamp for ESP-IDF lines
+    message: str
+
+    def to_dict(self) -> dict:
+        return {
+            "seq": self.seq,
+            "received": self.received,
+            "device": self.device,
+            "level": self.level,
+            "tag": self.tag,
+            "uptime_ms": self.uptime_ms,
+            "message": self.message,
+        }
+
+
+def parse_line(line: str) -> tuple[str, str | None, int | None, str]:
+    """(level, tag, uptime_ms, message) of a device log line; unknown formats are INFO."""
+    match = _ESP_LINE.match(line)
+    if match:
+        return match[1], match[3], int(match[2]), match[4]
+    match = _BRACKET_LINE.match(line)
+    if match:
+        return _LEVEL_NAMES[match[1]], None, None, match[2]
+    return "I", None, None, line
+
+
+def levels_at_or_above(level: str | None) -> str:
+    """Levels at least as severe as level ("W" -> "EW"); all levels for None."""
+    if not level:
+        return LEVELS
+    level = _LEVEL_NAMES.get(level.upper(), level.upper()[:1])
+    index = LEVELS.find(level)
+    if index < 0:
+        raise ValueError(f"Unknown log level: {level}")
+    return LEVELS[: index + 1]
+
+
+class LogStore:
+    """Fixed-size ring of device log entries with per-device and per-level indexes."""
+
+    def __init__(self, capacity: int = LOG_STORE_CAPACITY):
+        self.capacity = capacity
+        self._ring: list[LogEntry | None] = [None] * capacity
+        self._next_seq = 1
+        # Sequence numbers per device / level, oldest first; evictions pop from the left
+        self._by_device: dict[str, deque[int]] = {}
+        self._by_level: dict[str, deque[int]] = {}
+        self._new_entries = asyncio.Event()
+
+    @property
+    def cursor(self) -> int:
+        """Sequence number of the newest entry (0 when empty)."""
+        return self._next_seq - 1
+
+    @property
+    def oldest_seq(self) -> int:
+        return max(1, self._next_seq - self.capacity)
+
+    def __len__(self) -> int:
+        return self._next_seq - self.oldest_seq
+
+    def devices(self) -> list[str]:
+        return sorted(self._by_device)
+
+    def append(self, device: str, lines: list[str], received: float | None = None):
+        """Parse and store lines from one device."""
+        if received is None:
+            received = time.time()
+        ring, capacity = self._ring, self.capacity
+        for line in lines:
+            seq = self._next_seq
+            self._next_seq = seq + 1
+            slot = seq % capacity
+            evicted = ring[slot]
+            if evicted is not None:
+                self._evict(evicted)
+            level, tag, uptime_ms, message = parse_line(line)
+            ring[slot] = LogEntry(seq, received, device, level, tag, uptime_ms, message)
+            # Looked up per line: the eviction above may have dropped this device's index
+            device_index = self._by_device.get(device)
+            if device_index is None:
+                device_index = self._by_device[device] = deque()
+            device_index.append(seq)
+            level_index = self._by_level.get(level)
+            if level_index is None:
+                level_index = self._by_level[level] = deque()
+            level_index.append(seq)
+        self._new_entries.set()
+        self._new_entries.clear()
+
+    def _evict(self, entry: LogEntry):
+        # The evicted entry is the oldest, so it's at the head of its indexes
+        for indexes, key in ((self._by_device, entry.device), (self._by_level, entry.level)):
+            index = indexes[key]
+            index.popleft()
+            if not index:
+                del indexes[key]
+
+    def _get(self, seq: int) -> LogEntry:
+        return self._ring[seq % self.capacity]
+
+    def _candidates(self, device: str | None, level: str | None) -> list[deque[int]] | None:
+        """Index deques covering the filter, or None to walk the whole ring."""
+        if device is not None:
+            index = self._by_device.get(device)
+            return [index] if index else []
+        if level is not None:
+            return [self._by_level[lvl] for lvl in levels_at_or_above(level) if lvl in self._by_level]
+        return None
+
+    @staticmethod
+    def _matches(entry: LogEntry, levels: str, tag: str | None, contains: str | None) -> bool:
+        return (
+            entry.level in levels
+            and (tag is None or entry.tag == tag)
+            and (contains is None or contains in entry.message)
+        )
+
+    def tail(
+        self,
+        limit: int = 200,
+        device: str | None = None,
+        level: str | None = None,
+        tag: str | None = None,
+        contains: str | None = None,
+    ) -> list[LogEntry]:
+        """Newest `limit` matching entries, oldest first.
+
+        level is a minimum severity ("W" = warnings and errors).
+        """
+        levels = levels_at_or_above(level)
+        indexes = self._candidates(device, level)
+        if indexes is None:
+            seqs = range(self.cursor, self.oldest_seq - 1, -1)
+        elif len(indexes) == 1:
+            seqs = reversed(indexes[0])
+        else:
+            seqs = heapq.merge(*(reversed(index) for index in indexes), reverse=True)
+
+        matches = (entry for entry in map(self._get, seqs) if self._matches(entry, levels, tag, contains))
+        result = list(islice(matches, limit))
+        result.reverse()
+        return result
+
+    def since(
+        self,
+        cursor: int,
+        limit: int = 1000,
+        device: str | None = None,
+        level: str | None = None,
+        tag: str | None = None,
+        contains: str | None = None,
+    ) -> tuple[list[LogEntry], int, int]:
+        """Matching entries after cursor, oldest first.
+
+        Returns (entries, next cursor, dropped): dropped counts entries after
+        cursor that were already overwritten.
+        """
+        oldest = self.oldest_seq
+        dropped = max(0, oldest - cursor - 1)
+        start = max(cursor + 1, oldest)
+        levels = levels_at_or_above(level)
+
+        indexes = self._candidates(device, level)
+        if indexes is None:
+            seqs = range(start, self._next_seq)
+        else:
+            seqs = heapq.merge(*(islice(index, bisect_right(index, start - 1), None) for index in indexes))
+
+        result: list[LogEntry] = []
+        next_cursor = self.cursor
+        for seq in seqs:
+            entry = self._get(seq)
+            if self._matches(entry, levels, tag, contains):
+                if len(result) == limit:
+                    next_cursor = result[-1].seq
+                    break
+                result.append(entry)
+        return result, next_cursor, dropped
+
+    async def wait_for_entries(self, cursor: int, timeout: float | None = None) -> bool:
+        """Wait until there are entries after cursor; False on timeout."""
+        if self.cursor > cursor:
+            return True
+        try:
+            async with asyncio.timeout(timeout):
+                while self.cursor <= cursor:
+                    await self._new_entries.wait()
+        except TimeoutError:
+            return False
+        return True
+
+
+class DeviceLogReceiver:
+    """Reads device log datagrams from a UDP socket into a LogStore in batches."""
+
+    def __init__(self, store: LogStore, sock: socket.socket, echo: bool = True):
+        self.store = store
+        self.sock = sock
+        self.echo = echo
+        self.datagrams = 0
+        self.batches = 0
+        self._task: asyncio.Task | None = None
+        sock.setblocking(False)
+
+    def drain(self, first: tuple[bytes, tuple] | None = None) -> int:
+        """Read every queued datagram (up to MAX_DATAGRAMS_PER_BATCH) and store them.
+
+        first is a datagram the caller already received.
+        """
+        recvfrom = self.sock.recvfrom
+        by_device: dict[str, list[str]] = {}
+        count = 0
+        while count < MAX_DATAGRAMS_PER_BATCH:
+            if first is not None:
+                (data, addr), first = first, None
+            else:
+                try:
+                    data, addr = recvfrom(MAX_DATAGRAM_SIZE)
+                except (BlockingIOError, InterruptedError):
+                    break
+            count += 1
+            line = data.decode("utf-8", errors="replace").strip()
+            if line:
+                lines = by_device.get(addr[0])
+                if lines is None:
+                    lines = by_device[addr[0]] = []
+                lines.append(line)
+        if not count:
+            return 0
+
+        received = time.time()
+        for device, lines in by_device.items():
+            self.store.append(device, lines, received)
+            if self.echo:
+                sys.stdout.write("".join(f"[ESP32] {line}\n" for line in lines))
+        self.datagrams += count
+        self.batches += 1
+        return count
+
+    def _on_readable(self):
+        try:
+            self.drain()
+        except OSError as e:
+            logger.error(f"UDP listener error: {e}")
+
+    async def _receive_loop(self):
+        # For event loops without add_reader (Windows proactor)
+        loop = asyncio.get_running_loop()
+        while True:
+            try:
+                self.drain(await loop.sock_recvfrom(self.sock, MAX_DATAGRAM_SIZE))
+            except OSError as e:
+                logger.error(f"UDP listener error: {e}")
+                await asyncio.sleep(1)
+
+    def start(self):
+        """Start receiving on the running event loop."""
+        loop = asyncio.get_running_loop()
+        try:
+            loop.add_reader(self.sock.fileno(), self._on_readable)
+            self._task = None
+        except NotImplementedError:
+            self._task = loop.create_task(self._receive_loop())
+
+    def stop(self):
+        if self._task is not None:
+            self._task.cancel()
+        else:
+            asyncio.get_running_loop().remove_reader(self.sock.fileno())
+
+
+def open_log_socket(host: str = "0.0.0.0", port: int = UDP_LOG_PORT) -> socket.socket:
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    # Room for bursts while the event loop is busy elsewhere
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4 * 1024 * 1024)
+    sock.bind((host, port))
+    return sock
+
+
+# Store shared by the UDP listener and the /api/device/logs endpoints
+device_log_store = LogStore()
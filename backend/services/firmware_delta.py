@@ -0,0 +1,161 @@
+"""
+Binary deltas between firmware images.
+
+A delta rebuilds a target image from a source image the device already runs,
+so an OTA update only transfers what changed. The format is a header followed
+by COPY (from source) and INSERT (literal bytes) operations; it is applied
+front to back with constant extra memory beyond the target image
+(firmware/src/delta_patch.rs is the device-side applier).
+
+Layout, little-endian:
+
+    header   magic "SBD1", source_size u32, target_size u32,
+             source_sha256 [32], target_sha256 [32]
+    COPY     0x01, source_offset u32, length u32
+    INSERT   0x02, length u32, bytes[length]
+    END      0x00
+
+Deltas are found by matching BLOCK_SIZE-byte blocks of the source (indexed
+on block boundaries) at every target offset, then extending each match in
+both directions. Unchanged and shifted code both become COPYs.
+"""
+
+import hashlib
+import struct
+
+DELTA_MAGIC = b"SBD1"
+HEADER = struct.Struct("<4sII32s32s")
+OP_END = 0x00
+OP_COPY = 0x01
+OP_INSERT = 0x02
+COPY = struct.Struct("<BII")
+INSERT = struct.Struct("<BI")
+
+# Match granularity: smaller finds more matches but indexes more blocks
+BLOCK_SIZE = 32
+
+# Matches are extended by comparing this many bytes at a time
+_EXTEND_STEP = 256
+
+
+class DeltaError(Exception):
+    """Raised when a delta is malformed or doesn't match its source."""
+
+
+def _match_forward(source: bytes, s: int, target: bytes, t: int) -> int:
+    """Length of the common run of source[s:] and target[t:]."""
+    length = 0
+    limit = min(len(source) - s, len(target) - t)
+    while length + _EXTEND_STEP <= limit and (
+        source[s + length : s + length + _EXTEND_STEP] == target[t + length : t + length + _EXTEND_STEP]
+    ):
+        length += _EXTEND_STEP
+    while length < limit and source[s + length] == target[t + length]:
+        length += 1
+    return length
+
+
+def make_delta(source: bytes, target: bytes) -> bytes:
+    """Build a delta that turns source into target."""
+    index: dict[bytes, int] = {}
+    for offset in range(0, len(source) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        index.setdefault(source[offset : offset + BLOCK_SIZE], offset)
+
+    out = bytearray(
+        HEADER.pack(
+            DELTA_MAGIC,
+            len(source),
+            len(target),
+            hashlib.sha256(source).digest(),
+            hashlib.sha256(target).digest(),
+        )
+    )
+
+    def insert(start: int, end: int):
+        if end > start:
+            out.extend(INSERT.pack(OP_INSERT, end - start))
+            out.extend(target[start:end])
+
+    literal_start = 0  # Start of target bytes not yet covered by an operation
+    last_copy: tuple[int, int] | None = None  # (source offset, length) of the COPY just written
+    pos = 0
+    end = len(target) - BLOCK_SIZE
+    while pos <= end:
+        block = target[pos : pos + BLOCK_SIZE]
+        # Prefer continuing the previous COPY's diagonal: after an in-place edit the source and target realign
+        # there, and repeated blocks (padding, tables) would otherwise match their first occurrence piecemeal
+        src = last_copy[0] + last_copy[1] + pos - literal_start if last_copy else -1
+        if src < 0 or source[src : src + BLOCK_SIZE] != block:
+            src = index.get(block)
+            if src is None:
+                pos += 1
+                continue
+
+        # Extend backwards over bytes that would otherwise be inserted
+        back = 0
+        while back < pos - literal_start and back < src and source[src - back - 1] == target[pos - back - 1]:
+            back += 1
+        src -= back
+        start = pos - back
+        length = BLOCK_SIZE + back + _match_forward(source, src + BLOCK_SIZE + back, target, pos + BLOCK_SIZE)
+
+        insert(literal_start, start)
+        if last_copy and start == literal_start and last_copy[0] + last_copy[1] == src:
+            # Contiguous with the previous COPY - grow it in place
+            last_copy = (last_copy[0], last_copy[1] + length)
+            COPY.pack_into(out, len(out) - COPY.size, OP_COPY, *last_copy)
+        else:
+            last_copy = (src, length)
+            out.extend(COPY.pack(OP_COPY, src, length))
+        pos = literal_start = start + length
+
+    insert(literal_start, len(target))
+    out.append(OP_END)
+    return bytes(out)
+
+
+def read_header(delta: bytes) -> tuple[int, int, bytes, bytes]:
+    """(source_size, target_size, source_sha256, target_sha256) of a delta."""
+    if len(delta) < HEADER.size + 1:
+        raise DeltaError("Delta too short")
+    magic, source_size, target_size, source_sha, target_sha = HEADER.unpack_from(delta)
+    if magic != DELTA_MAGIC:
+        raise DeltaError(f"Bad delta magic: {magic!r}")
+    return source_size, target_size, source_sha, target_sha
+
+
+def apply_delta(source: bytes, delta: bytes) -> bytes:
+    """Rebuild the target image; verifies source and target SHA-256."""
+    source_size, target_size, source_sha, target_sha = read_header(delta)
+    if len(source) != source_size or hashlib.sha256(source).digest() != source_sha:
+        raise DeltaError("Source image does not match delta")
+
+    target = bytearray()
+    pos = HEADER.size
+    while True:
+        if pos >= len(delta):
+            raise DeltaError("Delta truncated")
+        op = delta[pos]
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            _, offset, length = COPY.unpack_from(delta, pos)
+            if offset + length > source_size:
+                raise DeltaError("COPY outside source image")
+            target += source[offset : offset + length]
+            pos += COPY.size
+        elif op == OP_INSERT:
+            _, length = INSERT.unpack_from(delta, pos)
+            pos += INSERT.size
+            if pos + length > len(delta):
+                raise DeltaError("Delta truncated")
+            target += delta[pos : pos + length]
+            pos += length
+        else:
+            raise DeltaError(f"Unknown delta operation 0x{op:02X} at {pos}")
+        if len(target) > target_size:
+            raise DeltaError("Delta overruns target size")
+
+    if len(target) != target_size or hashlib.sha256(target).digest() != target_sha:
+        raise DeltaError("Rebuilt image failed SHA-256 verification")
+    return bytes(target)
@@ -0,0 +1,178 @@
+"""
+Compact filament preset feed for constrained clients.
+
+Displays used to derive brand, material and temperature range from preset
+names themselves (string heuristics in ui_ams_slot_modal.c) after parsing the
+full slicer settings JSON. This module does that once on the server and packs
+the result into fixed-width little-endian records:
+
+    Header (12 bytes)
+        magic           4s   b"SBPF"
+        format          u8   FEED_FORMAT
+        brand_count     u8
+        material_count  u8
+        reserved        u8
+        count           u16  number of records
+        record_size     u16  RECORD_SIZE
+    Brand table         brand_count x 24 bytes, NUL padded
+    Material table      material_count x 8 bytes, NUL padded
+    Records             count x RECORD_SIZE bytes
+        setting_id      32s  NUL padded
+        name            64s  NUL padded (truncated on a UTF-8 boundary)
+        brand_id        u8   index into the brand table, NO_BRAND if unknown
+        material_id     u8   index into the material table
+        flags           u8   FLAG_CUSTOM | FLAG_USER
+        reserved        u8
+        temp_min        u16  nozzle temperature range, degrees C
+        temp_max        u16
+
+Records are deduplicated by setting_id and sorted custom first, then by name.
+"""
+
+import struct
+
+from models import SlicerPreset
+
+FEED_MAGIC = b"SBPF"
+FEED_FORMAT = 1
+
+HEADER = struct.Struct("<4sBBBBHH")
+BRAND_SIZE = 24
+MATERIAL_SIZE = 8
+RECORD = struct.Struct("<32s64sBBBBHH")
+RECORD_SIZE = RECORD.size
+
+NO_BRAND = 0xFF
+
+FLAG_CUSTOM = 0x01  # User's private preset from Bambu Cloud
+FLAG_USER = 0x02  # Not a Bambu system preset (setting_id outside GF*/P1*)
+
+# Material table, in match order - first substring match wins
+MATERIALS = ["PLA", "PETG", "ABS", "ASA", "TPU", "PC", "PA", "NYLON", "PVA", "HIPS", "PP", "PET"]
+DEFAULT_MATERIAL = "PLA"
+
+# Known filament brands - first substring match wins
+KNOWN_BRANDS = [
+    "BAMBU", "BBL", "POLYMAKER", "POLYLITE", "POLYTERRA", "POLYMAX",
+    "ESUN", "SUNLU", "OVERTURE", "HATCHBOX", "PRUSAMENT", "PRUSA",
+    "DEVIL DESIGN", "DEVIL", "ELEGOO", "CREALITY", "INLAND", "AMAZON",
+    "MATTERHACKERS", "PROTOPASTA", "FILLAMENTUM", "COLORFABB",
+    "ATOMIC", "3DXTECH", "PRILINE", "DURAMIC", "TINMORRY", "IIIDMAX",
+    "ZIRO", "ERYONE", "GEEETECH", "ANYCUBIC", "FLASHFORGE",
+]  # fmt: skip
+
+# Nozzle temperature ranges by material
+_TEMP_RANGES = [
+    ("PLA", (190, 230)),
+    ("PETG", (220, 260)),
+    ("ABS", (240, 280)),
+    ("ASA", (240, 280)),
+    ("TPU", (200, 240)),
+    ("PC", (260, 300)),
+    ("PA", (250, 290)),
+    ("NYLON", (250, 290)),
+]
+DEFAULT_TEMP_RANGE = (190, 230)
+
+
+def _clean_name(name: str) -> str:
+    """Strip the printer suffix ("@BBL X1C") and custom preset marker ("# ")."""
+    name = name.split("@", 1)[0]
+    if name.startswith("# "):
+        name = name[2:]
+    return name
+
+
+def parse_material(name: str) -> str:
+    upper = name.upper()
+    for material in MATERIALS:
+        if material in upper:
+            return material
+    return DEFAULT_MATERIAL
+
+
+def parse_brand(name: str) -> str:
+    """Brand as written in the preset name ("Devil Design PLA @H2D" -> "Devil Design")."""
+    start = _clean_name(name)
+    upper = start.upper()
+
+    for brand in KNOWN_BRANDS:
+        pos = upper.find(brand)
+        if pos >= 0:
+            return start[pos : pos + len(brand)]
+
+    # No known brand - take the words before the material ("eSun PLA+" -> "eSun")
+    for material in MATERIALS:
+        pos = upper.find(material)
+        if pos > 0:
+            brand = start[:pos].rstrip(" ")
+            if brand:
+                return brand
+    return ""
+
+
+def temp_range(material: str) -> tuple[int, int]:
+    for key, value in _TEMP_RANGES:
+        if key in material:
+            return value
+    return DEFAULT_TEMP_RANGE
+
+
+def is_user_preset(setting_id: str) -> bool:
+    return not (setting_id.startswith("GF") or setting_id.startswith("P1"))
+
+
+def _pad(value: str, size: int) -> bytes:
+    """Encode to at most size - 1 bytes without splitting a character."""
+    data = value.encode("utf-8")[: size - 1]
+    return data.decode("utf-8", "ignore").encode("utf-8")
+
+
+def build_feed(presets: list[SlicerPreset], limit: int | None = None) -> bytes:
+    """Pack filament presets into the compact feed."""
+    seen = set()
+    entries = []
+    for preset in presets:
+        setting_id = preset.setting_id
+        if not setting_id or setting_id in seen or len(setting_id.encode()) >= 32:
+            continue
+        seen.add(setting_id)
+        entries.append(preset)
+
+    entries.sort(key=lambda p: (not p.is_custom, p.name.casefold(), p.setting_id))
+    if limit is not None:
+        entries = entries[:limit]
+
+    brand_ids: dict[str, int] = {}  # casefolded brand -> index
+    brand_names: list[str] = []  # as first seen
+    material_ids = {m: i for i, m in enumerate(MATERIALS)}
+    records = bytearray()
+
+    for preset in entries:
+        material = parse_material(preset.name)
+        brand = _pad(parse_brand(preset.name), BRAND_SIZE).decode("utf-8")
+        brand_id = NO_BRAND
+        if brand:
+            key = brand.casefold()
+            if key not in brand_ids and len(brand_names) < NO_BRAND:
+                brand_ids[key] = len(brand_names)
+                brand_names.append(brand)
+            brand_id = brand_ids.get(key, NO_BRAND)
+
+        t_min, t_max = temp_range(material)
+        flags = (FLAG_CUSTOM if preset.is_custom else 0) | (FLAG_USER if is_user_preset(preset.setting_id) else 0)
+        records += RECORD.pack(
+            preset.setting_id.encode("utf-8"),
+            _pad(preset.name, 64),
+            brand_id,
+            material_ids[material],
+            flags,
+            0,
+            t_min,
+            t_max,
+        )
+
+    header = HEADER.pack(FEED_MAGIC, FEED_FORMAT, len(brand_names), len(MATERIALS), 0, len(entries), RECORD_SIZE)
+    brand_table = b"".join(struct.pack(f"{BRAND_SIZE}s", b.encode("utf-8")) for b in brand_names)
+    material_table = b"".join(struct.pack(f"{MATERIAL_SIZE}s", m.encode()) for m in MATERIALS)
+    return header + brand_table + material_table + bytes(records)
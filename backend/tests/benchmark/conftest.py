@@ -0,0 +1,32 @@
+"""Benchmark suite configuration.
+
+Requires pytest-benchmark; skipped without it. Fleet size and traffic can be
+scaled through the environment, e.g.:
+
+    SPOOLBUDDY_BENCH_PRINTERS=50 SPOOLBUDDY_BENCH_RATE=5 pytest tests/benchmark
+"""
+
+import os
+from dataclasses import dataclass
+
+import pytest
+
+pytest.importorskip("pytest_benchmark")
+
+
+@dataclass
+class FleetConfig:
+    printers: int  # Virtual printers on the broker
+    rate: float  # Reports per second per printer
+    duration: float  # Seconds of traffic
+    websocket_clients: int  # Fake WebSocket clients receiving broadcasts
+
+
+@pytest.fixture
+def fleet_config() -> FleetConfig:
+    return FleetConfig(
+        printers=int(os.environ.get("SPOOLBUDDY_BENCH_PRINTERS", "20")),
+        rate=float(os.environ.get("SPOOLBUDDY_BENCH_RATE", "2")),
+        duration=float(os.environ.get("SPOOLBUDDY_BENCH_SECONDS", "3")),
+        websocket_clients=int(os.environ.get("SPOOLBUDDY_BENCH_WS_CLIENTS", "5")),
+    )
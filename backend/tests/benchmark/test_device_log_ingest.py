@@ -0,0 +1,90 @@
+"""
+Device log ingestion throughput.
+
+The target is 50k lines/sec, i.e. at most 20 µs per line:
+- parse + store: LogStore.append with a realistic mix of line formats
+- receive: DeviceLogReceiver.drain over real loopback UDP datagrams
+- query: a filtered tail over a full store stays cheap while ingesting
+"""
+
+import socket
+
+import pytest
+from services import device_logs
+from services.device_logs import LogStore
+
+TARGET_LINES_PER_SEC = 50_000
+
+_LINES = [
+    "I (123456) spoolbuddy::backend_client: Received decoded tag data from backend",
+    "\x1b[0;33mW (123460) spoolbuddy::scale_manager: Scale reading unstable: 1012.4g\x1b[0m",
+    "[INFO] UDP logger initialized",
+    "E (123470) spoolbuddy::nfc_bridge_manager: NFC scan error: I2C timeout",
+    "D (123480) wifi: rssi=-61 channel=6",
+    "plain line without a level",
+]
+
+
+def _lines(count: int) -> list[str]:
+    return [_LINES[i % len(_LINES)] for i in range(count)]
+
+
+def test_parse_and_store_throughput(benchmark):
+    store = LogStore()
+    batch = _lines(512)
+    batches = 100
+
+    def run():
+        for _ in range(batches):
+            store.append("192.168.1.50", batch)
+
+    benchmark(run)
+    lines_per_sec = batches * len(batch) / benchmark.stats.stats.median
+    benchmark.extra_info["lines_per_sec"] = round(lines_per_sec)
+    assert lines_per_sec >= TARGET_LINES_PER_SEC
+
+
+@pytest.fixture
+def udp_pair():
+    receiver = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    receiver.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4 * 1024 * 1024)
+    receiver.bind(("127.0.0.1", 0))
+    sender = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    yield receiver, sender
+    receiver.close()
+    sender.close()
+
+
+def test_udp_drain_throughput(benchmark, udp_pair):
+    receiver_sock, sender = udp_pair
+    store = LogStore()
+    receiver = device_logs.DeviceLogReceiver(store, receiver_sock, echo=False)
+    address = receiver_sock.getsockname()
+    # Small enough to sit in the default socket buffer without loss
+    datagrams = [line.encode() for line in _lines(128)]
+    received = []
+
+    def fill():
+        for data in datagrams:
+            sender.sendto(data, address)
+
+    def drain():
+        received.append(receiver.drain())
+
+    benchmark.pedantic(drain, setup=fill, rounds=100)
+
+    assert set(received) == {len(datagrams)}
+    lines_per_sec = len(datagrams) / benchmark.stats.stats.median
+    benchmark.extra_info["lines_per_sec"] = round(lines_per_sec)
+    assert lines_per_sec >= TARGET_LINES_PER_SEC
+
+
+def test_filtered_tail_on_full_store(benchmark):
+    store = LogStore()
+    for i in range(0, store.capacity, 500):
+        store.append(f"192.168.1.{50 + i % 3}", _lines(500))
+
+    result = benchmark(store.tail, 200, device="192.168.1.51", level="W")
+
+    assert result and all(e.level in "EW" for e in result)
+    assert benchmark.stats.stats.median < 0.01
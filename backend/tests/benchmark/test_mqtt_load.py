@@ -0,0 +1,200 @@
+"""
+MQTT load benchmarks against the fake Bambu fleet.
+
+- Per-message CPU cost of PrinterConnection message handling, by report type
+- Event-loop lag and CPU time per message with a fleet pushing reports
+- WebSocket fan-out latency: printer publish -> every client's send_text
+
+Fleet results are attached to the benchmark JSON as extra_info
+(pytest --benchmark-json=out.json) and printed with -s.
+"""
+
+import asyncio
+import json
+import shutil
+import statistics
+import time
+from types import SimpleNamespace
+from unittest.mock import AsyncMock, patch
+
+import pytest
+from mqtt.client import PrinterConnection, PrinterManager
+from usage_tracker import UsageTracker
+
+from tests.fakes.bambu import FakeBambuBroker, VirtualPrinter
+
+# The fake broker generates its TLS certificate with the openssl CLI
+requires_openssl = pytest.mark.skipif(shutil.which("openssl") is None, reason="openssl not installed")
+
+
+def _percentile(values: list[float], pct: float) -> float:
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * pct / 100))]
+
+
+def _summary(values: list[float]) -> dict:
+    """Millisecond summary of a list of seconds."""
+    return {
+        "count": len(values),
+        "p50_ms": round(_percentile(values, 50) * 1000, 3),
+        "p99_ms": round(_percentile(values, 99) * 1000, 3),
+        "max_ms": round(max(values, default=0.0) * 1000, 3),
+        "mean_ms": round(statistics.fmean(values) * 1000, 3) if values else 0.0,
+    }
+
+
+class FakeWebSocket:
+    """Records when each printer report reached this client."""
+
+    def __init__(self, sent_at: dict, latencies: list):
+        self._sent_at = sent_at
+        self._latencies = latencies
+        self._seen: set = set()
+
+    async def send_text(self, text: str):
+        received = time.monotonic()
+        message = json.loads(text)
+        if message.get("type") != "printer_state":
+            return
+        # Reports without layer_num (AMS) rebroadcast the previous layer - count each layer once
+        key = (message["serial"], message["state"].get("layer_num"))
+        sent = self._sent_at.get(key)
+        if sent is not None and key not in self._seen:
+            self._seen.add(key)
+            self._latencies.append(received - sent)
+
+
+async def _lag_probe(samples: list[float], stop: asyncio.Event, interval: float = 0.01):
+    """Measure how late the event loop wakes a sleeper."""
+    while not stop.is_set():
+        start = time.monotonic()
+        await asyncio.sleep(interval)
+        samples.append(max(0.0, time.monotonic() - start - interval))
+
+
+async def _run_fleet(config, websocket_clients: int = 0) -> dict:
+    """Connect the backend's state pipeline to a virtual fleet and run traffic."""
+    import main
+
+    broker = FakeBambuBroker()
+    printers = [broker.add_printer(VirtualPrinter(f"01S00C{i:09d}")) for i in range(config.printers)]
+    await broker.start()
+
+    sent_at: dict = {}
+    latencies: list[float] = []
+
+    def on_report(serial, report, published):
+        layer = report["print"].get("layer_num")
+        if layer is not None:
+            sent_at[(serial, layer)] = published
+
+    broker.on_report = on_report
+
+    state_updates = 0
+
+    def on_state(serial, state):
+        nonlocal state_updates
+        state_updates += 1
+        main.on_printer_state_update(serial, state)
+
+    clients = {FakeWebSocket(sent_at, latencies) for _ in range(websocket_clients)}
+    manager = PrinterManager()
+    manager.set_state_callback(on_state)
+
+    with (
+        patch.object(main, "websocket_clients", clients),
+        patch.object(main, "usage_tracker", UsageTracker()),
+        patch.object(main, "_record_ams_sensors", AsyncMock()),
+        patch.object(main, "_previous_states", {}),
+    ):
+        try:
+            connect_start = time.monotonic()
+            for printer in printers:
+                await manager.connect(printer.serial, "127.0.0.1", printer.access_code, port=broker.port)
+            await broker.wait_subscribed()
+            connect_time = time.monotonic() - connect_start
+            await asyncio.sleep(0.5)  # Let connect-time pushall/calibration traffic settle
+
+            # Measure steady-state traffic only, not the connect-time pushall/calibration burst
+            sent_at.clear()
+            latencies.clear()
+            lag: list[float] = []
+            stop = asyncio.Event()
+            probe = asyncio.create_task(_lag_probe(lag, stop))
+            reports_before, updates_before = broker.reports_sent, state_updates
+            cpu_start = time.process_time()
+
+            await broker.run_traffic(config.rate, config.duration)
+            await asyncio.sleep(0.2)  # Drain in-flight messages
+
+            cpu = time.process_time() - cpu_start
+            stop.set()
+            await probe
+            reports = broker.reports_sent - reports_before
+            updates = state_updates - updates_before
+        finally:
+            # Each paho loop_stop() waits out its network loop; stop them in parallel
+            connections = list(manager._connections.values())
+            await asyncio.gather(*(asyncio.to_thread(conn.disconnect) for conn in connections))
+            await broker.stop()
+
+    return {
+        "printers": config.printers,
+        "rate_per_printer": config.rate,
+        "reports": reports,
+        "state_updates": updates,
+        "connect_s": round(connect_time, 2),
+        # Process CPU includes the broker thread, so this is an upper bound for the backend
+        "cpu_us_per_message": round(cpu / max(reports, 1) * 1e6, 1),
+        "loop_lag": _summary(lag),
+        "ws_clients": websocket_clients,
+        "ws_fanout": _summary(latencies),
+    }
+
+
+@pytest.fixture
+def connection() -> PrinterConnection:
+    conn = PrinterConnection(serial="01S00C000000001", ip_address="127.0.0.1", access_code="12345678")
+    conn._on_state_update = lambda serial, state: None
+    return conn
+
+
+@pytest.mark.parametrize("report", ["pushall", "progress", "ams", "calibration"])
+def test_message_cpu_time(benchmark, connection, report):
+    """CPU time to decode and apply one report (PrinterConnection._on_message)."""
+    printer = VirtualPrinter(connection.serial)
+    payload = {
+        "pushall": printer.pushall_report,
+        "progress": printer.progress_report,
+        "ams": printer.ams_report,
+        "calibration": lambda: printer.calibration_report("0.4"),
+    }[report]()
+    message = SimpleNamespace(payload=json.dumps(payload).encode())
+    benchmark.extra_info["payload_bytes"] = len(message.payload)
+
+    benchmark(connection._on_message, None, None, message)
+
+
+@requires_openssl
+def test_fleet_event_loop_lag(benchmark, fleet_config):
+    """Event-loop lag and CPU per message while the fleet pushes reports."""
+    results = benchmark.pedantic(lambda: asyncio.run(_run_fleet(fleet_config)), rounds=1, iterations=1)
+    benchmark.extra_info.update(results)
+    print(f"\nfleet: {json.dumps(results)}")
+
+    assert results["reports"] > 0
+    assert results["state_updates"] >= results["reports"] * 0.9
+
+
+@requires_openssl
+def test_websocket_fanout_latency(benchmark, fleet_config):
+    """Latency from a printer publishing a report to every WebSocket client receiving the state."""
+    results = benchmark.pedantic(
+        lambda: asyncio.run(_run_fleet(fleet_config, fleet_config.websocket_clients)), rounds=1, iterations=1
+    )
+    benchmark.extra_info.update(results)
+    print(f"\nfan-out: {json.dumps(results)}")
+
+    assert results["ws_fanout"]["count"] > 0
@@ -0,0 +1,90 @@
+"""
+Spool list fetches at inventory scale.
+
+With many spools (default 10k, SPOOLBUDDY_BENCH_SPOOLS to change) a client
+that already has the list must not download it again:
+- If-None-Match: 304 without a body while nothing changed
+- ?since=: only the changed rows, a fraction of the full list's bytes
+
+Response sizes are attached to the benchmark JSON as extra_info.
+"""
+
+import asyncio
+import os
+import uuid
+from unittest.mock import patch
+
+import pytest
+from db.database import Database
+from httpx import ASGITransport, AsyncClient
+
+SPOOLS = int(os.environ.get("SPOOLBUDDY_BENCH_SPOOLS", "10000"))
+CHANGED = 10
+
+
+@pytest.fixture(scope="module")
+def spool_api(tmp_path_factory):
+    from main import app
+
+    loop = asyncio.new_event_loop()
+    db = Database(tmp_path_factory.mktemp("spools") / "spools.db")
+    loop.run_until_complete(db.connect())
+
+    rows = [
+        (str(uuid.uuid4()), i + 1, "PLA", "Basic", f"Color {i}", "#112233FF", "Bambu Lab", 1000, 250, 800)
+        for i in range(SPOOLS)
+    ]
+    loop.run_until_complete(
+        db.conn.executemany(
+            """INSERT INTO spools (id, spool_number, material, subtype, color_name, rgba, brand,
+               label_weight, core_weight, weight_current) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)""",
+            rows,
+        )
+    )
+    loop.run_until_complete(db.conn.commit())
+
+    async def get_test_db():
+        return db
+
+    client = AsyncClient(transport=ASGITransport(app=app), base_url="http://test")
+    with patch("api.spools.get_db", get_test_db):
+        yield loop, db, client, [row[0] for row in rows]
+
+    loop.run_until_complete(client.aclose())
+    loop.run_until_complete(db.disconnect())
+    loop.close()
+
+
+def test_full_list(benchmark, spool_api):
+    loop, _, client, _ = spool_api
+
+    response = benchmark(lambda: loop.run_until_complete(client.get("/api/spools")))
+
+    assert len(response.json()) == SPOOLS
+    benchmark.extra_info["bytes"] = len(response.content)
+
+
+def test_not_modified(benchmark, spool_api):
+    loop, _, client, _ = spool_api
+    etag = loop.run_until_complete(client.get("/api/spools")).headers["etag"]
+
+    response = benchmark(lambda: loop.run_until_complete(client.get("/api/spools", headers={"If-None-Match": etag})))
+
+    assert response.status_code == 304
+    benchmark.extra_info["bytes"] = len(response.content)
+
+
+def test_incremental_fetch(benchmark, spool_api):
+    loop, db, client, spool_ids = spool_api
+    full = loop.run_until_complete(client.get("/api/spools"))
+    since = int(full.headers["etag"].strip('"'))
+    for spool_id in spool_ids[:CHANGED]:
+        loop.run_until_complete(db.set_spool_weight(spool_id, 500))
+
+    response = benchmark(lambda: loop.run_until_complete(client.get("/api/spools", params={"since": since})))
+
+    assert len(response.json()["spools"]) == CHANGED
+    benchmark.extra_info["bytes"] = len(response.content)
+    benchmark.extra_info["full_bytes"] = len(full.content)
+    # About the changed rows' share of the full list
+    assert len(response.content) < len(full.content) * 2 * CHANGED / SPOOLS
@@ -0,0 +1,136 @@
+"""
+Usage history at dashboard scale.
+
+Years of history (default a million rows, SPOOLBUDDY_BENCH_USAGE_ROWS to
+change) must not slow down the views that read it:
+- history pages: keyset pages deep in the history cost the same as the first
+- daily charts and totals: read from the daily aggregates, not the raw rows
+"""
+
+import asyncio
+import os
+import time
+
+import pytest
+from db.database import Database
+
+ROWS = int(os.environ.get("SPOOLBUDDY_BENCH_USAGE_ROWS", "1000000"))
+SPOOLS = 200
+PRINTERS = 10
+YEARS = 5
+
+
+@pytest.fixture(scope="module")
+def usage_db(tmp_path_factory):
+    loop = asyncio.new_event_loop()
+    db = Database(tmp_path_factory.mktemp("usage") / "usage.db")
+    loop.run_until_complete(db.connect())
+
+    # Spread over YEARS, oldest first; the triggers build the aggregates
+    now = int(time.time())
+    step = YEARS * 365 * 86400 // ROWS
+    start = time.perf_counter()
+    loop.run_until_complete(
+        db.conn.execute(
+            """WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i + 1 < ?)
+               INSERT INTO usage_history (spool_id, printer_serial, print_name, weight_used, timestamp)
+               SELECT 'spool-' || (i % ?), 'printer-' || (i % ?), 'print' || i || '.gcode', 12.5, ? - (? - i) * ?
+               FROM n""",
+            (ROWS, SPOOLS, PRINTERS, now, ROWS, step),
+        )
+    )
+    loop.run_until_complete(db.conn.commit())
+    print(f"\n{ROWS} usage rows generated in {time.perf_counter() - start:.1f} s")
+
+    yield loop, db
+
+    loop.run_until_complete(db.disconnect())
+    loop.close()
+
+
+def _cursor_at(loop, db, depth: float, spool_id: str | None = None) -> tuple[int, int]:
+    """(timestamp, id) of the row at `depth` (0 = newest, 1 = oldest)."""
+    where = "WHERE spool_id = ?" if spool_id else ""
+    params = (spool_id,) if spool_id else ()
+    total = ROWS // SPOOLS if spool_id else ROWS
+
+    async def query():
+        async with db.conn.execute(
+            f"SELECT timestamp, id FROM usage_history {where} ORDER BY timestamp DESC, id DESC LIMIT 1 OFFSET ?",
+            (*params, int(total * depth)),
+        ) as cursor:
+            row = await cursor.fetchone()
+            return row["timestamp"], row["id"]
+
+    return loop.run_until_complete(query())
+
+
+def _median(fn, rounds: int = 20) -> float:
+    samples = []
+    for _ in range(rounds):
+        start = time.perf_counter()
+        fn()
+        samples.append(time.perf_counter() - start)
+    return sorted(samples)[len(samples) // 2]
+
+
+def test_history_deep_page(benchmark, usage_db):
+    loop, db = usage_db
+    before = _cursor_at(loop, db, 0.9)
+
+    first = _median(lambda: loop.run_until_complete(db.get_usage_history(limit=100)))
+    rows = benchmark(lambda: loop.run_until_complete(db.get_usage_history(limit=100, before=before)))
+
+    assert len(rows) == 100
+    assert (rows[0]["timestamp"], rows[0]["id"]) < before
+    deep = benchmark.stats.stats.median
+    benchmark.extra_info["first_page_ms"] = round(first * 1000, 2)
+    benchmark.extra_info["deep_page_ms"] = round(deep * 1000, 2)
+    assert deep < max(first * 3, 0.005)
+
+
+def test_spool_history_deep_page(benchmark, usage_db):
+    loop, db = usage_db
+    before = _cursor_at(loop, db, 0.9, "spool-7")
+
+    first = _median(lambda: loop.run_until_complete(db.get_usage_history("spool-7", limit=50)))
+    rows = benchmark(lambda: loop.run_until_complete(db.get_usage_history("spool-7", limit=50, before=before)))
+
+    assert len(rows) == 50
+    assert {row["spool_id"] for row in rows} == {"spool-7"}
+    deep = benchmark.stats.stats.median
+    benchmark.extra_info["first_page_ms"] = round(first * 1000, 2)
+    benchmark.extra_info["deep_page_ms"] = round(deep * 1000, 2)
+    assert deep < max(first * 3, 0.005)
+
+
+def test_spool_dashboard(benchmark, usage_db):
+    loop, db = usage_db
+
+    async def dashboard():
+        return await db.get_usage_totals("spool-7"), await db.get_usage_daily(spool_id="spool-7", days=YEARS * 366)
+
+    async def raw_totals():
+        async with db.conn.execute(
+            "SELECT COUNT(*), SUM(weight_used) FROM usage_history WHERE spool_id = ?", ("spool-7",)
+        ) as cursor:
+            return await cursor.fetchone()
+
+    raw = _median(lambda: loop.run_until_complete(raw_totals()), rounds=5)
+    totals, days = benchmark(lambda: loop.run_until_complete(dashboard()))
+
+    assert totals["prints"] == loop.run_until_complete(raw_totals())[0]
+    assert sum(d["prints"] for d in days) == totals["prints"]
+    benchmark.extra_info["raw_scan_ms"] = round(raw * 1000, 2)
+    benchmark.extra_info["aggregate_ms"] = round(benchmark.stats.stats.median * 1000, 2)
+    # Bounded by days of history, not by prints
+    assert benchmark.stats.stats.median < 0.05
+
+
+def test_printer_daily_chart(benchmark, usage_db):
+    loop, db = usage_db
+
+    days = benchmark(lambda: loop.run_until_complete(db.get_usage_daily(printer_serial="printer-3", days=365)))
+
+    assert 360 <= len(days) <= 366
+    assert benchmark.stats.stats.median < 0.02
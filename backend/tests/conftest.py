@@ -65,6 +65,7 @@ def mock_printer_manager():
     manager.set_k_value = MagicMock(return_value=True)
     manager.reset_slot = MagicMock(return_value=True)
     manager.get_kprofiles = AsyncMock(return_value=[])
+    manager.has_kprofiles = MagicMock(return_value=False)
     manager.get_nozzle_diameter = MagicMock(return_value="0.4")
     manager.stage_assignment = MagicMock(return_value=True)
     manager.cancel_assignment = MagicMock(return_value=True)
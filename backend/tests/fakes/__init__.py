@@ -0,0 +1 @@
+"""Test doubles for external systems (printers, brokers)."""
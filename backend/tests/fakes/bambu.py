@@ -0,0 +1,560 @@
+"""
+Fake Bambu printer fleet behind an in-process TLS MQTT broker.
+
+Bambu printers run their own MQTT broker on port 8883 (TLS, self-signed
+certificate, user "bblp", password = LAN access code). FakeBambuBroker
+stands in for any number of them on one localhost port, so the real
+PrinterConnection/PrinterManager code (paho-mqtt, TLS, threads) can be
+driven without hardware:
+
+    broker = FakeBambuBroker()
+    broker.add_printer(VirtualPrinter("00M09A000000001"))
+    await broker.start()
+    await manager.connect(serial, "127.0.0.1", printer.access_code, port=broker.port)
+    await broker.run_traffic(rate=2.0, duration=5.0)
+
+The broker runs its own event loop on a background thread: paho's connect()
+does the TLS handshake synchronously on the caller's thread, which in the
+backend is the main event loop.
+
+Only what paho and the printers use is implemented: MQTT 3.1.1 CONNECT,
+SUBSCRIBE, QoS 0 PUBLISH, PINGREQ and DISCONNECT. Each VirtualPrinter
+answers pushall, extrusion_cali_get and ams_filament_setting requests and
+emits scripted report traffic (full status, print progress, AMS changes).
+"""
+
+import asyncio
+import json
+import random
+import ssl
+import struct
+import subprocess
+import tempfile
+import threading
+import time
+from collections.abc import Callable
+from dataclasses import dataclass, field
+from pathlib import Path
+
+# MQTT control packet types
+CONNECT = 1
+CONNACK = 2
+PUBLISH = 3
+SUBSCRIBE = 8
+SUBACK = 9
+PINGREQ = 12
+PINGRESP = 13
+DISCONNECT = 14
+
+CONNACK_ACCEPTED = 0
+CONNACK_NOT_AUTHORIZED = 5
+
+FILAMENTS = [
+    # (tray_type, tray_sub_brands, tray_info_idx, tray_color, nozzle_temp_min, nozzle_temp_max)
+    ("PLA", "PLA Basic", "GFA00", "FF6A13FF", 190, 230),
+    ("PLA", "PLA Matte", "GFA01", "000000FF", 190, 230),
+    ("PETG", "PETG HF", "GFG02", "0086D6FF", 230, 270),
+    ("ABS", "ABS", "GFB00", "FFFFFFFF", 240, 270),
+    ("PLA", "PLA Silk", "GFA05", "C0C0C0FF", 190, 230),
+    ("TPU", "TPU 95A", "GFU01", "F72323FF", 200, 250),
+]
+
+
+# ============================================================================
+# Virtual printer
+# ============================================================================
+
+
+@dataclass
+class VirtualPrinter:
+    """Scripted Bambu printer: answers requests and generates report traffic."""
+
+    serial: str
+    access_code: str = "12345678"
+    ams_count: int = 2
+    nozzle_diameter: str = "0.4"
+    kprofile_count: int = 12
+    seed: int = 0
+
+    sequence: int = 0  # Bumped for every report; sent as layer_num so deliveries can be matched
+    progress: int = 0
+    _rng: random.Random = field(init=False, repr=False)
+    _humidity: list[int] = field(init=False, repr=False)
+    _remain: list[list[int]] = field(init=False, repr=False)
+
+    def __post_init__(self):
+        self._rng = random.Random(self.seed or self.serial)
+        self._humidity = [self._rng.randint(15, 45) for _ in range(self.ams_count)]
+        self._remain = [[self._rng.randint(5, 100) for _ in range(4)] for _ in range(self.ams_count)]
+
+    # --- Report payloads ---
+
+    def _next_sequence(self) -> int:
+        self.sequence += 1
+        return self.sequence
+
+    def _tray(self, ams_id: int, tray_id: int) -> dict:
+        tray_type, sub_brand, info_idx, color, t_min, t_max = FILAMENTS[(ams_id * 4 + tray_id) % len(FILAMENTS)]
+        return {
+            "id": str(tray_id),
+            "remain": self._remain[ams_id][tray_id],
+            "k": 0.02,
+            "n": 1,
+            "cali_idx": -1,
+            "tag_uid": f"{self.serial[-4:]}{ams_id}{tray_id}00000000",
+            "tray_id_name": f"A{ams_id:02d}-{tray_id}",
+            "tray_info_idx": info_idx,
+            "tray_type": tray_type,
+            "tray_sub_brands": sub_brand,
+            "tray_color": color,
+            "tray_weight": "1000",
+            "tray_diameter": "1.75",
+            "tray_temp": "55",
+            "tray_time": "8",
+            "bed_temp_type": "1",
+            "bed_temp": "35",
+            "nozzle_temp_max": str(t_max),
+            "nozzle_temp_min": str(t_min),
+            "xcam_info": "000000000000000000000000",
+            "tray_uuid": f"{ams_id:02d}{tray_id:02d}" + "0" * 28,
+            "ctype": 0,
+            "cols": [color],
+        }
+
+    def _ams(self) -> dict:
+        return {
+            "ams": [
+                {
+                    "id": str(ams_id),
+                    "humidity": str(max(1, 5 - self._humidity[ams_id] // 10)),
+                    "humidity_raw": str(self._humidity[ams_id]),
+                    "temp": "24.5",
+                    "info": "1001",
+                    "tray": [self._tray(ams_id, tray_id) for tray_id in range(4)],
+                }
+                for ams_id in range(self.ams_count)
+            ],
+            "ams_exist_bits": f"{(1 << self.ams_count) - 1:x}",
+            "tray_exist_bits": f"{(1 << (4 * self.ams_count)) - 1:x}",
+            "tray_is_bbl_bits": f"{(1 << (4 * self.ams_count)) - 1:x}",
+            "tray_tar": "255",
+            "tray_now": "1",
+            "tray_pre": "255",
+            "tray_read_done_bits": f"{(1 << (4 * self.ams_count)) - 1:x}",
+            "tray_reading_bits": "0",
+            "version": 4,
+            "insert_flag": True,
+            "power_on_flag": False,
+        }
+
+    def pushall_report(self) -> dict:
+        """Full status, as sent in response to pushall and periodically by the printer."""
+        seq = self._next_sequence()
+        return {
+            "print": {
+                "command": "push_status",
+                "msg": 0,
+                "sequence_id": str(seq),
+                "nozzle_diameter": self.nozzle_diameter,
+                "nozzle_type": "hardened_steel",
+                "nozzle_temper": 219.8,
+                "nozzle_target_temper": 220,
+                "bed_temper": 55.1,
+                "bed_target_temper": 55,
+                "chamber_temper": 31,
+                "mc_print_stage": "2",
+                "mc_percent": self.progress,
+                "mc_remaining_time": max(0, 100 - self.progress) * 2,
+                "mc_print_line_number": str(seq * 1000),
+                "gcode_state": "RUNNING",
+                "gcode_file": "/data/Metadata/plate_1.gcode",
+                "gcode_file_prepare_percent": "100",
+                "subtask_name": "benchy",
+                "stg": [2, 14, 1],
+                "stg_cur": 0,
+                "print_type": "local",
+                "layer_num": seq,
+                "total_layer_num": 1_000_000,
+                "spd_lvl": 2,
+                "spd_mag": 100,
+                "cooling_fan_speed": "15",
+                "big_fan1_speed": "0",
+                "big_fan2_speed": "0",
+                "heatbreak_fan_speed": "15",
+                "wifi_signal": "-42dBm",
+                "home_flag": 6296472,
+                "hw_switch_state": 1,
+                "sdcard": True,
+                "print_error": 0,
+                "hms": [],
+                "lights_report": [{"node": "chamber_light", "mode": "on"}],
+                "upgrade_state": {"status": "IDLE", "progress": "", "new_version_state": 2},
+                "ipcam": {"ipcam_dev": "1", "ipcam_record": "enable", "timelapse": "disable", "resolution": "1080p"},
+                "online": {"ahb": False, "rfid": False, "version": 7},
+                "ams": self._ams(),
+                "vt_tray": {
+                    "id": "254",
+                    "tray_type": "",
+                    "tray_color": "00000000",
+                    "nozzle_temp_max": "0",
+                    "nozzle_temp_min": "0",
+                    "remain": 0,
+                    "k": 0.02,
+                    "cali_idx": -1,
+                },
+            }
+        }
+
+    def progress_report(self) -> dict:
+        """Incremental print progress push (the most frequent message while printing)."""
+        seq = self._next_sequence()
+        if seq % 10 == 0:
+            self.progress = (self.progress + 1) % 100
+        return {
+            "print": {
+                "command": "push_status",
+                "msg": 1,
+                "sequence_id": str(seq),
+                "nozzle_temper": 219.5 + self._rng.random(),
+                "bed_temper": 55.0 + self._rng.random() / 2,
+                "mc_percent": self.progress,
+                "mc_remaining_time": max(0, 100 - self.progress) * 2,
+                "mc_print_line_number": str(seq * 1000),
+                "layer_num": seq,
+                "wifi_signal": "-42dBm",
+            }
+        }
+
+    def ams_report(self) -> dict:
+        """AMS change push: humidity drift and filament consumption."""
+        seq = self._next_sequence()
+        ams_id = self._rng.randrange(self.ams_count)
+        self._humidity[ams_id] = min(80, max(5, self._humidity[ams_id] + self._rng.choice((-1, 1))))
+        tray_id = self._rng.randrange(4)
+        self._remain[ams_id][tray_id] = max(0, self._remain[ams_id][tray_id] - 1)
+        return {"print": {"command": "push_status", "msg": 1, "sequence_id": str(seq), "ams": self._ams()}}
+
+    def calibration_report(self, nozzle_diameter: str) -> dict:
+        """extrusion_cali_get response with this printer's K-profiles."""
+        seq = self._next_sequence()
+        filaments = []
+        for i in range(self.kprofile_count):
+            tray_type, sub_brand, info_idx, _, _, _ = FILAMENTS[i % len(FILAMENTS)]
+            filaments.append(
+                {
+                    "cali_idx": i + 1,
+                    "filament_id": info_idx,
+                    "setting_id": f"{info_idx}S{i:02d}",
+                    "name": f"Bambu {sub_brand} {i}",
+                    "k_value": f"{0.015 + i * 0.001:.3f}",
+                    "n_coef": "1.399999",
+                    "extruder_id": 0,
+                    "nozzle_id": f"HS00-{nozzle_diameter}",
+                }
+            )
+        return {
+            "print": {
+                "command": "extrusion_cali_get",
+                "sequence_id": str(seq),
+                "nozzle_diameter": nozzle_diameter,
+                "filament_id": "",
+                "filaments": filaments,
+                "reason": "success",
+                "result": "success",
+            }
+        }
+
+    def next_report(self) -> dict:
+        """Scripted traffic mix: mostly progress, some AMS changes, a periodic full push."""
+        if self.sequence % 20 == 0:
+            return self.pushall_report()
+        if self.sequence % 5 == 0:
+            return self.ams_report()
+        return self.progress_report()
+
+    def handle_request(self, payload: dict) -> list[dict]:
+        """Reports sent back for a request published to device/<serial>/request."""
+        if payload.get("pushing", {}).get("command") == "pushall":
+            return [self.pushall_report()]
+
+        request = payload.get("print", {})
+        command = request.get("command")
+        if command == "extrusion_cali_get":
+            return [self.calibration_report(str(request.get("nozzle_diameter", self.nozzle_diameter)))]
+        if command == "ams_filament_setting":
+            return [
+                {
+                    "print": {
+                        **request,
+                        "sequence_id": str(self._next_sequence()),
+                        "reason": "success",
+                        "result": "success",
+                    }
+                }
+            ]
+        return []
+
+
+# ============================================================================
+# Broker
+# ============================================================================
+
+
+def _encode_length(length: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = length % 128
+        length //= 128
+        if length:
+            byte |= 0x80
+        out.append(byte)
+        if not length:
+            return bytes(out)
+
+
+def _encode_string(value: str) -> bytes:
+    data = value.encode()
+    return struct.pack("!H", len(data)) + data
+
+
+def _packet(packet_type: int, flags: int, body: bytes) -> bytes:
+    return bytes([(packet_type << 4) | flags]) + _encode_length(len(body)) + body
+
+
+def encode_publish(topic: str, payload: bytes) -> bytes:
+    """QoS 0 PUBLISH packet."""
+    return _packet(PUBLISH, 0, _encode_string(topic) + payload)
+
+
+def _read_string(data: bytes, pos: int) -> tuple[str, int]:
+    (length,) = struct.unpack_from("!H", data, pos)
+    pos += 2
+    return data[pos : pos + length].decode(), pos + length
+
+
+def self_signed_certificate(directory: Path) -> tuple[Path, Path]:
+    """Generate a throwaway certificate and key with the openssl CLI."""
+    cert, key = directory / "broker.crt", directory / "broker.key"
+    subprocess.run(
+        [
+            "openssl",
+            "req",
+            "-x509",
+            "-newkey",
+            "rsa:2048",
+            "-nodes",
+            "-days",
+            "1",
+            "-subj",
+            "/CN=fake-bambu-printer",
+            "-keyout",
+            str(key),
+            "-out",
+            str(cert),
+        ],
+        check=True,
+        capture_output=True,
+    )
+    return cert, key
+
+
+@dataclass
+class _Session:
+    client_id: str
+    writer: asyncio.StreamWriter
+    subscriptions: set[str] = field(default_factory=set)
+
+
+class FakeBambuBroker:
+    """In-process TLS MQTT broker serving a fleet of VirtualPrinters."""
+
+    def __init__(self, host: str = "127.0.0.1"):
+        self.host = host
+        self.port = 0
+        self.printers: dict[str, VirtualPrinter] = {}
+        self.reports_sent = 0
+        self.requests_received = 0
+        # Called as on_report(serial, report, monotonic publish time) for every report sent
+        self.on_report: Callable[[str, dict, float], None] | None = None
+        self._sessions: list[_Session] = []
+        self._server: asyncio.Server | None = None
+        self._tempdir: tempfile.TemporaryDirectory | None = None
+        self._loop: asyncio.AbstractEventLoop | None = None
+        self._thread: threading.Thread | None = None
+
+    def add_printer(self, printer: VirtualPrinter) -> VirtualPrinter:
+        self.printers[printer.serial] = printer
+        return printer
+
+    async def start(self):
+        """Listen on an ephemeral localhost port (self.port)."""
+        self._tempdir = tempfile.TemporaryDirectory()
+        cert, key = self_signed_certificate(Path(self._tempdir.name))
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(cert, key)
+
+        self._loop = asyncio.new_event_loop()
+        self._thread = threading.Thread(target=self._loop.run_forever, name="fake-bambu-broker", daemon=True)
+        self._thread.start()
+        await self._call(self._start_server(context))
+
+    async def stop(self):
+        if self._loop:
+            await self._call(self._stop_server())
+            self._loop.call_soon_threadsafe(self._loop.stop)
+            self._thread.join()
+            self._loop.close()
+            self._loop = None
+        if self._tempdir:
+            self._tempdir.cleanup()
+
+    async def _call(self, coro):
+        """Run a coroutine on the broker thread and wait for it from the caller's loop."""
+        return await asyncio.wrap_future(asyncio.run_coroutine_threadsafe(coro, self._loop))
+
+    async def _start_server(self, context: ssl.SSLContext):
+        self._server = await asyncio.start_server(self._serve, self.host, 0, ssl=context)
+        self.port = self._server.sockets[0].getsockname()[1]
+
+    async def _stop_server(self):
+        for session in list(self._sessions):
+            session.writer.close()
+        self._server.close()
+        await self._server.wait_closed()
+
+    def subscribed(self, serial: str) -> bool:
+        topic = f"device/{serial}/report"
+        return any(topic in s.subscriptions for s in self._sessions)
+
+    async def wait_subscribed(self, timeout: float = 10.0):
+        """Wait until every printer has a subscriber (i.e. every client finished connecting)."""
+        deadline = time.monotonic() + timeout
+        while not all(self.subscribed(serial) for serial in self.printers):
+            if time.monotonic() > deadline:
+                missing = [s for s in self.printers if not self.subscribed(s)]
+                raise TimeoutError(f"Printers never subscribed: {missing}")
+            await asyncio.sleep(0.01)
+
+    def publish_report(self, serial: str, report: dict):
+        """Send a report to every client subscribed to the printer's report topic (broker thread only)."""
+        topic = f"device/{serial}/report"
+        packet = encode_publish(topic, json.dumps(report).encode())
+        published = time.monotonic()
+        for session in self._sessions:
+            if topic in session.subscriptions:
+                session.writer.write(packet)
+                self.reports_sent += 1
+        if self.on_report:
+            self.on_report(serial, report, published)
+
+    async def run_traffic(self, rate: float, duration: float):
+        """Have every printer emit next_report() at `rate` messages/s for `duration` seconds."""
+        await self._call(self._run_traffic(rate, duration))
+
+    async def _run_traffic(self, rate: float, duration: float):
+        async def printer_traffic(printer: VirtualPrinter):
+            interval = 1.0 / rate
+            # Spread printers across the interval instead of bursting in lockstep
+            await asyncio.sleep(random.random() * interval)
+            next_time = time.monotonic()
+            end = next_time + duration
+            while next_time < end:
+                self.publish_report(printer.serial, printer.next_report())
+                next_time += interval
+                await asyncio.sleep(max(0.0, next_time - time.monotonic()))
+
+        await asyncio.gather(*(printer_traffic(p) for p in self.printers.values()))
+
+    # --- Connection handling ---
+
+    async def _serve(self, reader: asyncio.StreamReader, writer: asyncio.StreamWriter):
+        session: _Session | None = None
+        try:
+            while True:
+                header = await reader.readexactly(1)
+                length, multiplier = 0, 1
+                while True:
+                    byte = (await reader.readexactly(1))[0]
+                    length += (byte & 0x7F) * multiplier
+                    multiplier *= 128
+                    if not byte & 0x80:
+                        break
+                body = await reader.readexactly(length) if length else b""
+                packet_type = header[0] >> 4
+
+                if packet_type == CONNECT:
+                    session = self._handle_connect(body, writer)
+                    if session is None:
+                        break
+                elif session is None:
+                    break
+                elif packet_type == SUBSCRIBE:
+                    self._handle_subscribe(session, body)
+                elif packet_type == PUBLISH:
+                    self._handle_publish(header[0], body)
+                elif packet_type == PINGREQ:
+                    writer.write(_packet(PINGRESP, 0, b""))
+                elif packet_type == DISCONNECT:
+                    break
+                await writer.drain()
+        except (asyncio.IncompleteReadError, ConnectionError, ssl.SSLError):
+            pass
+        finally:
+            if session in self._sessions:
+                self._sessions.remove(session)
+            writer.close()
+
+    def _handle_connect(self, body: bytes, writer: asyncio.StreamWriter) -> _Session | None:
+        _, pos = _read_string(body, 0)  # protocol name
+        flags = body[pos + 1]
+        pos += 4  # level, flags, keepalive
+        client_id, pos = _read_string(body, pos)
+        if flags & 0x04:  # will topic + message
+            _, pos = _read_string(body, pos)
+            _, pos = _read_string(body, pos)
+        username = password = None
+        if flags & 0x80:
+            username, pos = _read_string(body, pos)
+        if flags & 0x40:
+            password, pos = _read_string(body, pos)
+
+        # PrinterConnection uses client id "spoolbuddy_<serial>"
+        printer = self.printers.get(client_id.removeprefix("spoolbuddy_"))
+        if username != "bblp" or printer is None or password != printer.access_code:
+            writer.write(_packet(CONNACK, 0, bytes([0, CONNACK_NOT_AUTHORIZED])))
+            return None
+
+        writer.write(_packet(CONNACK, 0, bytes([0, CONNACK_ACCEPTED])))
+        session = _Session(client_id=client_id, writer=writer)
+        self._sessions.append(session)
+        return session
+
+    def _handle_subscribe(self, session: _Session, body: bytes):
+        (packet_id,) = struct.unpack_from("!H", body, 0)
+        pos = 2
+        granted = bytearray()
+        while pos < len(body):
+            topic, pos = _read_string(body, pos)
+            pos += 1  # requested QoS
+            session.subscriptions.add(topic)
+            granted.append(0)
+        session.writer.write(_packet(SUBACK, 0, struct.pack("!H", packet_id) + bytes(granted)))
+
+    def _handle_publish(self, first_byte: int, body: bytes):
+        topic, pos = _read_string(body, 0)
+        if (first_byte >> 1) & 0x03:  # QoS > 0 carries a packet id (acks are not needed by paho for our use)
+            pos += 2
+        parts = topic.split("/")
+        if len(parts) != 3 or parts[0] != "device" or parts[2] != "request":
+            return
+        printer = self.printers.get(parts[1])
+        if printer is None:
+            return
+
+        self.requests_received += 1
+        try:
+            request = json.loads(body[pos:])
+        except ValueError:
+            return
+        for report in printer.handle_request(request):
+            self.publish_report(printer.serial, report)
@@ -164,6 +164,59 @@ class TestAmsCalibrationAPI:
         assert len(data) == 1
         assert data[0]["cali_idx"] == 42
 
+    async def test_get_calibrations_offline_serves_stored(
+        self, async_client, test_db, sample_printer_data, mock_printer_manager
+    ):
+        """Test stored K-profiles are served while the printer is not connected."""
+        await async_client.post("/api/printers", json=sample_printer_data)
+        serial = sample_printer_data["serial"]
+        profiles = [{"cali_idx": 42, "filament_id": "GFL05", "k_value": 0.025, "name": "PLA Basic"}]
+        await test_db.save_printer_kprofiles(serial, "0.4", profiles, fetched_at=1700000000)
+
+        mock_printer_manager.is_connected.return_value = False
+
+        response = await async_client.get(f"/api/printers/{serial}/calibrations?nozzle_diameter=0.4")
+
+        assert response.status_code == 200
+        assert response.json() == profiles
+        mock_printer_manager.seed_kprofiles.assert_called_once_with(serial, "0.4", profiles, 1700000000)
+        mock_printer_manager.get_kprofiles.assert_not_called()
+
+    async def test_get_calibrations_cached_then_offline(
+        self, async_client, test_db, sample_printer_data, mock_printer_manager
+    ):
+        """Test profiles cached while connected are still served after the printer goes offline."""
+        await async_client.post("/api/printers", json=sample_printer_data)
+        serial = sample_printer_data["serial"]
+        profiles = [{"cali_idx": 42, "filament_id": "GFL05", "k_value": 0.025, "name": "PLA Basic"}]
+
+        mock_printer_manager.is_connected.return_value = True
+        mock_printer_manager.get_kprofiles = AsyncMock(return_value=profiles)
+        response = await async_client.get(f"/api/printers/{serial}/calibrations?nozzle_diameter=0.4")
+        assert response.status_code == 200
+
+        # Cached in memory now, so the store is no longer consulted
+        mock_printer_manager.has_kprofiles.return_value = True
+        mock_printer_manager.is_connected.return_value = False
+        response = await async_client.get(f"/api/printers/{serial}/calibrations?nozzle_diameter=0.4")
+
+        assert response.status_code == 200
+        assert response.json() == profiles
+        assert await test_db.get_printer_kprofiles(serial, "0.4") is None
+
+    async def test_get_calibrations_offline_without_store(
+        self, async_client, sample_printer_data, mock_printer_manager
+    ):
+        """Test a disconnected printer with nothing stored still reports not connected."""
+        await async_client.post("/api/printers", json=sample_printer_data)
+        mock_printer_manager.is_connected.return_value = False
+
+        response = await async_client.get(
+            f"/api/printers/{sample_printer_data['serial']}/calibrations?nozzle_diameter=0.4"
+        )
+
+        assert response.status_code == 400
+
 
 class TestAmsResetAPI:
     """Tests for AMS slot reset endpoint."""
@@ -7,9 +7,11 @@ Tests cover:
 - Get API key by ID
 - Update API key
 - Delete API key
+- API key validation (cached index, batched last_used)
 """
 
 import pytest
+from fastapi import HTTPException
 
 
 class TestAPIKeysAPI:
@@ -286,3 +288,185 @@ class TestAPIKeysAPI:
         assert response.status_code == 200
         created_at = response.json()["created_at"]
         assert before <= created_at <= after + 1
+
+
+class TestAPIKeyValidation:
+    """Tests for validate_api_key and its cached key index."""
+
+    async def test_validate_valid_key(self, async_client, test_db):
+        """Test a created key validates with its permissions."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Valid", "can_write": True})
+        data = create_response.json()
+
+        api_key = await validate_api_key(data["key"], None)
+
+        assert api_key["id"] == data["id"]
+        assert api_key["can_read"] is True
+        assert api_key["can_write"] is True
+        assert api_key["can_control"] is False
+
+    async def test_validate_bearer_header(self, async_client, test_db):
+        """Test the key is accepted from an Authorization: Bearer header."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Bearer"})
+        key = create_response.json()["key"]
+
+        api_key = await validate_api_key(None, f"Bearer {key}")
+
+        assert api_key["name"] == "Bearer"
+
+    async def test_validate_invalid_key(self, async_client, test_db):
+        """Test an unknown key is rejected."""
+        from api.api_keys import validate_api_key
+
+        await async_client.post("/api/api-keys/", json={"name": "Other"})
+
+        with pytest.raises(HTTPException) as exc:
+            await validate_api_key("sb_not-a-real-key", None)
+        assert exc.value.status_code == 401
+
+    async def test_validate_missing_key(self, async_client, test_db):
+        """Test a request without a key is rejected."""
+        from api.api_keys import validate_api_key
+
+        with pytest.raises(HTTPException) as exc:
+            await validate_api_key(None, None)
+        assert exc.value.status_code == 401
+
+    async def test_validate_after_disable(self, async_client, test_db):
+        """Test disabling a key takes effect on the cached index."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Disable"})
+        data = create_response.json()
+        await validate_api_key(data["key"], None)  # Index loaded
+
+        await async_client.patch(f"/api/api-keys/{data['id']}", json={"enabled": False})
+
+        with pytest.raises(HTTPException) as exc:
+            await validate_api_key(data["key"], None)
+        assert exc.value.status_code == 401
+
+    async def test_validate_after_permission_change(self, async_client, test_db):
+        """Test permission updates take effect on the cached index."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Perms"})
+        data = create_response.json()
+        assert (await validate_api_key(data["key"], None))["can_control"] is False
+
+        await async_client.patch(f"/api/api-keys/{data['id']}", json={"can_control": True})
+
+        assert (await validate_api_key(data["key"], None))["can_control"] is True
+
+    async def test_validate_after_delete(self, async_client, test_db):
+        """Test a deleted key is rejected."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Delete"})
+        data = create_response.json()
+        await validate_api_key(data["key"], None)
+
+        await async_client.delete(f"/api/api-keys/{data['id']}")
+
+        with pytest.raises(HTTPException) as exc:
+            await validate_api_key(data["key"], None)
+        assert exc.value.status_code == 401
+
+    async def test_invalidation_during_index_load(self, async_client, test_db, monkeypatch):
+        """Test a key disabled while the index is loading is not left in the index."""
+        from api.api_keys import _invalidate_key_index, validate_api_key
+
+        data = (await async_client.post("/api/api-keys/", json={"name": "Race"})).json()
+        _invalidate_key_index()
+        real_execute = type(test_db.conn).execute
+        raced = False
+
+        class RacingQuery:
+            def __init__(self, query):
+                self.query = query
+
+            async def __aenter__(self):
+                cursor = await self.query.__aenter__()
+                self.rows = await cursor.fetchall()
+                # The key is disabled after the rows were read, before the index is installed
+                await real_execute(test_db.conn, "UPDATE api_keys SET enabled = 0 WHERE id = ?", (data["id"],))
+                _invalidate_key_index()
+                return self
+
+            async def __aexit__(self, *exc):
+                return await self.query.__aexit__(*exc)
+
+            async def fetchall(self):
+                return self.rows
+
+        def racing_execute(self, sql, parameters=None):
+            nonlocal raced
+            query = real_execute(self, sql, parameters)
+            if raced or "WHERE enabled = 1" not in sql:
+                return query
+            raced = True
+            return RacingQuery(query)
+
+        with monkeypatch.context() as m:
+            m.setattr(type(test_db.conn), "execute", racing_execute)
+            with pytest.raises(HTTPException) as exc:
+                await validate_api_key(data["key"], None)
+        assert exc.value.status_code == 401
+        assert raced
+
+    async def test_last_used_written_in_batch(self, async_client, test_db):
+        """Test last_used is deferred until flushed, then written for all keys."""
+        from api.api_keys import flush_api_key_usage, validate_api_key
+
+        keys = []
+        for name in ("A", "B"):
+            response = await async_client.post("/api/api-keys/", json={"name": name})
+            keys.append(response.json())
+
+        for key in keys:
+            await validate_api_key(key["key"], None)
+            await validate_api_key(key["key"], None)
+
+        async with test_db.conn.execute("SELECT COUNT(*) FROM api_keys WHERE last_used IS NOT NULL") as cursor:
+            assert (await cursor.fetchone())[0] == 0
+
+        assert await flush_api_key_usage(test_db) == 2
+        assert await flush_api_key_usage(test_db) == 0
+
+        async with test_db.conn.execute("SELECT COUNT(*) FROM api_keys WHERE last_used IS NOT NULL") as cursor:
+            assert (await cursor.fetchone())[0] == 2
+
+    async def test_failed_flush_keeps_pending(self, async_client, test_db, monkeypatch):
+        """Test last_used timestamps survive a failed write and go out with the next flush."""
+        from api.api_keys import flush_api_key_usage, validate_api_key
+
+        response = await async_client.post("/api/api-keys/", json={"name": "A"})
+        await validate_api_key(response.json()["key"], None)
+
+        async def failing_executemany(self, sql, parameters):
+            raise RuntimeError("database is locked")
+
+        with monkeypatch.context() as m:
+            m.setattr(type(test_db.conn), "executemany", failing_executemany)
+            with pytest.raises(RuntimeError):
+                await flush_api_key_usage(test_db)
+
+        assert await flush_api_key_usage(test_db) == 1
+        async with test_db.conn.execute("SELECT COUNT(*) FROM api_keys WHERE last_used IS NOT NULL") as cursor:
+            assert (await cursor.fetchone())[0] == 1
+
+    async def test_last_used_visible_in_list(self, async_client, test_db):
+        """Test listing keys shows usage not yet flushed by the background task."""
+        from api.api_keys import validate_api_key
+
+        create_response = await async_client.post("/api/api-keys/", json={"name": "Listed"})
+        data = create_response.json()
+        await validate_api_key(data["key"], None)
+
+        response = await async_client.get(f"/api/api-keys/{data['id']}")
+
+        assert response.json()["last_used"] is not None
@@ -282,6 +282,41 @@ class TestCloudSettingsAPI:
         assert response.status_code == 200
         mock_service.get_slicer_settings.assert_called_once_with("01.00.00.00")
 
+    async def test_get_settings_filament_version(self, async_client, test_db, sample_slicer_settings):
+        """Test settings carry a filament catalog version that follows the content."""
+        await test_db.set_setting("cloud_access_token", "valid-token")
+
+        with patch("api.cloud.get_cloud_service") as mock_get_service:
+            mock_service = MagicMock()
+            mock_service.is_authenticated = True
+            mock_service.get_slicer_settings = AsyncMock(return_value=sample_slicer_settings)
+            mock_get_service.return_value = mock_service
+
+            first = (await async_client.get("/api/cloud/settings?refresh=true")).json()["filament_version"]
+            again = (await async_client.get("/api/cloud/settings?refresh=true")).json()["filament_version"]
+
+            sample_slicer_settings["filament"]["private"].append({"setting_id": "PFUS_new", "name": "# New PLA"})
+            changed = (await async_client.get("/api/cloud/settings?refresh=true")).json()["filament_version"]
+
+        assert first and first == again
+        assert changed != first
+
+    async def test_heartbeat_reports_presets_version(self, async_client, test_db, sample_slicer_settings):
+        """Test the display heartbeat carries the preset catalog version once presets are cached."""
+        response = await async_client.get("/api/display/heartbeat")
+        assert "presets_version" not in response.json()
+
+        await test_db.set_setting("cloud_access_token", "valid-token")
+        with patch("api.cloud.get_cloud_service") as mock_get_service:
+            mock_service = MagicMock()
+            mock_service.is_authenticated = True
+            mock_service.get_slicer_settings = AsyncMock(return_value=sample_slicer_settings)
+            mock_get_service.return_value = mock_service
+            settings = (await async_client.get("/api/cloud/settings")).json()
+
+        response = await async_client.get("/api/display/heartbeat")
+        assert response.json()["presets_version"] == settings["filament_version"]
+
 
 class TestCloudSettingDetailAPI:
     """Tests for setting detail endpoint."""
@@ -352,3 +387,62 @@ class TestCloudFilamentsAPI:
         assert response.status_code == 200
         data = response.json()
         assert isinstance(data, list)
+
+
+class TestCloudCompactFeedAPI:
+    """Tests for the compact filament preset feed endpoint."""
+
+    @pytest.fixture(autouse=True)
+    def clear_settings_cache(self):
+        """Clear the settings cache before each test."""
+        from api.cloud import _clear_settings_cache
+
+        _clear_settings_cache()
+        yield
+        _clear_settings_cache()
+
+    async def test_compact_feed_etag(self, async_client, test_db, sample_slicer_settings):
+        """Test the feed is binary, carries the catalog version as ETag and honours If-None-Match."""
+        from services.preset_feed import FEED_FORMAT, FEED_MAGIC, HEADER
+
+        await test_db.set_setting("cloud_access_token", "valid-token")
+
+        with patch("api.cloud.get_cloud_service") as mock_get_service:
+            mock_service = MagicMock()
+            mock_service.is_authenticated = True
+            mock_service.get_slicer_settings = AsyncMock(return_value=sample_slicer_settings)
+            mock_get_service.return_value = mock_service
+
+            settings = (await async_client.get("/api/cloud/settings")).json()
+            response = await async_client.get("/api/cloud/filaments/compact")
+            limited = await async_client.get("/api/cloud/filaments/compact?limit=1")
+            not_modified = await async_client.get(
+                "/api/cloud/filaments/compact", headers={"If-None-Match": response.headers["etag"]}
+            )
+            limited_stale = await async_client.get(
+                "/api/cloud/filaments/compact?limit=1", headers={"If-None-Match": response.headers["etag"]}
+            )
+
+        assert response.status_code == 200
+        assert response.headers["content-type"] == "application/octet-stream"
+        assert response.headers["etag"] == f'"{settings["filament_version"]}.{FEED_FORMAT}.0"'
+        magic, *_, count, _ = HEADER.unpack_from(response.content)
+        assert magic == FEED_MAGIC
+        assert count == 3
+
+        assert HEADER.unpack_from(limited.content)[5] == 1
+        assert limited.headers["etag"] == f'"{settings["filament_version"]}.{FEED_FORMAT}.1"'
+
+        assert not_modified.status_code == 304
+        assert not_modified.content == b""
+
+        # A validator for the full feed does not match the limited one
+        assert limited_stale.status_code == 200
+
+    async def test_compact_feed_unauthenticated(self, async_client, test_db):
+        """Test the feed requires cloud authentication."""
+        await test_db.delete_setting("cloud_access_token")
+
+        response = await async_client.get("/api/cloud/filaments/compact")
+
+        assert response.status_code == 401
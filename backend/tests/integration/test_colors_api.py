@@ -377,3 +377,71 @@ class TestColorsSearch:
         data = response.json()
         # Should find entries with partial match
         assert len(data) >= 1
+
+
+class TestColorsIndex:
+    """Tests for fuzzy search, nearest color and index consistency."""
+
+    async def test_fuzzy_search(self, async_client, test_db):
+        """Test ranking entries by similarity to a misspelt query."""
+        await async_client.post(
+            "/api/colors",
+            json={
+                "manufacturer": "FuzzyBrand",
+                "color_name": "Galaxy Purple",
+                "hex_color": "#5B2C83",
+                "material": "PLA",
+            },
+        )
+
+        response = await async_client.get("/api/colors/search", params={"q": "fuzzybrnd galaxy purpl"})
+
+        assert response.status_code == 200
+        data = response.json()
+        assert data[0]["manufacturer"] == "FuzzyBrand"
+        assert data[0]["color_name"] == "Galaxy Purple"
+
+    async def test_nearest(self, async_client, test_db):
+        """Test finding the perceptually closest colors."""
+        await async_client.post(
+            "/api/colors",
+            json={"manufacturer": "NearBrand", "color_name": "Odd Teal", "hex_color": "#127A7B", "material": "XMAT"},
+        )
+
+        response = await async_client.get(
+            "/api/colors/nearest", params={"hex_color": "#137B7B", "material": "XMAT", "limit": 3}
+        )
+
+        assert response.status_code == 200
+        data = response.json()
+        assert len(data) == 1
+        assert data[0]["color_name"] == "Odd Teal"
+        assert data[0]["score"] < 1
+
+    async def test_nearest_invalid_hex(self, async_client, test_db):
+        """Test rejecting an unparseable hex color."""
+        response = await async_client.get("/api/colors/nearest", params={"hex_color": "#XYZ"})
+
+        assert response.status_code == 400
+
+    async def test_index_follows_writes(self, async_client, test_db):
+        """Test lookups see updates and deletes."""
+        create_response = await async_client.post(
+            "/api/colors", json={"manufacturer": "IdxBrand", "color_name": "Before", "hex_color": "#101010"}
+        )
+        entry_id = create_response.json()["id"]
+
+        await async_client.put(
+            f"/api/colors/{entry_id}",
+            json={"manufacturer": "IdxBrand", "color_name": "After", "hex_color": "#202020"},
+        )
+        before = await async_client.get(
+            "/api/colors/lookup", params={"manufacturer": "IdxBrand", "color_name": "Before"}
+        )
+        after = await async_client.get("/api/colors/lookup", params={"manufacturer": "idxbrand", "color_name": "after"})
+        assert before.json()["found"] is False
+        assert after.json()["hex_color"] == "#202020"
+
+        await async_client.delete(f"/api/colors/{entry_id}")
+        after = await async_client.get("/api/colors/lookup", params={"manufacturer": "IdxBrand", "color_name": "After"})
+        assert after.json()["found"] is False
@@ -5,15 +5,33 @@ Tests cover:
 - Connection status
 - Device configuration
 - Connect/disconnect
-- Scale operations (tare, calibrate, reset)
+- Discovery (mDNS/subnet merge, result cache, subnet scanner)
+- Scale operations (tare, calibrate, reset, report deadband)
 - Device commands (reboot, update, factory reset)
 - Recovery info
+- Device logs (HTTP tail/since queries, live WebSocket)
+- Device state reports (/api/display/state)
 """
 
+import asyncio
+import ipaddress
+import json
+import socket
+import time
+from types import SimpleNamespace
 from unittest.mock import AsyncMock, patch
 
+import api.device as device_module
 import pytest
-from api.device import DeviceInfo
+from api.device import (
+    DeviceInfo,
+    _AdaptiveTimeout,
+    _discover_subnet,
+    _local_networks,
+    _scan_candidates,
+    device_logs_websocket,
+)
+from services.device_logs import LogStore
 
 
 class TestDeviceStatusAPI:
@@ -192,6 +210,15 @@ class TestDevicePingAPI:
         assert data["device"] is None
 
 
+@pytest.fixture
+def discovery_state(monkeypatch):
+    """Start each discovery test without cached results or recently seen devices."""
+    monkeypatch.setattr("api.device._discovery_cache", None)
+    monkeypatch.setattr("api.device._recent_devices", {})
+    monkeypatch.setattr("api.device._device_config", None)
+
+
+@pytest.mark.usefixtures("discovery_state")
 class TestDeviceDiscoverAPI:
     """Tests for device discovery endpoint."""
 
@@ -201,7 +228,10 @@ class TestDeviceDiscoverAPI:
             DeviceInfo(ip="192.168.1.100", hostname="spoolbuddy1"),
         ]
 
-        with patch("api.device._discover_mdns", AsyncMock(return_value=mock_devices)):
+        with (
+            patch("api.device._discover_mdns", AsyncMock(return_value=mock_devices)),
+            patch("api.device._discover_subnet", AsyncMock(return_value=([], True))),
+        ):
             response = await async_client.post("/api/device/discover")
 
         assert response.status_code == 200
@@ -214,7 +244,7 @@ class TestDeviceDiscoverAPI:
         """Test discovery with no devices found."""
         with (
             patch("api.device._discover_mdns", AsyncMock(return_value=[])),
-            patch("api.device._discover_subnet", AsyncMock(return_value=[])),
+            patch("api.device._discover_subnet", AsyncMock(return_value=([], True))),
         ):
             response = await async_client.post("/api/device/discover")
 
@@ -226,12 +256,189 @@ class TestDeviceDiscoverAPI:
         """Test discovery with custom timeout."""
         with (
             patch("api.device._discover_mdns", AsyncMock(return_value=[])),
-            patch("api.device._discover_subnet", AsyncMock(return_value=[])),
+            patch("api.device._discover_subnet", AsyncMock(return_value=([], True))),
         ):
             response = await async_client.post("/api/device/discover?timeout_ms=5000")
 
         assert response.status_code == 200
 
+    async def test_discover_merges_mdns_and_subnet(self, async_client):
+        """Devices found both ways are reported once, combining their details."""
+        mdns = [DeviceInfo(ip="192.168.1.100", hostname="spoolbuddy1.local.")]
+        subnet = [
+            DeviceInfo(ip="192.168.1.100", hostname="spoolbuddy1", firmware_version="0.1.1"),
+            DeviceInfo(ip="192.168.1.101"),
+        ]
+        with (
+            patch("api.device._discover_mdns", AsyncMock(return_value=mdns)),
+            patch("api.device._discover_subnet", AsyncMock(return_value=(subnet, True))),
+        ):
+            response = await async_client.post("/api/device/discover")
+
+        devices = response.json()["devices"]
+        assert [d["ip"] for d in devices] == ["192.168.1.100", "192.168.1.101"]
+        assert devices[0]["hostname"] == "spoolbuddy1.local."
+        assert devices[0]["firmware_version"] == "0.1.1"
+
+    async def test_discover_reuses_recent_result(self, async_client):
+        """Repeated discovery returns the cached result until refresh is requested."""
+        subnet = AsyncMock(return_value=([DeviceInfo(ip="192.168.1.100")], True))
+        with (
+            patch("api.device._discover_mdns", AsyncMock(return_value=[])),
+            patch("api.device._discover_subnet", subnet),
+        ):
+            first = (await async_client.post("/api/device/discover")).json()
+            second = (await async_client.post("/api/device/discover")).json()
+            assert subnet.await_count == 1
+            refreshed = (await async_client.post("/api/device/discover?refresh=true")).json()
+
+        assert first["cached"] is False
+        assert second["cached"] is True
+        assert second["devices"] == first["devices"]
+        assert refreshed["cached"] is False
+        assert subnet.await_count == 2
+
+    async def test_discover_partial_scan_not_cached(self, async_client):
+        """A subnet scan cut off by the timeout is reported as partial and not reused."""
+        subnet = AsyncMock(return_value=([DeviceInfo(ip="192.168.1.100")], False))
+        with (
+            patch("api.device._discover_mdns", AsyncMock(return_value=[])),
+            patch("api.device._discover_subnet", subnet),
+        ):
+            first = (await async_client.post("/api/device/discover")).json()
+            second = (await async_client.post("/api/device/discover")).json()
+
+        assert first["partial"] is True
+        assert second["cached"] is False
+        assert subnet.await_count == 2
+
+    async def test_discover_survives_mdns_failure(self, async_client):
+        """A failing discovery method doesn't hide the other's results."""
+        with (
+            patch("api.device._discover_mdns", AsyncMock(side_effect=OSError("no multicast"))),
+            patch("api.device._discover_subnet", AsyncMock(return_value=([DeviceInfo(ip="192.168.1.7")], True))),
+        ):
+            response = await async_client.post("/api/device/discover")
+
+        assert [d["ip"] for d in response.json()["devices"]] == ["192.168.1.7"]
+
+
+async def _fake_device_server(host: str, port: int, info: dict | None):
+    """Minimal HTTP server answering /api/info with info (or 404 when None)."""
+
+    async def handle(reader, writer):
+        await reader.readuntil(b"\r\n\r\n")
+        if info is None:
+            writer.write(b"HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n")
+        else:
+            body = json.dumps(info).encode()
+            writer.write(
+                b"HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                + f"Content-Length: {len(body)}\r\nConnection: close\r\n\r\n".encode()
+                + body
+            )
+        await writer.drain()
+        writer.close()
+
+    return await asyncio.start_server(handle, host, port)
+
+
+@pytest.mark.usefixtures("discovery_state")
+class TestSubnetDiscovery:
+    """Tests for the subnet scanner, with fake devices on loopback addresses."""
+
+    LOOPBACK = [(ipaddress.IPv4Address("127.0.0.1"), ipaddress.IPv4Network("127.0.0.0/29"))]
+
+    async def test_finds_fake_devices(self):
+        """Hosts answering /api/info are reported with details, other open ports are left out."""
+        device = await _fake_device_server("127.0.0.2", 0, {"hostname": "spoolbuddy", "version": "0.1.1"})
+        port = device.sockets[0].getsockname()[1]
+        other = await _fake_device_server("127.0.0.5", port, None)
+        try:
+            with patch("api.device._arp_neighbors", return_value=[]):
+                devices, complete = await _discover_subnet(3.0, networks=self.LOOPBACK, port=port)
+        finally:
+            device.close()
+            other.close()
+
+        assert complete is True
+        assert [d.ip for d in devices] == ["127.0.0.2"]
+        assert devices[0].hostname == "spoolbuddy"
+        assert devices[0].firmware_version == "0.1.1"
+
+    async def test_probes_likely_addresses_first(self):
+        """Recently seen devices, then ARP neighbors, then the rest; the host itself is skipped."""
+        device_module._recent_devices["127.0.0.6"] = time.monotonic()
+        device_module._recent_devices["127.0.0.3"] = time.monotonic() - device_module.RECENT_DEVICE_TTL - 1
+        with patch("api.device._arp_neighbors", return_value=["10.9.9.9", "127.0.0.4"]):
+            candidates = _scan_candidates(self.LOOPBACK)
+
+        assert candidates == ["127.0.0.6", "127.0.0.4", "127.0.0.2", "127.0.0.3", "127.0.0.5"]
+
+    async def test_concurrency_is_bounded(self):
+        """No more than DISCOVERY_CONCURRENCY probes are in flight."""
+        in_flight = peak = 0
+
+        async def slow_connect(ip, port, timeout):
+            nonlocal in_flight, peak
+            in_flight += 1
+            peak = max(peak, in_flight)
+            await asyncio.sleep(0.001)
+            in_flight -= 1
+            return None
+
+        networks = [(ipaddress.IPv4Address("10.20.30.1"), ipaddress.IPv4Network("10.20.30.0/24"))]
+        with (
+            patch("api.device._arp_neighbors", return_value=[]),
+            patch("api.device._tcp_connect_time", slow_connect),
+        ):
+            assert await _discover_subnet(10.0, networks=networks) == ([], True)
+
+        assert peak == device_module.DISCOVERY_CONCURRENCY
+
+    async def test_timeout_reports_incomplete_scan(self):
+        """A scan stopped by the timeout says not every address was probed."""
+
+        async def hanging_connect(ip, port, timeout):
+            await asyncio.sleep(10)
+
+        networks = [(ipaddress.IPv4Address("10.20.30.1"), ipaddress.IPv4Network("10.20.30.0/24"))]
+        with (
+            patch("api.device._arp_neighbors", return_value=[]),
+            patch("api.device._tcp_connect_time", hanging_connect),
+        ):
+            assert await _discover_subnet(0.05, networks=networks) == ([], False)
+
+    def test_adaptive_timeout(self):
+        """Timeout starts conservative and tightens on a fast network."""
+        timeouts = _AdaptiveTimeout()
+        assert timeouts.value == device_module.PROBE_TIMEOUT_INITIAL
+        for _ in range(20):
+            timeouts.observe(0.002)
+        assert timeouts.value == device_module.PROBE_TIMEOUT_MIN
+        for _ in range(50):
+            timeouts.observe(5.0)
+        assert timeouts.value == device_module.PROBE_TIMEOUT_MAX
+
+    def test_local_networks(self):
+        """Private interfaces only, with wide networks narrowed to the host's /24."""
+        addrs = {
+            "lo": [SimpleNamespace(family=socket.AF_INET, address="127.0.0.1", netmask="255.0.0.0")],
+            "eth0": [SimpleNamespace(family=socket.AF_INET, address="10.1.2.3", netmask="255.255.0.0")],
+            "wlan0": [
+                SimpleNamespace(family=socket.AF_INET6, address="fe80::1", netmask="ffff:ffff:ffff:ffff::"),
+                SimpleNamespace(family=socket.AF_INET, address="192.168.4.20", netmask="255.255.255.128"),
+            ],
+            "wan": [SimpleNamespace(family=socket.AF_INET, address="8.8.4.4", netmask="255.255.255.0")],
+        }
+        with patch("api.device.psutil.net_if_addrs", return_value=addrs):
+            networks = _local_networks()
+
+        assert [(str(ip), str(net)) for ip, net in networks] == [
+            ("10.1.2.3", "10.1.2.0/24"),
+            ("192.168.4.20", "192.168.4.0/25"),
+        ]
+
 
 class TestScaleAPI:
     """Tests for scale control endpoints."""
@@ -286,6 +493,22 @@ class TestScaleAPI:
 
         assert response.status_code == 400
 
+    async def test_deadband_success(self, async_client):
+        """Test setting the weight report deadband."""
+        with patch("main.is_display_connected", return_value=True), patch("main.queue_display_command") as mock_queue:
+            response = await async_client.post("/api/device/scale/deadband?grams=2")
+
+        assert response.status_code == 200
+        mock_queue.assert_called_once_with("state_deadband:2.0")
+
+    async def test_deadband_rejects_negative(self, async_client):
+        """Test deadband must not be negative."""
+        with patch("main.is_display_connected", return_value=True), patch("main.queue_display_command") as mock_queue:
+            response = await async_client.post("/api/device/scale/deadband?grams=-1")
+
+        assert response.status_code == 422
+        mock_queue.assert_not_called()
+
 
 class TestDeviceCommandsAPI:
     """Tests for device command endpoints (reboot, update, factory reset)."""
@@ -341,3 +564,169 @@ class TestRecoveryInfoAPI:
         assert "serial_commands" in data
         assert len(data["steps"]) > 0
         assert "flash" in data["serial_commands"]
+
+
+@pytest.fixture
+def log_store(monkeypatch):
+    """Fresh device log store with a few lines from two devices."""
+    store = LogStore(capacity=100)
+    store.append("192.168.1.50", ["I (100) main: boot", "W (200) wifi: weak signal", "E (300) nfc: read failed"])
+    store.append("192.168.1.51", ["[INFO] hello", "[ERROR] scale missing"])
+    monkeypatch.setattr("services.device_logs.device_log_store", store)
+    return store
+
+
+class FakeLogWebSocket:
+    def __init__(self):
+        self.messages = []
+        self.disconnected = asyncio.Event()
+
+    async def accept(self):
+        pass
+
+    async def close(self):
+        pass
+
+    async def send_json(self, message):
+        self.messages.append(message)
+
+    async def receive(self):
+        await self.disconnected.wait()
+        return {"type": "websocket.disconnect"}
+
+
+class TestDeviceLogsAPI:
+    """Tests for device log queries."""
+
+    async def test_tail(self, async_client, log_store):
+        response = await async_client.get("/api/device/logs?limit=2")
+
+        assert response.status_code == 200
+        data = response.json()
+        assert [e["message"] for e in data["entries"]] == ["hello", "scale missing"]
+        assert data["cursor"] == 5
+        assert data["devices"] == ["192.168.1.50", "192.168.1.51"]
+
+    async def test_tail_filters(self, async_client, log_store):
+        response = await async_client.get("/api/device/logs?level=warn&device=192.168.1.50")
+
+        entries = response.json()["entries"]
+        assert [(e["level"], e["tag"], e["uptime_ms"]) for e in entries] == [("W", "wifi", 200), ("E", "nfc", 300)]
+
+    async def test_since_cursor(self, async_client, log_store):
+        first = (await async_client.get("/api/device/logs?since=0&limit=3")).json()
+        log_store.append("192.168.1.50", ["I (400) main: later"])
+        second = (await async_client.get(f"/api/device/logs?since={first['cursor']}")).json()
+
+        assert [e["seq"] for e in first["entries"]] == [1, 2, 3]
+        assert [e["message"] for e in second["entries"]] == ["hello", "scale missing", "later"]
+        assert second["cursor"] == 6
+        assert second["dropped"] == 0
+
+    async def test_bad_level(self, async_client, log_store):
+        response = await async_client.get("/api/device/logs?level=loud")
+
+        assert response.status_code == 400
+
+    async def test_websocket_backlog_then_live(self, log_store):
+        websocket = FakeLogWebSocket()
+        task = asyncio.create_task(device_logs_websocket(websocket, level="E", backlog=1))
+        try:
+            async with asyncio.timeout(5):
+                while not websocket.messages:
+                    await asyncio.sleep(0.01)
+                log_store.append("192.168.1.50", ["I (500) main: ignored", "E (600) main: failure"])
+                while len(websocket.messages) < 2:
+                    await asyncio.sleep(0.01)
+                websocket.disconnected.set()
+                await task
+        finally:
+            task.cancel()
+
+        backlog, live = websocket.messages
+        assert [e["message"] for e in backlog["entries"]] == ["scale missing"]
+        assert backlog["cursor"] == 5
+        assert [e["message"] for e in live["entries"]] == ["failure"]
+        assert live["cursor"] == 7
+
+
+class TestDisplayStateAPI:
+    """Tests for device state reports (/api/display/state)."""
+
+    @pytest.fixture
+    def device_state(self, monkeypatch):
+        """Reset the device state globals in main and capture broadcasts."""
+        import main
+
+        monkeypatch.setattr(main, "_device_last_weight", None)
+        monkeypatch.setattr(main, "_device_weight_stable", False)
+        monkeypatch.setattr(main, "_confirmed_tag_id", None)
+        monkeypatch.setattr(main, "_device_current_tag_id", None)
+        monkeypatch.setattr(main, "_ever_had_tag", False)
+        monkeypatch.setattr(main, "_simulating_tag", False)
+        monkeypatch.setattr(main, "_staged_tag_id", None)
+        monkeypatch.setattr(main, "_staged_tag_data", None)
+        monkeypatch.setattr(main, "_tag_data_cache", {})
+        monkeypatch.setattr(main, "_device_wifi_ssid", None)
+        broadcast = AsyncMock()
+        monkeypatch.setattr(main, "broadcast_message", broadcast)
+        return main, broadcast
+
+    async def test_partial_update_keeps_missing_fields(self, async_client, device_state):
+        """Fields missing from a partial report keep their last value."""
+        main, _ = device_state
+        await async_client.post("/api/display/state?partial=1&weight=1000.0&stable=true&tag_id=&wifi_ssid=home")
+
+        response = await async_client.post("/api/display/state?partial=1&weight=1012.5")
+
+        assert response.status_code == 200
+        assert main._device_last_weight == 1012.5
+        assert main._device_weight_stable is True
+        assert main._device_wifi_ssid == "home"
+
+    async def test_legacy_update_defaults_stable(self, async_client, device_state):
+        """Full reports without stable still mean an unstable reading."""
+        main, _ = device_state
+        main._device_weight_stable = True
+
+        await async_client.post("/api/display/state?weight=500.0")
+
+        assert main._device_weight_stable is False
+
+    async def test_partial_tag_persists_without_tag_id(self, async_client, device_state):
+        """A tag stays confirmed while partial reports omit tag_id."""
+        main, _ = device_state
+        await async_client.post(
+            "/api/display/state?partial=1&tag_id=AA:BB:CC:DD&tag_vendor=Bambu&tag_material=PLA&tag_subtype=Basic"
+        )
+        assert main._confirmed_tag_id == "AA:BB:CC:DD"
+        assert main._staged_tag_id == "AA:BB:CC:DD"
+
+        # Past the staleness timeout for full reports
+        main._tag_last_seen_time -= main._tag_staleness_timeout + 1
+        await async_client.post("/api/display/state?partial=1&weight=990.0")
+
+        assert main._confirmed_tag_id == "AA:BB:CC:DD"
+
+    async def test_partial_empty_tag_id_removes_immediately(self, async_client, device_state):
+        """An empty tag_id in a partial report is an already-debounced removal."""
+        main, broadcast = device_state
+        await async_client.post("/api/display/state?partial=1&tag_id=AA:BB:CC:DD&tag_vendor=Bambu&tag_material=PLA")
+        broadcast.reset_mock()
+
+        await async_client.post("/api/display/state?partial=1&tag_id=")
+
+        assert main._confirmed_tag_id is None
+        broadcast.assert_awaited_with({"type": "device_state", "weight": None, "stable": False, "tag_id": None})
+
+    async def test_partial_keepalive_uses_cached_tag_data(self, async_client, device_state):
+        """Decoded data is sent once per tag; later reports with only the UID reuse it."""
+        main, _ = device_state
+        await async_client.post("/api/display/state?partial=1&tag_id=AA:BB:CC:DD&tag_vendor=Bambu&tag_material=PETG")
+        main._staged_tag_id = None
+        main._staged_tag_data = None
+
+        await async_client.post("/api/display/state?partial=1&tag_id=AA:BB:CC:DD")
+
+        assert main._staged_tag_id == "AA:BB:CC:DD"
+        assert main._staged_tag_data["material"] == "PETG"
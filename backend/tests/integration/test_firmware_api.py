@@ -7,9 +7,11 @@ Tests cover:
 - Checking for updates (GitHub API)
 - Downloading firmware files
 - Uploading firmware binaries
+- Delta updates between stored versions
 - Deleting firmware versions
 """
 
+import random
 import tempfile
 from datetime import datetime, timedelta
 from pathlib import Path
@@ -465,6 +467,115 @@ class TestFirmwareUploadAPI:
         assert "Could not determine firmware version" in response.json()["detail"]
 
 
+def _firmware_image(size: int = 64 * 1024, seed: int = 1) -> bytes:
+    """ESP32-looking image (magic byte, no app descriptor) with random content."""
+    return b"\xe9\x05" + random.Random(seed).randbytes(size - 2)
+
+
+class TestFirmwareDeltaAPI:
+    """Tests for delta OTA updates."""
+
+    async def _upload(self, async_client, version: str, content: bytes):
+        return await async_client.post(
+            "/api/firmware/upload",
+            files={"file": (f"spoolbuddy-{version}.bin", content, "application/octet-stream")},
+            data={"version": version},
+        )
+
+    async def test_upload_builds_delta_from_older_versions(self, async_client):
+        """Test uploading a new version precomputes a delta from each stored older version."""
+        from services.firmware_delta import apply_delta
+
+        old = _firmware_image()
+        new = old[:1000] + b"patched code" + old[1000:]
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                assert (await self._upload(async_client, "1.0.0", old)).json()["delta_from"] == []
+                response = await self._upload(async_client, "1.1.0", new)
+                assert response.json()["delta_from"] == ["1.0.0"]
+
+                response = await async_client.get("/api/firmware/ota/delta?from_version=1.0.0")
+
+        assert response.status_code == 200
+        assert response.headers["x-firmware-version"] == "1.1.0"
+        assert response.headers["x-delta-from"] == "1.0.0"
+        assert len(response.content) < 1024
+        assert apply_delta(old, response.content) == new
+
+    async def test_older_upload_builds_delta_to_newer(self, async_client):
+        """Test uploading an older version afterwards still gives it a delta to the latest."""
+        old = _firmware_image()
+        new = old[:-100] + b"tail"
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                await self._upload(async_client, "2.0.0", new)
+                response = await self._upload(async_client, "1.0.0", old)
+                assert response.json()["delta_from"] == []
+
+                response = await async_client.get("/api/firmware/ota/delta?from_version=1.0.0")
+
+        assert response.status_code == 200
+        assert response.headers["x-firmware-version"] == "2.0.0"
+
+    async def test_prerelease_version_forms_match(self, async_client):
+        """Test 0.2.0-beta.1 (device) finds the delta stored for 0.2.0b1."""
+        old = _firmware_image()
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                await self._upload(async_client, "0.2.0b1", old)
+                await self._upload(async_client, "0.2.0", old[:5000] + old[6000:])
+
+                response = await async_client.get("/api/firmware/ota/delta?from_version=0.2.0-beta.1")
+
+        assert response.status_code == 200
+        assert response.headers["x-delta-from"] == "0.2.0b1"
+
+    async def test_no_delta_for_unrelated_images(self, async_client):
+        """Test a delta that would not save anything is not kept."""
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                await self._upload(async_client, "1.0.0", _firmware_image(seed=1))
+                response = await self._upload(async_client, "1.1.0", _firmware_image(seed=2))
+                assert response.json()["delta_from"] == []
+
+                response = await async_client.get("/api/firmware/ota/delta?from_version=1.0.0")
+
+        assert response.status_code == 404
+
+    async def test_delta_unknown_or_current_version(self, async_client):
+        """Test 404 when the device version isn't stored or is already the latest."""
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                response = await async_client.get("/api/firmware/ota/delta?from_version=1.0.0")
+                assert response.status_code == 404
+
+                await self._upload(async_client, "1.0.0", _firmware_image())
+                response = await async_client.get("/api/firmware/ota/delta?from_version=0.9.0")
+                assert response.status_code == 404
+                response = await async_client.get("/api/firmware/ota/delta?from_version=1.0.0")
+                assert response.status_code == 404
+
+    async def test_delete_removes_deltas(self, async_client):
+        """Test deleting a version removes deltas to and from it."""
+        old = _firmware_image()
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            tmp_path = Path(tmp_dir)
+            with patch("api.firmware.FIRMWARE_DIR", tmp_path):
+                await self._upload(async_client, "1.0.0", old)
+                await self._upload(async_client, "1.1.0", old + b"more")
+                assert list((tmp_path / "deltas").glob("*.delta"))
+
+                response = await async_client.delete("/api/firmware/1.0.0")
+
+            assert response.status_code == 200
+            assert not list((tmp_path / "deltas").glob("*.delta"))
+
+
 class TestFirmwareDeleteAPI:
     """Tests for firmware deletion endpoint."""
 
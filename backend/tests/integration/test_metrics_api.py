@@ -0,0 +1,76 @@
+"""
+Integration tests for the /metrics endpoint.
+
+Tests cover:
+- Prometheus text format response
+- Per-route request latency labelled by route template
+- Cover cache hit/miss counters
+"""
+
+from unittest.mock import MagicMock
+
+from metrics import COVER_CACHE, HTTP_REQUEST_SECONDS
+
+
+class TestMetricsAPI:
+    """Tests for runtime metrics exposure."""
+
+    async def test_metrics_text_format(self, async_client):
+        """Test /metrics returns every backend metric family."""
+        response = await async_client.get("/metrics")
+
+        assert response.status_code == 200
+        assert response.headers["content-type"].startswith("text/plain")
+        for name in (
+            "spoolbuddy_http_request_seconds",
+            "spoolbuddy_mqtt_messages_total",
+            "spoolbuddy_mqtt_parse_seconds",
+            "spoolbuddy_websocket_clients",
+            "spoolbuddy_websocket_send_seconds",
+            "spoolbuddy_db_query_seconds",
+            "spoolbuddy_cover_cache_total",
+            "spoolbuddy_event_loop_lag_seconds",
+        ):
+            assert f"# TYPE {name} " in response.text
+
+    async def test_request_latency_by_route_template(self, async_client, spool_factory):
+        """Test requests are labelled by route template, not by path."""
+        spool = await spool_factory()
+        labels = ("GET", "/api/spools/{spool_id}", 200)
+        before = HTTP_REQUEST_SECONDS.count(*labels)
+
+        response = await async_client.get(f"/api/spools/{spool.id}")
+        assert response.status_code == 200
+
+        assert HTTP_REQUEST_SECONDS.count(*labels) == before + 1
+        response = await async_client.get("/metrics")
+        assert 'route="/api/spools/{spool_id}"' in response.text
+        assert spool.id not in response.text
+
+    async def test_unmatched_requests_share_a_label(self, async_client):
+        """Test unknown paths don't create a series per path."""
+        before = HTTP_REQUEST_SECONDS.count("GET", "unmatched", 404)
+
+        await async_client.get("/api/does-not-exist/1")
+        await async_client.get("/api/does-not-exist/2")
+
+        assert HTTP_REQUEST_SECONDS.count("GET", "unmatched", 404) == before + 2
+
+    async def test_cover_cache_hits_counted(self, async_client, printer_factory, mock_printer_manager):
+        """Test cover cache lookups are counted."""
+        from api import printers as printers_api
+
+        printer = await printer_factory()
+        mock_printer_manager.is_connected.return_value = True
+        mock_printer_manager.get_state.return_value = MagicMock(subtask_name="benchy", gcode_file=None)
+        printers_api._cover_cache[printer.serial] = {("benchy", 1, "png"): b"png"}
+        hits = COVER_CACHE.value("hit")
+
+        try:
+            response = await async_client.get(f"/api/printers/{printer.serial}/cover?format=png")
+        finally:
+            printers_api._cover_cache.pop(printer.serial, None)
+
+        assert response.status_code == 200
+        assert response.content == b"png"
+        assert COVER_CACHE.value("hit") == hits + 1
@@ -0,0 +1,99 @@
+"""
+Integration tests for PrinterManager against the fake Bambu fleet.
+
+Tests cover:
+- TLS MQTT connect with access code authentication
+- pushall and K-profile fetch on connect
+- Report traffic reaching the state callback
+"""
+
+import asyncio
+import shutil
+
+import pytest
+from mqtt.client import PrinterManager
+
+from tests.fakes.bambu import FakeBambuBroker, VirtualPrinter
+
+# The fake broker generates its TLS certificate with the openssl CLI
+pytestmark = pytest.mark.skipif(shutil.which("openssl") is None, reason="openssl not installed")
+
+
+@pytest.fixture
+async def broker():
+    broker = FakeBambuBroker()
+    await broker.start()
+    yield broker
+    await broker.stop()
+
+
+@pytest.fixture
+async def manager():
+    manager = PrinterManager()
+    yield manager
+    await manager.disconnect_all()
+
+
+async def _wait_for(condition, timeout: float = 10.0):
+    deadline = asyncio.get_running_loop().time() + timeout
+    while not condition():
+        if asyncio.get_running_loop().time() > deadline:
+            raise TimeoutError
+        await asyncio.sleep(0.02)
+
+
+class TestPrinterFleet:
+    """Test the MQTT client end to end against virtual printers."""
+
+    async def test_connect_receives_full_state(self, broker, manager):
+        """Test connecting subscribes, requests pushall and parses AMS state."""
+        printer = broker.add_printer(VirtualPrinter("00M09A000000001", ams_count=2))
+        states = {}
+        manager.set_state_callback(lambda serial, state: states.__setitem__(serial, state))
+
+        await manager.connect(printer.serial, "127.0.0.1", printer.access_code, port=broker.port)
+        await _wait_for(lambda: printer.serial in states and states[printer.serial].ams_units)
+
+        state = states[printer.serial]
+        assert manager.is_connected(printer.serial)
+        assert state.gcode_state == "RUNNING"
+        assert len(state.ams_units) == 2
+        assert len(state.ams_units[0].trays) == 4
+        assert state.ams_units[0].trays[0].tray_type == "PLA"
+
+    async def test_kprofiles_fetched_on_connect(self, broker, manager):
+        """Test calibration requests on connect are answered and cached."""
+        printer = broker.add_printer(VirtualPrinter("00M09A000000002", kprofile_count=5))
+
+        await manager.connect(printer.serial, "127.0.0.1", printer.access_code, port=broker.port)
+        await _wait_for(lambda: manager.has_kprofiles(printer.serial, "0.4"))
+
+        profiles = await manager.get_kprofiles(printer.serial, "0.4")
+        assert len(profiles) == 5
+
+    async def test_wrong_access_code_rejected(self, broker, manager):
+        """Test the broker refuses a wrong access code like a printer does."""
+        printer = broker.add_printer(VirtualPrinter("00M09A000000003"))
+
+        await manager.connect(printer.serial, "127.0.0.1", "wrong", port=broker.port)
+        await asyncio.sleep(0.5)
+
+        # (is_connected() may still be True within the disconnect grace period)
+        assert not broker.subscribed(printer.serial)
+        assert manager.get_state(printer.serial).ams_units == []
+
+    async def test_traffic_reaches_state_callback(self, broker, manager):
+        """Test scripted report traffic from several printers is delivered."""
+        printers = [broker.add_printer(VirtualPrinter(f"00M09A00000001{i}")) for i in range(3)]
+        updates = {p.serial: 0 for p in printers}
+
+        def on_state(serial, state):
+            updates[serial] += 1
+
+        manager.set_state_callback(on_state)
+        for printer in printers:
+            await manager.connect(printer.serial, "127.0.0.1", printer.access_code, port=broker.port)
+        await broker.wait_subscribed()
+
+        await broker.run_traffic(rate=20.0, duration=0.5)
+        await _wait_for(lambda: all(count >= 10 for count in updates.values()))
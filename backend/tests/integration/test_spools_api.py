@@ -152,3 +152,226 @@ class TestSpoolsDatabase:
         assert updated is not None
         assert updated.weight_current == 900
         assert updated.consumed_since_weight == 0  # Reset after scale reading
+
+
+class TestSpoolListSync:
+    """Test conditional and incremental spool list fetches."""
+
+    async def test_etag_not_modified(self, async_client, spool_factory):
+        """Test If-None-Match returns 304 until a spool changes."""
+        spool = await spool_factory()
+        response = await async_client.get("/api/spools")
+        etag = response.headers["etag"]
+
+        response = await async_client.get("/api/spools", headers={"If-None-Match": etag})
+        assert response.status_code == 304
+        assert response.content == b""
+
+        await async_client.put(f"/api/spools/{spool.id}", json={"note": "changed"})
+        response = await async_client.get("/api/spools", headers={"If-None-Match": etag})
+        assert response.status_code == 200
+        assert response.headers["etag"] != etag
+
+    async def test_since_returns_changes(self, async_client, spool_factory):
+        """Test ?since= returns changed spools, archives and deletions."""
+        kept = await spool_factory(material="PLA")
+        archived = await spool_factory(material="PETG")
+        deleted = await spool_factory(material="ABS")
+        since = (await async_client.get("/api/spools", params={"since": 0})).json()["revision"]
+
+        await async_client.post(f"/api/spools/{archived.id}/archive")
+        await async_client.delete(f"/api/spools/{deleted.id}")
+
+        response = await async_client.get("/api/spools", params={"since": since})
+        assert response.status_code == 200
+        data = response.json()
+        assert data["full"] is False
+        assert data["revision"] == since + 2
+        assert [s["id"] for s in data["spools"]] == [archived.id]
+        assert data["spools"][0]["archived_at"] is not None
+        assert data["deleted"] == [deleted.id]
+        assert kept.id not in [s["id"] for s in data["spools"]]
+
+    async def test_since_unknown_revision_returns_full(self, async_client, spool_factory):
+        """Test a revision from the future (replaced database) gets the full list."""
+        await spool_factory()
+
+        response = await async_client.get("/api/spools", params={"since": 10_000})
+        data = response.json()
+        assert data["full"] is True
+        assert len(data["spools"]) == 1
+
+    async def test_since_before_pruned_tombstones_returns_full(self, async_client, test_db, spool_factory):
+        """Test a revision older than the kept deletions gets the full list."""
+        kept = await spool_factory()
+        deleted = await spool_factory()
+        await async_client.delete(f"/api/spools/{deleted.id}")
+        await test_db.prune_spool_tombstones(keep=0)
+
+        data = (await async_client.get("/api/spools", params={"since": 1})).json()
+        assert data["full"] is True
+        assert [s["id"] for s in data["spools"]] == [kept.id]
+
+        revision = await test_db.get_spool_revision()
+        data = (await async_client.get("/api/spools", params={"since": revision})).json()
+        assert data["full"] is False
+
+    async def test_since_negative_rejected(self, async_client):
+        """Test a negative revision is rejected."""
+        response = await async_client.get("/api/spools", params={"since": -1})
+        assert response.status_code == 422
+
+
+class TestUsageHistoryAPI:
+    """Test usage history paging and aggregates via API."""
+
+    async def test_history_cursor_pages(self, async_client, test_db, spool_factory, printer_factory):
+        """Test X-Next-Cursor walks the global history without gaps or repeats."""
+        spool = await spool_factory()
+        printer = await printer_factory()
+        for i in range(5):
+            await test_db.log_usage(spool.id, printer.serial, f"print{i}.gcode", 1.0)
+
+        response = await async_client.get("/api/spools/usage/history", params={"limit": 3})
+        assert response.status_code == 200
+        first = [row["print_name"] for row in response.json()]
+        cursor = response.headers["x-next-cursor"]
+
+        response = await async_client.get("/api/spools/usage/history", params={"limit": 3, "cursor": cursor})
+        second = [row["print_name"] for row in response.json()]
+        assert "x-next-cursor" not in response.headers
+        assert first + second == [f"print{i}.gcode" for i in reversed(range(5))]
+
+    async def test_spool_history_cursor(self, async_client, test_db, spool_factory, printer_factory):
+        """Test per-spool history pages only contain that spool."""
+        spool1 = await spool_factory()
+        spool2 = await spool_factory()
+        printer = await printer_factory()
+        for i in range(4):
+            await test_db.log_usage(spool1.id, printer.serial, f"a{i}.gcode", 1.0)
+            await test_db.log_usage(spool2.id, printer.serial, f"b{i}.gcode", 1.0)
+
+        response = await async_client.get(f"/api/spools/{spool1.id}/history", params={"limit": 2})
+        cursor = response.headers["x-next-cursor"]
+        response = await async_client.get(f"/api/spools/{spool1.id}/history", params={"limit": 2, "cursor": cursor})
+        assert [row["print_name"] for row in response.json()] == ["a1.gcode", "a0.gcode"]
+
+    async def test_history_invalid_cursor(self, async_client):
+        """Test a malformed cursor is rejected."""
+        response = await async_client.get("/api/spools/usage/history", params={"cursor": "yesterday"})
+        assert response.status_code == 400
+
+    async def test_usage_daily_and_totals(self, async_client, test_db, spool_factory, printer_factory):
+        """Test daily and total usage endpoints for spools and printers."""
+        spool = await spool_factory()
+        printer = await printer_factory()
+        await test_db.log_usage(spool.id, printer.serial, "print1.gcode", 12.5)
+        await test_db.log_usage(spool.id, printer.serial, "print2.gcode", 7.5)
+
+        response = await async_client.get(f"/api/spools/{spool.id}/usage/daily", params={"days": 7})
+        assert response.status_code == 200
+        [day] = response.json()
+        assert day["prints"] == 2
+        assert day["weight_used"] == 20.0
+
+        response = await async_client.get(f"/api/spools/{spool.id}/usage/totals")
+        assert response.json()["weight_used"] == 20.0
+        assert response.json()["last_day"] == day["day"]
+
+        response = await async_client.get(f"/api/printers/{printer.serial}/usage/daily")
+        assert [d["prints"] for d in response.json()] == [2]
+
+    async def test_usage_daily_not_found(self, async_client):
+        """Test daily usage of unknown spools and printers is 404."""
+        assert (await async_client.get("/api/spools/nope/usage/daily")).status_code == 404
+        assert (await async_client.get("/api/printers/nope/usage/daily")).status_code == 404
+
+
+class TestSpoolBatchAPI:
+    """Test bulk spool creation (NFC inventory registration)."""
+
+    async def test_batch_create(self, async_client):
+        """Test all spools are created, numbered in request order."""
+        batch = {
+            "spools": [
+                {"tag_id": "04:A1:B2:C3:D4:E5:F6", "material": "PLA", "brand": "Bambu"},
+                {"tag_id": "87:0D:51:00", "material": "PETG"},
+                {"material": "ABS"},
+            ]
+        }
+        response = await async_client.post("/api/spools/batch", json=batch)
+        assert response.status_code == 201
+
+        data = response.json()
+        assert data["skipped"] == []
+        created = [(await async_client.get(f"/api/spools/{spool_id}")).json() for spool_id in data["created"]]
+        assert [s["material"] for s in created] == ["PLA", "PETG", "ABS"]
+        numbers = [s["spool_number"] for s in created]
+        assert numbers == list(range(numbers[0], numbers[0] + 3))
+        assert len((await async_client.get("/api/spools")).json()) == 3
+
+    async def test_batch_skips_known_tags(self, async_client, spool_factory):
+        """Test tags already in the inventory (archived too) or repeated in the batch are skipped."""
+        await spool_factory(tag_id="AA:BB:CC:DD")
+        archived = await spool_factory(tag_id="11:22:33:44")
+        await async_client.post(f"/api/spools/{archived.id}/archive")
+
+        batch = {
+            "spools": [
+                {"tag_id": "AA:BB:CC:DD", "material": "PLA"},
+                {"tag_id": "11:22:33:44", "material": "PLA"},
+                {"tag_id": "55:66:77:88", "material": "PLA"},
+                {"tag_id": "55:66:77:88", "material": "PETG"},
+            ]
+        }
+        response = await async_client.post("/api/spools/batch", json=batch)
+        assert response.status_code == 201
+
+        data = response.json()
+        assert len(data["created"]) == 1
+        assert (await async_client.get(f"/api/spools/{data['created'][0]}")).json()["tag_id"] == "55:66:77:88"
+        assert data["skipped"] == ["AA:BB:CC:DD", "11:22:33:44", "55:66:77:88"]
+
+    async def test_batch_all_skipped(self, async_client, spool_factory):
+        """Test a batch of known tags creates nothing."""
+        await spool_factory(tag_id="AA:BB:CC:DD")
+        response = await async_client.post(
+            "/api/spools/batch", json={"spools": [{"tag_id": "AA:BB:CC:DD", "material": "PLA"}]}
+        )
+        assert response.status_code == 201
+        assert response.json() == {"created": [], "skipped": ["AA:BB:CC:DD"]}
+
+    async def test_batch_empty_rejected(self, async_client):
+        """Test an empty batch is rejected."""
+        response = await async_client.post("/api/spools/batch", json={"spools": []})
+        assert response.status_code == 422
+
+    async def test_known_tags(self, async_client, spool_factory):
+        """Test one request resolves which tags of a round are in the inventory."""
+        await spool_factory(tag_id="AA:BB:CC:DD")
+        archived = await spool_factory(tag_id="11:22:33:44")
+        await async_client.post(f"/api/spools/{archived.id}/archive")
+
+        response = await async_client.get("/api/spools/known-tags?tag_ids=55:66:77:88,11:22:33:44,AA:BB:CC:DD")
+        assert response.status_code == 200
+        assert response.json() == ["11:22:33:44", "AA:BB:CC:DD"]
+
+        too_many = ",".join(f"{i:08X}" for i in range(101))
+        assert (await async_client.get(f"/api/spools/known-tags?tag_ids={too_many}")).status_code == 400
+
+
+class TestSpoolListDelta:
+    """Incremental fetches carry only what changed (timings in tests/benchmark)."""
+
+    async def test_delta_smaller_than_full_list(self, async_client, test_db, spool_factory):
+        spools = [await spool_factory(color_name=f"Color {i}") for i in range(20)]
+        full = await async_client.get("/api/spools")
+        since = int(full.headers["etag"].strip('"'))
+
+        changed = {spools[3].id, spools[11].id}
+        for spool_id in changed:
+            await test_db.set_spool_weight(spool_id, 500)
+
+        delta = await async_client.get("/api/spools", params={"since": since})
+        assert {s["id"] for s in delta.json()["spools"]} == changed
+        assert len(delta.content) < len(full.content)
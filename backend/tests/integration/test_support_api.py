@@ -9,7 +9,12 @@ Tests cover:
 - System information
 """
 
+import base64
+import io
+import json
+import os
 import tempfile
+import zipfile
 from pathlib import Path
 from unittest.mock import MagicMock, patch
 
@@ -248,7 +253,7 @@ class TestSupportBundleAPI:
 
     async def test_get_bundle_success(self, async_client, test_db):
         """Test getting support bundle successfully."""
-        log_content = "2024-01-15 10:30:00,123 INFO [main] Test log\n"
+        log_content = "2024-01-15 10:30:00,123 INFO [main] Connected to 192.168.1.20\n"
 
         with tempfile.NamedTemporaryFile(mode="w", suffix=".log", delete=False) as f:
             f.write(log_content)
@@ -286,9 +291,60 @@ class TestSupportBundleAPI:
                 assert "attachment" in response.headers["content-disposition"]
                 assert "spoolbuddy-support-" in response.headers["content-disposition"]
                 assert ".zip" in response.headers["content-disposition"]
+
+                with zipfile.ZipFile(io.BytesIO(response.content)) as zf:
+                    assert zf.testzip() is None
+                    info = json.loads(zf.read("support-info.json"))
+                    assert info["application"]["version"]
+                    log = zf.read("spoolbuddy.log").decode()
+                    assert "Connected to [IP]" in log
+                    assert "192.168" not in log
         finally:
             temp_path.unlink()
 
+    async def _bundle(self, log_path: Path, support_info: dict | None = None) -> tuple[list[bytes], zipfile.ZipFile]:
+        from api.support import _stream_support_bundle
+
+        with patch("api.support.LOG_FILE", log_path):
+            chunks = [chunk async for chunk in _stream_support_bundle(support_info or {"test": True})]
+        return chunks, zipfile.ZipFile(io.BytesIO(b"".join(chunks)))
+
+    async def test_bundle_streams_log_in_chunks(self, tmp_path):
+        """Test large logs are emitted incrementally, sanitized across chunk boundaries."""
+        log_path = tmp_path / "spoolbuddy.log"
+        # Random payloads so compressed output can't stay buffered in the compressor
+        lines = [
+            f"2024-01-15 10:30:00,123 INFO [mqtt] {base64.b64encode(os.urandom(48)).decode()} 10.0.0.{i % 200} {i}\n"
+            for i in range(5000)
+        ]
+        log_path.write_text("".join(lines))
+
+        with patch("api.support.BUNDLE_CHUNK_SIZE", 4096):
+            chunks, zf = await self._bundle(log_path)
+
+        assert len(chunks) > 10
+        log = zf.read("spoolbuddy.log").decode()
+        assert log.count("\n") == 5000
+        assert "10.0.0." not in log
+        assert log.endswith(" [IP] 4999\n")
+
+    async def test_bundle_log_capped_to_whole_lines(self, tmp_path):
+        """Test only the newest lines within the size cap are included."""
+        log_path = tmp_path / "spoolbuddy.log"
+        log_path.write_text("".join(f"line {i:04d}\n" for i in range(1000)))  # 10 bytes per line
+
+        with patch("api.support.BUNDLE_LOG_MAX_BYTES", 95):
+            _, zf = await self._bundle(log_path)
+
+        assert zf.read("spoolbuddy.log").decode() == "".join(f"line {i:04d}\n" for i in range(991, 1000))
+
+    async def test_bundle_without_log(self, tmp_path):
+        """Test bundle is still valid when there is no log file."""
+        _, zf = await self._bundle(tmp_path / "missing.log", {"collected_at": "now"})
+
+        assert zf.namelist() == ["support-info.json"]
+        assert json.loads(zf.read("support-info.json")) == {"collected_at": "now"}
+
 
 class TestSystemInfoAPI:
     """Tests for system information endpoint."""
@@ -0,0 +1,149 @@
+"""Unit tests for the in-memory color catalog index."""
+
+import math
+import random
+
+import pytest
+from services.color_index import ColorIndex, hex_to_lab, normalize, trigrams
+
+
+def _entry(entry_id: int, manufacturer: str, color_name: str, hex_color: str, material: str | None = "PLA") -> dict:
+    return {
+        "id": entry_id,
+        "manufacturer": manufacturer,
+        "color_name": color_name,
+        "hex_color": hex_color,
+        "material": material,
+        "is_default": False,
+        "created_at": None,
+    }
+
+
+def _generated_catalog(count: int, seed: int = 1) -> list[dict]:
+    rng = random.Random(seed)
+    words = ["Red", "Blue", "Green", "Galaxy", "Silk", "Matte", "Jade", "Sunset", "Ocean", "Ash"]
+    materials = ["PLA", "PLA+", "PETG", "ABS", "TPU", None]
+    return [
+        _entry(
+            i,
+            f"Brand {i % 400}",
+            f"{rng.choice(words)} {rng.choice(words)} {i}",
+            f"#{rng.randrange(1 << 24):06X}",
+            rng.choice(materials),
+        )
+        for i in range(1, count + 1)
+    ]
+
+
+class TestHelpers:
+    def test_normalize(self):
+        assert normalize("  Bambu   Lab ") == "bambu lab"
+        assert normalize(None) == ""
+
+    def test_trigrams(self):
+        assert trigrams("PLA") == {"  p", " pl", "pla", "la "}
+        assert trigrams("") == set()
+
+    def test_hex_to_lab(self):
+        white = hex_to_lab("#FFFFFF")
+        assert white[0] == pytest.approx(100, abs=0.1)
+        assert white[1] == pytest.approx(0, abs=0.1)
+        assert hex_to_lab("000000")[0] == pytest.approx(0, abs=0.1)
+        assert hex_to_lab("#FF0000FF") == hex_to_lab("#FF0000")
+        assert hex_to_lab("#GGGGGG") is None
+        assert hex_to_lab("#FFF") is None
+
+
+class TestColorIndex:
+    @pytest.fixture
+    def index(self) -> ColorIndex:
+        index = ColorIndex()
+        index.load(
+            [
+                _entry(1, "Bambu Lab", "Jade White", "#FFFFFF"),
+                _entry(2, "Bambu Lab", "Jade White", "#F5F5F5", "PETG"),
+                _entry(3, "Bambu Lab", "Scarlet Red", "#DE4343"),
+                _entry(4, "Polymaker", "Galaxy Black", "#1A1A1A", "PLA+"),
+                _entry(5, "eSun", "Fire Engine Red", "#C12E1F", None),
+            ]
+        )
+        return index
+
+    def test_lookup(self, index):
+        assert index.lookup("Bambu Lab", "Jade White")["id"] == 1
+        assert index.lookup("bambu  lab", "JADE WHITE", "petg")["id"] == 2
+        assert index.lookup("Bambu Lab", "Jade White", "ABS") is None
+        assert index.lookup("Nobody", "Jade White") is None
+
+    def test_filter(self, index):
+        assert [e["id"] for e in index.filter("bambu")] == [1, 2, 3]
+        assert [e["id"] for e in index.filter(material="pla")] == [1, 3, 4]
+        assert [e["id"] for e in index.filter("bambu", "petg")] == [2]
+        assert [e["id"] for e in index.filter(limit=2)] == [1, 2]
+
+    def test_search_fuzzy(self, index):
+        results = index.search("polymakr galaxy")
+        assert results[0][0]["id"] == 4
+        assert 0 < results[0][1] <= 1
+        assert index.search("zzzz") == []
+
+    def test_search_filters(self, index):
+        assert [e["id"] for e, _ in index.search("engine red", manufacturer="esun")] == [5]
+
+    def test_nearest(self, index):
+        results = index.nearest("#DD4444", limit=2)
+        assert [e["id"] for e, _ in results] == [3, 5]
+        assert results[0][1] < results[1][1]
+
+    def test_nearest_material(self, index):
+        assert [e["id"] for e, _ in index.nearest("#FFFFFF", limit=1, material="PETG")] == [2]
+
+    def test_nearest_invalid(self, index):
+        assert index.nearest("nothex") == []
+
+    def test_upsert_reindexes(self, index):
+        index.upsert(_entry(3, "Bambu Lab", "Crimson", "#8B0000"))
+        assert index.lookup("Bambu Lab", "Scarlet Red") is None
+        assert index.lookup("Bambu Lab", "Crimson")["hex_color"] == "#8B0000"
+        assert index.search("scarlet") == []
+        assert len(index) == 5
+
+    def test_remove(self, index):
+        index.remove(4)
+        index.remove(99)
+        assert index.get(4) is None
+        assert index.filter("polymaker") == []
+        assert all(e["id"] != 4 for e, _ in index.nearest("#1A1A1A", limit=5))
+        assert len(index) == 4
+
+
+class TestGeneratedCatalog:
+    """Index answers on a synced-size catalog match brute force."""
+
+    @pytest.fixture(scope="class")
+    def catalog(self) -> list[dict]:
+        return _generated_catalog(50_000)
+
+    @pytest.fixture(scope="class")
+    def index(self, catalog) -> ColorIndex:
+        index = ColorIndex()
+        index.load(catalog)
+        return index
+
+    def test_nearest_matches_brute_force(self, index, catalog):
+        rng = random.Random(2)
+        labs = [(hex_to_lab(e["hex_color"]), e["id"]) for e in catalog]
+        for _ in range(20):
+            query = f"#{rng.randrange(1 << 24):06X}"
+            lab = hex_to_lab(query)
+            expected = [i for _, i in sorted((math.dist(lab, other), i) for other, i in labs)[:5]]
+            assert [e["id"] for e, _ in index.nearest(query, limit=5)] == expected
+
+    def test_lookup(self, index, catalog):
+        for entry in catalog[::5000]:
+            assert index.lookup(entry["manufacturer"].upper(), entry["color_name"])["id"] == entry["id"]
+
+    def test_search_exact_name_ranks_first(self, index, catalog):
+        entry = catalog[12_345]
+        results = index.search(f"{entry['manufacturer']} {entry['color_name']}", limit=3)
+        assert results[0][0]["id"] == entry["id"]
@@ -150,6 +150,94 @@ class TestUsageHistory:
         history = await test_db.get_usage_history(spool.id, limit=5)
         assert len(history) == 5
 
+    async def test_get_usage_history_keyset_pages(self, test_db, spool_factory, printer_factory):
+        """Test paging with (timestamp, id) cursors returns every row once, newest first."""
+        spool = await spool_factory()
+        printer = await printer_factory()
+
+        # Same second, so only the id breaks ties
+        for i in range(10):
+            await test_db.log_usage(spool.id, printer.serial, f"print{i}.gcode", 10.0)
+
+        seen = []
+        before = None
+        while True:
+            page = await test_db.get_usage_history(spool.id, limit=4, before=before)
+            seen.extend(row["print_name"] for row in page)
+            if len(page) < 4:
+                break
+            before = (page[-1]["timestamp"], page[-1]["id"])
+
+        assert seen == [f"print{i}.gcode" for i in reversed(range(10))]
+
+    async def test_usage_daily_aggregates(self, test_db, spool_factory, printer_factory):
+        """Test log_usage maintains daily per-spool and per-printer totals."""
+        spool1 = await spool_factory()
+        spool2 = await spool_factory()
+        printer = await printer_factory()
+
+        await test_db.log_usage(spool1.id, printer.serial, "print1.gcode", 10.0)
+        await test_db.log_usage(spool1.id, printer.serial, "print2.gcode", 20.0)
+        await test_db.log_usage(spool2.id, printer.serial, "print3.gcode", 5.0)
+
+        days = await test_db.get_usage_daily(spool_id=spool1.id)
+        assert [(d["prints"], d["weight_used"]) for d in days] == [(2, 30.0)]
+        days = await test_db.get_usage_daily(printer_serial=printer.serial)
+        assert [(d["prints"], d["weight_used"]) for d in days] == [(3, 35.0)]
+
+        totals = await test_db.get_usage_totals(spool1.id)
+        assert totals["prints"] == 2
+        assert totals["weight_used"] == 30.0
+        assert totals["first_day"] == totals["last_day"] == days[0]["day"]
+
+        # Deleting history rows takes them out of the aggregates
+        await test_db.conn.execute("DELETE FROM usage_history WHERE spool_id = ?", (spool2.id,))
+        await test_db.conn.commit()
+        assert await test_db.get_usage_daily(spool_id=spool2.id) == []
+        days = await test_db.get_usage_daily(printer_serial=printer.serial)
+        assert [(d["prints"], d["weight_used"]) for d in days] == [(2, 30.0)]
+
+    async def test_usage_aggregates_backfilled(self, test_db, spool_factory, printer_factory):
+        """Test aggregates are built from existing history when first created."""
+        spool = await spool_factory()
+        printer = await printer_factory()
+        await test_db.log_usage(spool.id, printer.serial, "print1.gcode", 10.0)
+        await test_db.log_usage(spool.id, printer.serial, "print2.gcode", 15.0)
+
+        # Database from before the aggregates existed
+        await test_db.conn.execute("DROP TABLE usage_daily_spool")
+        await test_db.conn.execute("DROP TABLE usage_daily_printer")
+        await test_db.conn.commit()
+        await test_db._run_migrations()
+
+        totals = await test_db.get_usage_totals(spool.id)
+        assert totals["prints"] == 2
+        assert totals["weight_used"] == 25.0
+
+    async def test_usage_aggregates_created_with_backfill(self, test_db, spool_factory, printer_factory, monkeypatch):
+        """Test a failed backfill leaves no aggregate tables, so the next start builds them again."""
+        import db.database as database
+
+        spool = await spool_factory()
+        printer = await printer_factory()
+        await test_db.log_usage(spool.id, printer.serial, "print1.gcode", 10.0)
+
+        await test_db.conn.execute("DROP TABLE usage_daily_spool")
+        await test_db.conn.execute("DROP TABLE usage_daily_printer")
+        await test_db.conn.commit()
+
+        # Interrupted between schema and backfill
+        monkeypatch.setattr(database, "USAGE_AGGREGATE_BACKFILL", "SELECT * FROM no_such_table;")
+        with pytest.raises(Exception, match="no_such_table"):
+            await test_db._run_migrations()
+        await test_db.conn.rollback()
+        async with test_db.conn.execute("SELECT name FROM sqlite_master WHERE name = 'usage_daily_spool'") as cursor:
+            assert await cursor.fetchone() is None
+
+        monkeypatch.undo()
+        await test_db._run_migrations()
+        assert (await test_db.get_usage_totals(spool.id))["prints"] == 1
+
 
 class TestSetSpoolWeight:
     """Test set_spool_weight uses Default Core Weight from settings."""
@@ -221,3 +309,138 @@ class TestSetSpoolWeight:
         assert updated is not None
         assert updated.weight_current == 1500
         assert updated.weight_used == 0  # Clamped to zero
+
+
+class TestPrinterKProfiles:
+    """Test the persisted per-printer K-profile store."""
+
+    async def test_get_printer_kprofiles_not_found(self, test_db, printer_factory):
+        """Test getting K-profiles that were never stored."""
+        printer = await printer_factory()
+        assert await test_db.get_printer_kprofiles(printer.serial, "0.4") is None
+
+    async def test_save_and_get_printer_kprofiles(self, test_db, printer_factory):
+        """Test storing K-profiles keeps them per nozzle diameter."""
+        printer = await printer_factory()
+        profiles = [{"cali_idx": 42, "name": "PLA Basic", "k_value": 0.025, "filament_id": "GFL05"}]
+
+        await test_db.save_printer_kprofiles(printer.serial, "0.4", profiles, fetched_at=1700000000)
+
+        stored = await test_db.get_printer_kprofiles(printer.serial, "0.4")
+        assert stored == (profiles, 1700000000)
+        assert await test_db.get_printer_kprofiles(printer.serial, "0.6") is None
+
+    async def test_save_printer_kprofiles_replaces(self, test_db, printer_factory):
+        """Test storing again replaces the previous profiles."""
+        printer = await printer_factory()
+        await test_db.save_printer_kprofiles(printer.serial, "0.4", [{"cali_idx": 1}], fetched_at=100)
+        await test_db.save_printer_kprofiles(printer.serial, "0.4", [], fetched_at=200)
+
+        assert await test_db.get_printer_kprofiles(printer.serial, "0.4") == ([], 200)
+
+
+class TestCreateSpools:
+    """Test bulk spool creation."""
+
+    async def test_taken_tags_skipped(self, test_db, spool_factory):
+        """Test tags taken before or within the batch are skipped, not failed."""
+        from models import SpoolCreate
+
+        await spool_factory(tag_id="AA:BB:CC:DD")
+        batch = [SpoolCreate(tag_id=t, material="PLA") for t in ["11:22:33:44", "AA:BB:CC:DD", "11:22:33:44"]]
+
+        created, skipped = await test_db.create_spools(batch)
+
+        assert len(created) == 1
+        assert skipped == ["AA:BB:CC:DD", "11:22:33:44"]
+        assert (await test_db.get_spool(created[0])).tag_id == "11:22:33:44"
+
+    async def test_failure_rolls_back(self, test_db, monkeypatch):
+        """Test a failing batch leaves no rows for a later commit to persist."""
+        from models import SpoolCreate
+
+        spool_row = test_db._spool_row
+        calls = []
+
+        def failing_row(*args):
+            calls.append(args)
+            if len(calls) == 2:
+                raise RuntimeError("boom")
+            return spool_row(*args)
+
+        monkeypatch.setattr(test_db, "_spool_row", failing_row)
+        batch = [SpoolCreate(tag_id=t, material="PLA") for t in ["11:22:33:44", "55:66:77:88"]]
+        with pytest.raises(RuntimeError):
+            await test_db.create_spools(batch)
+
+        await test_db.set_setting("after", "commit")
+        assert await test_db.get_known_tag_ids(["11:22:33:44", "55:66:77:88"]) == set()
+
+
+class TestSpoolRevisions:
+    """Test spool list revision tracking."""
+
+    async def test_changes_bump_revision(self, test_db, spool_factory):
+        """Test every insert, update and archive takes a new revision."""
+        start = await test_db.get_spool_revision()
+
+        spool = await spool_factory()
+        created = await test_db.get_spool(spool.id)
+        assert created.revision == start + 1
+
+        await test_db.set_spool_weight(spool.id, 900)
+        await test_db.archive_spool(spool.id)
+        archived = await test_db.get_spool(spool.id)
+        assert archived.revision == start + 3
+        assert await test_db.get_spool_revision() == start + 3
+
+    async def test_get_spool_changes(self, test_db, spool_factory):
+        """Test only spools changed after a revision are returned."""
+        first = await spool_factory(material="PLA")
+        await spool_factory(material="PETG")
+        since = await test_db.get_spool_revision()
+
+        await test_db.set_spool_weight(first.id, 700)
+
+        spools, deleted = await test_db.get_spool_changes(since)
+        assert [s.id for s in spools] == [first.id]
+        assert spools[0].weight_current == 700
+        assert deleted == []
+
+    async def test_delete_leaves_tombstone(self, test_db, spool_factory):
+        """Test deleting a spool is reported as a removal."""
+        spool = await spool_factory()
+        since = await test_db.get_spool_revision()
+
+        await test_db.delete_spool(spool.id)
+
+        spools, deleted = await test_db.get_spool_changes(since)
+        assert spools == []
+        assert deleted == [spool.id]
+        assert await test_db.get_spool_revision() == since + 1
+
+    async def test_prune_tombstones(self, test_db, spool_factory):
+        """Test old tombstones are pruned and the horizon follows."""
+        old = await spool_factory()
+        recent = await spool_factory()
+        await test_db.delete_spool(old.id)
+        pruned_at = await test_db.get_spool_revision()
+        await test_db.delete_spool(recent.id)
+
+        assert await test_db.prune_spool_tombstones(keep=1) == 1
+        assert await test_db.get_spool_tombstone_horizon() == pruned_at
+        _, deleted = await test_db.get_spool_changes(pruned_at)
+        assert deleted == [recent.id]
+        assert await test_db.prune_spool_tombstones(keep=1) == 0
+
+    async def test_usage_bumps_revision(self, test_db, spool_factory, printer_factory):
+        """Test logging usage marks the spool changed (last_used_time)."""
+        spool = await spool_factory()
+        printer = await printer_factory()
+        since = await test_db.get_spool_revision()
+
+        await test_db.log_usage(spool.id, printer.serial, "print.gcode", 5.0)
+
+        spools, _ = await test_db.get_spool_changes(since)
+        assert [s.id for s in spools] == [spool.id]
+        assert spools[0].last_used_time is not None
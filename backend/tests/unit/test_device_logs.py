@@ -0,0 +1,198 @@
+"""Unit tests for device log parsing, the ring store and the UDP receiver."""
+
+import asyncio
+import socket
+
+import pytest
+from services.device_logs import DeviceLogReceiver, LogStore, levels_at_or_above, parse_line
+
+
+class TestParseLine:
+    """Tests for device log line parsing."""
+
+    def test_esp_idf_line(self):
+        assert parse_line("W (12345) backend_client: Failed to fetch printers") == (
+            "W",
+            "backend_client",
+            12345,
+            "Failed to fetch printers",
+        )
+
+    def test_rust_module_path_tag(self):
+        assert parse_line("I (99) spoolbuddy::ota_manager: Delta applied: 1.2 MB") == (
+            "I",
+            "spoolbuddy::ota_manager",
+            99,
+            "Delta applied: 1.2 MB",
+        )
+
+    def test_esp_idf_line_with_ansi_colour(self):
+        assert parse_line("\x1b[0;31mE (42) nfc: read error: timeout\x1b[0m") == ("E", "nfc", 42, "read error: timeout")
+
+    def test_bracket_line(self):
+        assert parse_line("[WARN] scale not stable") == ("W", None, None, "scale not stable")
+
+    def test_unknown_format_is_info(self):
+        assert parse_line("UDP logger initialized") == ("I", None, None, "UDP logger initialized")
+
+    def test_levels_at_or_above(self):
+        assert levels_at_or_above(None) == "EWIDV"
+        assert levels_at_or_above("W") == "EW"
+        assert levels_at_or_above("info") == "EWI"
+        with pytest.raises(ValueError):
+            levels_at_or_above("X")
+
+
+class TestLogStore:
+    """Tests for the ring store and its queries."""
+
+    def _fill(self, store: LogStore, count: int, device: str = "10.0.0.2"):
+        store.append(device, [f"{'EWI'[i % 3]} ({i}) tag{i % 2}: line {i}" for i in range(count)])
+
+    def test_tail_and_filters(self):
+        store = LogStore(capacity=100)
+        self._fill(store, 30, "10.0.0.2")
+        self._fill(store, 30, "10.0.0.3")
+
+        assert [e.message for e in store.tail(2)] == ["line 28", "line 29"]
+        assert all(e.device == "10.0.0.3" for e in store.tail(5, device="10.0.0.3"))
+        assert [e.level for e in store.tail(4, device="10.0.0.2", level="E")] == ["E"] * 4
+        assert {e.level for e in store.tail(100, level="W")} == {"E", "W"}
+        assert len(store.tail(100, level="W")) == 40
+        assert [e.message for e in store.tail(3, tag="tag1", contains="line 2")] == ["line 25", "line 27", "line 29"]
+        assert store.tail(10, device="10.9.9.9") == []
+        assert store.devices() == ["10.0.0.2", "10.0.0.3"]
+
+    def test_tail_entries_in_sequence_order(self):
+        store = LogStore(capacity=100)
+        self._fill(store, 20)
+        seqs = [e.seq for e in store.tail(100, level="W")]
+        assert seqs == sorted(seqs)
+
+    def test_ring_evicts_oldest_and_keeps_indexes_consistent(self):
+        store = LogStore(capacity=50)
+        self._fill(store, 40, "10.0.0.2")
+        self._fill(store, 40, "10.0.0.3")
+
+        assert len(store) == 50
+        assert store.oldest_seq == 31
+        assert [e.seq for e in store.tail(100)] == list(range(31, 81))
+        assert len(store.tail(100, device="10.0.0.2")) == 10
+        assert len(store.tail(100, device="10.0.0.3")) == 40
+        assert len(store.tail(100, level="E")) == sum(1 for e in store.tail(100) if e.level == "E")
+
+        # Fully evicted devices disappear from the index
+        self._fill(store, 50, "10.0.0.3")
+        assert store.devices() == ["10.0.0.3"]
+
+    def test_batch_evicting_own_device_keeps_index(self):
+        store = LogStore(capacity=3)
+        store.append("10.0.0.2", ["I (1) a: one"])
+        store.append("10.0.0.3", ["I (1) b: one", "I (1) b: two"])
+        # First line evicts the device's only entry, the rest wrap over 10.0.0.3
+        store.append("10.0.0.2", ["I (1) a: two", "I (1) a: three", "I (1) a: four"])
+
+        assert store.devices() == ["10.0.0.2"]
+        assert [e.message for e in store.tail(10, device="10.0.0.2")] == ["two", "three", "four"]
+
+        # Interleaved devices keep wrapping without losing either index
+        for i in range(10):
+            store.append("10.0.0.3", [f"I (1) b: {i}"])
+            store.append("10.0.0.2", [f"I (1) a: {i}", f"I (1) a: {i}b"])
+        assert store.devices() == ["10.0.0.2", "10.0.0.3"]
+        assert [e.message for e in store.tail(10, device="10.0.0.3")] == ["9"]
+        assert [e.message for e in store.tail(10, device="10.0.0.2")] == ["9", "9b"]
+
+    def test_since_cursor_paging(self):
+        store = LogStore(capacity=100)
+        self._fill(store, 10)
+
+        entries, cursor, dropped = store.since(0, limit=4)
+        assert [e.seq for e in entries] == [1, 2, 3, 4]
+        assert (cursor, dropped) == (4, 0)
+
+        entries, cursor, _ = store.since(cursor)
+        assert [e.seq for e in entries] == list(range(5, 11))
+        assert cursor == 10
+
+        assert store.since(cursor) == ([], 10, 0)
+
+    def test_since_with_filter(self):
+        store = LogStore(capacity=100)
+        self._fill(store, 12, "10.0.0.2")
+        self._fill(store, 12, "10.0.0.3")
+
+        entries, cursor, _ = store.since(5, level="E", limit=3)
+        assert [(e.seq, e.level) for e in entries] == [(7, "E"), (10, "E"), (13, "E")]
+        assert cursor == 13
+
+        entries, cursor, _ = store.since(cursor, device="10.0.0.3")
+        assert [e.seq for e in entries] == list(range(14, 25))
+        assert cursor == 24
+
+    def test_since_reports_dropped(self):
+        store = LogStore(capacity=10)
+        self._fill(store, 25)
+
+        entries, cursor, dropped = store.since(3)
+        assert dropped == 12
+        assert [e.seq for e in entries] == list(range(16, 26))
+        assert cursor == 25
+
+    async def test_wait_for_entries(self):
+        store = LogStore(capacity=10)
+        assert await store.wait_for_entries(0, timeout=0.01) is False
+
+        waiter = asyncio.create_task(store.wait_for_entries(0, timeout=5))
+        await asyncio.sleep(0)
+        store.append("10.0.0.2", ["I (1) main: hello"])
+        assert await waiter is True
+
+
+class TestDeviceLogReceiver:
+    """Tests for batched UDP reads."""
+
+    @pytest.fixture
+    def sockets(self):
+        receiver = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        receiver.bind(("127.0.0.1", 0))
+        sender = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        yield receiver, sender
+        receiver.close()
+        sender.close()
+
+    def test_drain_reads_queued_datagrams_as_one_batch(self, sockets):
+        receiver_sock, sender = sockets
+        store = LogStore(capacity=100)
+        receiver = DeviceLogReceiver(store, receiver_sock, echo=False)
+        for i in range(20):
+            sender.sendto(f"I ({i}) main: line {i}\n".encode(), receiver_sock.getsockname())
+
+        assert receiver.drain() == 20
+        assert receiver.drain() == 0
+        assert receiver.batches == 1
+        assert [e.message for e in store.tail(100)] == [f"line {i}" for i in range(20)]
+        assert store.devices() == ["127.0.0.1"]
+
+    def test_drain_skips_empty_datagrams(self, sockets):
+        receiver_sock, sender = sockets
+        store = LogStore(capacity=100)
+        receiver = DeviceLogReceiver(store, receiver_sock, echo=False)
+        sender.sendto(b"\r\n", receiver_sock.getsockname())
+        sender.sendto(b"[ERROR] boom", receiver_sock.getsockname())
+
+        assert receiver.drain() == 2
+        assert [(e.level, e.message) for e in store.tail(10)] == [("E", "boom")]
+
+    async def test_receives_on_event_loop(self, sockets):
+        receiver_sock, sender = sockets
+        store = LogStore(capacity=100)
+        receiver = DeviceLogReceiver(store, receiver_sock, echo=False)
+        receiver.start()
+        try:
+            sender.sendto(b"W (7) wifi: disconnected", receiver_sock.getsockname())
+            assert await store.wait_for_entries(0, timeout=5)
+        finally:
+            receiver.stop()
+
+        assert store.tail(1)[0].tag == "wifi"
@@ -0,0 +1,122 @@
+"""Unit tests for binary firmware deltas."""
+
+import random
+from pathlib import Path
+
+import pytest
+from services.firmware_delta import (
+    BLOCK_SIZE,
+    HEADER,
+    DeltaError,
+    apply_delta,
+    make_delta,
+    read_header,
+)
+
+RELEASES_DIR = Path(__file__).resolve().parents[3] / "firmware" / "releases"
+
+
+def _image(size: int, seed: int = 1) -> bytes:
+    """Firmware-like image: code-ish random runs, repeated tables and 0xFF padding."""
+    rng = random.Random(seed)
+    out = bytearray(b"\xe9\x05\x02\x20")
+    table = rng.randbytes(512)
+    while len(out) < size:
+        kind = rng.random()
+        if kind < 0.7:
+            out += rng.randbytes(rng.randint(64, 4096))
+        elif kind < 0.9:
+            out += table
+        else:
+            out += b"\xff" * rng.randint(16, 2048)
+    return bytes(out[:size])
+
+
+def _edit(image: bytes, seed: int = 2) -> tuple[bytes, int]:
+    """Insert, replace and delete a few regions; returns (new image, changed bytes)."""
+    rng = random.Random(seed)
+    new = bytearray(image)
+    changed = 0
+    for _ in range(5):
+        pos = rng.randrange(len(new))
+        patch = rng.randbytes(rng.randint(16, 1024))
+        action = rng.choice(("insert", "replace", "delete"))
+        if action == "insert":
+            new[pos:pos] = patch
+        elif action == "replace":
+            new[pos : pos + len(patch)] = patch
+        else:
+            del new[pos : pos + len(patch)]
+        changed += len(patch)
+    return bytes(new), changed
+
+
+class TestFirmwareDelta:
+    """Tests for make_delta / apply_delta."""
+
+    def test_roundtrip_identical(self):
+        image = _image(200_000)
+        delta = make_delta(image, image)
+
+        assert apply_delta(image, delta) == image
+        assert len(delta) < HEADER.size + 32
+
+    def test_delta_size_tracks_changes(self):
+        old = _image(500_000)
+        new, changed = _edit(old)
+        delta = make_delta(old, new)
+
+        assert apply_delta(old, delta) == new
+        # Literal bytes plus realignment slack around each edit
+        assert len(delta) < changed + 5 * 4 * BLOCK_SIZE + 512
+
+    def test_unrelated_images(self):
+        old = _image(50_000, seed=1)
+        new = _image(60_000, seed=99)
+
+        assert apply_delta(old, make_delta(old, new)) == new
+
+    @pytest.mark.parametrize(
+        ("old", "new"),
+        [(b"", b""), (b"", b"new image"), (b"old image", b""), (b"short", b"short but longer")],
+    )
+    def test_small_and_empty(self, old, new):
+        assert apply_delta(old, make_delta(old, new)) == new
+
+    def test_header(self):
+        old, new = _image(10_000), _image(12_000, seed=3)
+        source_size, target_size, source_sha, target_sha = read_header(make_delta(old, new))
+
+        assert (source_size, target_size) == (len(old), len(new))
+        assert len(source_sha) == len(target_sha) == 32
+
+    def test_rejects_wrong_source(self):
+        old = _image(20_000)
+        new, _ = _edit(old)
+        delta = make_delta(old, new)
+
+        with pytest.raises(DeltaError, match="Source image"):
+            apply_delta(old[:-1] + b"\x00", delta)
+
+    def test_rejects_corrupt_delta(self):
+        old = _image(20_000)
+        new, _ = _edit(old)
+        delta = bytearray(make_delta(old, new))
+
+        with pytest.raises(DeltaError):
+            apply_delta(old, b"XXXX" + bytes(delta[4:]))
+        with pytest.raises(DeltaError):
+            apply_delta(old, bytes(delta[:-1]))
+        delta[HEADER.size - 1] ^= 0xFF  # Target SHA-256
+        with pytest.raises(DeltaError, match="SHA-256"):
+            apply_delta(old, bytes(delta))
+
+    @pytest.mark.skipif(not any(RELEASES_DIR.glob("*.bin")), reason="no release image")
+    def test_release_image(self):
+        """Small edits to a real firmware image give a delta of about the edited size."""
+        old = next(RELEASES_DIR.glob("*.bin")).read_bytes()
+        new, changed = _edit(old, seed=7)
+        delta = make_delta(old, new)
+
+        assert apply_delta(old, delta) == new
+        assert len(delta) < len(old) // 100
@@ -0,0 +1,134 @@
+"""Unit tests for the runtime metrics registry."""
+
+import pytest
+from db.database import statement_label
+from metrics import DB_QUERY_SECONDS, Registry
+
+
+class TestRegistry:
+    """Tests for metric types and text rendering."""
+
+    def test_counter_labels(self):
+        registry = Registry()
+        counter = registry.counter("test_total", "Test counter", ("printer",))
+        counter.inc("A")
+        counter.inc("A")
+        counter.inc("B", amount=3)
+
+        assert counter.value("A") == 2
+        assert counter.value("B") == 3
+        assert counter.value("C") == 0
+        text = registry.render()
+        assert "# HELP test_total Test counter\n# TYPE test_total counter\n" in text
+        assert 'test_total{printer="A"} 2\n' in text
+        assert 'test_total{printer="B"} 3\n' in text
+
+    def test_gauge_without_labels(self):
+        registry = Registry()
+        gauge = registry.gauge("test_clients", "Clients")
+        gauge.set(value=4)
+        gauge.set(value=2)
+
+        assert "# TYPE test_clients gauge\ntest_clients 2\n" in registry.render()
+
+    def test_histogram_buckets_are_cumulative(self):
+        registry = Registry()
+        histogram = registry.histogram("test_seconds", "Latency", ("route",), buckets=(0.1, 1.0))
+        histogram.observe(0.05, "/a")
+        histogram.observe(0.1, "/a")  # upper bounds are inclusive
+        histogram.observe(0.5, "/a")
+        histogram.observe(5.0, "/a")
+
+        assert histogram.count("/a") == 4
+        assert histogram.total("/a") == pytest.approx(5.65)
+        text = registry.render()
+        assert 'test_seconds_bucket{route="/a",le="0.1"} 2\n' in text
+        assert 'test_seconds_bucket{route="/a",le="1"} 3\n' in text
+        assert 'test_seconds_bucket{route="/a",le="+Inf"} 4\n' in text
+        assert 'test_seconds_count{route="/a"} 4\n' in text
+        assert 'test_seconds_sum{route="/a"} 5.65\n' in text
+
+    def test_label_values_escaped(self):
+        registry = Registry()
+        registry.counter("test_total", "Test", ("name",)).inc('say "hi"\n')
+
+        assert 'test_total{name="say \\"hi\\"\\n"} 1' in registry.render()
+
+    def test_duplicate_name_rejected(self):
+        registry = Registry()
+        registry.counter("test_total", "Test")
+
+        with pytest.raises(ValueError):
+            registry.gauge("test_total", "Test")
+
+
+class TestDatabaseMetrics:
+    """Tests for SQLite statement timing."""
+
+    @pytest.mark.parametrize(
+        ("sql", "label"),
+        [
+            ("SELECT * FROM spools WHERE id = ?", "SELECT spools"),
+            ("  select count(*)\n  from usage_history", "SELECT usage_history"),
+            ("INSERT OR REPLACE INTO settings (key, value) VALUES (?, ?)", "INSERT settings"),
+            ("UPDATE spools SET weight_used = ? WHERE id = ?", "UPDATE spools"),
+            ("DELETE FROM spool_assignments WHERE printer_serial = ?", "DELETE spool_assignments"),
+            ("SELECT s.*, (SELECT MAX(timestamp) FROM usage_history) FROM spools s", "SELECT spools"),
+            ("PRAGMA table_info(spools)", "PRAGMA"),
+            ("ALTER TABLE spools ADD COLUMN x TEXT", "ALTER"),
+        ],
+    )
+    def test_statement_label(self, sql, label):
+        assert statement_label(sql) == label
+
+    async def test_queries_are_timed(self, test_db):
+        before = DB_QUERY_SECONDS.count("SELECT spools")
+
+        await test_db.get_spools()
+        async with test_db.conn.execute("SELECT COUNT(*) FROM spools") as cursor:
+            await cursor.fetchone()
+
+        assert DB_QUERY_SECONDS.count("SELECT spools") == before + 2
+
+
+class TestRequestMetrics:
+    """Tests for request labelling by the metrics middleware."""
+
+    async def test_static_paths_share_one_series(self, tmp_path):
+        from fastapi import FastAPI
+        from fastapi.staticfiles import StaticFiles
+        from httpx import ASGITransport, AsyncClient
+        from metrics import HTTP_REQUEST_SECONDS, RequestMetricsMiddleware
+
+        (tmp_path / "index.html").write_text("<html></html>")
+        app = FastAPI()
+        app.add_middleware(RequestMetricsMiddleware)
+
+        @app.get("/api/items/{item_id}")
+        async def get_item(item_id: int):
+            return {"id": item_id}
+
+        app.mount("/", StaticFiles(directory=tmp_path, html=True), name="static")
+
+        series_before = len(HTTP_REQUEST_SECONDS._series)
+        static_before = HTTP_REQUEST_SECONDS.count("GET", "static", 404)
+        async with AsyncClient(transport=ASGITransport(app=app), base_url="http://test") as client:
+            for i in range(20):
+                await client.get(f"/probe-{i}.php")
+            await client.get("/api/items/1")
+            await client.get("/api/items/2")
+
+        assert HTTP_REQUEST_SECONDS.count("GET", "static", 404) == static_before + 20
+        assert HTTP_REQUEST_SECONDS.count("GET", "/api/items/{item_id}", 200) >= 2
+        assert len(HTTP_REQUEST_SECONDS._series) <= series_before + 2
+
+    def test_mount_route_label(self):
+        from metrics import _route_label
+        from starlette.routing import Mount
+
+        # Starlette routers record the Mount itself as the route
+        mount = Mount("/", app=lambda scope, receive, send: None)
+        assert (
+            _route_label({"route": mount, "path": "/wp-login.php", "path_params": {"path": "wp-login.php"}}) == "static"
+        )
+        assert _route_label({"path": "/nothing"}) == "unmatched"
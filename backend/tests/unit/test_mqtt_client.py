@@ -6,6 +6,7 @@ Tests cover:
 - AMS and tray parsing
 - Dual-nozzle support
 - Calibration profile handling
+- K-profile store (stale-while-revalidate)
 - Command generation
 - Pending assignment lifecycle
 """
@@ -437,6 +438,120 @@ class TestCalibrationResponse:
         assert all("k_value" in c for c in cals)
 
 
+class TestKProfileStore:
+    """Tests for the stale-while-revalidate K-profile cache."""
+
+    @staticmethod
+    def _connected_conn():
+        conn = PrinterConnection(
+            serial="00M09A123456789",
+            ip_address="192.168.1.100",
+            access_code="12345678",
+        )
+        conn._connected = True
+        conn._client = MagicMock()
+        conn._client.publish.return_value = MagicMock(rc=0)
+        return conn
+
+    def test_broadcast_for_other_nozzle_is_cached(self, sample_calibration_profiles):
+        """Test responses for a nozzle nobody is waiting on still fill the cache."""
+        conn = self._connected_conn()
+        conn._pending_kprofile_response = MagicMock()
+        conn._expected_kprofile_nozzle = "0.4"
+
+        conn._handle_calibration_response(
+            {"command": "extrusion_cali_get", "nozzle_diameter": "0.6", "filaments": sample_calibration_profiles}
+        )
+
+        assert conn.has_kprofiles("0.6")
+        assert len(conn._kprofile_cache["0.6"][0]) == 3
+        assert conn._kprofiles == []
+        conn._pending_kprofile_response.set.assert_not_called()
+
+    def test_changed_profiles_are_reported(self, sample_calibration_profiles):
+        """Test the update callback fires only when the profiles change."""
+        conn = self._connected_conn()
+        conn._loop = MagicMock()
+        conn._on_kprofiles_update = MagicMock()
+        data = {"command": "extrusion_cali_get", "nozzle_diameter": "0.4", "filaments": sample_calibration_profiles}
+
+        conn._handle_calibration_response(data)
+        conn._handle_calibration_response(data)
+
+        assert conn._loop.call_soon_threadsafe.call_count == 1
+        conn._loop.call_soon_threadsafe.call_args[0][0]()
+        serial, nozzle, profiles = conn._on_kprofiles_update.call_args[0]
+        assert (serial, nozzle, len(profiles)) == ("00M09A123456789", "0.4", 3)
+
+    async def test_stale_profiles_served_and_refreshed(self):
+        """Test expired profiles are returned at once while a refresh runs in the background."""
+        conn = self._connected_conn()
+        cached = [{"cali_idx": 1, "name": "Old"}]
+        conn._kprofile_cache["0.4"] = (cached, time.time() - 3600)
+
+        with patch.object(conn, "_fetch_kprofiles", AsyncMock(return_value=[])) as fetch:
+            result = await conn.get_kprofiles("0.4")
+            assert result is cached
+            await conn._kprofile_refresh_tasks["0.4"]
+
+        fetch.assert_awaited_once()
+        assert "0.4" not in conn._kprofile_refresh_tasks
+
+    async def test_fresh_profiles_skip_printer(self):
+        """Test fresh profiles are returned without a request."""
+        conn = self._connected_conn()
+        conn._kprofile_cache["0.4"] = ([{"cali_idx": 1}], time.time())
+
+        with patch.object(conn, "_fetch_kprofiles", AsyncMock()) as fetch:
+            assert await conn.get_kprofiles("0.4") == [{"cali_idx": 1}]
+
+        fetch.assert_not_called()
+        assert conn._kprofile_refresh_tasks == {}
+
+    async def test_seeded_profiles_served_offline(self):
+        """Test persisted profiles are served while disconnected and revalidated later."""
+        conn = self._connected_conn()
+        conn._connected = False
+        conn.seed_kprofiles("0.4", [{"cali_idx": 7}], 1700000000)
+
+        assert await conn.get_kprofiles("0.4") == [{"cali_idx": 7}]
+        assert "0.4" in conn._kprofile_stale
+        assert conn._kprofile_refresh_tasks == {}
+
+    def test_seed_does_not_override_live_profiles(self):
+        """Test seeding leaves profiles already received from the printer alone."""
+        conn = self._connected_conn()
+        conn._kprofile_cache["0.4"] = ([{"cali_idx": 1}], time.time())
+
+        conn.seed_kprofiles("0.4", [{"cali_idx": 7}], 1700000000)
+
+        assert conn._kprofile_cache["0.4"][0] == [{"cali_idx": 1}]
+        assert "0.4" not in conn._kprofile_stale
+
+    def test_set_k_value_invalidates_nozzle(self):
+        """Test a successful set_k_value marks that nozzle's profiles stale."""
+        conn = self._connected_conn()
+        conn._kprofile_cache["0.4"] = ([{"cali_idx": 1}], time.time())
+
+        assert conn.set_k_value(tray_id=1, k_value=0.03, nozzle_diameter="0.4")
+        assert "0.4" in conn._kprofile_stale
+
+    def test_set_calibration_invalidates_nozzle(self):
+        """Test a successful set_calibration marks that nozzle's profiles stale."""
+        conn = self._connected_conn()
+
+        assert conn.set_calibration(ams_id=0, tray_id=1, cali_idx=42, nozzle_diameter="0.6")
+        assert conn._kprofile_stale == {"0.6"}
+
+    def test_failed_publish_keeps_profiles_fresh(self):
+        """Test a failed publish does not invalidate anything."""
+        conn = self._connected_conn()
+        conn._client.publish.return_value = MagicMock(rc=1)
+
+        assert not conn.set_k_value(tray_id=1, k_value=0.03, nozzle_diameter="0.4")
+        assert conn._kprofile_stale == set()
+
+
 class TestSetFilamentCommand:
     """Tests for set_filament command generation."""
 
@@ -0,0 +1,129 @@
+"""Unit tests for the compact filament preset feed."""
+
+import struct
+
+from models import SlicerPreset
+from services.preset_feed import (
+    BRAND_SIZE,
+    FEED_FORMAT,
+    FEED_MAGIC,
+    FLAG_CUSTOM,
+    FLAG_USER,
+    HEADER,
+    MATERIAL_SIZE,
+    MATERIALS,
+    NO_BRAND,
+    RECORD,
+    RECORD_SIZE,
+    build_feed,
+    parse_brand,
+    parse_material,
+    temp_range,
+)
+
+
+def _preset(setting_id: str, name: str, is_custom: bool = False) -> SlicerPreset:
+    return SlicerPreset(setting_id=setting_id, name=name, type="filament", is_custom=is_custom)
+
+
+def _decode(feed: bytes):
+    magic, fmt, brand_count, material_count, _, count, record_size = HEADER.unpack_from(feed)
+    pos = HEADER.size
+    brands = [
+        feed[pos + i * BRAND_SIZE : pos + (i + 1) * BRAND_SIZE].rstrip(b"\0").decode() for i in range(brand_count)
+    ]
+    pos += brand_count * BRAND_SIZE
+    materials = [
+        feed[pos + i * MATERIAL_SIZE : pos + (i + 1) * MATERIAL_SIZE].rstrip(b"\0").decode()
+        for i in range(material_count)
+    ]
+    pos += material_count * MATERIAL_SIZE
+    records = []
+    for i in range(count):
+        sid, name, brand_id, material_id, flags, _, t_min, t_max = RECORD.unpack_from(feed, pos + i * record_size)
+        records.append(
+            {
+                "setting_id": sid.rstrip(b"\0").decode(),
+                "name": name.rstrip(b"\0").decode(),
+                "brand": brands[brand_id] if brand_id != NO_BRAND else None,
+                "material": materials[material_id],
+                "flags": flags,
+                "temp": (t_min, t_max),
+            }
+        )
+    assert len(feed) == pos + count * record_size
+    return magic, fmt, record_size, records
+
+
+class TestNameParsing:
+    """Tests for the server-side name heuristics."""
+
+    def test_parse_material(self):
+        assert parse_material("Bambu PETG HF @BBL X1C") == "PETG"
+        assert parse_material("Generic ABS") == "ABS"
+        assert parse_material("Mystery Filament") == "PLA"
+
+    def test_parse_brand_known(self):
+        assert parse_brand("Devil Design PLA @BBL H2D") == "Devil Design"
+        assert parse_brand("# Polymaker PolyLite PLA") == "Polymaker"
+
+    def test_parse_brand_before_material(self):
+        assert parse_brand("Acme PETG @BBL P1S") == "Acme"
+        assert parse_brand("PLA Basic") == ""
+
+    def test_temp_range(self):
+        assert temp_range("PETG") == (220, 260)
+        assert temp_range("NYLON") == (250, 290)
+        assert temp_range("HIPS") == (190, 230)
+
+
+class TestBuildFeed:
+    """Tests for feed layout, dedupe and sorting."""
+
+    def test_layout(self):
+        feed = build_feed([_preset("GFSL05_07", "Bambu PLA Basic @BBL X1C")])
+        magic, fmt, record_size, records = _decode(feed)
+
+        assert magic == FEED_MAGIC
+        assert fmt == FEED_FORMAT
+        assert record_size == RECORD_SIZE
+        assert records == [
+            {
+                "setting_id": "GFSL05_07",
+                "name": "Bambu PLA Basic @BBL X1C",
+                "brand": "Bambu",
+                "material": "PLA",
+                "flags": 0,
+                "temp": (190, 230),
+            }
+        ]
+
+    def test_dedupes_and_sorts_custom_first(self):
+        feed = build_feed(
+            [
+                _preset("GFG99", "Generic PETG"),
+                _preset("PFUS123", "# My ABS", is_custom=True),
+                _preset("GFA00", "Bambu ABS"),
+                _preset("GFG99", "Generic PETG (duplicate)"),
+            ]
+        )
+        _, _, _, records = _decode(feed)
+
+        assert [r["setting_id"] for r in records] == ["PFUS123", "GFA00", "GFG99"]
+        assert records[0]["flags"] == FLAG_CUSTOM | FLAG_USER
+        assert records[0]["temp"] == (240, 280)
+
+    def test_limit_and_shared_brand_table(self):
+        presets = [_preset(f"GFSL{i:02d}", f"Bambu PLA {i:02d}") for i in range(10)]
+        feed = build_feed(presets, limit=3)
+        _, _, _, records = _decode(feed)
+
+        assert len(records) == 3
+        assert struct.unpack_from("<B", feed, 5)[0] == 1  # One brand entry for all records
+        assert len(MATERIALS) == struct.unpack_from("<B", feed, 6)[0]
+
+    def test_long_names_truncated_on_char_boundary(self):
+        feed = build_feed([_preset("GFX1", "é" * 40)])
+        _, _, _, records = _decode(feed)
+
+        assert records[0]["name"] == "é" * 31
@@ -0,0 +1,281 @@
+"""Unit tests for the serial console bridge, using a pty pair as the device."""
+
+import asyncio
+import os
+import select
+import sys
+
+import pytest
+from api import serial as serial_api
+from api.serial import SerialBridge, SerialSubscriber, forward_serial_output
+
+pytestmark = pytest.mark.skipif(sys.platform == "win32", reason="needs a pty pair")
+
+
+class PtyPort:
+    """Stands in for serial.Serial on the pty's device side."""
+
+    def __init__(self, fd: int):
+        self.fd = fd
+        self.is_open = True
+
+    def fileno(self) -> int:
+        return self.fd
+
+    def close(self):
+        # The fixture closes the fd
+        self.is_open = False
+
+
+class ThreadedPtyPort:
+    """Port without fileno(), forcing the reader-thread fallback."""
+
+    def __init__(self, fd: int, timeout: float = 0.05):
+        self.fd = fd
+        self.timeout = timeout
+
+    @property
+    def in_waiting(self) -> int:
+        return 0
+
+    def read(self, size: int) -> bytes:
+        readable, _, _ = select.select([self.fd], [], [], self.timeout)
+        return os.read(self.fd, max(size, 4096)) if readable else b""
+
+
+class FakeWebSocket:
+    def __init__(self):
+        self.messages = []
+
+    async def send_json(self, message):
+        self.messages.append(message)
+
+
+@pytest.fixture
+def pty_pair():
+    """(host fd, device fd) - bytes written to the host fd are read from the device fd."""
+    import tty
+
+    host, device = os.openpty()
+    tty.setraw(device)
+    os.set_blocking(device, False)
+    yield host, device
+    for fd in (host, device):
+        try:
+            os.close(fd)
+        except OSError:
+            pass
+
+
+async def _write(fd: int, data: bytes):
+    """Write from a thread: large writes block until the bridge reads the pty."""
+    view = memoryview(data)
+    while view:
+        view = view[await asyncio.to_thread(os.write, fd, view) :]
+
+
+async def _collect(subscriber: SerialSubscriber, size: int, timeout: float = 5.0) -> tuple[bytes, list[bytes], int]:
+    frames, dropped = [], 0
+    async with asyncio.timeout(timeout):
+        while sum(map(len, frames)) < size:
+            frame, lost = await subscriber.next_frame()
+            frames.append(frame)
+            dropped += lost
+    return b"".join(frames), frames, dropped
+
+
+class TestSerialBridge:
+    """Tests for SerialBridge framing, buffering and error handling."""
+
+    async def test_coalesces_burst_into_one_frame(self, pty_pair):
+        host, device = pty_pair
+        bridge = SerialBridge(PtyPort(device), frame_interval=0.1)
+        subscriber = bridge.subscribe()
+        bridge.start()
+        try:
+            for i in range(50):
+                os.write(host, f"line {i}\n".encode())
+            data, frames, dropped = await _collect(subscriber, sum(len(f"line {i}\n") for i in range(50)))
+        finally:
+            bridge.stop()
+
+        assert data == b"".join(f"line {i}\n".encode() for i in range(50))
+        assert len(frames) == 1
+        assert dropped == 0
+
+    async def test_frames_capped_at_frame_max(self, pty_pair):
+        host, device = pty_pair
+        payload = bytes(range(256)) * 64  # 16 KB
+        bridge = SerialBridge(PtyPort(device), frame_max=4096)
+        subscriber = bridge.subscribe()
+        bridge.start()
+        try:
+            writer = asyncio.create_task(_write(host, payload))
+            data, frames, _ = await _collect(subscriber, len(payload))
+            await writer
+        finally:
+            bridge.stop()
+
+        assert data == payload
+        assert all(len(frame) <= 4096 for frame in frames)
+
+    async def test_slow_consumer_drops_oldest_and_counts(self, pty_pair):
+        host, device = pty_pair
+        payload = bytes(range(256)) * 16  # 4 KB
+        bridge = SerialBridge(PtyPort(device), buffer_max=1024)
+        subscriber = bridge.subscribe()
+        bridge.start()
+        try:
+            await _write(host, payload)
+            # Consumer is busy while the whole payload arrives
+            while subscriber._dropped + len(subscriber._buffer) < len(payload):
+                await asyncio.sleep(0.01)
+            data, _, dropped = await _collect(subscriber, 1024)
+        finally:
+            bridge.stop()
+
+        assert data == payload[-1024:]
+        assert dropped == len(payload) - 1024
+
+    async def test_reader_thread_fallback(self, pty_pair):
+        host, device = pty_pair
+        bridge = SerialBridge(ThreadedPtyPort(device))
+        subscriber = bridge.subscribe()
+        bridge.start()
+        try:
+            os.write(host, b"boot: ok\r\n")
+            data, _, _ = await _collect(subscriber, 10)
+        finally:
+            bridge.stop()
+
+        assert data == b"boot: ok\r\n"
+
+    async def test_device_gone_raises_after_buffered_output(self, pty_pair):
+        host, device = pty_pair
+        bridge = SerialBridge(PtyPort(device))
+        subscriber = bridge.subscribe()
+        bridge.start()
+        os.write(host, b"last words")
+        data, _, _ = await _collect(subscriber, 10)
+        os.close(host)
+
+        with pytest.raises((OSError, EOFError)):
+            async with asyncio.timeout(5):
+                await subscriber.next_frame()
+        assert data == b"last words"
+
+
+class TestForwardSerialOutput:
+    """Tests for forwarding bridge frames to the WebSocket."""
+
+    async def test_multibyte_character_split_across_frames(self, pty_pair):
+        host, device = pty_pair
+        websocket = FakeWebSocket()
+        bridge = SerialBridge(PtyPort(device), frame_interval=0.01)
+        subscriber = bridge.subscribe()
+        bridge.start()
+        task = asyncio.create_task(forward_serial_output(subscriber, websocket))
+        try:
+            os.write(host, "temp 21°".encode()[:-1])
+            await asyncio.sleep(0.2)
+            os.write(host, "temp 21°".encode()[-1:] + b"C\n")
+            async with asyncio.timeout(5):
+                while "".join(m["data"] for m in websocket.messages) != "temp 21°C\n":
+                    await asyncio.sleep(0.01)
+        finally:
+            bridge.stop()
+            task.cancel()
+
+        assert len(websocket.messages) == 2
+        assert all(m["type"] == "data" and "dropped" not in m for m in websocket.messages)
+
+    async def test_reports_dropped_bytes(self, pty_pair):
+        host, device = pty_pair
+        websocket = FakeWebSocket()
+        bridge = SerialBridge(PtyPort(device), buffer_max=100)
+        subscriber = bridge.subscribe()
+        bridge.start()
+        os.write(host, b"x" * 300)
+        while subscriber._dropped + len(subscriber._buffer) < 300:
+            await asyncio.sleep(0.01)
+        task = asyncio.create_task(forward_serial_output(subscriber, websocket))
+        try:
+            async with asyncio.timeout(5):
+                while not websocket.messages:
+                    await asyncio.sleep(0.01)
+        finally:
+            bridge.stop()
+            task.cancel()
+
+        assert websocket.messages[0] == {"type": "data", "data": "x" * 100, "dropped": 200}
+
+    async def test_sends_error_when_port_fails(self, pty_pair):
+        host, device = pty_pair
+        websocket = FakeWebSocket()
+        bridge = SerialBridge(PtyPort(device))
+        subscriber = bridge.subscribe()
+        bridge.start()
+        os.close(host)
+
+        async with asyncio.timeout(5):
+            await forward_serial_output(subscriber, websocket)
+
+        assert websocket.messages[-1]["type"] == "error"
+
+
+class TestSharedBridge:
+    """Tests for several WebSocket clients on one port."""
+
+    @pytest.fixture
+    def active_port(self, pty_pair, monkeypatch):
+        host, device = pty_pair
+        monkeypatch.setattr(serial_api, "_active_port", PtyPort(device))
+        monkeypatch.setattr(serial_api, "_active_bridge", None)
+        return host
+
+    async def test_two_clients_share_the_port(self, active_port):
+        host = active_port
+        first, second = FakeWebSocket(), FakeWebSocket()
+        sub_first, sub_second = serial_api._subscribe(), serial_api._subscribe()
+        bridge = serial_api._active_bridge
+        tasks = [
+            asyncio.create_task(forward_serial_output(sub_first, first)),
+            asyncio.create_task(forward_serial_output(sub_second, second)),
+        ]
+
+        async def received(websocket, text):
+            async with asyncio.timeout(5):
+                while "".join(m["data"] for m in websocket.messages) != text:
+                    await asyncio.sleep(0.01)
+
+        try:
+            os.write(host, b"both\n")
+            await received(first, "both\n")
+            await received(second, "both\n")
+
+            # First client leaves; the second keeps reading the same fd
+            serial_api._unsubscribe(sub_first)
+            tasks[0].cancel()
+            os.write(host, b"still here\n")
+            await received(second, "both\nstill here\n")
+            assert serial_api._active_bridge is bridge
+
+            serial_api._unsubscribe(sub_second)
+            assert serial_api._active_bridge is None
+        finally:
+            for task in tasks:
+                task.cancel()
+
+        assert first.messages == [{"type": "data", "data": "both\n"}]
+
+    async def test_disconnect_stops_bridge_and_notifies_clients(self, active_port):
+        websocket = FakeWebSocket()
+        subscriber = serial_api._subscribe()
+        task = asyncio.create_task(forward_serial_output(subscriber, websocket))
+
+        await serial_api.disconnect_serial()
+
+        async with asyncio.timeout(5):
+            await task
+        assert serial_api._active_bridge is None
+        assert websocket.messages[-1]["type"] == "error"
@@ -7,6 +7,7 @@
 #include "display_driver.h"
 #include "lvgl.h"
 #include "ui.h"  // EEZ generated UI
+#include "ui_log.h"
 
 #include <string.h>
 #include "esp_lcd_panel_ops.h"
@@ -92,13 +93,13 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
     // Always log flushes after the first 5 if they're for a new screen (y1 == 0 could indicate full redraw)
     bool is_likely_full_redraw = (area->y1 == 0 && area->x1 == 0);
     if (flush_count <= 10 || is_likely_full_redraw) {
-        ESP_LOGI(TAG, "flush_cb #%d: area=(%ld,%ld)-(%ld,%ld), panel=%p, active=%p",
-                 flush_count, (long)area->x1, (long)area->y1, (long)area->x2, (long)area->y2,
-                 panel_handle, lv_screen_active());
+        UI_LOGI("flush_cb #%d: area=(%ld,%ld)-(%ld,%ld), panel=%p, active=%p",
+                flush_count, (long)area->x1, (long)area->y1, (long)area->x2, (long)area->y2,
+                panel_handle, lv_screen_active());
     }
 
     if (panel_handle == NULL) {
-        ESP_LOGE(TAG, "flush_cb: panel_handle is NULL!");
+        UI_LOGE("flush_cb: panel_handle is NULL!");
         lv_display_flush_ready(disp);
         return;
     }
@@ -108,11 +109,11 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
     esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 1, &fb);
 
     if (flush_count <= 5) {
-        ESP_LOGI(TAG, "flush_cb: fb=%p", fb);
+        UI_LOGI("flush_cb: fb=%p", fb);
     }
 
     if (fb == NULL) {
-        ESP_LOGE(TAG, "flush_cb: framebuffer is NULL!");
+        UI_LOGE("flush_cb: framebuffer is NULL!");
         lv_display_flush_ready(disp);
         return;
     }
@@ -124,8 +125,8 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
     int height = area->y2 - area->y1 + 1;
 
     if (flush_count <= 5) {
-        ESP_LOGI(TAG, "flush_cb #%d: copying %d rows, width=%d, src=%p",
-                 flush_count, height, width, src);
+        UI_LOGI("flush_cb #%d: copying %d rows, width=%d, src=%p",
+                flush_count, height, width, src);
     }
 
     for (int y = area->y1; y <= area->y2; y++) {
@@ -135,18 +136,18 @@ static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 
         // Log every 10th row for first few flushes
         if (flush_count <= 3 && (y - area->y1) % 10 == 0) {
-            ESP_LOGI(TAG, "flush_cb #%d: row %d done", flush_count, y);
+            UI_LOGI("flush_cb #%d: row %d done", flush_count, y);
         }
     }
 
     if (flush_count <= 5) {
-        ESP_LOGI(TAG, "flush_cb #%d: memcpy done, calling flush_ready", flush_count);
+        UI_LOGI("flush_cb #%d: memcpy done, calling flush_ready", flush_count);
     }
 
     lv_display_flush_ready(disp);
 
     if (flush_count <= 5) {
-        ESP_LOGI(TAG, "flush_cb #%d: flush_ready returned", flush_count);
+        UI_LOGI("flush_cb #%d: flush_ready returned", flush_count);
     }
 }
 
@@ -483,8 +484,8 @@ void display_tick(void)
     flush_before_timer = flush_count;
 
     if (tick_count <= 10 || tick_count % 200 == 0) {
-        ESP_LOGI(TAG, "tick #%d before lv_timer_handler, flush=%d, active=%p",
-                 tick_count, flush_count, lv_screen_active());
+        UI_LOGI("tick #%d before lv_timer_handler, flush=%d, active=%p",
+                tick_count, flush_count, lv_screen_active());
     }
 
     lv_timer_handler();
@@ -492,14 +493,14 @@ void display_tick(void)
     // Log if any flushes happened during timer_handler
     int flushes_this_tick = flush_count - flush_before_timer;
     if (tick_count <= 10 || tick_count % 200 == 0 || flushes_this_tick > 0) {
-        ESP_LOGI(TAG, "tick #%d after lv_timer, flush=%d (+%d this tick), active=%p",
-                 tick_count, flush_count, flushes_this_tick, lv_screen_active());
+        UI_LOGI("tick #%d after lv_timer, flush=%d (+%d this tick), active=%p",
+                tick_count, flush_count, flushes_this_tick, lv_screen_active());
     }
 
     ui_tick();
 
     if (tick_count <= 10 || tick_count % 200 == 0) {
-        ESP_LOGI(TAG, "tick #%d after ui_tick", tick_count);
+        UI_LOGI("tick #%d after ui_tick", tick_count);
     }
 }
 
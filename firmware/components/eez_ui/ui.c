@@ -13,21 +13,21 @@
 #include "ui_internal.h"
 #include "ui_nfc.h"
 #include "ui_nfc_card.h"
+#include "ui_keyboard.h"
+#include "ui_log.h"
+#include "ui_mem_arena.h"
 #include "ui_status_bar.h"
 #include "screens.h"
+#ifdef UI_SCREEN_TABLES
+#include "ui_screen_table.h"
+#endif
 #include "images.h"
 #include "actions.h"
 #include "vars.h"
 #include <stdio.h>
 #include <string.h>
 
-#ifdef ESP_PLATFORM
-#include "esp_log.h"
 static const char *TAG = "ui";
-#define UI_LOGI(fmt, ...) ESP_LOGI(TAG, fmt, ##__VA_ARGS__)
-#else
-#define UI_LOGI(fmt, ...) printf("[ui] " fmt "\n", ##__VA_ARGS__)
-#endif
 
 // =============================================================================
 // IMPORTANT: STALE POINTER WARNING
@@ -73,6 +73,10 @@ void ui_tick() {
     tick_screen(g_currentScreen);
 }
 
+uint32_t ui_tick_wait_ms(void) {
+    return 0;  // Flow runs every tick
+}
+
 #else
 
 // =============================================================================
@@ -126,7 +130,10 @@ void loadScreen(enum ScreensEnum screenId) {
     if (screen) {
         lv_screen_load(screen);
         lv_obj_invalidate(screen);
+        // Rendering fills caches (decoded images, layers) that outlive the screen
+        ui_mem_arena_t *arena = ui_mem_arena_suspend();
         lv_refr_now(NULL);
+        ui_mem_arena_end(arena);
     }
 }
 
@@ -291,11 +298,29 @@ void delete_all_screens(void) {
     }
 }
 
+// Build an EEZ screen. With UI_SCREEN_TABLES the generated descriptor table
+// is used (see ui_screen_table.h); the EEZ code stays as fallback.
+static void create_eez_screen(enum ScreensEnum id, void (*create_fn)(void)) {
+#ifdef UI_SCREEN_TABLES
+    const ui_screen_table_t *table = ui_screen_table_get(id);
+    if (table) {
+        ui_screen_table_create(table);
+        return;
+    }
+#else
+    (void)id;
+#endif
+    create_fn();
+}
+
 // =============================================================================
 // Main Entry Points
 // =============================================================================
 
 void ui_init() {
+    // Drains deferred log records on the device (the simulator drains from its main loop)
+    ui_log_init();
+
     // Load saved printers from NVS
     load_printers_from_nvs();
 
@@ -306,16 +331,30 @@ void ui_init() {
         lv_display_set_theme(dispp, theme);
     }
 
+    // Shared on-screen keyboard, kept on the top layer across screens
+    ui_keyboard_init();
+
     // Show splash screen first
     create_splash_screen();
     loadScreen(SCREEN_ID_SPLASH_SCREEN);
 }
 
+// Backend/UI status poll period
+#define UI_POLL_PERIOD_MS 100
+
 static int tick_count = 0;
+static uint32_t last_poll_ms = 0;
+
+uint32_t ui_tick_wait_ms(void) {
+    if (pendingScreen != 0) return 0;
+    uint32_t elapsed = lv_tick_elaps(last_poll_ms);
+    return elapsed >= UI_POLL_PERIOD_MS ? 0 : UI_POLL_PERIOD_MS - elapsed;
+}
+
 void ui_tick() {
     tick_count++;
     if (tick_count % 500 == 0) {
-        UI_LOGI("ui_tick #%d", tick_count);
+        UI_LOGD("ui_tick #%d", tick_count);
     }
     if (pendingScreen != 0) {
         enum ScreensEnum screen = pendingScreen;
@@ -344,7 +383,8 @@ void ui_tick() {
         // This prevents LVGL from having an invalid active screen during transition
         if (screen == SCREEN_ID_NFC_SCREEN || screen == SCREEN_ID_SCALE_CALIBRATION_SCREEN ||
             screen == SCREEN_ID_KEYBOARD_LAYOUT_SCREEN) {
-            // Create the new programmatic screen
+            // Create the new programmatic screen in its own arena
+            ui_mem_arena_t *prev_arena = ui_mem_arena_begin(UI_MEM_ARENA_SCREEN);
             if (screen == SCREEN_ID_NFC_SCREEN) {
                 create_nfc_screen();
             } else if (screen == SCREEN_ID_SCALE_CALIBRATION_SCREEN) {
@@ -354,6 +394,8 @@ void ui_tick() {
             }
             // Load it immediately so LVGL has a valid active screen
             loadScreen(screen);
+            ui_mem_arena_bind(lv_scr_act());
+            ui_mem_arena_end(prev_arena);
             // Now delete old EEZ screens (programmatic screens are protected in cleanup)
             delete_all_screens();
             // Clean up splash if we were on it
@@ -363,15 +405,16 @@ void ui_tick() {
         } else {
             // Standard EEZ screen transition
             delete_all_screens();
+            ui_mem_arena_t *prev_arena = ui_mem_arena_begin(UI_MEM_ARENA_SCREEN);
 
             switch ((int)screen) {
                 case SCREEN_ID_MAIN_SCREEN:
-                    create_screen_main_screen();
+                    create_eez_screen(SCREEN_ID_MAIN_SCREEN, create_screen_main_screen);
                     wire_main_buttons();
                     ui_nfc_card_init();
                     break;
                 case SCREEN_ID_AMS_OVERVIEW:
-                    create_screen_ams_overview();
+                    create_eez_screen(SCREEN_ID_AMS_OVERVIEW, create_screen_ams_overview);
                     // Hide AMS panel immediately after creation to prevent flicker
                     // Must happen BEFORE any potential render cycle
                     if (objects.ams_screen_ams_panel) {
@@ -380,42 +423,35 @@ void ui_tick() {
                     wire_ams_overview_buttons();
                     break;
                 case SCREEN_ID_SCAN_RESULT:
-                    create_screen_scan_result();
+                    create_eez_screen(SCREEN_ID_SCAN_RESULT, create_screen_scan_result);
                     wire_scan_result_buttons();
                     ui_scan_result_init();
                     break;
                 case SCREEN_ID_SPOOL_DETAILS:
-                    create_screen_spool_details();
+                    create_eez_screen(SCREEN_ID_SPOOL_DETAILS, create_screen_spool_details);
                     wire_spool_details_buttons();
                     break;
                 case SCREEN_ID_SETTINGS_SCREEN:
-                    create_screen_settings_screen();
-                    wire_settings_buttons();
-                    wire_printers_tab();
-                    update_printers_list();  // Refresh printer list after returning from edit
-                    update_wifi_ui_state();
-                    if (pending_settings_tab >= 0) {
-                        select_settings_tab(pending_settings_tab);
-                        pending_settings_tab = -1;
-                    }
+                    create_settings_screen();
+                    wire_settings_buttons();  // Builds and selects pending_settings_tab
                     break;
                 case SCREEN_ID_SETTINGS_WIFI_SCREEN:
-                    create_screen_settings_wifi_screen();
+                    create_eez_screen(SCREEN_ID_SETTINGS_WIFI_SCREEN, create_screen_settings_wifi_screen);
                     wire_settings_subpage_buttons(objects.settings_wifi_screen_top_bar_icon_back);
                     wire_wifi_settings_buttons();
                     break;
                 case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN:
-                    create_screen_settings_printer_add_screen();
+                    create_eez_screen(SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN, create_screen_settings_printer_add_screen);
                     wire_settings_subpage_buttons(objects.settings_printer_add_screen_top_bar_icon_back);
                     wire_printer_add_buttons();
                     break;
                 case SCREEN_ID_SETTINGS_DISPLAY_SCREEN:
-                    create_screen_settings_display_screen();
+                    create_eez_screen(SCREEN_ID_SETTINGS_DISPLAY_SCREEN, create_screen_settings_display_screen);
                     wire_settings_subpage_buttons(objects.settings_display_screen_top_bar_icon_back);
                     wire_display_buttons();
                     break;
                 case SCREEN_ID_SETTINGS_UPDATE_SCREEN:
-                    create_screen_settings_update_screen();
+                    create_eez_screen(SCREEN_ID_SETTINGS_UPDATE_SCREEN, create_screen_settings_update_screen);
                     wire_settings_subpage_buttons(objects.settings_update_screen_top_bar_icon_back);
                     wire_update_buttons();
                     break;
@@ -429,6 +465,8 @@ void ui_tick() {
             } else if (screen == SCREEN_ID_AMS_OVERVIEW) {
                 ui_status_bar_init(false);
             }
+            ui_mem_arena_bind(lv_scr_act());
+            ui_mem_arena_end(prev_arena);
 
             // Clean up splash screen AFTER loading new screen to avoid "active screen deleted" warning
             if ((int)leavingScreen == SCREEN_ID_SPLASH_SCREEN) {
@@ -441,11 +479,9 @@ void ui_tick() {
         update_backend_ui();
     }
 
-    // Poll backend/UI status (every ~20 ticks = 100ms for faster updates)
-    static int wifi_poll_counter = 0;
-    wifi_poll_counter++;
-    if (wifi_poll_counter >= 20) {
-        wifi_poll_counter = 0;
+    // Poll backend/UI status every 100ms (by time, so callers may skip idle ticks)
+    if (lv_tick_elaps(last_poll_ms) >= UI_POLL_PERIOD_MS) {
+        last_poll_ms = lv_tick_get();
 
         // Update WiFi settings screen if active
         int screen_id = currentScreen + 1;
@@ -457,9 +493,9 @@ void ui_tick() {
         update_firmware_ui();
 
         // Update backend status UI (main screen printer info)
-        UI_LOGI("Calling update_backend_ui");
+        UI_LOGD("Calling update_backend_ui");
         update_backend_ui();
-        UI_LOGI("update_backend_ui returned");
+        UI_LOGD("update_backend_ui returned");
 
         // Update NFC card on main screen and AMS overview (tag popup should appear on both)
         if (screen_id == SCREEN_ID_MAIN_SCREEN || screen_id == SCREEN_ID_AMS_OVERVIEW) {
@@ -4,6 +4,8 @@
  */
 
 #include "ui_ams_slot_modal.h"
+#include "ui_keyboard.h"
+#include "ui_mem_arena.h"
 #include "screens.h"
 #include "lvgl.h"
 #include <stdio.h>
@@ -42,12 +44,6 @@ static const char *TAG = "ui_ams_slot_modal";
 #define EXT_RAM_BSS_ATTR
 #endif
 
-// Material types for parsing preset names
-static const char *MATERIAL_TYPES[] = {
-    "PLA", "PETG", "ABS", "ASA", "TPU", "PC", "PA", "NYLON", "PVA", "HIPS", "PP", "PET"
-};
-#define MATERIAL_TYPES_COUNT 12
-
 // Quick colors (basic palette)
 static const struct { const char *name; const char *hex; } QUICK_COLORS[] = {
     { "White", "FFFFFF" },
@@ -146,7 +142,6 @@ static lv_obj_t *g_color_preview = NULL;
 static lv_obj_t *g_configure_btn = NULL;
 static lv_obj_t *g_error_label = NULL;
 static lv_obj_t *g_colors_container = NULL;
-static lv_obj_t *g_keyboard = NULL;
 static lv_obj_t *g_search_ta = NULL;
 static lv_obj_t *g_left_col = NULL;
 static lv_obj_t *g_right_col = NULL;
@@ -222,124 +217,12 @@ static bool is_user_preset(const char *setting_id) {
     return !(strncmp(setting_id, "GF", 2) == 0 || strncmp(setting_id, "P1", 2) == 0);
 }
 
-// Parse material from preset name
-static const char *parse_material(const char *name) {
-    // Convert to uppercase for comparison
-    char upper[128];
-    size_t len = strlen(name);
-    if (len >= sizeof(upper)) len = sizeof(upper) - 1;
-    for (size_t i = 0; i < len; i++) {
-        upper[i] = toupper((unsigned char)name[i]);
-    }
-    upper[len] = '\0';
-
-    for (int i = 0; i < MATERIAL_TYPES_COUNT; i++) {
-        if (strstr(upper, MATERIAL_TYPES[i])) {
-            return MATERIAL_TYPES[i];
-        }
-    }
-    return "PLA";  // Default
-}
-
-// Known filament brands for parsing
-static const char *KNOWN_BRANDS[] = {
-    "BAMBU", "BBL", "POLYMAKER", "POLYLITE", "POLYTERRA", "POLYMAX",
-    "ESUN", "SUNLU", "OVERTURE", "HATCHBOX", "PRUSAMENT", "PRUSA",
-    "DEVIL DESIGN", "DEVIL", "ELEGOO", "CREALITY", "INLAND", "AMAZON",
-    "MATTERHACKERS", "PROTOPASTA", "FILLAMENTUM", "COLORFABB",
-    "ATOMIC", "3DXTECH", "PRILINE", "DURAMIC", "TINMORRY", "IIIDMAX",
-    "ZIRO", "ERYONE", "GEEETECH", "ANYCUBIC", "FLASHFORGE"
-};
-#define KNOWN_BRANDS_COUNT 33
-
-// Parse brand from preset name (e.g., "Devil Design PLA @h2d" -> "Devil Design")
-static void parse_brand(const char *name, char *brand_out, size_t brand_len) {
-    brand_out[0] = '\0';
-
-    // Remove @ suffix first (e.g., "@bbl" or "@h2d")
-    char clean_name[128];
-    strncpy(clean_name, name, sizeof(clean_name) - 1);
-    clean_name[sizeof(clean_name) - 1] = '\0';
-    char *at_pos = strchr(clean_name, '@');
-    if (at_pos) *at_pos = '\0';
-
-    // Strip "# " prefix for custom presets
-    char *start = clean_name;
-    if (strncmp(start, "# ", 2) == 0) start += 2;
-
-    // Convert to uppercase for comparison
-    char upper[128];
-    size_t len = strlen(start);
-    if (len >= sizeof(upper)) len = sizeof(upper) - 1;
-    for (size_t i = 0; i < len; i++) {
-        upper[i] = toupper((unsigned char)start[i]);
-    }
-    upper[len] = '\0';
-
-    // Check for known brands
-    for (int i = 0; i < KNOWN_BRANDS_COUNT; i++) {
-        if (strstr(upper, KNOWN_BRANDS[i])) {
-            // Found a brand - extract original case version
-            const char *brand_upper = KNOWN_BRANDS[i];
-            size_t brand_upper_len = strlen(brand_upper);
-
-            // Find position in original string
-            char *pos = strstr(upper, brand_upper);
-            if (pos) {
-                size_t offset = pos - upper;
-                size_t copy_len = brand_upper_len;
-                if (copy_len >= brand_len) copy_len = brand_len - 1;
-
-                // Copy from original (preserving case of original name)
-                strncpy(brand_out, start + offset, copy_len);
-                brand_out[copy_len] = '\0';
-                return;
-            }
-        }
-    }
-
-    // No known brand found - try to extract first word(s) before material type
-    // e.g., "eSun PLA+" -> "eSun"
-    for (int i = 0; i < MATERIAL_TYPES_COUNT; i++) {
-        char *mat_pos = strstr(upper, MATERIAL_TYPES[i]);
-        if (mat_pos && mat_pos > upper) {
-            size_t offset = mat_pos - upper;
-            // Go back to trim trailing space
-            while (offset > 0 && start[offset - 1] == ' ') offset--;
-            if (offset > 0 && offset < brand_len) {
-                strncpy(brand_out, start, offset);
-                brand_out[offset] = '\0';
-                return;
-            }
-        }
-    }
-}
-
-// Parse preset name into brand and material, store in globals
-static void parse_preset_info(const char *name) {
-    g_selected_brand[0] = '\0';
-    g_selected_material[0] = '\0';
-
-    if (!name || !name[0]) return;
-
-    // Parse brand
-    parse_brand(name, g_selected_brand, sizeof(g_selected_brand));
-
-    // Parse material
-    const char *material = parse_material(name);
-    strncpy(g_selected_material, material, sizeof(g_selected_material) - 1);
-}
-
-// Get temperature range for material
-static void get_temp_range(const char *material, int *temp_min, int *temp_max) {
-    if (strstr(material, "PLA")) { *temp_min = 190; *temp_max = 230; }
-    else if (strstr(material, "PETG")) { *temp_min = 220; *temp_max = 260; }
-    else if (strstr(material, "ABS")) { *temp_min = 240; *temp_max = 280; }
-    else if (strstr(material, "ASA")) { *temp_min = 240; *temp_max = 280; }
-    else if (strstr(material, "TPU")) { *temp_min = 200; *temp_max = 240; }
-    else if (strstr(material, "PC")) { *temp_min = 260; *temp_max = 300; }
-    else if (strstr(material, "PA") || strstr(material, "NYLON")) { *temp_min = 250; *temp_max = 290; }
-    else { *temp_min = 190; *temp_max = 230; }
+// Copy the selected preset's brand and material (resolved by the backend) into globals
+static void parse_preset_info(const SlicerPreset *preset) {
+    strncpy(g_selected_brand, preset->brand, sizeof(g_selected_brand) - 1);
+    g_selected_brand[sizeof(g_selected_brand) - 1] = '\0';
+    strncpy(g_selected_material, preset->material[0] ? preset->material : "PLA", sizeof(g_selected_material) - 1);
+    g_selected_material[sizeof(g_selected_material) - 1] = '\0';
 }
 
 // Convert hex string to color value
@@ -421,12 +304,10 @@ static void filter_k_profiles(void) {
         return;
     }
 
-    const char *preset_name = g_presets[g_selected_preset_idx].name;
+    // Brand and material come with the preset
+    parse_preset_info(&g_presets[g_selected_preset_idx]);
 
-    // Parse brand and material from preset name
-    parse_preset_info(preset_name);
-
-    ESP_LOGI(TAG, "Parsed preset: brand='%s' material='%s'", g_selected_brand, g_selected_material);
+    ESP_LOGI(TAG, "Selected preset: brand='%s' material='%s'", g_selected_brand, g_selected_material);
     ESP_LOGI(TAG, "Filtering %d K-profiles for brand='%s' material='%s' extruder=%d",
              g_k_profile_count, g_selected_brand, g_selected_material, g_extruder_id);
 
@@ -493,88 +374,28 @@ static void build_modal_content(void);
 // Keyboard Handlers
 // =============================================================================
 
-#define KEYBOARD_HEIGHT 200
-
-static void show_keyboard(void) {
-    if (!g_keyboard || !g_modal) return;
-
-    // Show keyboard at bottom
-    lv_obj_remove_flag(g_keyboard, LV_OBJ_FLAG_HIDDEN);
+// Make room for the keyboard while it is open for the search field
+static void search_keyboard_toggle(lv_obj_t *ta, bool visible, void *user_data) {
+    (void)ta;
+    (void)user_data;
+    if (!g_modal) return;
 
-    // Shrink preset list to make room
+    // Shrink preset list and hide right column to give more space
     if (g_preset_list) {
-        lv_obj_set_height(g_preset_list, 120);  // Reduced from 250
+        lv_obj_set_height(g_preset_list, visible ? 120 : 250);
     }
-
-    // Hide right column to give more space
     if (g_right_col) {
-        lv_obj_add_flag(g_right_col, LV_OBJ_FLAG_HIDDEN);
+        if (visible) {
+            lv_obj_add_flag(g_right_col, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_remove_flag(g_right_col, LV_OBJ_FLAG_HIDDEN);
+        }
     }
 
     // Expand left column to full width
     if (g_left_col) {
-        lv_obj_set_width(g_left_col, 768);
-        lv_obj_set_width(g_preset_list, 768);
-    }
-}
-
-static void hide_keyboard(void) {
-    if (!g_keyboard) return;
-
-    // Hide keyboard
-    lv_obj_add_flag(g_keyboard, LV_OBJ_FLAG_HIDDEN);
-
-    // Restore preset list height
-    if (g_preset_list) {
-        lv_obj_set_height(g_preset_list, 250);
-    }
-
-    // Show right column again
-    if (g_right_col) {
-        lv_obj_remove_flag(g_right_col, LV_OBJ_FLAG_HIDDEN);
-    }
-
-    // Restore left column width
-    if (g_left_col) {
-        lv_obj_set_width(g_left_col, 440);
-        lv_obj_set_width(g_preset_list, 440);
-    }
-}
-
-static void keyboard_event_handler(lv_event_t *e) {
-    lv_event_code_t code = lv_event_get_code(e);
-
-    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
-        // User pressed OK (checkmark) or Cancel - just hide keyboard
-        // Don't clear focus - let LVGL handle it naturally
-        // This allows the textarea to be clicked again to reopen keyboard
-        hide_keyboard();
-    }
-}
-
-static void textarea_focus_handler(lv_event_t *e) {
-    lv_event_code_t code = lv_event_get_code(e);
-
-    if (code == LV_EVENT_FOCUSED) {
-        // Assign keyboard to this textarea
-        if (g_keyboard && g_search_ta) {
-            lv_keyboard_set_textarea(g_keyboard, g_search_ta);
-            show_keyboard();
-        }
-    } else if (code == LV_EVENT_DEFOCUSED) {
-        // Only hide if keyboard isn't being used
-        // (defocus happens when clicking keyboard too)
-    }
-}
-
-static void textarea_click_handler(lv_event_t *e) {
-    (void)e;
-    // Show keyboard when textarea is clicked (handles reopening after close)
-    if (g_keyboard && g_search_ta) {
-        lv_keyboard_set_textarea(g_keyboard, g_search_ta);
-        show_keyboard();
-        // Ensure textarea is focused
-        lv_obj_add_state(g_search_ta, LV_STATE_FOCUSED);
+        lv_obj_set_width(g_left_col, visible ? 768 : 440);
+        lv_obj_set_width(g_preset_list, visible ? 768 : 440);
     }
 }
 
@@ -719,7 +540,7 @@ static void configure_handler(lv_event_t *e) {
     }
 
     SlicerPreset *preset = &g_presets[g_selected_preset_idx];
-    const char *material = parse_material(preset->name);
+    const char *material = preset->material[0] ? preset->material : "PLA";
 
     // Get tray_info_idx and effective_setting_id
     char tray_info_idx[64] = {0};
@@ -764,9 +585,9 @@ static void configure_handler(lv_event_t *e) {
     char tray_color[24];
     snprintf(tray_color, sizeof(tray_color), "%.8sFF", color_hex);  // Add alpha
 
-    // Get temp range
-    int temp_min, temp_max;
-    get_temp_range(material, &temp_min, &temp_max);
+    // Temp range comes with the preset
+    int temp_min = preset->temp_max ? preset->temp_min : 190;
+    int temp_max = preset->temp_max ? preset->temp_max : 230;
 
     // Get preset name for tray_sub_brands (strip @ suffix)
     char tray_sub_brands[64];
@@ -1308,7 +1129,9 @@ static void on_data_fetch_complete(void *user_data) {
     }
 
     // Build the full content
+    ui_mem_arena_t *prev_arena = ui_mem_arena_resume(g_modal);
     build_modal_content();
+    ui_mem_arena_end(prev_arena);
 }
 
 #ifdef ESP_PLATFORM
@@ -1318,7 +1141,7 @@ static void data_fetch_task(void *pvParameters) {
 
     ESP_LOGI(TAG, "Data fetch task started");
 
-    // Fetch presets (blocking HTTP call - but in separate task)
+    // Presets come from the flash catalog (synced on heartbeat); HTTP only on first use
     g_preset_count = backend_get_slicer_presets(g_presets, MAX_PRESETS);
     if (g_preset_count < 0) g_preset_count = 0;
     ESP_LOGI(TAG, "Loaded %d presets", g_preset_count);
@@ -1374,7 +1197,7 @@ static void load_data_timer_cb(lv_timer_t *t) {
         }
     }
 #else
-    // Simulator: load synchronously (no threading issues)
+    // Simulator: load synchronously (no threading issues); presets come from the catalog
     g_preset_count = backend_get_slicer_presets(g_presets, MAX_PRESETS);
     if (g_preset_count < 0) g_preset_count = 0;
     ESP_LOGI(TAG, "Loaded %d presets", g_preset_count);
@@ -1416,9 +1239,11 @@ void ui_ams_slot_modal_open(const char *printer_serial, int ams_id, int tray_id,
     g_success_overlay = NULL;
     g_data_loaded = false;
 
-    // Create full-screen modal with loading state
+    // Create full-screen modal with loading state, in its own arena
+    ui_mem_arena_t *prev_arena = ui_mem_arena_begin(UI_MEM_ARENA_MODAL);
     // DEBUG: Use lv_scr_act() instead of lv_layer_top() to test
     g_modal = lv_obj_create(lv_scr_act());
+    ui_mem_arena_bind(g_modal);
     lv_obj_set_size(g_modal, 800, 480);
     lv_obj_set_pos(g_modal, 0, 0);
     lv_obj_set_style_bg_color(g_modal, lv_color_hex(0x1a1a1a), 0);
@@ -1509,6 +1334,7 @@ void ui_ams_slot_modal_open(const char *printer_serial, int ams_id, int tray_id,
     lv_obj_set_style_text_font(g_loading_label, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(g_loading_label, lv_color_hex(0x888888), 0);
     lv_obj_align(g_loading_label, LV_ALIGN_CENTER, 0, 40);
+    ui_mem_arena_end(prev_arena);
 
     // Start timer to load data (allows UI to render first, 100ms initial delay)
     lv_timer_create(load_data_timer_cb, 100, NULL);
@@ -1555,9 +1381,7 @@ static void build_modal_content(void) {
     lv_obj_set_style_border_color(g_search_ta, lv_color_hex(0x444444), 0);
     lv_obj_set_style_radius(g_search_ta, 8, 0);
     lv_obj_add_event_cb(g_search_ta, search_input_handler, LV_EVENT_VALUE_CHANGED, NULL);
-    lv_obj_add_event_cb(g_search_ta, textarea_focus_handler, LV_EVENT_FOCUSED, NULL);
-    lv_obj_add_event_cb(g_search_ta, textarea_focus_handler, LV_EVENT_DEFOCUSED, NULL);
-    lv_obj_add_event_cb(g_search_ta, textarea_click_handler, LV_EVENT_CLICKED, NULL);
+    ui_keyboard_register_textarea(g_search_ta, LV_KEYBOARD_MODE_TEXT_LOWER, search_keyboard_toggle, NULL);
 
     g_preset_list = lv_obj_create(g_left_col);
     lv_obj_set_size(g_preset_list, 440, 250);
@@ -1730,17 +1554,6 @@ static void build_modal_content(void) {
 
     ESP_LOGI(TAG, "build_modal_content: buttons done");
 
-    // Keyboard (hidden by default, shown when textarea focused)
-    g_keyboard = lv_keyboard_create(g_modal);
-    lv_obj_set_size(g_keyboard, 780, 240);
-    lv_obj_align(g_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_add_flag(g_keyboard, LV_OBJ_FLAG_HIDDEN);
-    lv_keyboard_set_textarea(g_keyboard, g_search_ta);
-    lv_obj_add_event_cb(g_keyboard, keyboard_event_handler, LV_EVENT_READY, NULL);
-    lv_obj_add_event_cb(g_keyboard, keyboard_event_handler, LV_EVENT_CANCEL, NULL);
-    apply_keyboard_layout(g_keyboard);
-    ESP_LOGI(TAG, "build_modal_content: keyboard done");
-
     ESP_LOGI(TAG, "build_modal_content: COMPLETE");
 }
 
@@ -1766,7 +1579,6 @@ void ui_ams_slot_modal_close(void) {
     g_loading_label = NULL;
     g_data_loaded = false;
     g_success_overlay = NULL;
-    g_keyboard = NULL;
     g_search_ta = NULL;
     g_left_col = NULL;
     g_right_col = NULL;
@@ -9,6 +9,10 @@
  */
 
 #include "screens.h"
+#include "ui_slot_stripes.h"
+#include "ui_spool_gauge.h"
+#include "ui_mem_arena.h"
+#include "ui_log.h"
 #include <lvgl.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,14 +21,10 @@
 // Firmware: use ESP-IDF and Rust FFI backend
 #include "ui_internal.h"
 #include "ui_ams_slot_modal.h"
-#include "esp_log.h"
-static const char *TAG = "ui_backend";
 #else
 // Simulator: use libcurl backend with compatibility API
 #include "../backend_client.h"
 #include "ui_ams_slot_modal.h"
-#define ESP_LOGI(tag, fmt, ...) printf("[%s] " fmt "\n", tag, ##__VA_ARGS__)
-static const char *TAG = "ui_backend";
 // Variables shared with ui.c
 extern int16_t currentScreen;
 // Printers list update (from ui_printer.c)
@@ -34,6 +34,8 @@ extern void ui_scan_result_init(void);
 extern void ui_scan_result_refresh_ams(void);
 #endif
 
+static const char *TAG = "ui_backend";
+
 // Update counter for rate limiting UI updates
 static int backend_update_counter = 0;
 // Track previous screen to detect navigation
@@ -86,6 +88,7 @@ static void update_ams_display(void);
 static void update_ams_overview_display(void);
 static void update_notification_bell(void);
 static void update_settings_menu_indicator(void);
+static void pulse_timer_wake(bool screen_changed);
 static void reset_main_screen_dynamic_state(void);  // Reset stale pointers on screen recreation
 
 /**
@@ -108,6 +111,8 @@ void update_backend_ui(void) {
     }
     previous_screen = screen_id;
 
+    pulse_timer_wake(screen_changed);
+
     // Always update notification bell on screen change (no rate limiting)
     // This ensures the notification dot appears on all screens
     if (screen_changed) {
@@ -615,6 +620,7 @@ static lv_obj_t *ams_widgets_right[MAX_AMS_WIDGETS];
 static int ams_widget_count_left = 0;
 static int ams_widget_count_right = 0;
 static bool ams_static_hidden = false;
+static uint32_t last_ams_topology = 0;  // Unit layout the containers were built for
 
 // Dimensions matching EEZ static design exactly
 // NOTE: EEZ uses negative positions to account for default LVGL container padding (~15px)
@@ -666,69 +672,39 @@ static int get_global_tray_index(int ams_id, int tray_idx) {
     return -1;
 }
 
+// EEZ slot x positions inside a 4-slot container (spacing of 28px)
+static const int slot_x_positions[4] = {-17, 11, 39, 68};
+
 /**
- * @brief Create a color slot matching EEZ design
- * Uses lv_obj_create with lv_line_create for empty slot striping (matches simulator)
+ * @brief Update slot colors and active highlight of an AMS container
+ * The container's slot widget (user data) only redraws slots that changed.
+ * @param tray_now Global active tray index (used to highlight active slot)
  */
-static lv_obj_t* create_slot(lv_obj_t *parent, int x, int y, uint32_t rgba, bool is_active) {
-    // Use container for slot to allow child objects (striping lines)
-    lv_obj_t *slot = lv_obj_create(parent);
-    lv_obj_set_pos(slot, x, y);
-    lv_obj_set_size(slot, SLOT_SIZE, SLOT_SIZE + 1);
-    lv_obj_clear_flag(slot, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_pad_all(slot, 0, 0);
-
-    // Extract RGB from RGBA
-    uint8_t r = (rgba >> 24) & 0xFF;
-    uint8_t g = (rgba >> 16) & 0xFF;
-    uint8_t b = (rgba >> 8) & 0xFF;
-    uint32_t color_hex = (r << 16) | (g << 8) | b;
-    bool is_empty = (rgba == 0);
+static void update_ams_container(lv_obj_t *container, AmsUnitCInfo *info, int tray_now) {
+    lv_obj_t *slots = lv_obj_get_user_data(container);
+    int slot_count = info->tray_count > 0 ? info->tray_count : 1;
+    bool container_active = false;
 
-    if (!is_empty) {
-        // Use solid color (no gradient) for better color visibility
-        lv_obj_set_style_bg_color(slot, lv_color_hex(color_hex), 0);
-        lv_obj_set_style_bg_opa(slot, 255, 0);
-        // Add subtle dark border for depth instead of gradient
-        lv_obj_set_style_border_width(slot, 1, 0);
-        lv_obj_set_style_border_color(slot, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_border_opa(slot, 80, 0);
-    } else {
-        // Empty slot: darker background with striping pattern
-        lv_obj_set_style_bg_color(slot, lv_color_hex(0x0a0a0a), 0);
-        lv_obj_set_style_bg_opa(slot, 255, 0);
-
-        // Use simple rectangle objects as diagonal stripes (more reliable than lv_line)
-        // Create 3 thin rectangles positioned diagonally
-        for (int i = 0; i < 3; i++) {
-            lv_obj_t *stripe = lv_obj_create(slot);
-            lv_obj_remove_style_all(stripe);
-            lv_obj_set_size(stripe, SLOT_SIZE + 8, 3);
-            lv_obj_set_pos(stripe, -4, 6 + i * 10);  // Offset positions
-            lv_obj_set_style_bg_color(stripe, lv_color_hex(0x3a3a3a), 0);
-            lv_obj_set_style_bg_opa(stripe, 255, 0);
-            lv_obj_set_style_transform_rotation(stripe, -200, 0);  // Slight angle (0.1 deg units)
-            lv_obj_clear_flag(stripe, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        }
-    }
-
-    lv_obj_set_style_radius(slot, 5, 0);
-    lv_obj_set_style_clip_corner(slot, true, 0);
-
-    if (is_active) {
-        lv_obj_set_style_border_color(slot, lv_color_hex(ACCENT_GREEN), 0);
-        lv_obj_set_style_border_width(slot, 3, 0);
-    } else {
-        lv_obj_set_style_border_color(slot, lv_color_hex(0xbab1b1), 0);
-        lv_obj_set_style_border_width(slot, 2, 0);
+    for (int i = 0; i < slot_count && i < 4; i++) {
+        int global_tray = get_global_tray_index(info->id, i);
+        bool slot_active = (tray_now == global_tray);
+        uint32_t color = (i < info->tray_count) ? info->trays[i].tray_color : 0;
+        ui_slot_stripes_set_slot(slots, i, color, slot_active);
+        container_active |= slot_active;
     }
-    lv_obj_set_style_border_opa(slot, 255, 0);
 
-    return slot;
+    // Container border - accent green (CHECKED style) if it contains the active slot
+    if (container_active) {
+        lv_obj_add_state(container, LV_STATE_CHECKED);
+    } else {
+        lv_obj_remove_state(container, LV_STATE_CHECKED);
+    }
 }
 
 /**
  * @brief Create AMS container matching EEZ design exactly
+ * All slots are painted by one ui_slot_stripes widget instead of an object per
+ * slot (and per empty-slot stripe).
  * @param tray_now Global active tray index (used to highlight active slot)
  */
 static lv_obj_t* create_ams_container(lv_obj_t *parent, AmsUnitCInfo *info, int tray_now) {
@@ -751,23 +727,10 @@ static lv_obj_t* create_ams_container(lv_obj_t *parent, AmsUnitCInfo *info, int
     lv_obj_set_style_bg_opa(container, 255, 0);  // Fully opaque
     lv_obj_set_style_layout(container, LV_LAYOUT_NONE, 0);
 
-    // Check if this container has the active slot
-    bool container_active = false;
-    for (int i = 0; i < slot_count; i++) {
-        int global_tray = get_global_tray_index(info->id, i);
-        if (global_tray == tray_now) {
-            container_active = true;
-            break;
-        }
-    }
-
-    // Container border - accent green if it contains the active slot
+    // Container border - accent green while it contains the active slot
     lv_obj_set_style_border_width(container, 3, 0);
-    if (container_active) {
-        lv_obj_set_style_border_color(container, lv_color_hex(ACCENT_GREEN), 0);
-    } else {
-        lv_obj_set_style_border_color(container, lv_color_hex(0x3d3d3d), 0);
-    }
+    lv_obj_set_style_border_color(container, lv_color_hex(0x3d3d3d), 0);
+    lv_obj_set_style_border_color(container, lv_color_hex(ACCENT_GREEN), LV_STATE_CHECKED);
 
     // Shadow matching EEZ
     lv_obj_set_style_shadow_width(container, 5, 0);
@@ -782,33 +745,58 @@ static lv_obj_t* create_ams_container(lv_obj_t *parent, AmsUnitCInfo *info, int
     lv_obj_set_style_text_color(label, lv_color_hex(0xfafafa), 0);
     lv_obj_set_style_text_opa(label, 255, 0);
 
+    lv_obj_t *slots = ui_slot_stripes_create(container, UI_SLOT_STRIPES_SWATCH);
+    lv_obj_set_user_data(container, slots);
+
     if (is_single_slot) {
         // Single slot: label at top-left, slot below - EEZ positions
         lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
         lv_obj_set_pos(label, -14, -17);  // EEZ: HT-A label position
 
-        int global_tray = get_global_tray_index(info->id, 0);
-        bool slot_active = (tray_now == global_tray);
-        uint32_t color = info->tray_count > 0 ? info->trays[0].tray_color : 0;
-        create_slot(container, -10, -1, color, slot_active);  // EEZ: x=-10, y=-1
+        lv_obj_set_pos(slots, -10, -1);  // EEZ: x=-10, y=-1
+        lv_obj_set_size(slots, SLOT_SIZE, SLOT_SIZE + 1);
+        ui_slot_stripes_set_geometry(slots, 0, 0, 0, SLOT_SIZE, SLOT_SIZE + 1);
     } else {
         // 4-slot: label centered at top, slots in a row - EEZ positions
         lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
         lv_obj_set_pos(label, 35, -18);  // EEZ position
 
-        // EEZ slot positions: -17, 11, 39, 68 (spacing of 28px)
-        int slot_x_positions[4] = {-17, 11, 39, 68};
+        int x0 = slot_x_positions[0];
+        lv_obj_set_pos(slots, x0, -3);
+        lv_obj_set_size(slots, slot_x_positions[3] - x0 + SLOT_SIZE, SLOT_SIZE + 1);
         for (int i = 0; i < slot_count && i < 4; i++) {
-            int global_tray = get_global_tray_index(info->id, i);
-            bool slot_active = (tray_now == global_tray);
-            uint32_t color = (i < info->tray_count) ? info->trays[i].tray_color : 0;
-            create_slot(container, slot_x_positions[i], -3, color, slot_active);
+            ui_slot_stripes_set_geometry(slots, i, slot_x_positions[i] - x0, 0, SLOT_SIZE, SLOT_SIZE + 1);
         }
     }
 
+    update_ams_container(container, info, tray_now);
     return container;
 }
 
+/**
+ * @brief Get the container for the next AMS unit on one side
+ * On a rebuild a new container is created; otherwise the one created for the
+ * same unit last time is reused and only its slots are updated.
+ */
+static lv_obj_t* next_ams_container(bool rebuild, bool use_left, int *index, lv_obj_t *parent,
+                                    AmsUnitCInfo *info, int tray_now) {
+    lv_obj_t **widgets = use_left ? ams_widgets_left : ams_widgets_right;
+    int *count = use_left ? &ams_widget_count_left : &ams_widget_count_right;
+    lv_obj_t *widget = NULL;
+
+    if (rebuild) {
+        if (*count < MAX_AMS_WIDGETS) {
+            widget = create_ams_container(parent, info, tray_now);
+            widgets[(*count)++] = widget;
+        }
+    } else if (*index < *count) {
+        widget = widgets[*index];
+        update_ams_container(widget, info, tray_now);
+    }
+    (*index)++;
+    return widget;
+}
+
 /**
  * @brief Hide all children of a container
  */
@@ -942,7 +930,7 @@ static void reset_main_screen_dynamic_state(void) {
     last_printer_count = -1;
     last_connected_mask = 0;
 
-    ESP_LOGI(TAG, "Reset main screen dynamic state - cleared stale pointers");
+    UI_LOGI("Reset main screen dynamic state - cleared stale pointers");
 }
 
 /**
@@ -980,9 +968,6 @@ static void update_ams_display(void) {
     // Setup on first call
     setup_ams_containers();
 
-    // Clear previous dynamic widgets
-    clear_ams_widgets();
-
     // Get AMS data for selected printer
     int ams_count = backend_get_ams_count(selected_printer_index);
     int tray_now = backend_get_tray_now(selected_printer_index);  // Legacy single-nozzle
@@ -990,8 +975,8 @@ static void update_ams_display(void) {
     int tray_now_right = backend_get_tray_now_right(selected_printer_index);
     int active_extruder = backend_get_active_extruder(selected_printer_index);  // -1=unknown, 0=right, 1=left
 
-    ESP_LOGI(TAG, "AMS display: tray_now=%d, left=%d, right=%d, active_ext=%d",
-             tray_now, tray_now_left, tray_now_right, active_extruder);
+    UI_LOGD("AMS display: tray_now=%d, left=%d, right=%d, active_ext=%d",
+            tray_now, tray_now_left, tray_now_right, active_extruder);
 
     // Determine which tray is ACTIVELY printing (not just loaded)
     // For dual-nozzle printers: active_extruder indicates which nozzle (0=right, 1=left)
@@ -1014,6 +999,26 @@ static void update_ams_display(void) {
     // Dual-nozzle only if AMS units are assigned to left extruder
     bool is_dual_nozzle = has_left_extruder_ams;
 
+    // Containers are only rebuilt when the set of units changes; otherwise the
+    // existing ones are reused and just their slot colors/highlights updated
+    uint32_t topology = is_dual_nozzle ? 1 : 0;
+    for (int i = 0; i < ams_count && i < MAX_AMS_WIDGETS; i++) {
+        AmsUnitCInfo topo_info;
+        if (backend_get_ams_unit(selected_printer_index, i, &topo_info) == 0) {
+            topology = topology * 31 + (uint32_t)topo_info.id;
+            topology = topology * 31 + (uint32_t)topo_info.tray_count;
+            topology = topology * 31 + (uint32_t)(topo_info.extruder + 1);
+        }
+    }
+    bool rebuild = (topology != last_ams_topology) ||
+                   (ams_widget_count_left + ams_widget_count_right == 0);
+    if (rebuild) {
+        clear_ams_widgets();
+        last_ams_topology = topology;
+    }
+    int left_index = 0;
+    int right_index = 0;
+
 
     // Update the tracking variable
     selected_printer_is_dual_nozzle = is_dual_nozzle;
@@ -1071,8 +1076,8 @@ static void update_ams_display(void) {
         }
     }
 
-    ESP_LOGI(TAG, "AMS active trays: dual=%d, active_left=%d, active_right=%d",
-             is_dual_nozzle, active_tray_left, active_tray_right);
+    UI_LOGD("AMS active trays: dual=%d, active_left=%d, active_right=%d",
+            is_dual_nozzle, active_tray_left, active_tray_right);
 
     // Separate AMS units by type and nozzle
     // Left nozzle: top row for 4-slot, bottom row for 1-slot
@@ -1097,7 +1102,8 @@ static void update_ams_display(void) {
 
         // Use the active tray for this extruder (only if it's the active extruder)
         int active_tray = use_left ? active_tray_left : active_tray_right;
-        lv_obj_t *widget = create_ams_container(parent, &info, active_tray);
+        lv_obj_t *widget = next_ams_container(rebuild, use_left, use_left ? &left_index : &right_index,
+                                              parent, &info, active_tray);
 
         // Position based on slot count and nozzle
         bool is_single = (info.tray_count <= 1);
@@ -1115,9 +1121,6 @@ static void update_ams_display(void) {
                 y_pos = ROW_TOP_Y;
                 step = CONTAINER_4SLOT_W + CONTAINER_4SLOT_GAP;  // 120 + 7 = 127
             }
-            if (ams_widget_count_left < MAX_AMS_WIDGETS) {
-                ams_widgets_left[ams_widget_count_left++] = widget;
-            }
         } else {
             if (is_single) {
                 x_pos = &right_1slot_x;
@@ -1128,12 +1131,9 @@ static void update_ams_display(void) {
                 y_pos = ROW_TOP_Y;
                 step = CONTAINER_4SLOT_W + CONTAINER_4SLOT_GAP;
             }
-            if (ams_widget_count_right < MAX_AMS_WIDGETS) {
-                ams_widgets_right[ams_widget_count_right++] = widget;
-            }
         }
 
-        lv_obj_set_pos(widget, *x_pos, y_pos);
+        if (widget) lv_obj_set_pos(widget, *x_pos, y_pos);
         *x_pos += step;
     }
 
@@ -1153,17 +1153,17 @@ static void update_ams_display(void) {
 
         if (!is_dual_nozzle) {
             // Single-nozzle: create one "Ext" slot on LEFT side, use active_tray_left
-            if (objects.main_screen_ams_left_nozzle && ams_widget_count_left < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext = create_ams_container(objects.main_screen_ams_left_nozzle, &ext_info, active_tray_left);
-                lv_obj_set_pos(ext, left_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_left[ams_widget_count_left++] = ext;
+            if (objects.main_screen_ams_left_nozzle) {
+                lv_obj_t *ext = next_ams_container(rebuild, true, &left_index,
+                                                   objects.main_screen_ams_left_nozzle, &ext_info, active_tray_left);
+                if (ext) lv_obj_set_pos(ext, left_1slot_x, ROW_BOTTOM_Y);
             }
         } else {
             // Dual-nozzle: create EXT-R on right and EXT-L on left
-            if (objects.main_screen_ams_right_nozzle && ams_widget_count_right < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext_r = create_ams_container(objects.main_screen_ams_right_nozzle, &ext_info, active_tray_right);
-                lv_obj_set_pos(ext_r, right_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_right[ams_widget_count_right++] = ext_r;
+            if (objects.main_screen_ams_right_nozzle) {
+                lv_obj_t *ext_r = next_ams_container(rebuild, false, &right_index,
+                                                     objects.main_screen_ams_right_nozzle, &ext_info, active_tray_right);
+                if (ext_r) lv_obj_set_pos(ext_r, right_1slot_x, ROW_BOTTOM_Y);
             }
 
             AmsUnitCInfo ext_l_info = {
@@ -1174,10 +1174,10 @@ static void update_ams_display(void) {
                 .tray_count = 1,
                 .trays = {{.tray_color = 0}}  // Empty
             };
-            if (objects.main_screen_ams_left_nozzle && ams_widget_count_left < MAX_AMS_WIDGETS) {
-                lv_obj_t *ext_l = create_ams_container(objects.main_screen_ams_left_nozzle, &ext_l_info, active_tray_left);
-                lv_obj_set_pos(ext_l, left_1slot_x, ROW_BOTTOM_Y);
-                ams_widgets_left[ams_widget_count_left++] = ext_l;
+            if (objects.main_screen_ams_left_nozzle) {
+                lv_obj_t *ext_l = next_ams_container(rebuild, true, &left_index,
+                                                     objects.main_screen_ams_left_nozzle, &ext_l_info, active_tray_left);
+                if (ext_l) lv_obj_set_pos(ext_l, left_1slot_x, ROW_BOTTOM_Y);
             }
         }
     }
@@ -1188,10 +1188,16 @@ static void update_ams_display(void) {
 // =============================================================================
 
 /**
- * @brief Update a single slot's color based on RGBA value
+ * @brief Show a spool's color and fill level on an AMS overview slot
+ * The slot outline image gets one precomposed spool (ui_spool_gauge) and the
+ * separately recolored EEZ fill image on top of it is hidden.
+ * @param slot Slot outline image (keeps its border/click handling)
+ * @param slot_color EEZ fill image of the slot
+ * @param rgba Tray color (0 = empty)
+ * @param remain Remaining filament percentage (255 = unknown)
  */
-static void update_slot_color(lv_obj_t *slot_color, uint32_t rgba) {
-    if (!slot_color) return;
+static void update_slot_gauge(lv_obj_t *slot, lv_obj_t *slot_color, uint32_t rgba, uint8_t remain) {
+    if (!slot) return;
 
     uint8_t r = (rgba >> 24) & 0xFF;
     uint8_t g = (rgba >> 16) & 0xFF;
@@ -1199,76 +1205,64 @@ static void update_slot_color(lv_obj_t *slot_color, uint32_t rgba) {
     uint32_t color_hex = (r << 16) | (g << 8) | b;
     bool is_empty = (rgba == 0);
 
-    // slot_color is an lv_image with img_spool_fill - use image recoloring
-    if (is_empty) {
-        // Empty/no filament - dark gray
-        lv_obj_set_style_image_recolor(slot_color, lv_color_hex(0x1a1a1a), 0);
-        lv_obj_set_style_image_recolor_opa(slot_color, 255, 0);
-    } else {
-        // Apply filament color via image recolor
-        lv_obj_set_style_image_recolor(slot_color, lv_color_hex(color_hex), 0);
+    // Empty/no filament - dark gray, drawn full
+    int fill_pct = UI_SPOOL_GAUGE_LEVEL_UNKNOWN;
+    if (!is_empty && remain <= 100) fill_pct = remain;
+
+    if (ui_spool_gauge_set(slot, is_empty ? 0x1a1a1a : color_hex, fill_pct,
+                           UI_SPOOL_GAUGE_SRC_W, UI_SPOOL_GAUGE_SRC_H)) {
+        if (slot_color) lv_obj_add_flag(slot_color, LV_OBJ_FLAG_HIDDEN);
+    } else if (slot_color) {
+        // Gauge cache exhausted - fall back to the recolored EEZ layer
+        lv_obj_clear_flag(slot_color, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_style_image_recolor(slot_color, lv_color_hex(is_empty ? 0x1a1a1a : color_hex), 0);
         lv_obj_set_style_image_recolor_opa(slot_color, 255, 0);
     }
 }
 
-// Stripe line storage for slot empty state visualization
-// Each slot has 3 diagonal stripe lines
-#define STRIPE_COUNT 3
+// Empty-slot stripes: one ui_slot_stripes overlay per panel, drawn over the
+// EEZ slot images (instead of 3 lv_line objects per slot)
+#define OVERVIEW_SLOT_W 32
+#define OVERVIEW_SLOT_H 42
 
 // HT slots (HT-A, HT-B)
-static lv_obj_t *ht_a_stripes[STRIPE_COUNT] = {NULL};
-static lv_obj_t *ht_b_stripes[STRIPE_COUNT] = {NULL};
+static lv_obj_t *ht_a_stripes = NULL;
+static lv_obj_t *ht_b_stripes = NULL;
 
-// AMS slots (4 per AMS panel, 4 panels = 16 total)
-static lv_obj_t *ams_a_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_b_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_c_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-static lv_obj_t *ams_d_slot_stripes[4][STRIPE_COUNT] = {{NULL}};
-
-// Static line points for diagonal stripes on 32x42 slots
-static lv_point_precise_t stripe_pts_0[2] = {{0, 12}, {32, 4}};
-static lv_point_precise_t stripe_pts_1[2] = {{0, 24}, {32, 16}};
-static lv_point_precise_t stripe_pts_2[2] = {{0, 36}, {32, 28}};
-static lv_point_precise_t *stripe_pts[STRIPE_COUNT] = {stripe_pts_0, stripe_pts_1, stripe_pts_2};
+// AMS panels A-D (4 slots each)
+static lv_obj_t *ams_slot_stripes[4] = {NULL};
 
 /**
- * @brief Create stripe lines for an empty slot
- * Creates diagonal lines as visual indicator for empty state
- * @param parent The panel containing the slot
- * @param stripes Array to store created line objects (STRIPE_COUNT elements)
- * @param slot_x X position of the slot within parent
- * @param slot_y Y position of the slot within parent
+ * @brief Get (creating on first use) the stripe overlay of a panel
+ * @param stripes Overlay pointer storage for this panel
+ * @param parent The panel containing the slots
+ * @param slot_x X positions of the slots within parent
+ * @param slot_y Y positions of the slots within parent
+ * @param count Number of slots
  */
-static void create_slot_stripes(lv_obj_t *parent, lv_obj_t **stripes, int slot_x, int slot_y) {
-    if (!parent) return;
-
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        if (!stripes[i]) {
-            stripes[i] = lv_line_create(parent);
-            lv_line_set_points(stripes[i], stripe_pts[i], 2);
-            lv_obj_set_pos(stripes[i], slot_x, slot_y);
-            lv_obj_set_style_line_color(stripes[i], lv_color_hex(0x4a4a4a), 0);
-            lv_obj_set_style_line_width(stripes[i], 3, 0);
-            lv_obj_set_style_line_opa(stripes[i], 255, 0);
-        }
-    }
-}
-
-/**
- * @brief Show or hide stripe lines for slot empty state
- * @param stripes Array of stripe line objects (STRIPE_COUNT elements)
- * @param show True to show stripes (empty slot), false to hide (has filament)
- */
-static void set_slot_stripes_visible(lv_obj_t **stripes, bool show) {
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        if (stripes[i]) {
-            if (show) {
-                lv_obj_clear_flag(stripes[i], LV_OBJ_FLAG_HIDDEN);
-            } else {
-                lv_obj_add_flag(stripes[i], LV_OBJ_FLAG_HIDDEN);
-            }
-        }
-    }
+static lv_obj_t *get_slot_stripes(lv_obj_t **stripes, lv_obj_t *parent,
+                                  const int *slot_x, const int *slot_y, int count) {
+    if (!parent) return NULL;
+    if (*stripes) return *stripes;
+
+    int x0 = slot_x[0], y0 = slot_y[0], x1 = slot_x[0], y1 = slot_y[0];
+    for (int i = 1; i < count; i++) {
+        if (slot_x[i] < x0) x0 = slot_x[i];
+        if (slot_y[i] < y0) y0 = slot_y[i];
+        if (slot_x[i] > x1) x1 = slot_x[i];
+        if (slot_y[i] > y1) y1 = slot_y[i];
+    }
+
+    lv_obj_t *overlay = ui_slot_stripes_create(parent, UI_SLOT_STRIPES_OVERLAY);
+    if (!overlay) return NULL;
+    lv_obj_set_pos(overlay, x0, y0);
+    lv_obj_set_size(overlay, x1 - x0 + OVERVIEW_SLOT_W, y1 - y0 + OVERVIEW_SLOT_H);
+    for (int i = 0; i < count; i++) {
+        ui_slot_stripes_set_geometry(overlay, i, slot_x[i] - x0, slot_y[i] - y0,
+                                     OVERVIEW_SLOT_W, OVERVIEW_SLOT_H);
+    }
+    *stripes = overlay;
+    return overlay;
 }
 
 /**
@@ -1405,11 +1399,11 @@ static void update_ams_overview_display(void) {
         lv_obj_clear_flag(objects.ams_screen_ams_panel, LV_OBJ_FLAG_HIDDEN);
     }
 
-    ESP_LOGI(TAG, "AMS overview update: panel=%p ht_a=%p ext1=%p ext2=%p",
-             (void*)objects.ams_screen_ams_panel,
-             (void*)objects.ams_screen_ams_panel_ht_a,
-             (void*)objects.ams_screen_ams_panel_ext_1,
-             (void*)objects.ams_screen_ams_panel_ext_2);
+    UI_LOGD("AMS overview update: panel=%p ht_a=%p ext1=%p ext2=%p",
+            (void*)objects.ams_screen_ams_panel,
+            (void*)objects.ams_screen_ams_panel_ht_a,
+            (void*)objects.ams_screen_ams_panel_ext_1,
+            (void*)objects.ams_screen_ams_panel_ext_2);
 
     // Detect screen recreation - reset positioning flag
     if (objects.ams_overview != last_ams_screen) {
@@ -1507,11 +1501,12 @@ static void update_ams_overview_display(void) {
 
                     for (int j = 0; j < 4 && j < info->tray_count; j++) {
                         bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
+                        update_slot_gauge(slots[j], slot_colors[j], info->trays[j].tray_color, info->trays[j].remain);
 
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_a, ams_a_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_a_slot_stripes[j], is_empty);
+                        // Stripes for empty slots (only redrawn when emptiness changes)
+                        ui_slot_stripes_set_slot(get_slot_stripes(&ams_slot_stripes[0], objects.ams_screen_ams_panel_ams_a,
+                                                                  slot_x, slot_y, 4),
+                                                 j, info->trays[j].tray_color, false);
 
                         // Update material label
                         if (slot_materials[j]) {
@@ -1622,11 +1617,12 @@ static void update_ams_overview_display(void) {
 
                     for (int j = 0; j < 4 && j < info->tray_count; j++) {
                         bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
+                        update_slot_gauge(slots[j], slot_colors[j], info->trays[j].tray_color, info->trays[j].remain);
 
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_b, ams_b_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_b_slot_stripes[j], is_empty);
+                        // Stripes for empty slots (only redrawn when emptiness changes)
+                        ui_slot_stripes_set_slot(get_slot_stripes(&ams_slot_stripes[1], objects.ams_screen_ams_panel_ams_b,
+                                                                  slot_x, slot_y, 4),
+                                                 j, info->trays[j].tray_color, false);
 
                         if (slot_materials[j]) {
                             if (!is_empty && info->trays[j].tray_type[0]) {
@@ -1736,11 +1732,12 @@ static void update_ams_overview_display(void) {
 
                     for (int j = 0; j < 4 && j < info->tray_count; j++) {
                         bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
+                        update_slot_gauge(slots[j], slot_colors[j], info->trays[j].tray_color, info->trays[j].remain);
 
-                        // Create/update stripes for empty slots
-                        create_slot_stripes(objects.ams_screen_ams_panel_ams_c, ams_c_slot_stripes[j], slot_x[j], slot_y[j]);
-                        set_slot_stripes_visible(ams_c_slot_stripes[j], is_empty);
+                        // Stripes for empty slots (only redrawn when emptiness changes)
+                        ui_slot_stripes_set_slot(get_slot_stripes(&ams_slot_stripes[2], objects.ams_screen_ams_panel_ams_c,
+                                                                  slot_x, slot_y, 4),
+                                                 j, info->trays[j].tray_color, false);
 
                         if (slot_materials[j]) {
                             if (!is_empty && info->trays[j].tray_type[0]) {
@@ -1837,7 +1834,7 @@ static void update_ams_overview_display(void) {
 
                     for (int j = 0; j < 4 && j < info->tray_count; j++) {
                         bool is_empty = (info->trays[j].tray_color == 0);
-                        update_slot_color(slot_colors[j], info->trays[j].tray_color);
+                        update_slot_gauge(slots[j], slot_colors[j], info->trays[j].tray_color, info->trays[j].remain);
 
                         if (slot_materials[j]) {
                             if (!is_empty && info->trays[j].tray_type[0]) {
@@ -1917,13 +1914,16 @@ static void update_ams_overview_display(void) {
                         }
                     }
 
-                    // Single slot for HT - create stripes on first run
-                    create_slot_stripes(objects.ams_screen_ams_panel_ht_a, ht_a_stripes, 14, 47);
+                    // Single slot for HT - stripes shown while empty
+                    static const int ht_slot_x[] = {14}, ht_slot_y[] = {47};
+                    lv_obj_t *stripes = get_slot_stripes(&ht_a_stripes, objects.ams_screen_ams_panel_ht_a,
+                                                         ht_slot_x, ht_slot_y, 1);
 
                     if (info->tray_count > 0 && info->trays[0].tray_color != 0) {
                         // Has filament - hide stripes
-                        set_slot_stripes_visible(ht_a_stripes, false);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_a_slot_color, info->trays[0].tray_color);
+                        ui_slot_stripes_set_slot(stripes, 0, info->trays[0].tray_color, false);
+                        update_slot_gauge(objects.ams_screen_ams_panel_ht_a_slot, objects.ams_screen_ams_panel_ht_a_slot_color,
+                                          info->trays[0].tray_color, info->trays[0].remain);
 
                         if (objects.ams_screen_ams_panel_ht_a_label_material) {
                             if (info->trays[0].tray_type[0]) {
@@ -1941,8 +1941,8 @@ static void update_ams_overview_display(void) {
                         }
                     } else {
                         // Empty slot - show stripes
-                        set_slot_stripes_visible(ht_a_stripes, true);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_a_slot_color, 0);
+                        ui_slot_stripes_set_slot(stripes, 0, 0, false);
+                        update_slot_gauge(objects.ams_screen_ams_panel_ht_a_slot, objects.ams_screen_ams_panel_ht_a_slot_color, 0, 255);
                         if (objects.ams_screen_ams_panel_ht_a_label_material) {
                             lv_label_set_text(objects.ams_screen_ams_panel_ht_a_label_material, "");
                         }
@@ -2009,13 +2009,16 @@ static void update_ams_overview_display(void) {
                         }
                     }
 
-                    // Single slot for HT - create stripes on first run
-                    create_slot_stripes(objects.ams_screen_ams_panel_ht_b, ht_b_stripes, 14, 47);
+                    // Single slot for HT - stripes shown while empty
+                    static const int ht_slot_x[] = {14}, ht_slot_y[] = {47};
+                    lv_obj_t *stripes = get_slot_stripes(&ht_b_stripes, objects.ams_screen_ams_panel_ht_b,
+                                                         ht_slot_x, ht_slot_y, 1);
 
                     if (info->tray_count > 0 && info->trays[0].tray_color != 0) {
                         // Has filament - hide stripes
-                        set_slot_stripes_visible(ht_b_stripes, false);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_b_slot_color, info->trays[0].tray_color);
+                        ui_slot_stripes_set_slot(stripes, 0, info->trays[0].tray_color, false);
+                        update_slot_gauge(objects.ams_screen_ams_panel_ht_b_slot, objects.ams_screen_ams_panel_ht_b_slot_color,
+                                          info->trays[0].tray_color, info->trays[0].remain);
 
                         if (objects.ams_screen_ams_panel_ht_b_label_material) {
                             if (info->trays[0].tray_type[0]) {
@@ -2033,8 +2036,8 @@ static void update_ams_overview_display(void) {
                         }
                     } else {
                         // Empty slot - show stripes
-                        set_slot_stripes_visible(ht_b_stripes, true);
-                        update_slot_color(objects.ams_screen_ams_panel_ht_b_slot_color, 0);
+                        ui_slot_stripes_set_slot(stripes, 0, 0, false);
+                        update_slot_gauge(objects.ams_screen_ams_panel_ht_b_slot, objects.ams_screen_ams_panel_ht_b_slot_color, 0, 255);
                         if (objects.ams_screen_ams_panel_ht_b_label_material) {
                             lv_label_set_text(objects.ams_screen_ams_panel_ht_b_label_material, "");
                         }
@@ -2169,11 +2172,158 @@ static int last_bell_screen = -1;
 static lv_obj_t *notification_dots[16] = {NULL};
 static int notification_dot_count = 0;
 
+// Shared pulse driver: one timer drives the opacity of every registered dot
+// from a single phase value, so all dots change in the same refresh cycle
+// instead of each running its own infinite lv_anim.
+#define PULSE_OPA_MAX        255
+#define PULSE_OPA_MIN        180    // Very subtle: only 30% fade
+#define PULSE_HALF_PERIOD_MS 2500   // 2.5s per direction
+#define PULSE_TIMER_MS       50     // ~20 opacity steps per second is plenty for a 75-step fade
+#define MAX_PULSE_DOTS       16
+
+static lv_obj_t *pulse_dots[MAX_PULSE_DOTS] = {NULL};
+static int pulse_dot_count = 0;
+static lv_timer_t *pulse_timer = NULL;
+static lv_opa_t pulse_last_opa = PULSE_OPA_MAX;
+static bool pulse_sleeping = false;    // Paused while idle or no dot is visible
+static uint32_t pulse_paused_at = 0;   // lv_tick_get() when it paused
+
+// Screen timeout (Rust FFI on ESP32, mock in ui_display.c on simulator)
+extern uint16_t display_get_timeout(void);
+
+/**
+ * @brief Compute the shared pulse opacity for the current tick (triangle wave)
+ */
+static lv_opa_t pulse_phase_opa(uint32_t now) {
+    uint32_t t = now % (2 * PULSE_HALF_PERIOD_MS);
+    if (t >= PULSE_HALF_PERIOD_MS) {
+        t = 2 * PULSE_HALF_PERIOD_MS - t;  // Playback direction
+    }
+    return (lv_opa_t)(PULSE_OPA_MAX - ((PULSE_OPA_MAX - PULSE_OPA_MIN) * t) / PULSE_HALF_PERIOD_MS);
+}
+
+/**
+ * @brief True when the display has been untouched longer than the screen timeout
+ */
+static bool pulse_display_idle(void) {
+    uint16_t timeout_sec = display_get_timeout();
+    if (timeout_sec == 0) return false;  // "Never"
+    return lv_display_get_inactive_time(NULL) >= (uint32_t)timeout_sec * 1000;
+}
+
+/**
+ * @brief Stop the timer until pulse_timer_wake() sees activity or a screen load
+ */
+static void pulse_timer_sleep(void) {
+    lv_timer_pause(pulse_timer);
+    pulse_sleeping = true;
+    pulse_paused_at = lv_tick_get();
+}
+
+/**
+ * @brief Resume a sleeping timer after a screen change or input since it paused
+ *
+ * Called from update_backend_ui() on every UI tick.
+ */
+static void pulse_timer_wake(bool screen_changed) {
+    if (!pulse_sleeping || pulse_dot_count == 0) return;
+    if (!screen_changed && lv_display_get_inactive_time(NULL) >= lv_tick_elaps(pulse_paused_at)) return;
+
+    pulse_sleeping = false;
+    lv_timer_resume(pulse_timer);
+}
+
+/**
+ * @brief Shared timer callback - applies one phase value to all visible dots
+ */
+static void pulse_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+
+    if (pulse_dot_count == 0 || pulse_display_idle()) {
+        pulse_timer_sleep();
+        return;
+    }
+
+    lv_opa_t opa = pulse_phase_opa(lv_tick_get());
+    lv_obj_t *active = lv_screen_active();
+    bool any_visible = false;
+    for (int i = 0; i < pulse_dot_count; i++) {
+        lv_obj_t *dot = pulse_dots[i];
+        // Skip dots on screens that aren't shown or that are hidden/scrolled away
+        if (lv_obj_get_screen(dot) != active || !lv_obj_is_visible(dot)) {
+            continue;
+        }
+        any_visible = true;
+        // Nothing changed since last step - no invalidation at all
+        if (opa != pulse_last_opa) {
+            lv_obj_set_style_bg_opa(dot, opa, 0);
+        }
+    }
+
+    if (!any_visible) {
+        pulse_timer_sleep();
+        return;
+    }
+    pulse_last_opa = opa;
+}
+
+static void pulse_dot_unregister(lv_obj_t *dot) {
+    for (int i = 0; i < pulse_dot_count; i++) {
+        if (pulse_dots[i] == dot) {
+            // Keep registration order, so pulse_dots[0] is always the oldest
+            memmove(&pulse_dots[i], &pulse_dots[i + 1], (pulse_dot_count - i - 1) * sizeof(pulse_dots[0]));
+            pulse_dots[--pulse_dot_count] = NULL;
+            break;
+        }
+    }
+    if (pulse_dot_count == 0 && pulse_timer) {
+        lv_timer_pause(pulse_timer);
+    }
+}
+
 /**
- * @brief Animation callback for pulsing opacity
+ * @brief Drop a dot from the pulse driver when LVGL deletes it
+ *
+ * Covers both explicit deletion and deletion of the parent screen.
  */
-static void pulse_anim_cb(void *var, int32_t value) {
-    lv_obj_set_style_bg_opa((lv_obj_t *)var, (lv_opa_t)value, 0);
+static void pulse_dot_delete_cb(lv_event_t *e) {
+    pulse_dot_unregister(lv_event_get_target(e));
+}
+
+/**
+ * @brief Register a dot with the shared pulse driver
+ */
+static void pulse_dot_register(lv_obj_t *dot) {
+    if (!dot) return;
+
+    if (pulse_dot_count >= MAX_PULSE_DOTS) {
+        // Full: the oldest dot stops pulsing (left fully opaque) to make room
+        static bool overflow_logged = false;
+        if (!overflow_logged) {
+            overflow_logged = true;
+            UI_LOGW("More than %d pulse dots, oldest ones stop pulsing", MAX_PULSE_DOTS);
+        }
+        lv_obj_t *oldest = pulse_dots[0];
+        lv_obj_remove_event_cb(oldest, pulse_dot_delete_cb);
+        lv_obj_set_style_bg_opa(oldest, PULSE_OPA_MAX, 0);
+        pulse_dot_unregister(oldest);
+    }
+
+    pulse_dots[pulse_dot_count++] = dot;
+    lv_obj_add_event_cb(dot, pulse_dot_delete_cb, LV_EVENT_DELETE, NULL);
+
+    // Start in phase with the other dots
+    lv_obj_set_style_bg_opa(dot, pulse_phase_opa(lv_tick_get()), 0);
+
+    if (!pulse_timer) {
+        // Outlives the screen the first dot is on
+        ui_mem_arena_t *arena = ui_mem_arena_suspend();
+        pulse_timer = lv_timer_create(pulse_timer_cb, PULSE_TIMER_MS, NULL);
+        ui_mem_arena_end(arena);
+    } else {
+        pulse_sleeping = false;
+        lv_timer_resume(pulse_timer);
+    }
 }
 
 /**
@@ -2196,16 +2346,8 @@ static lv_obj_t* create_notification_dot(lv_obj_t *bell) {
     lv_coord_t bell_w = lv_obj_get_width(bell);
     lv_obj_set_pos(dot, bell_x + bell_w - 4, bell_y - 2);
 
-    // Add very gentle pulsing animation
-    lv_anim_t anim;
-    lv_anim_init(&anim);
-    lv_anim_set_var(&anim, dot);
-    lv_anim_set_values(&anim, 255, 180);  // Very subtle: only 30% fade
-    lv_anim_set_time(&anim, 2500);  // 2.5s per direction
-    lv_anim_set_playback_time(&anim, 2500);
-    lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_set_exec_cb(&anim, pulse_anim_cb);
-    lv_anim_start(&anim);
+    // Very gentle pulsing, driven by the shared pulse timer
+    pulse_dot_register(dot);
 
     return dot;
 }
@@ -2274,19 +2416,11 @@ void reset_backend_ui_state(void) {
     // Reset cover image state
     cover_displayed = false;
 
-    // Reset slot stripes (become invalid when screen is deleted)
-    for (int i = 0; i < STRIPE_COUNT; i++) {
-        ht_a_stripes[i] = NULL;
-        ht_b_stripes[i] = NULL;
-    }
-    // Reset AMS slot stripes
-    for (int slot = 0; slot < 4; slot++) {
-        for (int i = 0; i < STRIPE_COUNT; i++) {
-            ams_a_slot_stripes[slot][i] = NULL;
-            ams_b_slot_stripes[slot][i] = NULL;
-            ams_c_slot_stripes[slot][i] = NULL;
-            ams_d_slot_stripes[slot][i] = NULL;
-        }
+    // Reset slot stripe overlays (become invalid when screen is deleted)
+    ht_a_stripes = NULL;
+    ht_b_stripes = NULL;
+    for (int i = 0; i < 4; i++) {
+        ams_slot_stripes[i] = NULL;
     }
 
     // Reset AMS overview screen tracking
@@ -2306,7 +2440,7 @@ void reset_backend_ui_state(void) {
     // Force past rate limit on next update_backend_ui call
     backend_update_counter = 1000;
 
-    ESP_LOGI(TAG, "Reset backend UI state - cleared all stale pointers");
+    UI_LOGI("Reset backend UI state - cleared all stale pointers");
 }
 
 /**
@@ -2461,7 +2595,7 @@ static void scan_printer_dropdown_changed(lv_event_t *e) {
     // Then refresh the scan result screen's AMS display (preserves tag data)
     ui_scan_result_refresh_ams();
 
-    ESP_LOGI(TAG, "Scan screen printer changed, refreshed AMS display");
+    UI_LOGI("Scan screen printer changed, refreshed AMS display");
 }
 
 /**
@@ -2498,29 +2632,29 @@ static AmsSlotUserData ams_ext2_slot_data = {255, 0, 1};
 
 // Success callback - trigger AMS display refresh
 static void ams_slot_config_success(void) {
-    ESP_LOGI(TAG, "AMS slot configuration succeeded, refreshing display");
+    UI_LOGI("AMS slot configuration succeeded, refreshing display");
     needs_data_refresh = true;
 }
 
 // Click handler for AMS slots
 static void ams_slot_click_handler(lv_event_t *e) {
-    ESP_LOGI(TAG, "ams_slot_click_handler: ENTRY");
+    UI_LOGD("ams_slot_click_handler: ENTRY");
 
     AmsSlotUserData *slot_data = (AmsSlotUserData *)lv_event_get_user_data(e);
     if (!slot_data) {
-        ESP_LOGI(TAG, "ams_slot_click_handler: no slot_data");
+        UI_LOGW("ams_slot_click_handler: no slot_data");
         return;
     }
 
-    ESP_LOGI(TAG, "ams_slot_click_handler: slot ams=%d tray=%d", slot_data->ams_id, slot_data->tray_id);
+    UI_LOGD("ams_slot_click_handler: slot ams=%d tray=%d", slot_data->ams_id, slot_data->tray_id);
 
     // Get printer serial
     BackendPrinterInfo printer_info = {0};
     if (backend_get_printer(selected_printer_index, &printer_info) != 0) {
-        ESP_LOGI(TAG, "Failed to get printer info for slot click");
+        UI_LOGW("Failed to get printer info for slot click");
         return;
     }
-    ESP_LOGI(TAG, "ams_slot_click_handler: got printer info");
+    UI_LOGD("ams_slot_click_handler: got printer info");
 
     // Get current tray info
     AmsUnitCInfo ams_info = {0};
@@ -2553,16 +2687,16 @@ static void ams_slot_click_handler(lv_event_t *e) {
     // Get extruder_id from AMS unit (-1 if not found or unknown)
     int extruder_id = found_ams ? ams_info.extruder : -1;
 
-    ESP_LOGI(TAG, "Opening AMS slot config: printer=%s, ams=%d, tray=%d, extruder=%d, type=%s, color=%s",
-             printer_info.serial, slot_data->ams_id, slot_data->tray_id, extruder_id,
-             tray_type ? tray_type : "empty", tray_color);
+    UI_LOGI("Opening AMS slot config: printer=%s, ams=%d, tray=%d, extruder=%d, type=%s, color=%s",
+            printer_info.serial, slot_data->ams_id, slot_data->tray_id, extruder_id,
+            tray_type ? tray_type : "empty", tray_color);
 
-    ESP_LOGI(TAG, "ams_slot_click_handler: calling ui_ams_slot_modal_open");
+    UI_LOGD("ams_slot_click_handler: calling ui_ams_slot_modal_open");
     ui_ams_slot_modal_open(printer_info.serial, slot_data->ams_id, slot_data->tray_id,
                            slot_data->tray_count, extruder_id,
                            tray_type, tray_color[0] ? tray_color : NULL,
                            ams_slot_config_success);
-    ESP_LOGI(TAG, "ams_slot_click_handler: modal_open returned");
+    UI_LOGD("ams_slot_click_handler: modal_open returned");
 }
 
 /**
@@ -2658,7 +2792,7 @@ void wire_ams_slot_click_handlers(void) {
                            LV_EVENT_CLICKED, &ams_ext2_slot_data);
     }
 
-    ESP_LOGI(TAG, "Wired AMS slot click handlers");
+    UI_LOGI("Wired AMS slot click handlers");
 }
 
 /**
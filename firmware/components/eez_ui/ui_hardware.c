@@ -5,6 +5,7 @@
 // =============================================================================
 
 #include "ui_internal.h"
+#include "ui_keyboard.h"
 #include "screens.h"
 #include "images.h"
 #include <stdio.h>
@@ -59,7 +60,6 @@ static lv_obj_t *scale_cal_status_subtitle = NULL;
 static lv_obj_t *scale_cal_weight_input = NULL;
 static lv_obj_t *scale_cal_weight_label = NULL;    // Live weight display
 static lv_obj_t *scale_cal_status_label = NULL;    // Operation status
-static lv_obj_t *scale_cal_keyboard = NULL;
 static lv_timer_t *scale_cal_timer = NULL;
 static int scale_cal_weight_value = 500;           // Default calibration weight
 
@@ -570,31 +570,14 @@ static void cal_screen_calibrate_handler(lv_event_t *e) {
     }
 }
 
-static void cal_keyboard_handler(lv_event_t *e) {
-    lv_event_code_t code = lv_event_get_code(e);
-    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
-        // Close keyboard and scroll content back
-        if (scale_cal_keyboard) {
-            lv_obj_add_flag(scale_cal_keyboard, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (scale_cal_content) {
-            lv_obj_scroll_to_y(scale_cal_content, 0, LV_ANIM_ON);
-        }
-    }
-}
-
-static void cal_input_click_handler(lv_event_t *e) {
-    (void)e;
-    // Show keyboard when input is clicked
-    if (scale_cal_keyboard) {
-        lv_obj_clear_flag(scale_cal_keyboard, LV_OBJ_FLAG_HIDDEN);
-        // Scroll content up so input field is visible above keyboard
-        // Weight input is at y=260, keyboard is ~200px tall
-        // Need to scroll enough that input appears near top of visible area
-        if (scale_cal_content) {
-            lv_obj_scroll_to_y(scale_cal_content, 180, LV_ANIM_ON);
-        }
-    }
+static void cal_keyboard_toggle(lv_obj_t *ta, bool visible, void *user_data) {
+    (void)ta;
+    (void)user_data;
+    if (!scale_cal_content) return;
+    // Scroll content up so input field is visible above keyboard
+    // Weight input is at y=260, keyboard is ~240px tall
+    // Need to scroll enough that input appears near top of visible area
+    lv_obj_scroll_to_y(scale_cal_content, visible ? 180 : 0, LV_ANIM_ON);
 }
 
 // Weight display hysteresis for calibration screen
@@ -743,7 +726,6 @@ void create_scale_calibration_screen(void) {
     lv_obj_set_style_text_color(scale_cal_weight_input, lv_color_hex(COLOR_TEXT_PRIMARY), LV_PART_MAIN);
     lv_obj_set_style_text_font(scale_cal_weight_input, &lv_font_montserrat_18, LV_PART_MAIN);
     lv_obj_set_style_border_color(scale_cal_weight_input, lv_color_hex(COLOR_BORDER), LV_PART_MAIN);
-    lv_obj_add_event_cb(scale_cal_weight_input, cal_input_click_handler, LV_EVENT_CLICKED, NULL);
 
     // Live weight display
     scale_cal_weight_label = lv_label_create(input_container);
@@ -804,12 +786,8 @@ void create_scale_calibration_screen(void) {
     lv_obj_set_style_border_width(spacer, 0, LV_PART_MAIN);
     lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
 
-    // Keyboard (hidden by default)
-    scale_cal_keyboard = lv_keyboard_create(scale_calibration_screen);
-    lv_keyboard_set_mode(scale_cal_keyboard, LV_KEYBOARD_MODE_NUMBER);
-    lv_keyboard_set_textarea(scale_cal_keyboard, scale_cal_weight_input);
-    lv_obj_add_event_cb(scale_cal_keyboard, cal_keyboard_handler, LV_EVENT_ALL, NULL);
-    lv_obj_add_flag(scale_cal_keyboard, LV_OBJ_FLAG_HIDDEN);
+    // Number keyboard when the weight input is clicked
+    ui_keyboard_register_textarea(scale_cal_weight_input, LV_KEYBOARD_MODE_NUMBER, cal_keyboard_toggle, NULL);
 
     // Start timer for live weight updates
     scale_cal_timer = lv_timer_create(scale_cal_timer_cb, 200, NULL);
@@ -927,76 +905,6 @@ static lv_obj_t *kb_layout_preview = NULL;
 static KeyboardLayout current_keyboard_layout = KEYBOARD_LAYOUT_QWERTY;
 static bool keyboard_layout_loaded = false;
 
-// =============================================================================
-// Custom Keyboard Maps for QWERTZ and AZERTY
-// =============================================================================
-
-#define LV_KB_BTN(width) LV_BUTTONMATRIX_CTRL_POPOVER | width
-
-// QWERTZ lowercase map (German layout - Y and Z swapped)
-static const char * const kb_map_qwertz_lc[] = {
-    "1#", "q", "w", "e", "r", "t", "z", "u", "i", "o", "p", LV_SYMBOL_BACKSPACE, "\n",
-    "ABC", "a", "s", "d", "f", "g", "h", "j", "k", "l", LV_SYMBOL_NEW_LINE, "\n",
-    "_", "-", "y", "x", "c", "v", "b", "n", "m", ".", ",", ":", "\n",
-    LV_SYMBOL_KEYBOARD, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
-};
-
-// QWERTZ uppercase map
-static const char * const kb_map_qwertz_uc[] = {
-    "1#", "Q", "W", "E", "R", "T", "Z", "U", "I", "O", "P", LV_SYMBOL_BACKSPACE, "\n",
-    "abc", "A", "S", "D", "F", "G", "H", "J", "K", "L", LV_SYMBOL_NEW_LINE, "\n",
-    "_", "-", "Y", "X", "C", "V", "B", "N", "M", ".", ",", ":", "\n",
-    LV_SYMBOL_CLOSE, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
-};
-
-// AZERTY lowercase map (French layout)
-static const char * const kb_map_azerty_lc[] = {
-    "1#", "a", "z", "e", "r", "t", "y", "u", "i", "o", "p", LV_SYMBOL_BACKSPACE, "\n",
-    "ABC", "q", "s", "d", "f", "g", "h", "j", "k", "l", "m", LV_SYMBOL_NEW_LINE, "\n",
-    "_", "-", "w", "x", "c", "v", "b", "n", ".", ",", ":", "\n",
-    LV_SYMBOL_KEYBOARD, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
-};
-
-// AZERTY uppercase map
-static const char * const kb_map_azerty_uc[] = {
-    "1#", "A", "Z", "E", "R", "T", "Y", "U", "I", "O", "P", LV_SYMBOL_BACKSPACE, "\n",
-    "abc", "Q", "S", "D", "F", "G", "H", "J", "K", "L", "M", LV_SYMBOL_NEW_LINE, "\n",
-    "_", "-", "W", "X", "C", "V", "B", "N", ".", ",", ":", "\n",
-    LV_SYMBOL_CLOSE, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
-};
-
-// Control maps (same structure for all layouts)
-static const lv_buttonmatrix_ctrl_t kb_ctrl_text_map[] = {
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
-    LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4),
-    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 6,
-    LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3),
-    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
-    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
-    LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1),
-    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2,
-    LV_BUTTONMATRIX_CTRL_CHECKED | 2, 6, LV_BUTTONMATRIX_CTRL_CHECKED | 2,
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2
-};
-
-// AZERTY control map (slightly different row layout - 11 keys in row 2)
-static const lv_buttonmatrix_ctrl_t kb_ctrl_azerty_map[] = {
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
-    LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4),
-    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
-    LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3),
-    LV_BUTTONMATRIX_CTRL_CHECKED | 6,
-    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
-    LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1),
-    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2,
-    LV_BUTTONMATRIX_CTRL_CHECKED | 2, 6, LV_BUTTONMATRIX_CTRL_CHECKED | 2,
-    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2
-};
-
 // =============================================================================
 // NVS Functions for Keyboard Layout
 // =============================================================================
@@ -1076,31 +984,6 @@ KeyboardLayout get_keyboard_layout(void) {
     return current_keyboard_layout;
 }
 
-// =============================================================================
-// Apply Keyboard Layout to a Keyboard Widget
-// =============================================================================
-
-void apply_keyboard_layout(lv_obj_t *keyboard) {
-    if (!keyboard) return;
-
-    KeyboardLayout layout = get_keyboard_layout();
-
-    switch (layout) {
-        case KEYBOARD_LAYOUT_QWERTZ:
-            lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_LOWER, kb_map_qwertz_lc, kb_ctrl_text_map);
-            lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_UPPER, kb_map_qwertz_uc, kb_ctrl_text_map);
-            break;
-        case KEYBOARD_LAYOUT_AZERTY:
-            lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_LOWER, kb_map_azerty_lc, kb_ctrl_azerty_map);
-            lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_UPPER, kb_map_azerty_uc, kb_ctrl_azerty_map);
-            break;
-        case KEYBOARD_LAYOUT_QWERTY:
-        default:
-            // QWERTY is the default LVGL layout, no need to set custom maps
-            break;
-    }
-}
-
 // =============================================================================
 // Keyboard Layout Screen Handlers
 // =============================================================================
@@ -1135,19 +1018,7 @@ static void update_preview_keyboard(KeyboardLayout layout) {
     if (!kb_layout_preview) return;
 
     // Apply the selected layout to preview keyboard
-    switch (layout) {
-        case KEYBOARD_LAYOUT_QWERTZ:
-            lv_keyboard_set_map(kb_layout_preview, LV_KEYBOARD_MODE_TEXT_LOWER, kb_map_qwertz_lc, kb_ctrl_text_map);
-            break;
-        case KEYBOARD_LAYOUT_AZERTY:
-            lv_keyboard_set_map(kb_layout_preview, LV_KEYBOARD_MODE_TEXT_LOWER, kb_map_azerty_lc, kb_ctrl_azerty_map);
-            break;
-        case KEYBOARD_LAYOUT_QWERTY:
-        default:
-            // Reset to default QWERTY - need to reload widget to reset maps
-            // For now, just leave as-is since QWERTY is default
-            break;
-    }
+    apply_keyboard_layout(kb_layout_preview, layout);
     lv_keyboard_set_mode(kb_layout_preview, LV_KEYBOARD_MODE_TEXT_LOWER);
 }
 
@@ -1366,7 +1237,6 @@ void cleanup_hardware_screens(void) {
         scale_cal_weight_input = NULL;
         scale_cal_weight_label = NULL;
         scale_cal_status_label = NULL;
-        scale_cal_keyboard = NULL;
     }
     if (!keyboard_layout_screen) {
         kb_layout_top_bar_icon_back = NULL;
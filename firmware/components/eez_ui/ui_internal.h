@@ -201,6 +201,9 @@ extern bool spool_sync_weight(const char *spool_id, int weight);
 
 // Check if a spool with given tag_id exists in inventory
 extern bool spool_exists_by_tag(const char *tag_id);
+// Check several tag ids with one request, sets known[i] for tag_ids[i]
+// Returns 0 on success, -1 on error
+extern int spool_tags_known(const char **tag_ids, int count, bool *known);
 
 // Add a new spool to inventory
 extern bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *material,
@@ -230,6 +233,36 @@ extern int spool_get_untagged_count(void);
 // Returns: 0 = success, -1 = connection error, or HTTP status code (e.g., 409 = already assigned)
 extern int spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_type);
 
+// =============================================================================
+// NFC Bulk Inventory (implemented in Rust)
+// =============================================================================
+
+// One tag of the last inventory round (matches NfcInventoryTag in nfc_bridge_manager.rs)
+typedef struct {
+    char uid_hex[32];       // "XX:XX:XX:XX"
+    uint8_t tag_type;       // 0=unknown, 1=NTAG, 2=MIFARE 1K, 3=MIFARE 4K
+    bool decoded;           // vendor..spool_weight read from the tag
+    char vendor[32];
+    char material[32];
+    char subtype[32];
+    char color_name[32];
+    uint32_t color_rgba;
+    int32_t spool_weight;
+} NfcInventoryTag;
+
+// Bulk inventory mode: the bridge reports every tag in the field instead of one
+extern void nfc_inventory_set_active(bool active);
+extern bool nfc_inventory_is_active(void);
+// Completed rounds since the mode was entered (changes when the list may have)
+extern uint32_t nfc_inventory_get_round(void);
+extern int nfc_inventory_get_count(void);
+extern bool nfc_inventory_get_tag(int index, NfcInventoryTag *tag);
+
+// Add one spool per tag in a single request (POST /api/spools/batch)
+// Returns spools created, -1 on error; skipped = tags already in inventory
+extern int spool_add_batch_to_inventory(const NfcInventoryTag *tags, int count,
+                                        const char *data_origin, int *skipped);
+
 // =============================================================================
 // AMS Slot Configuration API (for Configure Slot modal)
 // =============================================================================
@@ -240,6 +273,10 @@ typedef struct {
     char name[64];          // Preset name (e.g., "Bambu PLA Basic")
     char type[16];          // Type: "filament", "printer", "process"
     bool is_custom;         // true for user's custom presets
+    char brand[24];         // Brand parsed by the backend (e.g., "Devil Design"), empty if unknown
+    char material[8];       // Material type (e.g., "PETG")
+    int16_t temp_min;       // Nozzle temperature range for the material
+    int16_t temp_max;
 } SlicerPreset;
 
 // Preset detail from cloud API (matches backend_client.h PresetDetail)
@@ -270,7 +307,7 @@ typedef struct {
     char material[32];      // e.g., "PLA" (may be empty)
 } ColorCatalogEntry;
 
-// Get slicer filament presets from Bambu Cloud
+// Get slicer filament presets (from the flash catalog; downloads only if there is none yet)
 // Returns number of presets found (up to max_count), -1 on error
 extern int backend_get_slicer_presets(SlicerPreset *presets, int max_count);
 
@@ -325,6 +362,10 @@ extern enum ScreensEnum previousScreen;
 extern const char *pending_settings_detail_title;
 extern int pending_settings_tab;
 
+// Milliseconds until ui_tick() has work (0 = call it now): a pending screen
+// change or the next UI poll. Lets a main loop sleep between them.
+uint32_t ui_tick_wait_ms(void);
+
 // =============================================================================
 // Shared Printer State (defined in ui_printer.c)
 // =============================================================================
@@ -374,6 +415,7 @@ void sync_printers_from_backend(void);  // Sync saved_printers with backend data
 // Module Functions - ui_settings.c
 // =============================================================================
 
+void create_settings_screen(void);  // Tabs are built on first selection
 void wire_settings_buttons(void);
 void wire_settings_detail_buttons(void);
 void wire_settings_subpage_buttons(lv_obj_t *back_btn);
@@ -420,8 +462,8 @@ typedef enum {
     KEYBOARD_LAYOUT_AZERTY = 2,
 } KeyboardLayout;
 
-// Apply saved keyboard layout to a keyboard widget
-void apply_keyboard_layout(lv_obj_t *keyboard);
+// Set a keyboard widget's text maps for a layout (ui_keyboard.c)
+void apply_keyboard_layout(lv_obj_t *keyboard, KeyboardLayout layout);
 // Get current keyboard layout setting
 KeyboardLayout get_keyboard_layout(void);
 // Save keyboard layout to NVS
@@ -0,0 +1,265 @@
+/**
+ * @file ui_keyboard.c
+ * @brief Shared on-screen keyboard (see ui_keyboard.h)
+ */
+
+#include "ui_keyboard.h"
+#include "ui_internal.h"
+#include <stdio.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+static const char *TAG = "ui_keyboard";
+#define KEYBOARD_LOGW(fmt, ...) ESP_LOGW(TAG, fmt, ##__VA_ARGS__)
+#else
+#define KEYBOARD_LOGW(fmt, ...) printf("[ui_keyboard] " fmt "\n", ##__VA_ARGS__)
+#endif
+
+// =============================================================================
+// Keyboard Maps
+// =============================================================================
+
+// QWERTY maps, same as the LVGL defaults. Needed to switch back from
+// another layout, LVGL doesn't export its own.
+static const char * const kb_map_qwerty_lc[] = {
+    "1#", "q", "w", "e", "r", "t", "y", "u", "i", "o", "p", LV_SYMBOL_BACKSPACE, "\n",
+    "ABC", "a", "s", "d", "f", "g", "h", "j", "k", "l", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "z", "x", "c", "v", "b", "n", "m", ".", ",", ":", "\n",
+    LV_SYMBOL_KEYBOARD, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+static const char * const kb_map_qwerty_uc[] = {
+    "1#", "Q", "W", "E", "R", "T", "Y", "U", "I", "O", "P", LV_SYMBOL_BACKSPACE, "\n",
+    "abc", "A", "S", "D", "F", "G", "H", "J", "K", "L", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "Z", "X", "C", "V", "B", "N", "M", ".", ",", ":", "\n",
+    LV_SYMBOL_CLOSE, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+#define LV_KB_BTN(width) LV_BUTTONMATRIX_CTRL_POPOVER | width
+
+// QWERTZ lowercase map (German layout - Y and Z swapped)
+static const char * const kb_map_qwertz_lc[] = {
+    "1#", "q", "w", "e", "r", "t", "z", "u", "i", "o", "p", LV_SYMBOL_BACKSPACE, "\n",
+    "ABC", "a", "s", "d", "f", "g", "h", "j", "k", "l", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "y", "x", "c", "v", "b", "n", "m", ".", ",", ":", "\n",
+    LV_SYMBOL_KEYBOARD, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+// QWERTZ uppercase map
+static const char * const kb_map_qwertz_uc[] = {
+    "1#", "Q", "W", "E", "R", "T", "Z", "U", "I", "O", "P", LV_SYMBOL_BACKSPACE, "\n",
+    "abc", "A", "S", "D", "F", "G", "H", "J", "K", "L", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "Y", "X", "C", "V", "B", "N", "M", ".", ",", ":", "\n",
+    LV_SYMBOL_CLOSE, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+// AZERTY lowercase map (French layout)
+static const char * const kb_map_azerty_lc[] = {
+    "1#", "a", "z", "e", "r", "t", "y", "u", "i", "o", "p", LV_SYMBOL_BACKSPACE, "\n",
+    "ABC", "q", "s", "d", "f", "g", "h", "j", "k", "l", "m", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "w", "x", "c", "v", "b", "n", ".", ",", ":", "\n",
+    LV_SYMBOL_KEYBOARD, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+// AZERTY uppercase map
+static const char * const kb_map_azerty_uc[] = {
+    "1#", "A", "Z", "E", "R", "T", "Y", "U", "I", "O", "P", LV_SYMBOL_BACKSPACE, "\n",
+    "abc", "Q", "S", "D", "F", "G", "H", "J", "K", "L", "M", LV_SYMBOL_NEW_LINE, "\n",
+    "_", "-", "W", "X", "C", "V", "B", "N", ".", ",", ":", "\n",
+    LV_SYMBOL_CLOSE, LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, LV_SYMBOL_OK, ""
+};
+
+// Control maps (same structure for all layouts)
+static const lv_buttonmatrix_ctrl_t kb_ctrl_text_map[] = {
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
+    LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4),
+    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 6,
+    LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3),
+    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
+    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
+    LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1),
+    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2,
+    LV_BUTTONMATRIX_CTRL_CHECKED | 2, 6, LV_BUTTONMATRIX_CTRL_CHECKED | 2,
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2
+};
+
+// AZERTY control map (slightly different row layout - 11 keys in row 2)
+static const lv_buttonmatrix_ctrl_t kb_ctrl_azerty_map[] = {
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
+    LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4), LV_KB_BTN(4),
+    LV_BUTTONMATRIX_CTRL_CHECKED | 7,
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 5,
+    LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3), LV_KB_BTN(3),
+    LV_BUTTONMATRIX_CTRL_CHECKED | 6,
+    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
+    LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1), LV_KB_BTN(1),
+    LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1), LV_BUTTONMATRIX_CTRL_CHECKED | LV_KB_BTN(1),
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2,
+    LV_BUTTONMATRIX_CTRL_CHECKED | 2, 6, LV_BUTTONMATRIX_CTRL_CHECKED | 2,
+    LV_BUTTONMATRIX_CTRL_NO_REPEAT | LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKED | 2
+};
+
+typedef struct {
+    const char * const *lower;
+    const char * const *upper;
+    const lv_buttonmatrix_ctrl_t *ctrl;
+} keyboard_layout_maps_t;
+
+static const keyboard_layout_maps_t layout_maps[] = {
+    [KEYBOARD_LAYOUT_QWERTY] = {kb_map_qwerty_lc, kb_map_qwerty_uc, kb_ctrl_text_map},
+    [KEYBOARD_LAYOUT_QWERTZ] = {kb_map_qwertz_lc, kb_map_qwertz_uc, kb_ctrl_text_map},
+    [KEYBOARD_LAYOUT_AZERTY] = {kb_map_azerty_lc, kb_map_azerty_uc, kb_ctrl_azerty_map},
+};
+
+void apply_keyboard_layout(lv_obj_t *keyboard, KeyboardLayout layout) {
+    if (!keyboard) return;
+    if ((unsigned)layout >= sizeof(layout_maps) / sizeof(layout_maps[0])) {
+        layout = KEYBOARD_LAYOUT_QWERTY;
+    }
+    const keyboard_layout_maps_t *maps = &layout_maps[layout];
+    lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_LOWER, maps->lower, maps->ctrl);
+    lv_keyboard_set_map(keyboard, LV_KEYBOARD_MODE_TEXT_UPPER, maps->upper, maps->ctrl);
+}
+
+// =============================================================================
+// Shared Keyboard
+// =============================================================================
+
+typedef struct {
+    lv_obj_t *ta;
+    lv_keyboard_mode_t mode;
+    ui_keyboard_toggle_cb_t on_toggle;
+    void *user_data;
+} keyboard_registration_t;
+
+static lv_obj_t *keyboard = NULL;
+static keyboard_registration_t registrations[UI_KEYBOARD_MAX_TEXTAREAS];
+// Registration the keyboard is open for (NULL when hidden)
+static keyboard_registration_t *active = NULL;
+// Layout whose maps are set on the keyboard (-1 = none yet)
+static int applied_layout = -1;
+
+static void refresh_layout(void) {
+    KeyboardLayout layout = get_keyboard_layout();
+    if ((int)layout == applied_layout) return;
+    apply_keyboard_layout(keyboard, layout);
+    applied_layout = (int)layout;
+}
+
+static keyboard_registration_t *find_registration(lv_obj_t *ta) {
+    for (int i = 0; i < UI_KEYBOARD_MAX_TEXTAREAS; i++) {
+        if (registrations[i].ta == ta) return &registrations[i];
+    }
+    return NULL;
+}
+
+static void keyboard_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
+        ui_keyboard_hide();
+    }
+}
+
+static void textarea_event_cb(lv_event_t *e) {
+    keyboard_registration_t *reg = (keyboard_registration_t *)lv_event_get_user_data(e);
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_CLICKED || code == LV_EVENT_FOCUSED) {
+        ui_keyboard_show(reg->ta);
+    } else if (code == LV_EVENT_DELETE) {
+        // Screen teardown: detach without calling back into the screen
+        if (active == reg) {
+            active = NULL;
+            lv_keyboard_set_textarea(keyboard, NULL);
+            lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+        }
+        reg->ta = NULL;
+        reg->on_toggle = NULL;
+        reg->user_data = NULL;
+    }
+}
+
+void ui_keyboard_init(void) {
+    if (keyboard) return;
+
+    keyboard = lv_keyboard_create(lv_layer_top());
+    if (!keyboard) return;
+
+    lv_obj_set_size(keyboard, LV_PCT(100), UI_KEYBOARD_HEIGHT);
+    lv_obj_align(keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(keyboard, keyboard_event_cb, LV_EVENT_READY, NULL);
+    lv_obj_add_event_cb(keyboard, keyboard_event_cb, LV_EVENT_CANCEL, NULL);
+    refresh_layout();
+}
+
+void ui_keyboard_register_textarea(lv_obj_t *ta, lv_keyboard_mode_t mode,
+                                   ui_keyboard_toggle_cb_t on_toggle, void *user_data) {
+    if (!ta) return;
+
+    keyboard_registration_t *reg = find_registration(ta);
+    if (!reg) {
+        reg = find_registration(NULL);
+        if (!reg) {
+            KEYBOARD_LOGW("No free keyboard slot, text area not registered");
+            return;
+        }
+        reg->ta = ta;
+        lv_obj_add_flag(ta, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_event_cb(ta, textarea_event_cb, LV_EVENT_CLICKED, reg);
+        lv_obj_add_event_cb(ta, textarea_event_cb, LV_EVENT_FOCUSED, reg);
+        lv_obj_add_event_cb(ta, textarea_event_cb, LV_EVENT_DELETE, reg);
+    }
+    reg->mode = mode;
+    reg->on_toggle = on_toggle;
+    reg->user_data = user_data;
+}
+
+void ui_keyboard_show(lv_obj_t *ta) {
+    keyboard_registration_t *reg = ta ? find_registration(ta) : NULL;
+    if (!keyboard || !reg || active == reg) return;
+
+    // Switching fields: let the previous one's screen restore itself first
+    keyboard_registration_t *previous = active;
+    active = reg;
+    if (previous && previous->on_toggle) {
+        previous->on_toggle(previous->ta, false, previous->user_data);
+    }
+
+    refresh_layout();
+    if (lv_keyboard_get_mode(keyboard) != reg->mode) {
+        lv_keyboard_set_mode(keyboard, reg->mode);
+    }
+    lv_keyboard_set_textarea(keyboard, ta);
+    lv_obj_add_state(ta, LV_STATE_FOCUSED);
+    lv_obj_remove_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+    // Popups on the top layer created since startup would otherwise cover it
+    lv_obj_move_foreground(keyboard);
+
+    if (reg->on_toggle) {
+        reg->on_toggle(ta, true, reg->user_data);
+    }
+}
+
+void ui_keyboard_hide(void) {
+    if (!keyboard || !active) return;
+
+    keyboard_registration_t *reg = active;
+    active = NULL;
+    lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_keyboard_set_textarea(keyboard, NULL);
+
+    if (reg->on_toggle) {
+        reg->on_toggle(reg->ta, false, reg->user_data);
+    }
+}
+
+bool ui_keyboard_is_visible(void) {
+    return active != NULL;
+}
+
+lv_obj_t *ui_keyboard_get_textarea(void) {
+    return active ? active->ta : NULL;
+}
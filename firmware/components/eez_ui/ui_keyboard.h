@@ -0,0 +1,75 @@
+/**
+ * @file ui_keyboard.h
+ * @brief Shared on-screen keyboard
+ *
+ * One keyboard is created at startup on lv_layer_top() and lives for the
+ * whole session. Screens and modals register their text areas instead of
+ * creating their own keyboard; opening the keyboard only retargets it and
+ * clears its hidden flag. The saved layout's button maps are applied once
+ * and again only when the layout setting changes.
+ *
+ *     ui_keyboard_register_textarea(ta, LV_KEYBOARD_MODE_TEXT_LOWER, on_toggle, NULL);
+ *
+ * The keyboard opens when a registered text area is clicked or focused and
+ * closes on the OK/close keys, ui_keyboard_hide(), or when its text area is
+ * deleted (e.g. with its screen).
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#ifndef UI_KEYBOARD_H
+#define UI_KEYBOARD_H
+
+#include <stdbool.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Text areas that can be registered at the same time
+#define UI_KEYBOARD_MAX_TEXTAREAS 8
+
+// Keyboard height; screens move their content up by about this much
+#define UI_KEYBOARD_HEIGHT 240
+
+/**
+ * Called after the keyboard opens for (visible = true) or closes from a
+ * registered text area, so the screen can make room for it.
+ */
+typedef void (*ui_keyboard_toggle_cb_t)(lv_obj_t *ta, bool visible, void *user_data);
+
+/**
+ * Create the shared keyboard (hidden). Call once after the display exists.
+ */
+void ui_keyboard_init(void);
+
+/**
+ * Open the keyboard when ta is clicked or focused. on_toggle may be NULL.
+ * Registration ends when ta is deleted.
+ */
+void ui_keyboard_register_textarea(lv_obj_t *ta, lv_keyboard_mode_t mode,
+                                   ui_keyboard_toggle_cb_t on_toggle, void *user_data);
+
+/**
+ * Open the keyboard for a registered text area.
+ */
+void ui_keyboard_show(lv_obj_t *ta);
+
+/**
+ * Close the keyboard if it is open.
+ */
+void ui_keyboard_hide(void);
+
+bool ui_keyboard_is_visible(void);
+
+/**
+ * Text area the keyboard is open for, or NULL.
+ */
+lv_obj_t *ui_keyboard_get_textarea(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_KEYBOARD_H */
@@ -0,0 +1,381 @@
+/**
+ * @file ui_log.c
+ * @brief Leveled logging with deferred formatting
+ *
+ * See ui_log.h.
+ */
+
+#include "ui_log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+static portMUX_TYPE ring_lock = portMUX_INITIALIZER_UNLOCKED;
+#define RING_LOCK() portENTER_CRITICAL(&ring_lock)
+#define RING_UNLOCK() portEXIT_CRITICAL(&ring_lock)
+#else
+#include <pthread.h>
+#include <time.h>
+static pthread_mutex_t ring_lock = PTHREAD_MUTEX_INITIALIZER;
+#define RING_LOCK() pthread_mutex_lock(&ring_lock)
+#define RING_UNLOCK() pthread_mutex_unlock(&ring_lock)
+#endif
+
+static const char *TAG = "ui_log";
+
+// Longest formatted message handed to the sink
+#define LINE_MAX_LEN 256
+
+#define ALIGN8(n) (((n) + 7) & ~(size_t)7)
+
+// A record in the ring, followed by nargs type bytes (padded to 8), nargs
+// 8-byte values and the copied strings. A string's value is its offset in
+// the record.
+typedef struct {
+    uint16_t size;      // Bytes including this header, 0 = wrap marker
+    uint8_t level;
+    uint8_t nargs;
+    uint32_t time_ms;
+    const char *tag;
+    const char *fmt;
+} record_t;
+
+#define HEADER_SIZE ALIGN8(sizeof(record_t))
+#define MAX_RECORD_SIZE \
+    (HEADER_SIZE + ALIGN8(UI_LOG_MAX_ARGS) + 8 * UI_LOG_MAX_ARGS + UI_LOG_MAX_ARGS * UI_LOG_MAX_STRING)
+#define NULL_STRING UINT64_MAX
+
+static uint64_t ring_words[UI_LOG_RING_SIZE / 8];
+#define ring ((uint8_t *)ring_words)
+
+static size_t head = 0;       // Next write offset
+static size_t tail = 0;       // Oldest record
+static uint32_t pending = 0;
+static uint32_t written = 0;
+static uint32_t dropped = 0;
+static uint32_t dropped_reported = 0;
+static size_t high_water = 0;
+
+static uint32_t now_ms(void) {
+#ifdef ESP_PLATFORM
+    return esp_log_timestamp();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+#endif
+}
+
+// =============================================================================
+// Ring (caller holds the lock)
+// =============================================================================
+
+static void evict_oldest(void) {
+    const record_t *r = (const record_t *)(ring + tail);
+    if (r->size == 0) {
+        tail = 0;  // Wrap marker
+        return;
+    }
+    tail += r->size;
+    if (tail >= UI_LOG_RING_SIZE) tail = 0;
+    pending--;
+    dropped++;
+}
+
+static size_t reserve(size_t size) {
+    if (head + size > UI_LOG_RING_SIZE) {
+        // Doesn't fit before the end: drop what's there and wrap
+        while (pending && tail >= head) evict_oldest();
+        ((record_t *)(ring + head))->size = 0;
+        head = 0;
+    }
+    while (pending && tail >= head && tail - head < size) evict_oldest();
+
+    size_t offset = head;
+    head += size;
+    if (head >= UI_LOG_RING_SIZE) head = 0;
+    if (pending == 0) tail = offset;
+    return offset;
+}
+
+static size_t ring_used(void) {
+    if (!pending) return 0;
+    return head > tail ? head - tail : UI_LOG_RING_SIZE - tail + head;
+}
+
+// =============================================================================
+// Writing
+// =============================================================================
+
+void ui_log_write(int level, const char *tag, const char *fmt, const ui_log_arg_t *args, int nargs) {
+    if (nargs > UI_LOG_MAX_ARGS) nargs = UI_LOG_MAX_ARGS;
+
+    size_t str_len[UI_LOG_MAX_ARGS];
+    size_t values = HEADER_SIZE + ALIGN8((size_t)nargs);
+    size_t size = values + 8 * (size_t)nargs;
+    for (int i = 0; i < nargs; i++) {
+        if (args[i].type != UI_LOG_ARG_STRING || !args[i].v.s) continue;
+        size_t len = 0;
+        while (len < UI_LOG_MAX_STRING - 1 && args[i].v.s[len]) len++;
+        str_len[i] = len;
+        size += len + 1;
+    }
+    size = ALIGN8(size);
+    uint32_t time_ms = now_ms();
+
+    RING_LOCK();
+    uint8_t *rec = ring + reserve(size);
+    record_t *r = (record_t *)rec;
+    r->size = (uint16_t)size;
+    r->level = (uint8_t)level;
+    r->nargs = (uint8_t)nargs;
+    r->time_ms = time_ms;
+    r->tag = tag;
+    r->fmt = fmt;
+
+    size_t strings = values + 8 * (size_t)nargs;
+    for (int i = 0; i < nargs; i++) {
+        rec[HEADER_SIZE + i] = args[i].type;
+        uint64_t value;
+        if (args[i].type == UI_LOG_ARG_STRING) {
+            value = NULL_STRING;
+            if (args[i].v.s) {
+                value = strings;
+                memcpy(rec + strings, args[i].v.s, str_len[i]);
+                rec[strings + str_len[i]] = '\0';
+                strings += str_len[i] + 1;
+            }
+        } else if (args[i].type == UI_LOG_ARG_POINTER) {
+            value = (uint64_t)(uintptr_t)args[i].v.p;
+        } else {
+            memcpy(&value, &args[i].v, sizeof(value));
+        }
+        memcpy(rec + values + 8 * (size_t)i, &value, sizeof(value));
+    }
+
+    pending++;
+    written++;
+    size_t used = ring_used();
+    if (used > high_water) high_water = used;
+    RING_UNLOCK();
+}
+
+// =============================================================================
+// Formatting
+// =============================================================================
+
+static bool is_one_of(char c, const char *set) {
+    return c && strchr(set, c) != NULL;
+}
+
+static int64_t arg_as_int(const ui_log_arg_t *a) {
+    if (a->type == UI_LOG_ARG_DOUBLE) return (int64_t)a->v.d;
+    if (a->type == UI_LOG_ARG_INT || a->type == UI_LOG_ARG_UINT) return a->v.i;
+    return 0;
+}
+
+static double arg_as_double(const ui_log_arg_t *a) {
+    if (a->type == UI_LOG_ARG_DOUBLE) return a->v.d;
+    if (a->type == UI_LOG_ARG_INT) return (double)a->v.i;
+    if (a->type == UI_LOG_ARG_UINT) return (double)a->v.u;
+    return 0.0;
+}
+
+size_t ui_log_format(char *buf, size_t len, const char *fmt, const ui_log_arg_t *args, int nargs) {
+    if (!len) return 0;
+    size_t n = 0;
+    int next = 0;
+
+    while (*fmt && n + 1 < len) {
+        if (*fmt != '%') {
+            buf[n++] = *fmt++;
+            continue;
+        }
+        fmt++;
+        if (*fmt == '%') {
+            buf[n++] = '%';
+            fmt++;
+            continue;
+        }
+
+        // Rebuild the conversion with the stored type's length modifier
+        char spec[40];
+        size_t s = 0;
+        spec[s++] = '%';
+        while (is_one_of(*fmt, "-+ #0")) {
+            if (s < 8) spec[s++] = *fmt;
+            fmt++;
+        }
+        for (int part = 0; part < 2; part++) {
+            if (part == 1) {
+                if (*fmt != '.') break;
+                spec[s++] = *fmt++;
+            }
+            if (*fmt == '*') {
+                int v = next < nargs ? (int)arg_as_int(&args[next++]) : 0;
+                s += (size_t)snprintf(spec + s, 12, "%d", v);
+                fmt++;
+            } else {
+                while (*fmt >= '0' && *fmt <= '9') {
+                    if (s < 30) spec[s++] = *fmt;
+                    fmt++;
+                }
+            }
+        }
+        while (is_one_of(*fmt, "hlLqjzt")) fmt++;
+
+        char conv = *fmt;
+        if (!conv) break;
+        fmt++;
+
+        const ui_log_arg_t *a = next < nargs ? &args[next++] : NULL;
+        size_t room = len - n;
+        int w;
+        if (!a) {
+            w = snprintf(buf + n, room, "?");
+        } else if (conv == 'c') {
+            spec[s++] = 'c';
+            spec[s] = '\0';
+            w = snprintf(buf + n, room, spec, (int)arg_as_int(a));
+        } else if (is_one_of(conv, "di")) {
+            spec[s++] = 'l';
+            spec[s++] = 'l';
+            spec[s++] = 'd';
+            spec[s] = '\0';
+            w = snprintf(buf + n, room, spec, (long long)arg_as_int(a));
+        } else if (is_one_of(conv, "uxXo")) {
+            spec[s++] = 'l';
+            spec[s++] = 'l';
+            spec[s++] = conv;
+            spec[s] = '\0';
+            w = snprintf(buf + n, room, spec, (unsigned long long)arg_as_int(a));
+        } else if (is_one_of(conv, "fFeEgGaA")) {
+            spec[s++] = conv;
+            spec[s] = '\0';
+            w = snprintf(buf + n, room, spec, arg_as_double(a));
+        } else if (conv == 's') {
+            spec[s++] = 's';
+            spec[s] = '\0';
+            const char *str = a->type == UI_LOG_ARG_STRING ? (a->v.s ? a->v.s : "(null)") : "?";
+            w = snprintf(buf + n, room, spec, str);
+        } else if (conv == 'p') {
+            w = snprintf(buf + n, room, "%p", a->type == UI_LOG_ARG_POINTER ? a->v.p : NULL);
+        } else {
+            w = snprintf(buf + n, room, "%%%c", conv);
+        }
+        if (w > 0) n += (size_t)w < room ? (size_t)w : room - 1;
+    }
+
+    buf[n] = '\0';
+    return n;
+}
+
+// =============================================================================
+// Draining
+// =============================================================================
+
+static void console_sink(int level, const char *tag, uint32_t time_ms, const char *line) {
+#ifdef ESP_PLATFORM
+    static const char letters[] = "NEWIDV";
+    esp_log_write((esp_log_level_t)level, tag, "%c (%lu) %s: %s\n", letters[level], (unsigned long)time_ms, tag,
+                  line);
+#else
+    // Same prefixes as esp_stubs/esp_log.h
+    static const char *const prefixes[] = {"", "[ERROR]", "[WARN]", "", "[DEBUG]", "[VERBOSE]"};
+    (void)time_ms;
+    printf("%s[%s] %s\n", prefixes[level], tag, line);
+#endif
+}
+
+int ui_log_drain(ui_log_sink_t sink, int max) {
+    uint64_t copy_words[MAX_RECORD_SIZE / 8 + 1];
+    uint8_t *copy = (uint8_t *)copy_words;
+    ui_log_arg_t args[UI_LOG_MAX_ARGS];
+    char line[LINE_MAX_LEN];
+    int drained = 0;
+
+    if (!sink) sink = console_sink;
+
+    while (max <= 0 || drained < max) {
+        RING_LOCK();
+        if (pending && ((const record_t *)(ring + tail))->size == 0) tail = 0;
+        if (!pending) {
+            uint32_t lost = dropped - dropped_reported;
+            dropped_reported = dropped;
+            RING_UNLOCK();
+            if (lost) {
+                char msg[48];
+                snprintf(msg, sizeof(msg), "%lu log records dropped (ring full)", (unsigned long)lost);
+                sink(UI_LOG_LEVEL_WARN, TAG, now_ms(), msg);
+            }
+            break;
+        }
+        const record_t *r = (const record_t *)(ring + tail);
+        memcpy(copy, r, r->size);
+        tail += r->size;
+        if (tail >= UI_LOG_RING_SIZE) tail = 0;
+        pending--;
+        RING_UNLOCK();
+
+        r = (const record_t *)copy;
+        size_t values = HEADER_SIZE + ALIGN8((size_t)r->nargs);
+        for (int i = 0; i < r->nargs; i++) {
+            uint64_t value;
+            memcpy(&value, copy + values + 8 * (size_t)i, sizeof(value));
+            args[i].type = copy[HEADER_SIZE + i];
+            if (args[i].type == UI_LOG_ARG_STRING) {
+                args[i].v.s = value == NULL_STRING ? NULL : (const char *)copy + value;
+            } else if (args[i].type == UI_LOG_ARG_POINTER) {
+                args[i].v.p = (const void *)(uintptr_t)value;
+            } else {
+                memcpy(&args[i].v, &value, sizeof(value));
+            }
+        }
+
+        ui_log_format(line, sizeof(line), r->fmt, args, r->nargs);
+        sink(r->level, r->tag, r->time_ms, line);
+        drained++;
+    }
+    return drained;
+}
+
+void ui_log_dump(void) {
+    ui_log_drain(NULL, 0);
+#ifndef ESP_PLATFORM
+    fflush(stdout);
+#endif
+}
+
+void ui_log_get_stats(ui_log_stats_t *out) {
+    if (!out) return;
+    RING_LOCK();
+    out->written = written;
+    out->dropped = dropped;
+    out->pending = pending;
+    out->high_water = high_water;
+    RING_UNLOCK();
+}
+
+#ifdef ESP_PLATFORM
+static void drain_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        ui_log_drain(NULL, 0);
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+}
+#endif
+
+void ui_log_init(void) {
+#ifdef ESP_PLATFORM
+    static bool started = false;
+    if (started) return;
+    started = true;
+    // Lowest priority: formatting and console output only run when the UI is idle
+    xTaskCreate(drain_task, "ui_log", 4096, NULL, 1, NULL);
+#endif
+}
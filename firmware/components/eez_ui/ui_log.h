@@ -0,0 +1,230 @@
+/**
+ * @file ui_log.h
+ * @brief Leveled logging with deferred formatting
+ *
+ * A log call copies its format pointer and argument values into a binary
+ * ring and returns; nothing is formatted on the calling path. Records are
+ * formatted when the ring is drained (ui_log_drain(), called off the UI
+ * tick) or dumped after a problem (ui_log_dump()). Calls below the module's
+ * level are compiled out, arguments included.
+ *
+ *     #define UI_LOG_LEVEL UI_LOG_LEVEL_DEBUG   // optional, before the include
+ *     #include "ui_log.h"
+ *
+ *     static const char *TAG = "ui_nfc_card";
+ *     UI_LOGI("Tag %s present, weight %dg", uid, weight);
+ *
+ * The tag is the module's TAG unless UI_LOG_TAG is defined. The format must
+ * be a string literal (only its address is stored). Strings are copied, up
+ * to UI_LOG_MAX_STRING bytes each; at most UI_LOG_MAX_ARGS arguments.
+ *
+ * When the ring is full the oldest records are dropped and counted.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#ifndef UI_LOG_H
+#define UI_LOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_LOG_LEVEL_NONE    0
+#define UI_LOG_LEVEL_ERROR   1
+#define UI_LOG_LEVEL_WARN    2
+#define UI_LOG_LEVEL_INFO    3
+#define UI_LOG_LEVEL_DEBUG   4
+#define UI_LOG_LEVEL_VERBOSE 5
+
+// Level of modules that don't set UI_LOG_LEVEL
+#ifndef UI_LOG_DEFAULT_LEVEL
+#define UI_LOG_DEFAULT_LEVEL UI_LOG_LEVEL_INFO
+#endif
+
+// Ring size in bytes (a record is ~24 bytes plus 9 per argument and its strings)
+#ifndef UI_LOG_RING_SIZE
+#define UI_LOG_RING_SIZE (16 * 1024)
+#endif
+
+#define UI_LOG_MAX_ARGS 10
+#define UI_LOG_MAX_STRING 64
+
+typedef enum {
+    UI_LOG_ARG_INT = 0,
+    UI_LOG_ARG_UINT,
+    UI_LOG_ARG_DOUBLE,
+    UI_LOG_ARG_STRING,
+    UI_LOG_ARG_POINTER,
+} ui_log_arg_type_t;
+
+typedef struct {
+    uint8_t type;  // ui_log_arg_type_t
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        const char *s;
+        const void *p;
+    } v;
+} ui_log_arg_t;
+
+/**
+ * Receives each formatted line (no trailing newline).
+ */
+typedef void (*ui_log_sink_t)(int level, const char *tag, uint32_t time_ms, const char *line);
+
+typedef struct {
+    uint32_t written;   // Records written
+    uint32_t dropped;   // Records overwritten before they were drained
+    uint32_t pending;   // Records in the ring
+    size_t high_water;  // Most bytes in the ring at once
+} ui_log_stats_t;
+
+/**
+ * Record one message. Use the UI_LOGx macros instead.
+ */
+void ui_log_write(int level, const char *tag, const char *fmt, const ui_log_arg_t *args, int nargs);
+
+/**
+ * Format and pass pending records to the sink (NULL = console), oldest
+ * first, at most max records (0 = all). Returns the number drained.
+ */
+int ui_log_drain(ui_log_sink_t sink, int max);
+
+/**
+ * Drain everything to the console, e.g. before a restart.
+ */
+void ui_log_dump(void);
+
+/**
+ * On the device, start a low-priority task that drains to the console.
+ * The simulator drains from its main loop instead.
+ */
+void ui_log_init(void);
+
+void ui_log_get_stats(ui_log_stats_t *out);
+
+/**
+ * Format a record's message into buf. Returns the length written.
+ */
+size_t ui_log_format(char *buf, size_t len, const char *fmt, const ui_log_arg_t *args, int nargs);
+
+// =============================================================================
+// Argument capture
+// =============================================================================
+
+static inline ui_log_arg_t ui_log_arg_int(long long v) { ui_log_arg_t a; a.type = UI_LOG_ARG_INT; a.v.i = v; return a; }
+static inline ui_log_arg_t ui_log_arg_uint(unsigned long long v) { ui_log_arg_t a; a.type = UI_LOG_ARG_UINT; a.v.u = v; return a; }
+static inline ui_log_arg_t ui_log_arg_double(double v) { ui_log_arg_t a; a.type = UI_LOG_ARG_DOUBLE; a.v.d = v; return a; }
+static inline ui_log_arg_t ui_log_arg_string(const char *v) { ui_log_arg_t a; a.type = UI_LOG_ARG_STRING; a.v.s = v; return a; }
+static inline ui_log_arg_t ui_log_arg_pointer(const volatile void *v) { ui_log_arg_t a; a.type = UI_LOG_ARG_POINTER; a.v.p = (const void *)v; return a; }
+
+// "+ 0" promotes small integers and decays arrays to pointers
+#define UI_LOG_ARG(x) _Generic((x) + 0,                 \
+    char *: ui_log_arg_string,                          \
+    const char *: ui_log_arg_string,                    \
+    float: ui_log_arg_double,                           \
+    double: ui_log_arg_double,                          \
+    int: ui_log_arg_int,                                \
+    long: ui_log_arg_int,                               \
+    long long: ui_log_arg_int,                          \
+    unsigned int: ui_log_arg_uint,                      \
+    unsigned long: ui_log_arg_uint,                     \
+    unsigned long long: ui_log_arg_uint,                \
+    default: ui_log_arg_pointer)(x)
+
+#define UI_LOG_NARGS(...) UI_LOG_NARGS_(0, ##__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define UI_LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, n, ...) n
+#define UI_LOG_CAT(a, b) UI_LOG_CAT_(a, b)
+#define UI_LOG_CAT_(a, b) a##b
+
+// Each argument becomes ", UI_LOG_ARG(x)"
+#define UI_LOG_MAP(...) UI_LOG_CAT(UI_LOG_MAP_, UI_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define UI_LOG_MAP_0()
+#define UI_LOG_MAP_1(a) , UI_LOG_ARG(a)
+#define UI_LOG_MAP_2(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_1(__VA_ARGS__)
+#define UI_LOG_MAP_3(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_2(__VA_ARGS__)
+#define UI_LOG_MAP_4(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_3(__VA_ARGS__)
+#define UI_LOG_MAP_5(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_4(__VA_ARGS__)
+#define UI_LOG_MAP_6(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_5(__VA_ARGS__)
+#define UI_LOG_MAP_7(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_6(__VA_ARGS__)
+#define UI_LOG_MAP_8(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_7(__VA_ARGS__)
+#define UI_LOG_MAP_9(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_8(__VA_ARGS__)
+#define UI_LOG_MAP_10(a, ...) , UI_LOG_ARG(a) UI_LOG_MAP_9(__VA_ARGS__)
+
+// Type-checks the format against its arguments; never called
+static inline void ui_log_check_format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static inline void ui_log_check_format(const char *fmt, ...) { (void)fmt; }
+
+#define UI_LOG_WRITE(level, fmt, ...)                                                         \
+    do {                                                                                      \
+        if (0) ui_log_check_format(fmt, ##__VA_ARGS__);                                       \
+        const ui_log_arg_t ui_log_args_[] = { ui_log_arg_int(0) UI_LOG_MAP(__VA_ARGS__) };    \
+        ui_log_write((level), UI_LOG_TAG, (fmt), ui_log_args_ + 1,                            \
+                     (int)(sizeof(ui_log_args_) / sizeof(ui_log_args_[0])) - 1);              \
+    } while (0)
+
+// Compiled out: arguments are not evaluated but still type-checked
+#define UI_LOG_SKIP(fmt, ...)                                                                 \
+    do {                                                                                      \
+        if (0) ui_log_check_format(fmt, ##__VA_ARGS__);                                       \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_LOG_H */
+
+// =============================================================================
+// Per-module macros, outside the include guard so every file gets its level
+// =============================================================================
+
+#ifndef UI_LOG_LEVEL
+#define UI_LOG_LEVEL UI_LOG_DEFAULT_LEVEL
+#endif
+
+#ifndef UI_LOG_TAG
+#define UI_LOG_TAG TAG
+#endif
+
+#undef UI_LOGE
+#undef UI_LOGW
+#undef UI_LOGI
+#undef UI_LOGD
+#undef UI_LOGV
+
+#if UI_LOG_LEVEL >= UI_LOG_LEVEL_ERROR
+#define UI_LOGE(fmt, ...) UI_LOG_WRITE(UI_LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define UI_LOGE(fmt, ...) UI_LOG_SKIP(fmt, ##__VA_ARGS__)
+#endif
+
+#if UI_LOG_LEVEL >= UI_LOG_LEVEL_WARN
+#define UI_LOGW(fmt, ...) UI_LOG_WRITE(UI_LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define UI_LOGW(fmt, ...) UI_LOG_SKIP(fmt, ##__VA_ARGS__)
+#endif
+
+#if UI_LOG_LEVEL >= UI_LOG_LEVEL_INFO
+#define UI_LOGI(fmt, ...) UI_LOG_WRITE(UI_LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define UI_LOGI(fmt, ...) UI_LOG_SKIP(fmt, ##__VA_ARGS__)
+#endif
+
+#if UI_LOG_LEVEL >= UI_LOG_LEVEL_DEBUG
+#define UI_LOGD(fmt, ...) UI_LOG_WRITE(UI_LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define UI_LOGD(fmt, ...) UI_LOG_SKIP(fmt, ##__VA_ARGS__)
+#endif
+
+#if UI_LOG_LEVEL >= UI_LOG_LEVEL_VERBOSE
+#define UI_LOGV(fmt, ...) UI_LOG_WRITE(UI_LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)
+#else
+#define UI_LOGV(fmt, ...) UI_LOG_SKIP(fmt, ##__VA_ARGS__)
+#endif
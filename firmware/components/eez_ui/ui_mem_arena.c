@@ -0,0 +1,277 @@
+/**
+ * @file ui_mem_arena.c
+ * @brief Per-screen and per-modal arenas for LVGL allocations
+ *
+ * See ui_mem_arena.h.
+ */
+
+#include "ui_mem_arena.h"
+
+#ifdef UI_MEM_ARENAS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+static const char *TAG = "ui_mem_arena";
+#define ARENA_LOGW(fmt, ...) ESP_LOGW(TAG, fmt, ##__VA_ARGS__)
+// Widgets are fine in PSRAM; keep internal RAM for DMA and draw buffers
+#define ARENA_ALLOC(size) heap_caps_aligned_alloc(ARENA_ALIGN, (size), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#else
+#define ARENA_LOGW(fmt, ...) printf("[ui_mem_arena] " fmt "\n", ##__VA_ARGS__)
+#define ARENA_ALLOC(size) malloc(size)
+#endif
+
+// Same alignment as malloc on the target
+#define ARENA_ALIGN (2 * sizeof(void *))
+#define ALIGN_UP(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+#define ARENA_COUNT (UI_MEM_SCREEN_ARENAS + UI_MEM_MODAL_ARENAS)
+#define NO_BLOCK UINT32_MAX
+#define BLOCK_FREED 1U
+
+// Precedes every arena allocation. Blocks form a stack: freed blocks on top
+// of it are popped, so a rebuild that frees its newest widgets reuses them.
+typedef struct {
+    uint32_t size;  // Payload bytes (multiple of ARENA_ALIGN), BLOCK_FREED once freed
+    uint32_t prev;  // Offset of the previous block's header, NO_BLOCK for the first
+} block_header_t;
+
+#define HEADER_SIZE ALIGN_UP(sizeof(block_header_t))
+
+struct ui_mem_arena {
+    ui_mem_arena_kind_t kind;
+    uint8_t *base;
+    size_t capacity;
+    size_t top;         // Bump offset
+    uint32_t last;      // Offset of the newest block's header
+    size_t high_water;
+    uint32_t live;
+    uint32_t resets;
+    uint32_t fallbacks;
+    bool owned;         // Taken by a scope or bound to an owner
+    lv_obj_t *owner;
+};
+
+static ui_mem_arena_t arenas[ARENA_COUNT];
+static ui_mem_arena_t *current = NULL;
+static bool initialized = false;
+static bool enabled = true;
+
+// LVGL's allocator, reached through -Wl,--wrap
+void *__real_lv_malloc_core(size_t size);
+void *__real_lv_realloc_core(void *p, size_t new_size);
+void __real_lv_free_core(void *p);
+
+static void arenas_init(void) {
+    if (initialized) return;
+    initialized = true;
+
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        ui_mem_arena_t *a = &arenas[i];
+        a->kind = i < UI_MEM_SCREEN_ARENAS ? UI_MEM_ARENA_SCREEN : UI_MEM_ARENA_MODAL;
+        size_t capacity = a->kind == UI_MEM_ARENA_SCREEN ? UI_MEM_SCREEN_ARENA_SIZE : UI_MEM_MODAL_ARENA_SIZE;
+        a->base = ARENA_ALLOC(capacity);
+        a->capacity = a->base ? capacity : 0;
+        a->last = NO_BLOCK;
+        if (!a->base) {
+            ARENA_LOGW("No memory for %u byte arena, using the general heap", (unsigned)capacity);
+        }
+    }
+}
+
+static ui_mem_arena_t *arena_of(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        if (b >= arenas[i].base && b < arenas[i].base + arenas[i].capacity) {
+            return &arenas[i];
+        }
+    }
+    return NULL;
+}
+
+static inline block_header_t *header_of(void *p) {
+    return (block_header_t *)((uint8_t *)p - HEADER_SIZE);
+}
+
+static inline block_header_t *header_at(ui_mem_arena_t *a, uint32_t offset) {
+    return (block_header_t *)(a->base + offset);
+}
+
+static void *arena_alloc(ui_mem_arena_t *a, size_t size) {
+    size_t payload = ALIGN_UP(size);
+    if (payload > a->capacity || a->top + HEADER_SIZE + payload > a->capacity) {
+        a->fallbacks++;
+        return NULL;
+    }
+
+    block_header_t *h = header_at(a, (uint32_t)a->top);
+    h->size = (uint32_t)payload;
+    h->prev = a->last;
+    a->last = (uint32_t)a->top;
+    a->top += HEADER_SIZE + payload;
+    if (a->top > a->high_water) a->high_water = a->top;
+    a->live++;
+    return (uint8_t *)h + HEADER_SIZE;
+}
+
+static void arena_free(ui_mem_arena_t *a, void *p) {
+    header_of(p)->size |= BLOCK_FREED;
+    a->live--;
+
+    if (a->live == 0) {
+        // Everything allocated here is gone: rewind the whole arena
+        a->top = 0;
+        a->last = NO_BLOCK;
+        a->resets++;
+        return;
+    }
+
+    // Pop freed blocks off the top
+    while (a->last != NO_BLOCK) {
+        block_header_t *h = header_at(a, a->last);
+        if (!(h->size & BLOCK_FREED)) break;
+        a->top = a->last;
+        a->last = h->prev;
+    }
+}
+
+static void *arena_realloc(ui_mem_arena_t *a, void *p, size_t new_size) {
+    block_header_t *h = header_of(p);
+    size_t size = h->size;
+    if (new_size <= size) return p;
+
+    // Newest block: grow in place
+    uint32_t offset = (uint32_t)((uint8_t *)h - a->base);
+    size_t payload = ALIGN_UP(new_size);
+    if (offset == a->last && offset + HEADER_SIZE + payload <= a->capacity) {
+        h->size = (uint32_t)payload;
+        a->top = offset + HEADER_SIZE + payload;
+        if (a->top > a->high_water) a->high_water = a->top;
+        return p;
+    }
+
+    // Stay in the same arena: the block belongs to its owner, not to
+    // whichever scope happens to be current (e.g. a screen's child list
+    // growing while a modal is built on it)
+    void *moved = arena_alloc(a, new_size);
+    if (!moved) moved = __real_lv_malloc_core(new_size);
+    if (!moved) return NULL;
+    memcpy(moved, p, size);
+    arena_free(a, p);
+    return moved;
+}
+
+// =============================================================================
+// LVGL allocator hooks
+// =============================================================================
+
+void *__wrap_lv_malloc_core(size_t size) {
+    if (current && enabled) {
+        void *p = arena_alloc(current, size);
+        if (p) return p;
+    }
+    return __real_lv_malloc_core(size);
+}
+
+void *__wrap_lv_realloc_core(void *p, size_t new_size) {
+    if (!p) return __wrap_lv_malloc_core(new_size);
+    ui_mem_arena_t *a = arena_of(p);
+    if (a) return arena_realloc(a, p, new_size);
+    return __real_lv_realloc_core(p, new_size);
+}
+
+void __wrap_lv_free_core(void *p) {
+    ui_mem_arena_t *a = p ? arena_of(p) : NULL;
+    if (a) {
+        arena_free(a, p);
+        return;
+    }
+    __real_lv_free_core(p);
+}
+
+// =============================================================================
+// Scopes
+// =============================================================================
+
+static void owner_deleted_cb(lv_event_t *e) {
+    ui_mem_arena_t *a = (ui_mem_arena_t *)lv_event_get_user_data(e);
+    // The owner's widgets are freed right after this; the arena rewinds
+    // when the last of its blocks goes
+    a->owner = NULL;
+    a->owned = false;
+    if (current == a) current = NULL;
+}
+
+ui_mem_arena_t *ui_mem_arena_begin(ui_mem_arena_kind_t kind) {
+    ui_mem_arena_t *previous = current;
+    current = NULL;
+    if (!enabled) return previous;
+
+    arenas_init();
+    for (int i = 0; i < ARENA_COUNT; i++) {
+        ui_mem_arena_t *a = &arenas[i];
+        // Blocks left by a previous owner keep an arena out of the pool
+        if (a->kind == kind && a->base && !a->owned && a->live == 0) {
+            a->owned = true;
+            current = a;
+            break;
+        }
+    }
+    return previous;
+}
+
+void ui_mem_arena_bind(lv_obj_t *owner) {
+    if (!current || current->owner || !owner) return;
+    current->owner = owner;
+    lv_obj_add_event_cb(owner, owner_deleted_cb, LV_EVENT_DELETE, current);
+}
+
+ui_mem_arena_t *ui_mem_arena_resume(lv_obj_t *owner) {
+    ui_mem_arena_t *previous = current;
+    current = NULL;
+    for (int i = 0; owner && i < ARENA_COUNT; i++) {
+        if (arenas[i].owner == owner) {
+            current = &arenas[i];
+            break;
+        }
+    }
+    return previous;
+}
+
+ui_mem_arena_t *ui_mem_arena_suspend(void) {
+    ui_mem_arena_t *previous = current;
+    current = NULL;
+    return previous;
+}
+
+void ui_mem_arena_end(ui_mem_arena_t *previous) {
+    if (current && !current->owner) {
+        current->owned = false;
+    }
+    current = previous;
+}
+
+void ui_mem_arena_set_enabled(bool on) {
+    enabled = on;
+}
+
+int ui_mem_arena_get_stats(int index, ui_mem_arena_stats_t *out) {
+    if (index >= 0 && index < ARENA_COUNT && out) {
+        const ui_mem_arena_t *a = &arenas[index];
+        out->kind = a->kind;
+        out->capacity = a->capacity;
+        out->used = a->top;
+        out->high_water = a->high_water;
+        out->live = a->live;
+        out->resets = a->resets;
+        out->fallbacks = a->fallbacks;
+        out->owned = a->owned;
+    }
+    return ARENA_COUNT;
+}
+
+#endif // UI_MEM_ARENAS
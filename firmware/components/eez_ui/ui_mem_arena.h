@@ -0,0 +1,132 @@
+/**
+ * @file ui_mem_arena.h
+ * @brief Per-screen and per-modal arenas for LVGL allocations
+ *
+ * While an arena is current, every lv_malloc() is bump-allocated from it
+ * instead of the general LVGL heap. A screen or modal is built inside an
+ * arena, so its widgets sit together rather than scattered between
+ * longer-lived allocations. Once all of them are freed (the screen is
+ * deleted) the arena is reset in one step and reused for the next screen.
+ *
+ *     ui_mem_arena_t *prev = ui_mem_arena_begin(UI_MEM_ARENA_SCREEN);
+ *     create_screen_...();
+ *     ui_mem_arena_bind(screen);   // Arena goes back to the pool with the screen
+ *     ui_mem_arena_end(prev);
+ *
+ * Anything that doesn't fit, and every allocation made outside a scope,
+ * goes to the general heap. Freed arena memory is only reclaimed when it is
+ * the newest allocation or when the whole arena is empty, so long-lived
+ * caches must not be allocated inside a scope (see ui_mem_arena_suspend).
+ *
+ * Enabled with UI_MEM_ARENAS. The build links with
+ * -Wl,--wrap=lv_malloc_core,--wrap=lv_realloc_core,--wrap=lv_free_core so
+ * LVGL's allocator calls come here first. Without it every function is a
+ * no-op and LVGL allocates as before.
+ *
+ * Arenas are used from the LVGL task only.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#ifndef UI_MEM_ARENA_H
+#define UI_MEM_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Arena pool. Two screen arenas because a programmatic screen is built
+// before the previous screen is deleted.
+#ifndef UI_MEM_SCREEN_ARENAS
+#define UI_MEM_SCREEN_ARENAS 2
+#endif
+#ifndef UI_MEM_SCREEN_ARENA_SIZE
+#define UI_MEM_SCREEN_ARENA_SIZE (160U * 1024U)
+#endif
+#ifndef UI_MEM_MODAL_ARENAS
+#define UI_MEM_MODAL_ARENAS 1
+#endif
+#ifndef UI_MEM_MODAL_ARENA_SIZE
+#define UI_MEM_MODAL_ARENA_SIZE (96U * 1024U)
+#endif
+
+typedef enum {
+    UI_MEM_ARENA_SCREEN = 0,
+    UI_MEM_ARENA_MODAL,
+} ui_mem_arena_kind_t;
+
+typedef struct ui_mem_arena ui_mem_arena_t;
+
+typedef struct {
+    ui_mem_arena_kind_t kind;
+    size_t capacity;
+    size_t used;           // Bump offset, including freed blocks not yet reclaimed
+    size_t high_water;
+    uint32_t live;         // Allocations not freed yet
+    uint32_t resets;       // Times the arena emptied and was rewound
+    uint32_t fallbacks;    // Allocations that didn't fit and went to the general heap
+    bool owned;            // Bound to a screen/modal that still exists
+} ui_mem_arena_stats_t;
+
+#ifdef UI_MEM_ARENAS
+
+/**
+ * Take a free arena of this kind and make it current. Returns the previous
+ * current arena for ui_mem_arena_end(). With no free arena, allocations go
+ * to the general heap until the matching end.
+ */
+ui_mem_arena_t *ui_mem_arena_begin(ui_mem_arena_kind_t kind);
+
+/**
+ * Keep the current arena for owner: it returns to the pool when owner is
+ * deleted. An arena that is never bound returns at ui_mem_arena_end().
+ */
+void ui_mem_arena_bind(lv_obj_t *owner);
+
+/**
+ * Make owner's arena current again, e.g. to add content later. Returns the
+ * previous current arena for ui_mem_arena_end().
+ */
+ui_mem_arena_t *ui_mem_arena_resume(lv_obj_t *owner);
+
+/**
+ * Allocate from the general heap until ui_mem_arena_end(), for caches that
+ * outlive the current screen.
+ */
+ui_mem_arena_t *ui_mem_arena_suspend(void);
+
+void ui_mem_arena_end(ui_mem_arena_t *previous);
+
+/**
+ * Turn arena allocation on or off (benchmarks). Existing arena blocks are
+ * still freed correctly while off.
+ */
+void ui_mem_arena_set_enabled(bool enabled);
+
+/**
+ * Stats of arena index (0 .. count-1). Returns the number of arenas.
+ */
+int ui_mem_arena_get_stats(int index, ui_mem_arena_stats_t *out);
+
+#else
+
+static inline ui_mem_arena_t *ui_mem_arena_begin(ui_mem_arena_kind_t kind) { (void)kind; return NULL; }
+static inline void ui_mem_arena_bind(lv_obj_t *owner) { (void)owner; }
+static inline ui_mem_arena_t *ui_mem_arena_resume(lv_obj_t *owner) { (void)owner; return NULL; }
+static inline ui_mem_arena_t *ui_mem_arena_suspend(void) { return NULL; }
+static inline void ui_mem_arena_end(ui_mem_arena_t *previous) { (void)previous; }
+static inline void ui_mem_arena_set_enabled(bool enabled) { (void)enabled; }
+static inline int ui_mem_arena_get_stats(int index, ui_mem_arena_stats_t *out) { (void)index; (void)out; return 0; }
+
+#endif // UI_MEM_ARENAS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_MEM_ARENA_H */
@@ -4,11 +4,13 @@
  */
 
 #include "ui_nfc_card.h"
+#include "ui_nfc_inventory.h"
+#include "ui_spool_gauge.h"
 #include "screens.h"
 #include "lvgl.h"
 #include <stdio.h>
 #include <string.h>
-#include "esp_log.h"
+#include "ui_log.h"
 
 #ifdef ESP_PLATFORM
 #include "ui_internal.h"
@@ -47,9 +49,6 @@ extern bool scale_is_stable(void);
 // Get selected printer index for K-profile lookup
 extern int get_selected_printer_index(void);
 
-// Spool images for popup display
-extern const lv_image_dsc_t img_spool_clean;
-extern const lv_image_dsc_t img_spool_fill;
 
 // Screen navigation
 extern enum ScreensEnum pendingScreen;
@@ -79,6 +78,15 @@ static int untagged_spools_count = 0;
 static lv_obj_t *details_modal = NULL;
 static char details_modal_spool_id[64] = {0};  // For sync button
 
+// Remaining filament from inventory weight, for the spool image
+static int spool_fill_pct(const SpoolInfoLocal *info) {
+    if (info->label_weight <= 0 || info->weight_current <= 0) return UI_SPOOL_GAUGE_LEVEL_UNKNOWN;
+    int filament_weight = info->weight_current - 200;  // ~200g core
+    if (filament_weight < 0) filament_weight = 0;
+    int pct = (filament_weight * 100) / info->label_weight;
+    return pct > 100 ? 100 : pct;
+}
+
 // Close handler for details modal
 static void details_modal_close_handler(lv_event_t *e) {
     (void)e;
@@ -88,6 +96,13 @@ static void details_modal_close_handler(lv_event_t *e) {
     }
 }
 
+// Bulk add button handler - several spools on the reader at once
+static void bulk_add_click_handler(lv_event_t *e) {
+    (void)e;
+    details_modal_close_handler(NULL);
+    ui_nfc_inventory_open();
+}
+
 // Sync weight button handler
 static void sync_weight_click_handler(lv_event_t *e) {
     (void)e;
@@ -98,15 +113,15 @@ static void sync_weight_click_handler(lv_event_t *e) {
     if (weight_int >= -20 && weight_int <= 20) weight_int = 0;
     if (weight_int < 0) weight_int = 0;
 
-    ESP_LOGI(TAG, "Syncing weight %dg for spool %s", weight_int, details_modal_spool_id);
+    UI_LOGI("Syncing weight %dg for spool %s", weight_int, details_modal_spool_id);
 
     if (spool_sync_weight(details_modal_spool_id, weight_int)) {
-        ESP_LOGI(TAG, "Weight synced successfully");
+        UI_LOGI("Weight synced successfully");
         // Close and reopen to refresh
         details_modal_close_handler(NULL);
         ui_nfc_card_show_details();
     } else {
-        ESP_LOGE(TAG, "Failed to sync weight");
+        UI_LOGE("Failed to sync weight");
     }
 }
 
@@ -135,7 +150,7 @@ void ui_nfc_card_show_details(void) {
         if (scale_weight < 0) scale_weight = 0;
     }
 
-    ESP_LOGI(TAG, "Opening tag details modal (tag_present=%d, in_inventory=%d)", tag_present, tag_in_inventory);
+    UI_LOGI("Opening tag details modal (tag_present=%d, in_inventory=%d)", tag_present, tag_in_inventory);
 
     // Create modal background
     details_modal = lv_obj_create(lv_layer_top());
@@ -257,10 +272,24 @@ void ui_nfc_card_show_details(void) {
         lv_obj_set_style_text_color(nfc_hint, lv_color_hex(0x555555), LV_PART_MAIN);
         lv_obj_align(nfc_hint, LV_ALIGN_TOP_MID, 0, 270);
 
+        // Bulk add button
+        lv_obj_t *btn_bulk = lv_btn_create(card);
+        lv_obj_set_size(btn_bulk, 100, 36);
+        lv_obj_align(btn_bulk, LV_ALIGN_BOTTOM_MID, -60, -5);
+        lv_obj_set_style_bg_color(btn_bulk, lv_color_hex(0x1976D2), 0);
+        lv_obj_set_style_radius(btn_bulk, 18, 0);
+        lv_obj_add_event_cb(btn_bulk, bulk_add_click_handler, LV_EVENT_CLICKED, NULL);
+
+        lv_obj_t *bulk_label = lv_label_create(btn_bulk);
+        lv_label_set_text(bulk_label, "Bulk Add");
+        lv_obj_set_style_text_font(bulk_label, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_text_color(bulk_label, lv_color_hex(0xFFFFFF), 0);
+        lv_obj_center(bulk_label);
+
         // Close button
         lv_obj_t *btn_close = lv_btn_create(card);
         lv_obj_set_size(btn_close, 100, 36);
-        lv_obj_align(btn_close, LV_ALIGN_BOTTOM_MID, 0, -5);
+        lv_obj_align(btn_close, LV_ALIGN_BOTTOM_MID, 60, -5);
         lv_obj_set_style_bg_color(btn_close, lv_color_hex(0x555555), 0);
         lv_obj_set_style_radius(btn_close, 18, 0);
         lv_obj_add_event_cb(btn_close, details_modal_close_handler, LV_EVENT_CLICKED, NULL);
@@ -318,19 +347,9 @@ void ui_nfc_card_show_details(void) {
         lv_obj_set_style_pad_all(spool_container, 0, 0);
         lv_obj_clear_flag(spool_container, LV_OBJ_FLAG_SCROLLABLE);
 
-        lv_obj_t *spool_outline = lv_image_create(spool_container);
-        lv_image_set_src(spool_outline, &img_spool_clean);
-        lv_image_set_pivot(spool_outline, 0, 0);
-        lv_image_set_scale(spool_outline, 420);
-        lv_obj_set_pos(spool_outline, 0, 0);
-
-        lv_obj_t *spool_fill = lv_image_create(spool_container);
-        lv_image_set_src(spool_fill, &img_spool_fill);
-        lv_image_set_pivot(spool_fill, 0, 0);
-        lv_image_set_scale(spool_fill, 420);
-        lv_obj_set_pos(spool_fill, 0, 0);
-        lv_obj_set_style_image_recolor(spool_fill, lv_color_hex(color_hex), 0);
-        lv_obj_set_style_image_recolor_opa(spool_fill, 255, 0);
+        // Spool precomposed at its displayed size (32x42 source at scale 420)
+        lv_obj_t *spool_img = ui_spool_gauge_create(spool_container, color_hex, spool_fill_pct(&spool_info), 52, 68);
+        lv_obj_set_pos(spool_img, 0, 0);
 
         // Details container (right of spool)
         lv_obj_t *details_container = lv_obj_create(top_section);
@@ -613,7 +632,7 @@ void ui_nfc_card_show_details(void) {
 // Button click handlers
 static void popup_close_handler(lv_event_t *e) {
     (void)e;
-    ESP_LOGI(TAG, "popup_close_handler called, dismissing tag %s", popup_tag_uid);
+    UI_LOGI("popup_close_handler called, dismissing tag %s", popup_tag_uid);
     popup_user_closed = true;  // Remember user closed it
     // Remember which tag was dismissed (survives brief NFC reader glitches)
     strncpy(dismissed_tag_uid, (char*)popup_tag_uid, sizeof(dismissed_tag_uid) - 1);
@@ -645,7 +664,7 @@ static void show_link_spool_popup(void);
 
 static void add_spool_click_handler(lv_event_t *e) {
     (void)e;
-    ESP_LOGI(TAG, "Add Spool clicked");
+    UI_LOGI("Add Spool clicked");
 
     // Get current weight
     float weight = scale_get_weight();
@@ -670,17 +689,17 @@ static void add_spool_click_handler(lv_event_t *e) {
     );
 
     if (success) {
-        ESP_LOGI(TAG, "Spool added successfully");
+        UI_LOGI("Spool added successfully");
         show_success_overlay("Spool Added!\nConfigure details in web UI.");
     } else {
-        ESP_LOGE(TAG, "Failed to add spool");
+        UI_LOGE("Failed to add spool");
         show_success_overlay("Failed to add spool.\nPlease try again.");
     }
 }
 
 static void link_spool_click_handler(lv_event_t *e) {
     (void)e;
-    ESP_LOGI(TAG, "Link to Spool clicked");
+    UI_LOGI("Link to Spool clicked");
     show_link_spool_popup();
 }
 
@@ -776,13 +795,13 @@ static void spool_item_click_handler(lv_event_t *e) {
     int spool_index = (int)(intptr_t)lv_event_get_user_data(e);
 
     if (spool_index < 0 || spool_index >= untagged_spools_count) {
-        ESP_LOGE(TAG, "Invalid spool index: %d", spool_index);
+        UI_LOGE("Invalid spool index: %d", spool_index);
         return;
     }
 
     UntaggedSpoolInfo *spool = &untagged_spools[spool_index];
-    ESP_LOGI(TAG, "Linking tag %s to spool %s (%s %s)",
-             popup_tag_uid, spool->id, spool->brand, spool->material);
+    UI_LOGI("Linking tag %s to spool %s (%s %s)",
+            popup_tag_uid, spool->id, spool->brand, spool->material);
 
     // Link the tag to this spool
     // Returns: 0 = success, -1 = connection error, 409 = already assigned, other = server error
@@ -814,10 +833,10 @@ static void show_link_spool_popup(void) {
 
     // Fetch untagged spools
     untagged_spools_count = spool_get_untagged_list(untagged_spools, 20);
-    ESP_LOGI(TAG, "Found %d untagged spools", untagged_spools_count);
+    UI_LOGI("Found %d untagged spools", untagged_spools_count);
 
     if (untagged_spools_count == 0) {
-        ESP_LOGW(TAG, "No untagged spools available");
+        UI_LOGW("No untagged spools available");
         return;
     }
 
@@ -926,7 +945,7 @@ extern const char* nfc_get_tag_material_subtype(void);
 static void create_tag_popup(void) {
     if (tag_popup) return;  // Already open
 
-    ESP_LOGI(TAG, "Creating tag popup");
+    UI_LOGI("Creating tag popup");
 
     // Get tag UID and store it
     uint8_t uid_str[32];
@@ -938,7 +957,7 @@ static void create_tag_popup(void) {
     bool tag_in_inventory = spool_exists_by_tag((const char*)uid_str);
     int untagged_count = spool_get_untagged_count();
 
-    ESP_LOGI(TAG, "Tag %s: in_inventory=%d, untagged_count=%d", uid_str, tag_in_inventory, untagged_count);
+    UI_LOGI("Tag %s: in_inventory=%d, untagged_count=%d", uid_str, tag_in_inventory, untagged_count);
 
     // Get weight
     float weight = scale_get_weight();
@@ -1012,29 +1031,17 @@ static void create_tag_popup(void) {
         lv_obj_set_style_pad_all(spool_container, 0, LV_PART_MAIN);
         lv_obj_clear_flag(spool_container, LV_OBJ_FLAG_SCROLLABLE);
 
-        lv_obj_t *spool_outline = lv_image_create(spool_container);
-        lv_image_set_src(spool_outline, &img_spool_clean);
-        lv_image_set_scale(spool_outline, 300);
-        lv_obj_set_pos(spool_outline, 0, 0);
-
-        lv_obj_t *spool_fill = lv_image_create(spool_container);
-        lv_image_set_src(spool_fill, &img_spool_fill);
-        lv_image_set_scale(spool_fill, 300);
-        lv_obj_set_pos(spool_fill, 0, 0);
-
         // Color from inventory
         uint32_t color_rgba = spool_info.color_rgba;
         uint8_t r = (color_rgba >> 24) & 0xFF;
         uint8_t g = (color_rgba >> 16) & 0xFF;
         uint8_t b = (color_rgba >> 8) & 0xFF;
         uint32_t color_hex = (r << 16) | (g << 8) | b;
-        if (color_rgba != 0) {
-            lv_obj_set_style_image_recolor(spool_fill, lv_color_hex(color_hex), 0);
-            lv_obj_set_style_image_recolor_opa(spool_fill, 255, 0);
-        } else {
-            lv_obj_set_style_image_recolor(spool_fill, lv_color_hex(0x808080), 0);
-            lv_obj_set_style_image_recolor_opa(spool_fill, 255, 0);
-        }
+        if (color_rgba == 0) color_hex = 0x808080;
+
+        // Spool precomposed at its displayed size (32x42 source at scale 300)
+        lv_obj_t *spool_img = ui_spool_gauge_create(spool_container, color_hex, spool_fill_pct(&spool_info), 37, 49);
+        lv_obj_set_pos(spool_img, 0, 0);
 
         // Spool details from inventory
         lv_obj_t *details_container = lv_obj_create(content_container);
@@ -1224,7 +1231,7 @@ static void create_tag_popup(void) {
         lv_obj_center(close_label);
     }
 
-    ESP_LOGI(TAG, "Tag popup created successfully");
+    UI_LOGI("Tag popup created successfully");
 }
 
 // Update weight display in popup if open
@@ -1262,19 +1269,26 @@ void ui_nfc_card_set_configured_tag(const char *tag_id) {
         // Also set dismissed_tag_uid so it survives brief NFC glitches
         strncpy(dismissed_tag_uid, tag_id, sizeof(dismissed_tag_uid) - 1);
         dismissed_tag_uid[sizeof(dismissed_tag_uid) - 1] = '\0';
-        ESP_LOGI(TAG, "Suppressing popup for tag: %s", configured_tag_id);
+        UI_LOGI("Suppressing popup for tag: %s", configured_tag_id);
     }
 }
 
 void ui_nfc_card_cleanup(void) {
     close_popup();
+    ui_nfc_inventory_close();
     last_tag_present = false;
     // Don't reset configured_tag_id - it needs to persist across screen transitions
 }
 
 void ui_nfc_card_update(void) {
     if (!nfc_is_initialized()) {
-        ESP_LOGD(TAG, "NFC not initialized, skipping update");
+        UI_LOGD("NFC not initialized, skipping update");
+        return;
+    }
+
+    // Bulk inventory owns the reader while open - no single tag popup
+    if (ui_nfc_inventory_is_open()) {
+        ui_nfc_inventory_update();
         return;
     }
 
@@ -1288,8 +1302,8 @@ void ui_nfc_card_update(void) {
 
     // Log state changes
     if (tag_present != last_tag_present) {
-        ESP_LOGI(TAG, "Tag state changed: present=%d, uid=%s, popup=%p, user_closed=%d",
-                 tag_present, current_uid, (void*)tag_popup, popup_user_closed);
+        UI_LOGI("Tag state changed: present=%d, uid=%s, popup=%p, user_closed=%d",
+                tag_present, current_uid, (void*)tag_popup, popup_user_closed);
     }
 
     // Tag detected
@@ -1318,7 +1332,7 @@ void ui_nfc_card_update(void) {
 
         if (is_different_tag) {
             // Different tag detected - clear all suppression
-            ESP_LOGI(TAG, "Different tag %s detected (was %s), clearing suppression", current_uid, dismissed_tag_uid);
+            UI_LOGI("Different tag %s detected (was %s), clearing suppression", current_uid, dismissed_tag_uid);
             configured_tag_id[0] = '\0';
             dismissed_tag_uid[0] = '\0';
             popup_user_closed = false;
@@ -1328,8 +1342,8 @@ void ui_nfc_card_update(void) {
         if (!tag_popup) {
             // No popup open - check if we should open one
             if (!is_suppressed) {
-                ESP_LOGI(TAG, "Opening popup for tag %s (dismissed=%s, configured=%s)",
-                         current_uid, dismissed_tag_uid, configured_tag_id);
+                UI_LOGI("Opening popup for tag %s (dismissed=%s, configured=%s)",
+                        current_uid, dismissed_tag_uid, configured_tag_id);
                 create_tag_popup();
             }
             // else: suppressed, don't open
@@ -1338,7 +1352,7 @@ void ui_nfc_card_update(void) {
             bool popup_is_different = (popup_tag_uid[0] != '\0') &&
                                       (strcmp((char*)current_uid, (char*)popup_tag_uid) != 0);
             if (popup_is_different) {
-                ESP_LOGI(TAG, "Different tag %s (popup was %s), recreating popup", current_uid, popup_tag_uid);
+                UI_LOGI("Different tag %s (popup was %s), recreating popup", current_uid, popup_tag_uid);
                 close_popup();
                 dismissed_tag_uid[0] = '\0';
                 popup_user_closed = false;
@@ -1351,13 +1365,13 @@ void ui_nfc_card_update(void) {
         if (last_tag_present && !tag_present) {
             // Tag just lost - start the debounce timer
             tag_lost_time = lv_tick_get();
-            ESP_LOGI(TAG, "Tag lost, starting debounce timer");
+            UI_LOGI("Tag lost, starting debounce timer");
         } else if (tag_lost_time > 0) {
             // Tag still absent - check if debounce period has elapsed
             uint32_t elapsed = lv_tick_get() - tag_lost_time;
             if (elapsed >= TAG_REMOVAL_DEBOUNCE_MS) {
                 // Tag has been gone long enough - clear suppression
-                ESP_LOGI(TAG, "Tag gone for %ums, clearing suppression", (unsigned int)elapsed);
+                UI_LOGI("Tag gone for %ums, clearing suppression", (unsigned int)elapsed);
                 configured_tag_id[0] = '\0';
                 dismissed_tag_uid[0] = '\0';
                 popup_user_closed = false;
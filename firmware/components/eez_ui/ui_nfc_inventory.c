@@ -0,0 +1,355 @@
+/**
+ * NFC Bulk Inventory UI - register several spools in one pass
+ * Lists every tag of the last inventory round and adds the unknown ones
+ * to the backend inventory with a single request
+ */
+
+#include "ui_nfc_inventory.h"
+#include "lvgl.h"
+#include <stdio.h>
+#include <string.h>
+#include "ui_log.h"
+
+#ifdef ESP_PLATFORM
+#include "ui_internal.h"
+#else
+#include "backend_client.h"
+#endif
+
+static const char *TAG = "ui_nfc_inventory";
+
+#define INV_MAX_TAGS 16
+#define INV_KNOWN_CACHE_SIZE 32
+
+// Modal elements
+static lv_obj_t *inv_modal = NULL;
+static lv_obj_t *inv_status_label = NULL;
+static lv_obj_t *inv_result_label = NULL;
+static lv_obj_t *inv_list = NULL;
+static lv_obj_t *inv_add_btn = NULL;
+static lv_obj_t *inv_add_label = NULL;
+
+// Tags of the last round shown in the list
+static NfcInventoryTag inv_tags[INV_MAX_TAGS];
+static bool inv_known[INV_MAX_TAGS];
+static int inv_count = 0;
+static uint32_t inv_round = 0;
+
+// Inventory lookups per UID, so a tag is only looked up once while the modal is open
+static struct {
+    char uid[32];
+    bool known;
+} known_cache[INV_KNOWN_CACHE_SIZE];
+static int known_cache_count = 0;
+static int known_cache_next = 0;  // Slot replaced when the cache is full
+
+static int find_known(const char *uid) {
+    for (int i = 0; i < known_cache_count; i++) {
+        if (strcmp(known_cache[i].uid, uid) == 0) return i;
+    }
+    return -1;
+}
+
+// Fill inv_known, looking up all uncached UIDs of the round in one request
+static void resolve_known(void) {
+    const char *lookup[INV_MAX_TAGS];
+    bool lookup_known[INV_MAX_TAGS];
+    int lookup_count = 0;
+
+    for (int i = 0; i < inv_count; i++) {
+        if (find_known(inv_tags[i].uid_hex) < 0) lookup[lookup_count++] = inv_tags[i].uid_hex;
+    }
+
+    // On failure the tags show as new and are looked up again next round
+    if (lookup_count > 0 && spool_tags_known(lookup, lookup_count, lookup_known) == 0) {
+        for (int i = 0; i < lookup_count; i++) {
+            int slot = known_cache_count < INV_KNOWN_CACHE_SIZE ? known_cache_count++ : known_cache_next++ % INV_KNOWN_CACHE_SIZE;
+            snprintf(known_cache[slot].uid, sizeof(known_cache[slot].uid), "%s", lookup[i]);
+            known_cache[slot].known = lookup_known[i];
+        }
+    }
+
+    for (int i = 0; i < inv_count; i++) {
+        int slot = find_known(inv_tags[i].uid_hex);
+        inv_known[i] = slot >= 0 && known_cache[slot].known;
+    }
+}
+
+static void mark_known(const char *uid) {
+    int slot = find_known(uid);
+    if (slot >= 0) known_cache[slot].known = true;
+}
+
+static int count_new(void) {
+    int count = 0;
+    for (int i = 0; i < inv_count; i++) {
+        if (!inv_known[i]) count++;
+    }
+    return count;
+}
+
+static void update_status(void) {
+    char text[96];
+    if (inv_count == 0) {
+        snprintf(text, sizeof(text), "Hold spools on the reader...");
+    } else {
+        snprintf(text, sizeof(text), "Round %u: %d tags, %d new", (unsigned)inv_round, inv_count, count_new());
+    }
+    lv_label_set_text(inv_status_label, text);
+
+    int new_count = count_new();
+    if (new_count > 0) {
+        snprintf(text, sizeof(text), "Add %d spool%s", new_count, new_count == 1 ? "" : "s");
+        lv_obj_clear_state(inv_add_btn, LV_STATE_DISABLED);
+    } else {
+        snprintf(text, sizeof(text), "Add spools");
+        lv_obj_add_state(inv_add_btn, LV_STATE_DISABLED);
+    }
+    lv_label_set_text(inv_add_label, text);
+}
+
+static void build_rows(void) {
+    lv_obj_clean(inv_list);
+
+    for (int i = 0; i < inv_count; i++) {
+        const NfcInventoryTag *tag = &inv_tags[i];
+
+        lv_obj_t *item = lv_obj_create(inv_list);
+        lv_obj_set_size(item, LV_PCT(100), 50);
+        lv_obj_set_style_bg_color(item, lv_color_hex(0x2a2a2a), LV_PART_MAIN);
+        lv_obj_set_style_border_width(item, 0, LV_PART_MAIN);
+        lv_obj_set_style_radius(item, 8, LV_PART_MAIN);
+        lv_obj_set_style_pad_all(item, 0, LV_PART_MAIN);
+        lv_obj_clear_flag(item, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+        // Color indicator (gray for tags without spool data)
+        lv_obj_t *color_dot = lv_obj_create(item);
+        lv_obj_remove_style_all(color_dot);
+        lv_obj_set_size(color_dot, 24, 24);
+        lv_obj_align(color_dot, LV_ALIGN_LEFT_MID, 10, 0);
+        lv_obj_set_style_radius(color_dot, LV_RADIUS_CIRCLE, LV_PART_MAIN);
+        lv_obj_set_style_bg_opa(color_dot, LV_OPA_COVER, LV_PART_MAIN);
+        uint32_t rgba = tag->decoded ? tag->color_rgba : 0x808080FF;
+        lv_obj_set_style_bg_color(color_dot, lv_color_make((rgba >> 24) & 0xFF, (rgba >> 16) & 0xFF, (rgba >> 8) & 0xFF),
+                                  LV_PART_MAIN);
+        lv_obj_clear_flag(color_dot, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+        // Decoded summary
+        lv_obj_t *info = lv_label_create(item);
+        char info_text[128];
+        if (tag->decoded) {
+            snprintf(info_text, sizeof(info_text), "%s %s%s%s - %s",
+                     tag->vendor, tag->material, tag->subtype[0] ? " " : "", tag->subtype,
+                     tag->color_name[0] ? tag->color_name : "Unknown");
+        } else {
+            snprintf(info_text, sizeof(info_text), "Unknown spool (%s tag)", tag->tag_type == 1 ? "NTAG" : "MIFARE");
+        }
+        lv_label_set_text(info, info_text);
+        lv_obj_set_style_text_font(info, &lv_font_montserrat_14, LV_PART_MAIN);
+        lv_obj_set_style_text_color(info, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+        lv_obj_align(info, LV_ALIGN_TOP_LEFT, 45, 7);
+
+        // UID
+        lv_obj_t *uid = lv_label_create(item);
+        lv_label_set_text(uid, tag->uid_hex);
+        lv_obj_set_style_text_font(uid, &lv_font_montserrat_10, LV_PART_MAIN);
+        lv_obj_set_style_text_color(uid, lv_color_hex(0x888888), LV_PART_MAIN);
+        lv_obj_align(uid, LV_ALIGN_BOTTOM_LEFT, 45, -7);
+
+        // Inventory status
+        lv_obj_t *badge = lv_label_create(item);
+        lv_label_set_text(badge, inv_known[i] ? "In inventory" : "New");
+        lv_obj_set_style_text_font(badge, &lv_font_montserrat_12, LV_PART_MAIN);
+        lv_obj_set_style_text_color(badge, lv_color_hex(inv_known[i] ? 0x00FF00 : 0x1976D2), LV_PART_MAIN);
+        lv_obj_align(badge, LV_ALIGN_RIGHT_MID, -12, 0);
+    }
+}
+
+// Take over the last round; the list is only rebuilt when its tags changed
+static void refresh_tags(bool force) {
+    NfcInventoryTag tags[INV_MAX_TAGS];
+    int count = nfc_inventory_get_count();
+    if (count > INV_MAX_TAGS) count = INV_MAX_TAGS;
+
+    int valid = 0;
+    for (int i = 0; i < count; i++) {
+        if (nfc_inventory_get_tag(i, &tags[valid])) valid++;
+    }
+
+    bool changed = force || valid != inv_count;
+    for (int i = 0; i < valid && !changed; i++) {
+        changed = strcmp(tags[i].uid_hex, inv_tags[i].uid_hex) != 0 || tags[i].decoded != inv_tags[i].decoded;
+    }
+
+    if (changed) {
+        memcpy(inv_tags, tags, valid * sizeof(NfcInventoryTag));
+        inv_count = valid;
+        resolve_known();
+        if (!force) lv_label_set_text(inv_result_label, "");
+        build_rows();
+        UI_LOGI("Inventory round %u: %d tags, %d new", (unsigned)inv_round, inv_count, count_new());
+    }
+    update_status();
+}
+
+static void add_click_handler(lv_event_t *e) {
+    (void)e;
+    NfcInventoryTag new_tags[INV_MAX_TAGS];
+    int new_count = 0;
+
+    for (int i = 0; i < inv_count; i++) {
+        if (inv_known[i]) continue;
+        NfcInventoryTag *tag = &new_tags[new_count++];
+        *tag = inv_tags[i];
+        if (!tag->decoded) {
+            // Spool data can be completed later in the web UI
+            snprintf(tag->material, sizeof(tag->material), "Unknown");
+            tag->color_rgba = 0x808080FF;
+        }
+    }
+    if (new_count == 0) return;
+
+    int skipped = 0;
+    int created = spool_add_batch_to_inventory(new_tags, new_count, "display_bulk_add", &skipped);
+
+    char text[96];
+    if (created < 0) {
+        snprintf(text, sizeof(text), "Failed to add spools");
+        lv_obj_set_style_text_color(inv_result_label, lv_color_hex(0xFF5555), LV_PART_MAIN);
+    } else {
+        // Skipped tags were added elsewhere in the meantime - known as well
+        for (int i = 0; i < new_count; i++) {
+            mark_known(new_tags[i].uid_hex);
+        }
+        if (skipped > 0) {
+            snprintf(text, sizeof(text), "Added %d spools (%d already in inventory)", created, skipped);
+        } else {
+            snprintf(text, sizeof(text), "Added %d spool%s", created, created == 1 ? "" : "s");
+        }
+        lv_obj_set_style_text_color(inv_result_label, lv_color_hex(0x00FF00), LV_PART_MAIN);
+        refresh_tags(true);
+    }
+    lv_label_set_text(inv_result_label, text);
+}
+
+static void done_click_handler(lv_event_t *e) {
+    (void)e;
+    ui_nfc_inventory_close();
+}
+
+void ui_nfc_inventory_open(void) {
+    if (inv_modal) return;  // Already open
+
+    UI_LOGI("Opening bulk inventory");
+    nfc_inventory_set_active(true);
+    inv_count = 0;
+    inv_round = nfc_inventory_get_round();
+
+    // Create modal background (no close on background click - Done leaves the mode)
+    inv_modal = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(inv_modal, 800, 480);
+    lv_obj_set_pos(inv_modal, 0, 0);
+    lv_obj_set_style_bg_color(inv_modal, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(inv_modal, 200, LV_PART_MAIN);
+    lv_obj_set_style_border_width(inv_modal, 0, LV_PART_MAIN);
+    lv_obj_clear_flag(inv_modal, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *card = lv_obj_create(inv_modal);
+    lv_obj_set_size(card, 560, 440);
+    lv_obj_center(card);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x1a1a1a), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(card, 255, LV_PART_MAIN);
+    lv_obj_set_style_border_color(card, lv_color_hex(0x1976D2), LV_PART_MAIN);
+    lv_obj_set_style_border_width(card, 2, LV_PART_MAIN);
+    lv_obj_set_style_radius(card, 12, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(card, 15, LV_PART_MAIN);
+    lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    // Title
+    lv_obj_t *title = lv_label_create(card);
+    lv_label_set_text(title, "Bulk Add Spools");
+    lv_obj_set_style_text_font(title, &lv_font_montserrat_18, LV_PART_MAIN);
+    lv_obj_set_style_text_color(title, lv_color_hex(0x1976D2), LV_PART_MAIN);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
+
+    inv_status_label = lv_label_create(card);
+    lv_obj_set_style_text_font(inv_status_label, &lv_font_montserrat_12, LV_PART_MAIN);
+    lv_obj_set_style_text_color(inv_status_label, lv_color_hex(0xaaaaaa), LV_PART_MAIN);
+    lv_obj_align(inv_status_label, LV_ALIGN_TOP_MID, 0, 28);
+
+    // Scrollable tag list
+    inv_list = lv_obj_create(card);
+    lv_obj_set_size(inv_list, LV_PCT(100), 290);
+    lv_obj_align(inv_list, LV_ALIGN_TOP_MID, 0, 50);
+    lv_obj_set_style_bg_opa(inv_list, 0, LV_PART_MAIN);
+    lv_obj_set_style_border_width(inv_list, 0, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(inv_list, 0, LV_PART_MAIN);
+    lv_obj_set_flex_flow(inv_list, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(inv_list, 8, LV_PART_MAIN);
+    lv_obj_set_scroll_dir(inv_list, LV_DIR_VER);
+
+    inv_result_label = lv_label_create(card);
+    lv_label_set_text(inv_result_label, "");
+    lv_obj_set_style_text_font(inv_result_label, &lv_font_montserrat_12, LV_PART_MAIN);
+    lv_obj_align(inv_result_label, LV_ALIGN_BOTTOM_MID, 0, -44);
+
+    // Add button
+    inv_add_btn = lv_btn_create(card);
+    lv_obj_set_size(inv_add_btn, 160, 38);
+    lv_obj_align(inv_add_btn, LV_ALIGN_BOTTOM_MID, -90, 0);
+    lv_obj_set_style_bg_color(inv_add_btn, lv_color_hex(0x1976D2), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(inv_add_btn, lv_color_hex(0x333333), LV_PART_MAIN | LV_STATE_DISABLED);
+    lv_obj_set_style_radius(inv_add_btn, 8, LV_PART_MAIN);
+    lv_obj_add_event_cb(inv_add_btn, add_click_handler, LV_EVENT_CLICKED, NULL);
+
+    inv_add_label = lv_label_create(inv_add_btn);
+    lv_obj_set_style_text_font(inv_add_label, &lv_font_montserrat_14, LV_PART_MAIN);
+    lv_obj_set_style_text_color(inv_add_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    lv_obj_center(inv_add_label);
+
+    // Done button
+    lv_obj_t *btn_done = lv_btn_create(card);
+    lv_obj_set_size(btn_done, 120, 38);
+    lv_obj_align(btn_done, LV_ALIGN_BOTTOM_MID, 90, 0);
+    lv_obj_set_style_bg_color(btn_done, lv_color_hex(0x666666), LV_PART_MAIN);
+    lv_obj_set_style_radius(btn_done, 8, LV_PART_MAIN);
+    lv_obj_add_event_cb(btn_done, done_click_handler, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *done_label = lv_label_create(btn_done);
+    lv_label_set_text(done_label, "Done");
+    lv_obj_set_style_text_font(done_label, &lv_font_montserrat_14, LV_PART_MAIN);
+    lv_obj_set_style_text_color(done_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    lv_obj_center(done_label);
+
+    refresh_tags(true);
+}
+
+bool ui_nfc_inventory_is_open(void) {
+    return inv_modal != NULL;
+}
+
+void ui_nfc_inventory_update(void) {
+    if (!inv_modal) return;
+
+    uint32_t round = nfc_inventory_get_round();
+    if (round == inv_round) return;
+    inv_round = round;
+    refresh_tags(false);
+}
+
+void ui_nfc_inventory_close(void) {
+    if (!inv_modal) return;
+
+    UI_LOGI("Closing bulk inventory");
+    lv_obj_delete(inv_modal);
+    inv_modal = NULL;
+    inv_status_label = NULL;
+    inv_result_label = NULL;
+    inv_list = NULL;
+    inv_add_btn = NULL;
+    inv_add_label = NULL;
+    inv_count = 0;
+    known_cache_count = 0;
+    known_cache_next = 0;
+    nfc_inventory_set_active(false);
+}
@@ -0,0 +1,32 @@
+/**
+ * NFC Bulk Inventory UI - register several spools in one pass
+ */
+
+#ifndef UI_NFC_INVENTORY_H
+#define UI_NFC_INVENTORY_H
+
+#include <stdbool.h>
+
+/**
+ * Open the bulk inventory modal and switch the NFC bridge to inventory mode
+ * (every tag in the field is reported, instead of one at a time).
+ */
+void ui_nfc_inventory_open(void);
+
+/**
+ * True while the bulk inventory modal is open
+ */
+bool ui_nfc_inventory_is_open(void);
+
+/**
+ * Refresh the tag list from the last inventory round.
+ * Call this periodically while the modal is open.
+ */
+void ui_nfc_inventory_update(void);
+
+/**
+ * Close the modal and return the NFC bridge to single tag mode
+ */
+void ui_nfc_inventory_close(void);
+
+#endif // UI_NFC_INVENTORY_H
@@ -3,6 +3,7 @@
 // =============================================================================
 
 #include "ui_internal.h"
+#include "ui_keyboard.h"
 #include "screens.h"
 #include "images.h"
 #include <stdio.h>
@@ -32,9 +33,6 @@ int editing_printer_index = -1;  // -1 = adding new, >= 0 = editing
 static lv_obj_t *dynamic_printer_rows[MAX_PRINTERS] = {NULL};
 static int dynamic_printer_count = 0;
 
-// Keyboard object for printer add/edit screen (created on demand)
-static lv_obj_t *printer_keyboard = NULL;
-
 // Delete button (created dynamically in edit mode)
 static lv_obj_t *delete_button = NULL;
 
@@ -58,8 +56,6 @@ static void close_discover_modal(void);
 
 // Cleanup for printer add screen (call before screen transition)
 void ui_printer_add_cleanup(void) {
-    // Reset keyboard pointer (will be recreated when screen loads again)
-    printer_keyboard = NULL;
     // Reset delete button pointer
     delete_button = NULL;
     // Close delete confirmation modal if open
@@ -189,6 +185,8 @@ void update_printers_list(void) {
 
     lv_obj_t *content = objects.settings_screen_tabs_printers_content;
     if (!content) return;
+    // Tab content not built yet (created on first selection)
+    if (!objects.settings_screen_tabs_printers_content_add_printer) return;
 
     int printer_count = backend_get_printer_count();
     PRINTER_LOGI("ui_printer", "Updating printers tab: %d printers", printer_count);
@@ -377,31 +375,17 @@ static void move_panel_for_keyboard(bool show) {
     lv_obj_set_y(panel, target_y);
 }
 
-// Text area focus callback - show keyboard
-static void textarea_focus_handler(lv_event_t *e) {
-    lv_obj_t *ta = lv_event_get_target(e);
-    if (!printer_keyboard) return;
-
-    lv_keyboard_set_textarea(printer_keyboard, ta);
-    lv_obj_remove_flag(printer_keyboard, LV_OBJ_FLAG_HIDDEN);
-    move_panel_for_keyboard(true);
+// Keyboard shown/hidden for one of the printer textareas
+static void printer_keyboard_toggle(lv_obj_t *ta, bool visible, void *user_data) {
+    (void)ta;
+    (void)user_data;
+    move_panel_for_keyboard(visible);
 }
 
 // Text area defocus callback - hide keyboard
 static void textarea_defocus_handler(lv_event_t *e) {
-    (void)e;
-    if (printer_keyboard) {
-        lv_obj_add_flag(printer_keyboard, LV_OBJ_FLAG_HIDDEN);
-        move_panel_for_keyboard(false);
-    }
-}
-
-// Keyboard ready/cancel callback - hide keyboard when checkmark or X is pressed
-static void keyboard_ready_handler(lv_event_t *e) {
-    (void)e;
-    if (printer_keyboard) {
-        lv_obj_add_flag(printer_keyboard, LV_OBJ_FLAG_HIDDEN);
-        move_panel_for_keyboard(false);
+    if (ui_keyboard_get_textarea() == lv_event_get_target(e)) {
+        ui_keyboard_hide();
     }
 }
 
@@ -604,8 +588,8 @@ static void delete_button_click_handler(lv_event_t *e) {
 static void wire_textarea(lv_obj_t *ta) {
     if (!ta) return;
     lv_obj_add_event_cb(ta, textarea_value_changed, LV_EVENT_VALUE_CHANGED, NULL);
-    lv_obj_add_event_cb(ta, textarea_focus_handler, LV_EVENT_FOCUSED, NULL);
     lv_obj_add_event_cb(ta, textarea_defocus_handler, LV_EVENT_DEFOCUSED, NULL);
+    ui_keyboard_register_textarea(ta, LV_KEYBOARD_MODE_TEXT_LOWER, printer_keyboard_toggle, NULL);
 }
 
 // =============================================================================
@@ -885,19 +869,6 @@ void wire_printer_add_buttons(void) {
                             printer_add_back_handler, LV_EVENT_CLICKED, NULL);
     }
 
-    // Create keyboard (hidden by default)
-    lv_obj_t *screen = objects.settings_printer_add_screen;
-    if (screen && !printer_keyboard) {
-        printer_keyboard = lv_keyboard_create(screen);
-        lv_obj_set_size(printer_keyboard, 800, 240);
-        lv_obj_align(printer_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
-        lv_obj_add_flag(printer_keyboard, LV_OBJ_FLAG_HIDDEN);
-        // Handle keyboard ready (checkmark) and cancel (X) events
-        lv_obj_add_event_cb(printer_keyboard, keyboard_ready_handler, LV_EVENT_READY, NULL);
-        lv_obj_add_event_cb(printer_keyboard, keyboard_ready_handler, LV_EVENT_CANCEL, NULL);
-        apply_keyboard_layout(printer_keyboard);
-    }
-
     // Wire textareas with keyboard and change detection
     wire_textarea(objects.settings_printer_add_screen_panel_panel_input_name);
     wire_textarea(objects.settings_printer_add_screen_panel_panel_input_serial);
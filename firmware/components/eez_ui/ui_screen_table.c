@@ -0,0 +1,244 @@
+/**
+ * @file ui_screen_table.c
+ * @brief Interpreter for the generated screen descriptor tables
+ *
+ * See ui_screen_table.h. Nodes are stored in creation (depth-first) order,
+ * so a node's parent is always one of the ancestors currently on the stack.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#include "ui_screen_table.h"
+#include <lvgl.h>
+#include <stdio.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+static const char *TAG = "ui_screen_table";
+#else
+#define ESP_LOGE(tag, fmt, ...) printf("[%s] ERROR: " fmt "\n", tag, ##__VA_ARGS__)
+static const char *TAG = "ui_screen_table";
+#endif
+
+// EEZ screens nest at most ~6 levels; leave headroom for future layouts
+#define UI_TBL_MAX_DEPTH 16
+
+static inline int32_t tbl_coord(int16_t v) {
+    return v == UI_TBL_SIZE_CONTENT ? LV_SIZE_CONTENT : v;
+}
+
+static lv_obj_t *tbl_create_widget(uint8_t type, lv_obj_t *parent) {
+    switch (type) {
+        case UI_TBL_LABEL:    return lv_label_create(parent);
+        case UI_TBL_IMAGE:    return lv_image_create(parent);
+        case UI_TBL_BUTTON:   return lv_button_create(parent);
+        case UI_TBL_DROPDOWN: return lv_dropdown_create(parent);
+        case UI_TBL_TEXTAREA: return lv_textarea_create(parent);
+        case UI_TBL_SLIDER:   return lv_slider_create(parent);
+        case UI_TBL_BAR:      return lv_bar_create(parent);
+        case UI_TBL_LED:      return lv_led_create(parent);
+        case UI_TBL_OBJ:
+        default:              return lv_obj_create(parent);
+    }
+}
+
+static void tbl_apply_op(lv_obj_t *obj, const ui_tbl_op_t *op) {
+    switch (op->op) {
+        case UI_TBL_OP_LABEL_TEXT:
+            lv_label_set_text_static(obj, (const char *)op->p);
+            break;
+        case UI_TBL_OP_LABEL_LONG_MODE:
+            lv_label_set_long_mode(obj, (lv_label_long_mode_t)op->a);
+            break;
+        case UI_TBL_OP_IMAGE_SRC:
+            lv_image_set_src(obj, op->p);
+            break;
+        case UI_TBL_OP_IMAGE_SCALE:
+            lv_image_set_scale(obj, (uint32_t)op->a);
+            break;
+        case UI_TBL_OP_DROPDOWN_OPTIONS:
+            lv_dropdown_set_options_static(obj, (const char *)op->p);
+            break;
+        case UI_TBL_OP_DROPDOWN_SELECTED:
+            lv_dropdown_set_selected(obj, (uint32_t)op->a);
+            break;
+        case UI_TBL_OP_TEXTAREA_MAX_LENGTH:
+            lv_textarea_set_max_length(obj, (uint32_t)op->a);
+            break;
+        case UI_TBL_OP_TEXTAREA_PLACEHOLDER:
+            lv_textarea_set_placeholder_text(obj, (const char *)op->p);
+            break;
+        case UI_TBL_OP_TEXTAREA_ONE_LINE:
+            lv_textarea_set_one_line(obj, op->a != 0);
+            break;
+        case UI_TBL_OP_TEXTAREA_PASSWORD:
+            lv_textarea_set_password_mode(obj, op->a != 0);
+            break;
+        case UI_TBL_OP_SLIDER_RANGE:
+            lv_slider_set_range(obj, op->a, op->b);
+            break;
+        case UI_TBL_OP_SLIDER_VALUE:
+            lv_slider_set_value(obj, op->a, LV_ANIM_OFF);
+            break;
+        case UI_TBL_OP_LED_COLOR:
+            lv_led_set_color(obj, lv_color_hex((uint32_t)op->a));
+            break;
+        case UI_TBL_OP_LED_BRIGHTNESS:
+            lv_led_set_brightness(obj, (uint8_t)op->a);
+            break;
+        case UI_TBL_OP_ADD_FLAG:
+            lv_obj_add_flag(obj, (lv_obj_flag_t)op->a);
+            break;
+        case UI_TBL_OP_CLEAR_FLAG:
+            lv_obj_remove_flag(obj, (lv_obj_flag_t)op->a);
+            break;
+        case UI_TBL_OP_ADD_STATE:
+            lv_obj_add_state(obj, (lv_state_t)op->a);
+            break;
+        case UI_TBL_OP_STYLE_ALIGN:
+            lv_obj_set_style_align(obj, (lv_align_t)op->a, (lv_style_selector_t)op->b);
+            break;
+        default:
+            ESP_LOGE(TAG, "Unknown op %d", op->op);
+            break;
+    }
+}
+
+static lv_obj_t *tbl_create_node(const ui_screen_table_t *table, uint16_t i, lv_obj_t *parent) {
+    const ui_tbl_node_t *node = &table->nodes[i];
+    lv_obj_t *obj = tbl_create_widget(node->type, parent);
+    if (node->slot >= 0) {
+        ((lv_obj_t **)&objects)[node->slot] = obj;
+    }
+
+    lv_obj_set_pos(obj, node->x, node->y);
+    lv_obj_set_size(obj, tbl_coord(node->w), tbl_coord(node->h));
+
+    for (uint8_t s = 0; s < node->style_count; s++) {
+        const ui_tbl_style_ref_t *ref = &table->styles[node->style_first + s];
+        lv_obj_add_style(obj, ref->style, ref->selector);
+    }
+    for (uint8_t o = 0; o < node->op_count; o++) {
+        tbl_apply_op(obj, &table->ops[node->op_first + o]);
+    }
+    return obj;
+}
+
+static int tbl_find_slot(const ui_screen_table_t *table, int16_t slot) {
+    for (uint16_t i = 0; i < table->node_count; i++) {
+        if (table->nodes[i].slot == slot) return i;
+    }
+    return -1;
+}
+
+// One past the last descendant of node idx. Descendants follow their
+// ancestor contiguously, so the subtree ends at the first node whose
+// parent lies before idx.
+static uint16_t tbl_subtree_end(const ui_screen_table_t *table, uint16_t idx) {
+    uint16_t i = idx + 1;
+    while (i < table->node_count && table->nodes[i].parent >= (int16_t)idx) {
+        i++;
+    }
+    return i;
+}
+
+static void tbl_clear_slots(const ui_screen_table_t *table, uint16_t first, uint16_t end) {
+    for (uint16_t i = first; i < end; i++) {
+        if (table->nodes[i].slot >= 0) {
+            ((lv_obj_t **)&objects)[table->nodes[i].slot] = NULL;
+        }
+    }
+}
+
+static bool tbl_is_deferred(int16_t slot, const int16_t *deferred, uint8_t count) {
+    if (slot < 0) return false;
+    for (uint8_t d = 0; d < count; d++) {
+        if (deferred[d] == slot) return true;
+    }
+    return false;
+}
+
+// Create nodes [first, end). If root_obj is given it is the existing object
+// of node root_idx, the parent of the range.
+static lv_obj_t *tbl_build(const ui_screen_table_t *table, uint16_t first, uint16_t end,
+                           int16_t root_idx, lv_obj_t *root_obj,
+                           const int16_t *deferred, uint8_t deferred_count) {
+    // Ancestor stack: node index + created object per depth
+    int16_t stack_idx[UI_TBL_MAX_DEPTH];
+    lv_obj_t *stack_obj[UI_TBL_MAX_DEPTH];
+    int depth = 0;
+    lv_obj_t *first_obj = NULL;
+
+    if (root_obj) {
+        stack_idx[0] = root_idx;
+        stack_obj[0] = root_obj;
+        depth = 1;
+    }
+
+    for (uint16_t i = first; i < end; i++) {
+        const ui_tbl_node_t *node = &table->nodes[i];
+        lv_obj_t *parent = NULL;
+
+        if (node->parent >= 0) {
+            while (depth > 0 && stack_idx[depth - 1] != node->parent) {
+                depth--;
+            }
+            if (depth == 0) {
+                ESP_LOGE(TAG, "%s: node %d has no parent on stack", table->name, i);
+                return first_obj;
+            }
+            parent = stack_obj[depth - 1];
+        }
+
+        lv_obj_t *obj = tbl_create_node(table, i, parent);
+        if (!first_obj) first_obj = obj;
+
+        if (tbl_is_deferred(node->slot, deferred, deferred_count)) {
+            // Skip the subtree; nothing later can have it as parent
+            uint16_t sub_end = tbl_subtree_end(table, i);
+            tbl_clear_slots(table, i + 1, sub_end);
+            i = sub_end - 1;
+        }
+
+        if (depth < UI_TBL_MAX_DEPTH) {
+            stack_idx[depth] = (int16_t)i;
+            stack_obj[depth] = obj;
+            depth++;
+        } else {
+            ESP_LOGE(TAG, "%s: nesting deeper than %d", table->name, UI_TBL_MAX_DEPTH);
+        }
+    }
+
+    return first_obj;
+}
+
+lv_obj_t *ui_screen_table_create(const ui_screen_table_t *table) {
+    if (!table || table->node_count == 0) return NULL;
+    return tbl_build(table, 0, table->node_count, -1, NULL, NULL, 0);
+}
+
+lv_obj_t *ui_screen_table_create_deferred(const ui_screen_table_t *table,
+                                          const int16_t *deferred_slots, uint8_t deferred_count) {
+    if (!table || table->node_count == 0) return NULL;
+    return tbl_build(table, 0, table->node_count, -1, NULL, deferred_slots, deferred_count);
+}
+
+bool ui_screen_table_create_children(const ui_screen_table_t *table, int16_t slot) {
+    if (!table || slot < 0) return false;
+    int idx = tbl_find_slot(table, slot);
+    lv_obj_t *obj = ((lv_obj_t **)&objects)[slot];
+    if (idx < 0 || !obj) return false;
+
+    tbl_build(table, (uint16_t)idx + 1, tbl_subtree_end(table, (uint16_t)idx), (int16_t)idx, obj, NULL, 0);
+    return true;
+}
+
+void ui_screen_table_release_children(const ui_screen_table_t *table, int16_t slot) {
+    if (!table || slot < 0) return;
+    int idx = tbl_find_slot(table, slot);
+    lv_obj_t *obj = ((lv_obj_t **)&objects)[slot];
+    if (idx < 0 || !obj) return;
+
+    lv_obj_clean(obj);
+    tbl_clear_slots(table, (uint16_t)idx + 1, tbl_subtree_end(table, (uint16_t)idx));
+}
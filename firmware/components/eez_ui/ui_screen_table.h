@@ -0,0 +1,155 @@
+/**
+ * @file ui_screen_table.h
+ * @brief Table-driven screen construction from post-processed EEZ output
+ *
+ * firmware/tools/eez_screen_tables.py turns the generated create_screen_*()
+ * code in eez/src/ui/screens.c into compact const descriptor tables
+ * (ui_screen_tables.c): one node per widget with its geometry, a list of
+ * shared const styles (deduplicated across all screens, living in flash),
+ * and a few widget-specific setup ops. ui_screen_table_create() walks a
+ * table and instantiates the screen, filling the same `objects` fields the
+ * EEZ code does, so wire_*() functions work unchanged.
+ *
+ * Subtrees can be deferred: ui_screen_table_create_deferred() creates the
+ * listed containers empty and ui_screen_table_create_children() fills them
+ * in later (used by the settings screen to build tabs on first selection).
+ *
+ * Tables are enabled with UI_SCREEN_TABLES (the default for firmware and
+ * simulator), and the settings screen then also defers its tabs (see
+ * ui_settings.c); without it ui.c keeps calling the EEZ create_screen_*()
+ * functions. The simulator always builds both so that
+ * `./simulator --bench-screens` can compare them.
+ */
+
+#ifndef UI_SCREEN_TABLE_H
+#define UI_SCREEN_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "screens.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Widget class of a node
+typedef enum {
+    UI_TBL_OBJ = 0,
+    UI_TBL_LABEL,
+    UI_TBL_IMAGE,
+    UI_TBL_BUTTON,
+    UI_TBL_DROPDOWN,
+    UI_TBL_TEXTAREA,
+    UI_TBL_SLIDER,
+    UI_TBL_BAR,
+    UI_TBL_LED,
+} ui_tbl_widget_t;
+
+// Widget setup operations that aren't plain style properties
+typedef enum {
+    UI_TBL_OP_LABEL_TEXT = 0,       // p = text
+    UI_TBL_OP_LABEL_LONG_MODE,      // a = lv_label_long_mode_t
+    UI_TBL_OP_IMAGE_SRC,            // p = image descriptor
+    UI_TBL_OP_IMAGE_SCALE,          // a = scale (256 = 100%)
+    UI_TBL_OP_DROPDOWN_OPTIONS,     // p = options string
+    UI_TBL_OP_DROPDOWN_SELECTED,    // a = index
+    UI_TBL_OP_TEXTAREA_MAX_LENGTH,  // a = length
+    UI_TBL_OP_TEXTAREA_PLACEHOLDER, // p = text
+    UI_TBL_OP_TEXTAREA_ONE_LINE,    // a = bool
+    UI_TBL_OP_TEXTAREA_PASSWORD,    // a = bool
+    UI_TBL_OP_SLIDER_RANGE,         // a = min, b = max
+    UI_TBL_OP_SLIDER_VALUE,         // a = value
+    UI_TBL_OP_LED_COLOR,            // a = 0xRRGGBB
+    UI_TBL_OP_LED_BRIGHTNESS,       // a = brightness
+    UI_TBL_OP_ADD_FLAG,             // a = lv_obj_flag_t mask
+    UI_TBL_OP_CLEAR_FLAG,           // a = lv_obj_flag_t mask
+    UI_TBL_OP_ADD_STATE,            // a = lv_state_t mask
+    UI_TBL_OP_STYLE_ALIGN,          // a = lv_align_t, b = selector (kept local: ui_backend removes it)
+} ui_tbl_op_code_t;
+
+// Marker for LV_SIZE_CONTENT in the 16-bit geometry fields
+#define UI_TBL_SIZE_CONTENT INT16_MIN
+
+// Index of an `objects` field, as stored in ui_tbl_node_t.slot
+#define UI_TBL_SLOT(field) ((int16_t)(offsetof(objects_t, field) / sizeof(lv_obj_t *)))
+
+typedef struct {
+    uint8_t op;                 // ui_tbl_op_code_t
+    int32_t a;
+    int32_t b;
+    const void *p;
+} ui_tbl_op_t;
+
+typedef struct {
+    const lv_style_t *style;    // Shared const style (LV_STYLE_CONST_INIT)
+    uint32_t selector;          // Part | state
+} ui_tbl_style_ref_t;
+
+typedef struct {
+    uint8_t type;               // ui_tbl_widget_t
+    int16_t parent;             // Node index, -1 = this node is the screen
+    int16_t slot;               // Index into `objects`, -1 = not exported
+    int16_t x, y, w, h;
+    uint16_t style_first;       // Into ui_screen_table_t.styles
+    uint8_t style_count;
+    uint16_t op_first;          // Into ui_screen_table_t.ops
+    uint8_t op_count;
+} ui_tbl_node_t;
+
+typedef struct {
+    const char *name;
+    const ui_tbl_node_t *nodes;
+    uint16_t node_count;
+    const ui_tbl_style_ref_t *styles;
+    const ui_tbl_op_t *ops;
+} ui_screen_table_t;
+
+/**
+ * Instantiate a screen from its descriptor table.
+ *
+ * @param table Generated table (see ui_screen_tables.c)
+ * @return The new screen object (also stored in `objects`)
+ */
+lv_obj_t *ui_screen_table_create(const ui_screen_table_t *table);
+
+/**
+ * Instantiate a screen, leaving the children of some nodes out.
+ *
+ * The deferred nodes themselves are created (geometry, styles, flags), their
+ * descendants are not and the matching `objects` fields are set to NULL.
+ *
+ * @param deferred_slots `objects` slots (UI_TBL_SLOT) of the nodes to defer
+ * @param deferred_count Number of entries in deferred_slots
+ * @return The new screen object
+ */
+lv_obj_t *ui_screen_table_create_deferred(const ui_screen_table_t *table,
+                                          const int16_t *deferred_slots, uint8_t deferred_count);
+
+/**
+ * Create the descendants of a node whose object already exists.
+ *
+ * @param slot `objects` slot of the node (its object must be set)
+ * @return true if the children were created, false if the node is unknown
+ *         or has no object
+ */
+bool ui_screen_table_create_children(const ui_screen_table_t *table, int16_t slot);
+
+/**
+ * Delete the descendants of a node again and clear their `objects` fields.
+ * Anything else created inside the node is deleted too.
+ */
+void ui_screen_table_release_children(const ui_screen_table_t *table, int16_t slot);
+
+/**
+ * Look up the table for an EEZ screen (generated in ui_screen_tables.c).
+ *
+ * @return Table, or NULL if the screen has no table
+ */
+const ui_screen_table_t *ui_screen_table_get(enum ScreensEnum screen_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_SCREEN_TABLE_H */
@@ -0,0 +1,2721 @@
+// Generated by firmware/tools/eez_screen_tables.py from eez/src/ui/screens.c - do not edit.
+// Regenerate after every EEZ Studio export (update_eez_screens.sh runs it).
+
+#include "ui_screen_table.h"
+#include "images.h"
+#include "fonts.h"
+
+// =============================================================================
+// Shared styles (80 unique, from 1958 inline style calls)
+// =============================================================================
+
+static const lv_style_const_prop_t style_0_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x1a, 0x1a, 0x1a)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_0, style_0_props);
+
+static const lv_style_const_prop_t style_1_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_1, style_1_props);
+
+static const lv_style_const_prop_t style_2_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_2, style_2_props);
+
+static const lv_style_const_prop_t style_3_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_18),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_3, style_3_props);
+
+static const lv_style_const_prop_t style_4_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xfa, 0xaa, 0x05)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_TOP),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_4, style_4_props);
+
+static const lv_style_const_prop_t style_5_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_5, style_5_props);
+
+static const lv_style_const_prop_t style_6_props[] = {
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_WIDTH(5),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x79, 0x66, 0x66)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_6, style_6_props);
+
+static const lv_style_const_prop_t style_7_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_10),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_7, style_7_props);
+
+static const lv_style_const_prop_t style_8_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_8, style_8_props);
+
+static const lv_style_const_prop_t style_9_props[] = {
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_ROUNDED(false),
+    LV_STYLE_CONST_ARC_WIDTH(0),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_WIDTH(3),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_NONE),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_9, style_9_props);
+
+static const lv_style_const_prop_t style_10_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_10, style_10_props);
+
+static const lv_style_const_prop_t style_11_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x72, 0x6e, 0x6e)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x35, 0x2a, 0x2a)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_BG_GRAD_STOP(200),
+    LV_STYLE_CONST_BG_MAIN_STOP(100),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_11, style_11_props);
+
+static const lv_style_const_prop_t style_12_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_12, style_12_props);
+
+static const lv_style_const_prop_t style_13_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xec, 0x0a, 0x0a)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_13, style_13_props);
+
+static const lv_style_const_prop_t style_14_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x0a, 0x40, 0xec)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_14, style_14_props);
+
+static const lv_style_const_prop_t style_15_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xec, 0xe9, 0x0a)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_15, style_15_props);
+
+static const lv_style_const_prop_t style_16_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x14, 0x68, 0x19)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_16, style_16_props);
+
+static const lv_style_const_prop_t style_17_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x79, 0x66, 0x66)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_17, style_17_props);
+
+static const lv_style_const_prop_t style_18_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x5f, 0x5b, 0x5b)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_HOR),
+    LV_STYLE_CONST_BG_GRAD_STOP(255),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_FULL),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_OUTLINE_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_OUTLINE_OPA(255),
+    LV_STYLE_CONST_OUTLINE_WIDTH(2),
+    LV_STYLE_CONST_RADIUS(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_18, style_18_props);
+
+static const lv_style_const_prop_t style_19_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x1a, 0x1a, 0x1a)),
+    LV_STYLE_CONST_BG_OPA(128),
+    LV_STYLE_CONST_SHADOW_OPA(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_19, style_19_props);
+
+static const lv_style_const_prop_t style_20_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(100),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_20, style_20_props);
+
+static const lv_style_const_prop_t style_21_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_16),
+    LV_STYLE_CONST_TEXT_OPA(125),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_21, style_21_props);
+
+static const lv_style_const_prop_t style_22_props[] = {
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_WIDTH(5),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_22, style_22_props);
+
+static const lv_style_const_prop_t style_23_props[] = {
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x80, 0x80, 0x80)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_23, style_23_props);
+
+static const lv_style_const_prop_t style_24_props[] = {
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_ROUNDED(false),
+    LV_STYLE_CONST_ARC_WIDTH(0),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2f, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_WIDTH(3),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_NONE),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_24, style_24_props);
+
+static const lv_style_const_prop_t style_25_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2f, 0x32, 0x37)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x79, 0x66, 0x66)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_25, style_25_props);
+
+static const lv_style_const_prop_t style_26_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_OPA(128),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_26, style_26_props);
+
+static const lv_style_const_prop_t style_27_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_27, style_27_props);
+
+static const lv_style_const_prop_t style_28_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_28, style_28_props);
+
+static const lv_style_const_prop_t style_29_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_29, style_29_props);
+
+static const lv_style_const_prop_t style_30_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_30, style_30_props);
+
+static const lv_style_const_prop_t style_31_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_12),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_31, style_31_props);
+
+static const lv_style_const_prop_t style_32_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_32, style_32_props);
+
+static const lv_style_const_prop_t style_33_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x54, 0x51, 0x51)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_BG_GRAD_OPA(128),
+    LV_STYLE_CONST_BG_GRAD_STOP(255),
+    LV_STYLE_CONST_BG_MAIN_OPA(128),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_33, style_33_props);
+
+static const lv_style_const_prop_t style_34_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_34, style_34_props);
+
+static const lv_style_const_prop_t style_35_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0xf7, 0x03, 0x03)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_35, style_35_props);
+
+static const lv_style_const_prop_t style_36_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_BG_OPA(0),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_36, style_36_props);
+
+static const lv_style_const_prop_t style_37_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x36, 0x03, 0xf7)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_37, style_37_props);
+
+static const lv_style_const_prop_t style_38_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x50, 0x94, 0x05)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_38, style_38_props);
+
+static const lv_style_const_prop_t style_39_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(255),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0xfa, 0xd6, 0x07)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_39, style_39_props);
+
+static const lv_style_const_prop_t style_40_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_40, style_40_props);
+
+static const lv_style_const_prop_t style_41_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_41, style_41_props);
+
+static const lv_style_const_prop_t style_42_props[] = {
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x19, 0x67, 0xea)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_42, style_42_props);
+
+static const lv_style_const_prop_t style_43_props[] = {
+    LV_STYLE_CONST_IMAGE_OPA(100),
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_43, style_43_props);
+
+static const lv_style_const_prop_t style_44_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x3d, 0x3d, 0x3d)),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_44, style_44_props);
+
+static const lv_style_const_prop_t style_45_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BG_OPA(50),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_45, style_45_props);
+
+static const lv_style_const_prop_t style_46_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_46, style_46_props);
+
+static const lv_style_const_prop_t style_47_props[] = {
+    LV_STYLE_CONST_IMAGE_RECOLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_IMAGE_RECOLOR_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_47, style_47_props);
+
+static const lv_style_const_prop_t style_48_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x2f, 0x32, 0x37)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_48, style_48_props);
+
+static const lv_style_const_prop_t style_49_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(2),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_49, style_49_props);
+
+static const lv_style_const_prop_t style_50_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_50, style_50_props);
+
+static const lv_style_const_prop_t style_51_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xfa, 0xfa, 0xfa)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_51, style_51_props);
+
+static const lv_style_const_prop_t style_52_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xac, 0xa7, 0xa7)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_52, style_52_props);
+
+static const lv_style_const_prop_t style_53_props[] = {
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(2),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_53, style_53_props);
+
+static const lv_style_const_prop_t style_54_props[] = {
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_CONST_ARC_ROUNDED(false),
+    LV_STYLE_CONST_ARC_WIDTH(0),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_NONE),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(2),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(2),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_54, style_54_props);
+
+static const lv_style_const_prop_t style_55_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_55, style_55_props);
+
+static const lv_style_const_prop_t style_56_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xd0, 0xbd, 0xbb)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xba, 0xb1, 0xb1)),
+    LV_STYLE_CONST_BORDER_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(2),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_56, style_56_props);
+
+static const lv_style_const_prop_t style_57_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_16),
+    LV_STYLE_CONST_TEXT_OPA(255),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_57, style_57_props);
+
+static const lv_style_const_prop_t style_58_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_58, style_58_props);
+
+static const lv_style_const_prop_t style_59_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_59, style_59_props);
+
+static const lv_style_const_prop_t style_60_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_60, style_60_props);
+
+static const lv_style_const_prop_t style_61_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xff, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_61, style_61_props);
+
+static const lv_style_const_prop_t style_62_props[] = {
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_62, style_62_props);
+
+static const lv_style_const_prop_t style_63_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x28, 0x2b, 0x30)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_63, style_63_props);
+
+static const lv_style_const_prop_t style_64_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x25, 0x25, 0x25)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(15),
+    LV_STYLE_CONST_PAD_RIGHT(15),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_64, style_64_props);
+
+static const lv_style_const_prop_t style_65_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(15),
+    LV_STYLE_CONST_PAD_RIGHT(15),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_65, style_65_props);
+
+static const lv_style_const_prop_t style_66_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_66, style_66_props);
+
+static const lv_style_const_prop_t style_67_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x25, 0x25, 0x25)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_CLIP_CORNER(true),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(15),
+    LV_STYLE_CONST_PAD_RIGHT(15),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(5),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_67, style_67_props);
+
+static const lv_style_const_prop_t style_68_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x88, 0x88, 0x88)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_68, style_68_props);
+
+static const lv_style_const_prop_t style_69_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x1a, 0x1a, 0x1a)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(15),
+    LV_STYLE_CONST_PAD_RIGHT(15),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_69, style_69_props);
+
+static const lv_style_const_prop_t style_70_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(15),
+    LV_STYLE_CONST_PAD_RIGHT(15),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_RADIUS(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_70, style_70_props);
+
+static const lv_style_const_prop_t style_71_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_16),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_71, style_71_props);
+
+static const lv_style_const_prop_t style_72_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x66, 0x66, 0x66)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_18),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_72, style_72_props);
+
+static const lv_style_const_prop_t style_73_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x1a, 0x1a, 0x1a)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(2),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_73, style_73_props);
+
+static const lv_style_const_prop_t style_74_props[] = {
+    LV_STYLE_CONST_ARC_ROUNDED(true),
+    LV_STYLE_CONST_ARC_WIDTH(5),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2d, 0x2d, 0x2d)),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x79, 0x66, 0x66)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_74, style_74_props);
+
+static const lv_style_const_prop_t style_75_props[] = {
+    LV_STYLE_CONST_TEXT_DECOR(LV_TEXT_DECOR_UNDERLINE),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_75, style_75_props);
+
+static const lv_style_const_prop_t style_76_props[] = {
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_SPREAD(0),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_76, style_76_props);
+
+static const lv_style_const_prop_t style_77_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0xff, 0x00)),
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_77, style_77_props);
+
+static const lv_style_const_prop_t style_78_props[] = {
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_78, style_78_props);
+
+static const lv_style_const_prop_t style_79_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OFFSET_X(1),
+    LV_STYLE_CONST_SHADOW_OFFSET_Y(1),
+    LV_STYLE_CONST_SHADOW_OPA(100),
+    LV_STYLE_CONST_SHADOW_SPREAD(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_79, style_79_props);
+
+// =============================================================================
+// main_screen (79 objects)
+// =============================================================================
+
+static const ui_tbl_node_t main_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(main_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // main_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(top_bar), 0, 0, 800, 44, 1, 1, 0, 1 },  // top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(spoolbuddy_logo), -8, -1, 173, 46, 2, 0, 1, 3 },  // spoolbuddy_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(top_bar_printer_select), 325, 2, 150, 39, 2, 0, 4, 2 },  // top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(top_bar_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 6, 1 },  // top_bar_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(top_bar_notification_bell), 662, 11, 24, 24, 3, 0, 7, 2 },  // top_bar_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(top_bar_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 9, 1 },  // top_bar_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(bottom_bar), 0, 450, 800, 30, 4, 1, 10, 1 },  // bottom_bar
+    { UI_TBL_LED, 7, UI_TBL_SLOT(bottom_bar_message_dot), 13, 7, 12, 12, 5, 0, 11, 2 },  // bottom_bar_message_dot
+    { UI_TBL_LABEL, 7, UI_TBL_SLOT(bottom_bar_message), 33, 6, 754, 16, 5, 1, 13, 1 },  // bottom_bar_message
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(main_screen_ams_right_nozzle), 402, 319, 385, 127, 6, 1, 14, 1 },  // main_screen_ams_right_nozzle
+    { UI_TBL_LABEL, 10, UI_TBL_SLOT(main_screen_ams_right_nozzle_indicator), -14, -17, 12, 12, 7, 1, 15, 1 },  // main_screen_ams_right_nozzle_indicator
+    { UI_TBL_LABEL, 10, UI_TBL_SLOT(main_screen_ams_right_nozzle_text), 2, -17, UI_TBL_SIZE_CONTENT, 12, 8, 1, 16, 1 },  // main_screen_ams_right_nozzle_text
+    { UI_TBL_OBJ, 10, UI_TBL_SLOT(main_screen_ams_ht_a), -14, 50, 47, 50, 9, 1, 17, 1 },  // main_screen_ams_ht_a
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(main_screen_ams_ht_a_text), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 10, 1, 18, 1 },  // main_screen_ams_ht_a_text
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(main_screen_ams_ht_a_slot), -11, -1, 23, 24, 11, 1, 19, 1 },  // main_screen_ams_ht_a_slot
+    { UI_TBL_OBJ, 10, UI_TBL_SLOT(main_screen_ams_ext_1), 40, 50, 47, 50, 12, 1, 20, 1 },  // main_screen_ams_ext_1
+    { UI_TBL_LABEL, 16, UI_TBL_SLOT(main_screen_ams_ext_1_text), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 13, 1, 21, 1 },  // main_screen_ams_ext_1_text
+    { UI_TBL_LABEL, 16, UI_TBL_SLOT(main_screen_ams_ext_1_slot), -11, -1, 23, 24, 14, 1, 22, 1 },  // main_screen_ams_ext_1_slot
+    { UI_TBL_OBJ, 10, UI_TBL_SLOT(main_screen_ams_b), -14, -2, 120, 50, 15, 1, 23, 1 },  // main_screen_ams_b
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(main_screen_ams_b_label), 31, -19, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 16, 1, 24, 1 },  // main_screen_ams_b_label
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(main_screen_ams_b_slot_1), -17, -3, 23, 24, 17, 1, 25, 1 },  // main_screen_ams_b_slot_1
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(main_screen_ams_b_slot_2), 11, -3, 23, 24, 18, 1, 26, 1 },  // main_screen_ams_b_slot_2
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(main_screen_ams_b_slot_3), 39, -3, 23, 24, 19, 1, 27, 1 },  // main_screen_ams_b_slot_3
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(main_screen_ams_b_slot_4), 68, -3, 23, 24, 20, 1, 28, 1 },  // main_screen_ams_b_slot_4
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(main_screen_button_ams_setup), 507, 49, 137, 122, 21, 1, 29, 0 },  // main_screen_button_ams_setup
+    { UI_TBL_IMAGE, 25, UI_TBL_SLOT(main_screen_button_ams_setup_icon), 2, 2, 93, 79, 22, 1, 29, 3 },  // main_screen_button_ams_setup_icon
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(main_screen_button_ams_setup_label), 2, 49, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 23, 0, 32, 2 },  // main_screen_button_ams_setup_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(main_screen_button_encode_tag), 657, 49, 130, 122, 23, 1, 34, 0 },  // main_screen_button_encode_tag
+    { UI_TBL_IMAGE, 28, UI_TBL_SLOT(main_screen_button_encode_tag_icon), -1, 2, 93, 79, 24, 1, 34, 3 },  // main_screen_button_encode_tag_icon
+    { UI_TBL_LABEL, 28, UI_TBL_SLOT(main_screen_button_encode_tag_label), 0, 49, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 25, 0, 37, 2 },  // main_screen_button_encode_tag_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(main_screen_button_settings), 657, 182, 130, 126, 25, 1, 39, 0 },  // main_screen_button_settings
+    { UI_TBL_IMAGE, 31, UI_TBL_SLOT(main_screen_button_settings_icon), -1, 2, 93, 83, 26, 1, 39, 3 },  // main_screen_button_settings_icon
+    { UI_TBL_LABEL, 31, UI_TBL_SLOT(main_screen_button_settings_label), 0, 50, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 27, 0, 42, 2 },  // main_screen_button_settings_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(main_screen_button_catalog), 507, 180, 137, 129, 27, 2, 44, 1 },  // main_screen_button_catalog
+    { UI_TBL_IMAGE, 34, UI_TBL_SLOT(main_screen_button_catalog_icon), 2, 2, 93, 83, 29, 1, 45, 3 },  // main_screen_button_catalog_icon
+    { UI_TBL_LABEL, 34, UI_TBL_SLOT(main_screen_button_catalog_label), 2, 50, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 30, 0, 48, 2 },  // main_screen_button_catalog_label
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(main_screen_nfc_scale), 11, 179, 483, 130, 30, 1, 50, 1 },  // main_screen_nfc_scale
+    { UI_TBL_IMAGE, 37, UI_TBL_SLOT(main_screen_nfc_scale_nfc_logo), -17, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 31, 1, 51, 2 },  // main_screen_nfc_scale_nfc_logo
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(main_screen_nfc_scale_nfc_label), 7, 78, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 32, 1, 53, 1 },  // main_screen_nfc_scale_nfc_label
+    { UI_TBL_IMAGE, 37, UI_TBL_SLOT(main_screen_nfc_scale_scale_icon), 369, -18, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 33, 1, 54, 2 },  // main_screen_nfc_scale_scale_icon
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(main_screen_nfc_scale_scale_label), 382, 76, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 34, 1, 56, 1 },  // main_screen_nfc_scale_scale_label
+    { UI_TBL_OBJ, 37, UI_TBL_SLOT(main_screen_nfc_scale_messages), 83, -8, 276, 102, 35, 1, 57, 1 },  // main_screen_nfc_scale_messages
+    { UI_TBL_LABEL, 42, UI_TBL_SLOT(main_screen_nfc_scale_message), 41, 13, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 36, 1, 58, 1 },  // main_screen_nfc_scale_message
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(main_screen_ams_left_nozzle), 10, 319, 385, 127, 37, 1, 59, 1 },  // main_screen_ams_left_nozzle
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(main_screen_ams_left_nozzle_indicator), -16, -17, 12, 12, 38, 1, 60, 1 },  // main_screen_ams_left_nozzle_indicator
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(main_screen_ams_left_nozzle_label), 0, -17, UI_TBL_SIZE_CONTENT, 12, 39, 1, 61, 1 },  // main_screen_ams_left_nozzle_label
+    { UI_TBL_OBJ, 44, UI_TBL_SLOT(main_screen_ams_a), -16, -2, 120, 50, 40, 1, 62, 1 },  // main_screen_ams_a
+    { UI_TBL_LABEL, 47, UI_TBL_SLOT(main_screen_ams_a_label), 32, -18, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 41, 0, 63, 1 },  // main_screen_ams_a_label
+    { UI_TBL_LABEL, 47, UI_TBL_SLOT(main_screen_ams_a_slot_1), -17, -3, 23, 24, 41, 1, 64, 1 },  // main_screen_ams_a_slot_1
+    { UI_TBL_LABEL, 47, UI_TBL_SLOT(main_screen_ams_a_slot_3), 39, -3, 23, 24, 42, 1, 65, 1 },  // main_screen_ams_a_slot_3
+    { UI_TBL_LABEL, 47, UI_TBL_SLOT(main_screen_ams_a_slot_4), 68, -3, 23, 24, 43, 1, 66, 1 },  // main_screen_ams_a_slot_4
+    { UI_TBL_LABEL, 47, UI_TBL_SLOT(main_screen_ams_a_slot_2), 10, -3, 23, 24, 44, 1, 67, 1 },  // main_screen_ams_a_slot_2
+    { UI_TBL_OBJ, 44, UI_TBL_SLOT(main_screen_ams_c), 111, -2, 120, 50, 45, 1, 68, 1 },  // main_screen_ams_c
+    { UI_TBL_LABEL, 53, UI_TBL_SLOT(main_screen_ams_c_label), 32, -18, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 46, 1, 69, 1 },  // main_screen_ams_c_label
+    { UI_TBL_LABEL, 53, UI_TBL_SLOT(main_screen_ams_c_slot_1), -17, -3, 23, 24, 47, 1, 70, 1 },  // main_screen_ams_c_slot_1
+    { UI_TBL_LABEL, 53, UI_TBL_SLOT(main_screen_ams_c_slot_2), 11, -3, 23, 24, 48, 1, 71, 1 },  // main_screen_ams_c_slot_2
+    { UI_TBL_LABEL, 53, UI_TBL_SLOT(main_screen_ams_c_slot_3), 39, -3, 23, 24, 49, 1, 72, 1 },  // main_screen_ams_c_slot_3
+    { UI_TBL_LABEL, 53, UI_TBL_SLOT(main_screen_ams_c_slot_4), 68, -3, 23, 24, 50, 1, 73, 1 },  // main_screen_ams_c_slot_4
+    { UI_TBL_OBJ, 44, UI_TBL_SLOT(obj0), 240, -2, 120, 50, 51, 1, 74, 1 },  // obj0
+    { UI_TBL_LABEL, 59, UI_TBL_SLOT(main_screen_ams_d_label), 31, -18, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 52, 1, 75, 1 },  // main_screen_ams_d_label
+    { UI_TBL_LABEL, 59, UI_TBL_SLOT(main_screen_ams_d_slot_1), -17, -3, 23, 24, 53, 1, 76, 1 },  // main_screen_ams_d_slot_1
+    { UI_TBL_LABEL, 59, UI_TBL_SLOT(main_screen_ams_d_slot_2), 11, -3, 23, 24, 54, 1, 77, 1 },  // main_screen_ams_d_slot_2
+    { UI_TBL_LABEL, 59, UI_TBL_SLOT(main_screen_ams_d_slot_3), 39, -3, 23, 24, 55, 1, 78, 1 },  // main_screen_ams_d_slot_3
+    { UI_TBL_LABEL, 59, UI_TBL_SLOT(main_screen_ams_d_slot_4), 68, -3, 23, 24, 56, 1, 79, 1 },  // main_screen_ams_d_slot_4
+    { UI_TBL_OBJ, 44, UI_TBL_SLOT(main_screen_ht_b), -16, 50, 47, 50, 57, 1, 80, 1 },  // main_screen_ht_b
+    { UI_TBL_LABEL, 65, UI_TBL_SLOT(main_screen_ht_b_label), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 58, 1, 81, 1 },  // main_screen_ht_b_label
+    { UI_TBL_LABEL, 65, UI_TBL_SLOT(main_screen_ht_b_slot), -10, -1, 23, 24, 59, 1, 82, 1 },  // main_screen_ht_b_slot
+    { UI_TBL_OBJ, 44, UI_TBL_SLOT(main_screen_ext_2), 38, 50, 47, 50, 60, 1, 83, 1 },  // main_screen_ext_2
+    { UI_TBL_LABEL, 68, UI_TBL_SLOT(main_screen_ext_2_label), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 61, 1, 84, 1 },  // main_screen_ext_2_label
+    { UI_TBL_LABEL, 68, UI_TBL_SLOT(main_screen_ext_2_slot), -11, -1, 23, 24, 62, 1, 85, 1 },  // main_screen_ext_2_slot
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(main_screen_printer), 11, 49, 484, 122, 63, 1, 86, 1 },  // main_screen_printer
+    { UI_TBL_IMAGE, 71, UI_TBL_SLOT(main_screen_printer_print_cover), -11, -13, 70, 70, 64, 1, 87, 2 },  // main_screen_printer_print_cover
+    { UI_TBL_LABEL, 71, UI_TBL_SLOT(main_screen_printer_printer_name_label), 70, -6, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 65, 1, 89, 1 },  // main_screen_printer_printer_name_label
+    { UI_TBL_LABEL, 71, UI_TBL_SLOT(main_screen_printer_printer_status), 70, 27, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 66, 1, 90, 1 },  // main_screen_printer_printer_status
+    { UI_TBL_LABEL, 71, UI_TBL_SLOT(main_screen_printer_filename), -13, 62, 353, 16, 67, 1, 91, 1 },  // main_screen_printer_filename
+    { UI_TBL_LABEL, 71, UI_TBL_SLOT(main_screen_printer_eta), 385, 35, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 68, 1, 92, 1 },  // main_screen_printer_eta
+    { UI_TBL_BAR, 71, UI_TBL_SLOT(main_screen_printer_progress_bar), -17, 80, 467, 15, 69, 2, 93, 0 },  // main_screen_printer_progress_bar
+    { UI_TBL_LABEL, 71, UI_TBL_SLOT(main_screen_printer_time_left), 385, 62, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 71, 1, 93, 1 },  // main_screen_printer_time_left
+};
+
+static const ui_tbl_style_ref_t main_screen_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_4, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_5, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_6, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_12, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_16, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_19, LV_PART_MAIN | LV_STATE_DISABLED },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_20, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_21, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_20, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_21, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_22, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_23, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_16, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_24, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_12, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_16, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_12, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_16, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_25, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_26, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_27, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_28, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_29, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_30, LV_PART_INDICATOR | LV_STATE_DEFAULT },
+    { &style_31, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t main_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_DEFAULT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LED_COLOR, (int32_t)(0xfaaa05), (int32_t)(0), NULL },
+    { UI_TBL_OP_LED_BRIGHTNESS, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "R" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Right Nozzle" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Ext-1" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_amssetup },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(180), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS Setup" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_encoding },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(150), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Encode Tag" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_settings },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(150), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Settings" },
+    { UI_TBL_OP_ADD_STATE, (int32_t)(LV_STATE_DISABLED), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_catalog },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(150), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Catalog" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_nfc },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(175), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Ready" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_scale },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(190), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Ready" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Place spool on scale\nto scan & weigh..." },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "L" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Left Nozzle" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Ext-2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_filament_spool },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(100), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+};
+
+const ui_screen_table_t ui_screen_table_main_screen = {
+    "main_screen",
+    main_screen_nodes,
+    sizeof(main_screen_nodes) / sizeof(main_screen_nodes[0]),
+    main_screen_styles,
+    main_screen_ops,
+};
+
+// =============================================================================
+// ams_overview (164 objects)
+// =============================================================================
+
+static const ui_tbl_node_t ams_overview_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(ams_overview), 0, 0, 800, 480, 0, 1, 0, 0 },  // ams_overview
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(ams_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 0 },  // ams_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(ams_screen_top_bar_logo), -8, -1, 173, 43, 2, 0, 0, 3 },  // ams_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(ams_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 3, 2 },  // ams_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(ams_screen_top_bar_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 5, 1 },  // ams_screen_top_bar_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(ams_screen_top_bar_notofication_bell), 662, 11, 24, 24, 3, 0, 6, 2 },  // ams_screen_top_bar_notofication_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(ams_screen_top_bar_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 8, 1 },  // ams_screen_top_bar_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(ams_screen_bottom_bar), 0, 450, 800, 30, 4, 1, 9, 1 },  // ams_screen_bottom_bar
+    { UI_TBL_LED, 7, UI_TBL_SLOT(ams_screen_bottom_bar_led), 13, 7, 12, 12, 5, 0, 10, 2 },  // ams_screen_bottom_bar_led
+    { UI_TBL_LABEL, 7, UI_TBL_SLOT(ams_screen_bottom_bar_message), 30, 5, 696, 16, 5, 1, 12, 1 },  // ams_screen_bottom_bar_message
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(ams_screen_button_home), 728, 49, 60, 60, 6, 1, 13, 0 },  // ams_screen_button_home
+    { UI_TBL_IMAGE, 10, UI_TBL_SLOT(ams_screen_button_home_image), -15, -6, 50, 40, 7, 1, 13, 3 },  // ams_screen_button_home_image
+    { UI_TBL_LABEL, 10, UI_TBL_SLOT(ams_screen_button_home_label), 0, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 8, 1, 16, 2 },  // ams_screen_button_home_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(ams_screen_button_encode_tag), 728, 116, 60, 60, 9, 1, 18, 0 },  // ams_screen_button_encode_tag
+    { UI_TBL_IMAGE, 13, UI_TBL_SLOT(ams_screen_button_encode_tag_icon), -15, -6, 50, 40, 10, 1, 18, 3 },  // ams_screen_button_encode_tag_icon
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(ams_screen_button_encode_tag_label), 0, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 11, 1, 21, 2 },  // ams_screen_button_encode_tag_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(ams_screen_button_settings), 729, 249, 60, 60, 12, 1, 23, 0 },  // ams_screen_button_settings
+    { UI_TBL_IMAGE, 16, UI_TBL_SLOT(ams_screen_button_settings_icon), -15, -6, 50, 40, 13, 1, 23, 3 },  // ams_screen_button_settings_icon
+    { UI_TBL_LABEL, 16, UI_TBL_SLOT(ams_screen_button_settings_label), 0, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 14, 1, 26, 2 },  // ams_screen_button_settings_label
+    { UI_TBL_BUTTON, 0, UI_TBL_SLOT(ams_screen_button_catalog), 729, 182, 60, 60, 15, 2, 28, 1 },  // ams_screen_button_catalog
+    { UI_TBL_IMAGE, 19, UI_TBL_SLOT(ams_screen_button_catalog_icon), -15, -6, 50, 40, 17, 1, 29, 3 },  // ams_screen_button_catalog_icon
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(ams_screen_button_catalog_label), 0, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 18, 1, 32, 2 },  // ams_screen_button_catalog_label
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(ams_screen_ams_panel), 10, 49, 712, 393, 19, 1, 34, 1 },  // ams_screen_ams_panel
+    { UI_TBL_LABEL, 22, UI_TBL_SLOT(ams_screen_ams_panel_label), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 20, 0, 35, 1 },  // ams_screen_ams_panel_label
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_amd_d), -14, 185, 225, 175, 20, 1, 36, 1 },  // ams_screen_ams_panel_amd_d
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_indicator), -16, -16, 12, 12, 21, 1, 37, 1 },  // ams_screen_ams_panel_amd_d_indicator
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_label), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 22, 1, 38, 1 },  // ams_screen_ams_panel_amd_label
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_labe_humidity), 170, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 23, 1, 39, 1 },  // ams_screen_ams_panel_amd_d_labe_humidity
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_icon_humidity), 116, -16, 21, 14, 24, 0, 40, 2 },  // ams_screen_ams_panel_amd_d_icon_humidity
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_label_humidity), 133, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 24, 1, 42, 1 },  // ams_screen_ams_panel_amd_d_label_humidity
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_1), -6, 47, 32, 42, 25, 1, 43, 2 },  // ams_screen_ams_panel_amd_d_slot_1
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_1_color), -6, 47, 32, 42, 26, 1, 45, 2 },  // ams_screen_ams_panel_amd_d_slot_1_color
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_2), 46, 48, 32, 42, 27, 1, 47, 2 },  // ams_screen_ams_panel_amd_d_slot_2
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_2_color), 46, 48, 32, 42, 28, 1, 49, 2 },  // ams_screen_ams_panel_amd_d_slot_2_color
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_3), 100, 48, 32, 42, 29, 1, 51, 2 },  // ams_screen_ams_panel_amd_d_slot_3
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_3_color), 100, 48, 32, 42, 30, 1, 53, 2 },  // ams_screen_ams_panel_amd_d_slot_3_color
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_4), 155, 48, 32, 42, 31, 1, 55, 2 },  // ams_screen_ams_panel_amd_d_slot_4
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_4_color), 155, 48, 32, 42, 32, 1, 57, 2 },  // ams_screen_ams_panel_amd_d_slot_4_color
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_1_label_material), 0, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 33, 1, 59, 1 },  // ams_screen_ams_panel_amd_d_slot_1_label_material
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_2_label_material), 52, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 34, 1, 60, 1 },  // ams_screen_ams_panel_amd_d_slot_2_label_material
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_3_label_material), 105, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 35, 1, 61, 1 },  // ams_screen_ams_panel_amd_d_slot_3_label_material
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_4_label_material), 157, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 36, 1, 62, 1 },  // ams_screen_ams_panel_amd_d_slot_4_label_material
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_2_label_slotname), 55, 106, 18, 11, 37, 1, 63, 1 },  // ams_screen_ams_panel_amd_d_slot_2_label_slotname
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_3_label_slotname), 108, 106, 18, 11, 38, 1, 64, 1 },  // ams_screen_ams_panel_amd_d_slot_3_label_slotname
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_4_label_slotname), 162, 106, 18, 11, 39, 1, 65, 1 },  // ams_screen_ams_panel_amd_d_slot_4_label_slotname
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_1_label_fill_level), 0, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 40, 1, 66, 1 },  // ams_screen_ams_panel_amd_d_slot_1_label_fill_level
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_2_label_fill_level), 54, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 41, 1, 67, 1 },  // ams_screen_ams_panel_amd_d_slot_2_label_fill_level
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_3_label_fill_level), 107, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 42, 1, 68, 1 },  // ams_screen_ams_panel_amd_d_slot_3_label_fill_level
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_4_label_fill_level), 161, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 43, 1, 69, 1 },  // ams_screen_ams_panel_amd_d_slot_4_label_fill_level
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_slot_1_label_slotname), 2, 107, 18, 11, 44, 1, 70, 1 },  // ams_screen_ams_panel_amd_d_slot_1_label_slotname
+    { UI_TBL_IMAGE, 24, UI_TBL_SLOT(ams_screen_ams_panel_amd_d_icon_thermometer), 155, -17, 21, 14, 45, 1, 71, 2 },  // ams_screen_ams_panel_amd_d_icon_thermometer
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ams_a), -16, 3, 225, 175, 46, 1, 73, 1 },  // ams_screen_ams_panel_ams_a
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_indicator), -16, -16, 12, 12, 47, 1, 74, 1 },  // ams_screen_ams_panel_ams_a_indicator
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 48, 1, 75, 1 },  // ams_screen_ams_panel_ams_a_label_name
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_label_temperature), 170, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 49, 1, 76, 1 },  // ams_screen_ams_panel_ams_a_label_temperature
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_icon_humidity), 116, -16, 21, 14, 50, 0, 77, 2 },  // ams_screen_ams_panel_ams_a_icon_humidity
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_label_humidity), 133, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 50, 1, 79, 1 },  // ams_screen_ams_panel_ams_a_label_humidity
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_icon_thermometer), 155, -17, 21, 14, 51, 1, 80, 2 },  // ams_screen_ams_panel_ams_a_icon_thermometer
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_1), -6, 47, 32, 42, 52, 1, 82, 2 },  // ams_screen_ams_panel_ams_a_slot_1
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_1_color), -6, 47, 32, 42, 53, 1, 84, 2 },  // ams_screen_ams_panel_ams_a_slot_1_color
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_2), 46, 48, 32, 42, 54, 1, 86, 2 },  // ams_screen_ams_panel_ams_a_slot_2
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_2_color), 46, 48, 32, 42, 55, 1, 88, 2 },  // ams_screen_ams_panel_ams_a_slot_2_color
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_3), 100, 48, 32, 42, 56, 1, 90, 2 },  // ams_screen_ams_panel_ams_a_slot_3
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_3_color), 100, 48, 32, 42, 57, 1, 92, 2 },  // ams_screen_ams_panel_ams_a_slot_3_color
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_4), 155, 49, 32, 42, 58, 1, 94, 2 },  // ams_screen_ams_panel_ams_a_slot_4
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_4_color), 155, 49, 32, 42, 59, 1, 96, 2 },  // ams_screen_ams_panel_ams_a_slot_4_color
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_1_label_material), 0, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 60, 1, 98, 1 },  // ams_screen_ams_panel_ams_a_slot_1_label_material
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_2_label_material), 52, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 61, 1, 99, 1 },  // ams_screen_ams_panel_ams_a_slot_2_label_material
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_3_label_material), 105, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 62, 1, 100, 1 },  // ams_screen_ams_panel_ams_a_slot_3_label_material
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_4_label_material), 157, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 63, 1, 101, 1 },  // ams_screen_ams_panel_ams_a_slot_4_label_material
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_2_label_slot_name), 55, 106, 18, 11, 64, 1, 102, 1 },  // ams_screen_ams_panel_ams_a_slot_2_label_slot_name
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_3_label_slot_name), 108, 106, 18, 11, 65, 1, 103, 1 },  // ams_screen_ams_panel_ams_a_slot_3_label_slot_name
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_4_label_slot_name), 162, 106, 18, 11, 66, 1, 104, 1 },  // ams_screen_ams_panel_ams_a_slot_4_label_slot_name
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_1_label_slot_name_label_fill_level), 0, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 67, 1, 105, 1 },  // ams_screen_ams_panel_ams_a_slot_1_label_slot_name_label_fill_level
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_2_label_slot_name_label_fill_level), 54, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 68, 1, 106, 1 },  // ams_screen_ams_panel_ams_a_slot_2_label_slot_name_label_fill_level
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_3_label_slot_name_label_fill_level), 107, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 69, 1, 107, 1 },  // ams_screen_ams_panel_ams_a_slot_3_label_slot_name_label_fill_level
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_4_label_slot_name_label_fill_level), 161, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 70, 1, 108, 1 },  // ams_screen_ams_panel_ams_a_slot_4_label_slot_name_label_fill_level
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(ams_screen_ams_panel_ams_a_slot_1_label_slot_name), 1, 105, 18, 11, 71, 1, 109, 1 },  // ams_screen_ams_panel_ams_a_slot_1_label_slot_name
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ht_a), 219, 185, 108, 175, 72, 1, 110, 1 },  // ams_screen_ams_panel_ht_a
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_indicator), -16, -16, 12, 12, 73, 1, 111, 1 },  // ams_screen_ams_panel_ht_a_indicator
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 74, 1, 112, 1 },  // ams_screen_ams_panel_ht_a_label_name
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_label_temperature), 50, 136, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 75, 1, 113, 1 },  // ams_screen_ams_panel_ht_a_label_temperature
+    { UI_TBL_IMAGE, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_con_humidity), -8, 134, 21, 14, 76, 0, 114, 2 },  // ams_screen_ams_panel_ht_a_con_humidity
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_label_humidity), 10, 136, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 76, 1, 116, 1 },  // ams_screen_ams_panel_ht_a_label_humidity
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_label_material), 19, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 77, 1, 117, 1 },  // ams_screen_ams_panel_ht_a_label_material
+    { UI_TBL_LABEL, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_label_fill_level), 22, 107, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 78, 1, 118, 1 },  // ams_screen_ams_panel_ht_a_label_fill_level
+    { UI_TBL_IMAGE, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_slot), 14, 47, 32, 42, 79, 1, 119, 2 },  // ams_screen_ams_panel_ht_a_slot
+    { UI_TBL_IMAGE, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_slot_color), 14, 47, 32, 42, 80, 1, 121, 2 },  // ams_screen_ams_panel_ht_a_slot_color
+    { UI_TBL_IMAGE, 78, UI_TBL_SLOT(ams_screen_ams_panel_ht_a_icon_thermometer), 33, 133, 21, 14, 81, 1, 123, 2 },  // ams_screen_ams_panel_ht_a_icon_thermometer
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ht_b), 336, 185, 108, 175, 82, 1, 125, 1 },  // ams_screen_ams_panel_ht_b
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_indicator), -16, -16, 12, 12, 83, 1, 126, 1 },  // ams_screen_ams_panel_ht_b_indicator
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 84, 1, 127, 1 },  // ams_screen_ams_panel_ht_b_label_name
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_label_temperature), 50, 136, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 85, 1, 128, 1 },  // ams_screen_ams_panel_ht_b_label_temperature
+    { UI_TBL_IMAGE, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_icon_humidity), -8, 134, 21, 14, 86, 0, 129, 2 },  // ams_screen_ams_panel_ht_b_icon_humidity
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_label_humidity), 10, 136, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 86, 1, 131, 1 },  // ams_screen_ams_panel_ht_b_label_humidity
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_label_material), 19, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 87, 1, 132, 1 },  // ams_screen_ams_panel_ht_b_label_material
+    { UI_TBL_LABEL, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_label_fill_level), 22, 107, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 88, 1, 133, 1 },  // ams_screen_ams_panel_ht_b_label_fill_level
+    { UI_TBL_IMAGE, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_slot), 14, 47, 32, 42, 89, 1, 134, 2 },  // ams_screen_ams_panel_ht_b_slot
+    { UI_TBL_IMAGE, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_slot_color), 14, 47, 32, 42, 90, 1, 136, 2 },  // ams_screen_ams_panel_ht_b_slot_color
+    { UI_TBL_IMAGE, 89, UI_TBL_SLOT(ams_screen_ams_panel_ht_b_icon_t), 33, 133, 21, 14, 91, 1, 138, 2 },  // ams_screen_ams_panel_ht_b_icon_t
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ext_1), 454, 185, 108, 175, 92, 1, 140, 1 },  // ams_screen_ams_panel_ext_1
+    { UI_TBL_LABEL, 100, UI_TBL_SLOT(ams_screen_ams_panel_ext_1_indicator), -16, -16, 12, 12, 93, 1, 141, 1 },  // ams_screen_ams_panel_ext_1_indicator
+    { UI_TBL_LABEL, 100, UI_TBL_SLOT(ams_screen_ams_panel_ext_1_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 94, 1, 142, 1 },  // ams_screen_ams_panel_ext_1_label_name
+    { UI_TBL_LABEL, 100, UI_TBL_SLOT(ams_screen_ams_panel_ext_1_label_empty), 9, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 95, 1, 143, 1 },  // ams_screen_ams_panel_ext_1_label_empty
+    { UI_TBL_IMAGE, 100, UI_TBL_SLOT(ams_screen_ams_panel_ext_1_icon_empty), 0, 41, 66, 55, 96, 1, 144, 2 },  // ams_screen_ams_panel_ext_1_icon_empty
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ext_2), 570, 185, 108, 175, 97, 1, 146, 1 },  // ams_screen_ams_panel_ext_2
+    { UI_TBL_LABEL, 105, UI_TBL_SLOT(ams_screen_ams_panel_ext_2_indicator), -16, -16, 12, 12, 98, 1, 147, 1 },  // ams_screen_ams_panel_ext_2_indicator
+    { UI_TBL_LABEL, 105, UI_TBL_SLOT(ams_screen_ams_panel_ext_2_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 99, 1, 148, 1 },  // ams_screen_ams_panel_ext_2_label_name
+    { UI_TBL_LABEL, 105, UI_TBL_SLOT(ams_screen_ams_panel_ext_2_label_empty), 9, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 100, 1, 149, 1 },  // ams_screen_ams_panel_ext_2_label_empty
+    { UI_TBL_IMAGE, 105, UI_TBL_SLOT(ams_screen_ams_panel_ext_2_icon_empty), -1, 41, 66, 55, 101, 1, 150, 2 },  // ams_screen_ams_panel_ext_2_icon_empty
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ams_b), 219, 3, 225, 175, 102, 1, 152, 1 },  // ams_screen_ams_panel_ams_b
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_indicator), -16, -16, 12, 12, 103, 1, 153, 1 },  // ams_screen_ams_panel_ams_b_indicator
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 104, 1, 154, 1 },  // ams_screen_ams_panel_ams_b_label_name
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_label_temperature), 170, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 105, 1, 155, 1 },  // ams_screen_ams_panel_ams_b_label_temperature
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_icon_humidity), 116, -16, 21, 14, 106, 0, 156, 2 },  // ams_screen_ams_panel_ams_b_icon_humidity
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_labe_humidity), 133, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 106, 1, 158, 1 },  // ams_screen_ams_panel_ams_b_labe_humidity
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_1), -6, 47, 32, 42, 107, 1, 159, 2 },  // ams_screen_ams_panel_ams_b_slot_1
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_1_color), -6, 47, 32, 42, 108, 1, 161, 2 },  // ams_screen_ams_panel_ams_b_slot_1_color
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_2), 46, 48, 32, 42, 109, 1, 163, 2 },  // ams_screen_ams_panel_ams_b_slot_2
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_2_color), 46, 48, 32, 42, 110, 1, 165, 2 },  // ams_screen_ams_panel_ams_b_slot_2_color
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_3), 100, 48, 32, 42, 111, 1, 167, 2 },  // ams_screen_ams_panel_ams_b_slot_3
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_3_color), 100, 48, 32, 42, 112, 1, 169, 2 },  // ams_screen_ams_panel_ams_b_slot_3_color
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_4), 155, 49, 32, 42, 113, 1, 171, 2 },  // ams_screen_ams_panel_ams_b_slot_4
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_4_color), 155, 49, 32, 42, 114, 1, 173, 2 },  // ams_screen_ams_panel_ams_b_slot_4_color
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_1_label_material), 0, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 115, 1, 175, 1 },  // ams_screen_ams_panel_ams_b_slot_1_label_material
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_2_label_material), 52, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 116, 1, 176, 1 },  // ams_screen_ams_panel_ams_b_slot_2_label_material
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_3_label_material), 105, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 117, 1, 177, 1 },  // ams_screen_ams_panel_ams_b_slot_3_label_material
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_4_label_material), 157, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 118, 1, 178, 1 },  // ams_screen_ams_panel_ams_b_slot_4_label_material
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_1_label_slot_name), 2, 107, 18, 11, 119, 1, 179, 1 },  // ams_screen_ams_panel_ams_b_slot_1_label_slot_name
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_2_label_slot_name), 55, 106, 18, 11, 120, 1, 180, 1 },  // ams_screen_ams_panel_ams_b_slot_2_label_slot_name
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_3_label_slot_name), 108, 106, 18, 11, 121, 1, 181, 1 },  // ams_screen_ams_panel_ams_b_slot_3_label_slot_name
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_4_label_slot_name), 162, 106, 18, 11, 122, 1, 182, 1 },  // ams_screen_ams_panel_ams_b_slot_4_label_slot_name
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_1_label_fill_level), 0, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 123, 1, 183, 1 },  // ams_screen_ams_panel_ams_b_slot_1_label_fill_level
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_2_label_fill_level), 54, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 124, 1, 184, 1 },  // ams_screen_ams_panel_ams_b_slot_2_label_fill_level
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_3_label_fill_level), 107, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 125, 1, 185, 1 },  // ams_screen_ams_panel_ams_b_slot_3_label_fill_level
+    { UI_TBL_LABEL, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_slot_4_label_fill_level), 161, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 126, 1, 186, 1 },  // ams_screen_ams_panel_ams_b_slot_4_label_fill_level
+    { UI_TBL_IMAGE, 110, UI_TBL_SLOT(ams_screen_ams_panel_ams_b_icon_temperature), 155, -17, 21, 14, 127, 1, 187, 2 },  // ams_screen_ams_panel_ams_b_icon_temperature
+    { UI_TBL_OBJ, 22, UI_TBL_SLOT(ams_screen_ams_panel_ams_c), 454, 3, 225, 175, 128, 1, 189, 1 },  // ams_screen_ams_panel_ams_c
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_indicator), -16, -16, 12, 12, 129, 1, 190, 1 },  // ams_screen_ams_panel_ams_c_indicator
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_label_name), 1, -15, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 130, 1, 191, 1 },  // ams_screen_ams_panel_ams_c_label_name
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_label_temperature), 170, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 131, 1, 192, 1 },  // ams_screen_ams_panel_ams_c_label_temperature
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_icon_humidity), 116, -16, 21, 14, 132, 0, 193, 2 },  // ams_screen_ams_panel_ams_c_icon_humidity
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_label_humidity), 133, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 132, 1, 195, 1 },  // ams_screen_ams_panel_ams_c_label_humidity
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_1), -6, 47, 32, 42, 133, 1, 196, 2 },  // ams_screen_ams_panel_ams_c_slot_1
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_1_color), -6, 47, 32, 42, 134, 1, 198, 2 },  // ams_screen_ams_panel_ams_c_slot_1_color
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_2), 46, 48, 32, 42, 135, 1, 200, 2 },  // ams_screen_ams_panel_ams_c_slot_2
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_2_color), 46, 48, 32, 42, 136, 1, 202, 2 },  // ams_screen_ams_panel_ams_c_slot_2_color
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_3), 100, 48, 32, 42, 137, 1, 204, 2 },  // ams_screen_ams_panel_ams_c_slot_3
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_3_color), 100, 48, 32, 42, 138, 1, 206, 2 },  // ams_screen_ams_panel_ams_c_slot_3_color
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_4), 155, 49, 32, 42, 139, 1, 208, 2 },  // ams_screen_ams_panel_ams_c_slot_4
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_4_color), 155, 49, 32, 42, 140, 1, 210, 2 },  // ams_screen_ams_panel_ams_c_slot_4_color
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_1_label_material), 0, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 141, 1, 212, 1 },  // ams_screen_ams_panel_ams_c_slot_1_label_material
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_2_label_material), 52, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 142, 1, 213, 1 },  // ams_screen_ams_panel_ams_c_slot_2_label_material
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_3_label_material), 105, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 143, 1, 214, 1 },  // ams_screen_ams_panel_ams_c_slot_3_label_material
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_4_label_material), 157, 20, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 144, 1, 215, 1 },  // ams_screen_ams_panel_ams_c_slot_4_label_material
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_2_label_slot_name), 55, 106, 18, 11, 145, 1, 216, 1 },  // ams_screen_ams_panel_ams_c_slot_2_label_slot_name
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_3_label_slot_name), 108, 106, 18, 11, 146, 1, 217, 1 },  // ams_screen_ams_panel_ams_c_slot_3_label_slot_name
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_4_label_slot_name), 162, 106, 18, 11, 147, 1, 218, 1 },  // ams_screen_ams_panel_ams_c_slot_4_label_slot_name
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_1_label_fill_level), 0, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 148, 1, 219, 1 },  // ams_screen_ams_panel_ams_c_slot_1_label_fill_level
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_2_label_fill_level), 54, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 149, 1, 220, 1 },  // ams_screen_ams_panel_ams_c_slot_2_label_fill_level
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_3_label_fill_level), 107, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 150, 1, 221, 1 },  // ams_screen_ams_panel_ams_c_slot_3_label_fill_level
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_4_label_fill_level), 161, 123, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 151, 1, 222, 1 },  // ams_screen_ams_panel_ams_c_slot_4_label_fill_level
+    { UI_TBL_LABEL, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_slot_1_label_slot_name), 2, 107, 18, 11, 152, 1, 223, 1 },  // ams_screen_ams_panel_ams_c_slot_1_label_slot_name
+    { UI_TBL_IMAGE, 137, UI_TBL_SLOT(ams_screen_ams_panel_ams_c_icon_temperature), 155, -17, 21, 14, 153, 1, 224, 2 },  // ams_screen_ams_panel_ams_c_icon_temperature
+};
+
+static const ui_tbl_style_ref_t ams_overview_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_4, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_5, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_17, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_19, LV_PART_MAIN | LV_STATE_DISABLED },
+    { &style_18, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_32, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_36, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_37, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_38, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_36, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_37, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_38, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_43, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_43, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_36, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_37, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_38, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_33, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_35, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_36, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_37, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_38, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_34, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_40, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_8, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_41, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_42, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t ams_overview_ops[] = {
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_DEFAULT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LED_COLOR, (int32_t)(0xfaaa05), (int32_t)(0), NULL },
+    { UI_TBL_OP_LED_BRIGHTNESS, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_home },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(100), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Home" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_encoding },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(100), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Encode" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_settings },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(110), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Settings" },
+    { UI_TBL_OP_ADD_STATE, (int32_t)(LV_STATE_DISABLED), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_catalog },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(100), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Catalog" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS Units" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS D" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D3" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D4" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D1" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A3" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A4" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A1" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "85%" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "85%" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "EXT-1" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "<empty>" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_circle_empty },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(25), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "EXT-2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "<empty>" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_circle_empty },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(25), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B1" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B3" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B4" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "AMS C" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_humidity },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(60), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(400), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C2" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C3" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C4" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C1" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_thermometer },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(95), (int32_t)(0), NULL },
+};
+
+const ui_screen_table_t ui_screen_table_ams_overview = {
+    "ams_overview",
+    ams_overview_nodes,
+    sizeof(ams_overview_nodes) / sizeof(ams_overview_nodes[0]),
+    ams_overview_styles,
+    ams_overview_ops,
+};
+
+// =============================================================================
+// scan_result (72 objects)
+// =============================================================================
+
+static const ui_tbl_node_t scan_result_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(scan_result), 0, 0, 800, 480, 0, 1, 0, 0 },  // scan_result
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(scan_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 0 },  // scan_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(scan_screen_top_bar_icon_back), 5, 1, 48, 42, 2, 0, 0, 2 },  // scan_screen_top_bar_icon_back
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(scan_screen_top_bar_logo), 37, 1, 173, 43, 2, 0, 2, 3 },  // scan_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(scan_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 5, 2 },  // scan_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(scan_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 7, 1 },  // scan_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(scan_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 8, 2 },  // scan_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(scan_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 10, 1 },  // scan_screen_top_bar_label_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(scan_screen_main_panel), 25, 50, 751, 418, 4, 1, 11, 1 },  // scan_screen_main_panel
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(scan_screen_main_panel_top_panel), -3, -7, 706, 63, 5, 1, 12, 1 },  // scan_screen_main_panel_top_panel
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(scan_screen_main_panel_top_panel_label_message), 44, 11, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 6, 0, 13, 1 },  // scan_screen_main_panel_top_panel_label_message
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(scan_screen_main_panel_top_panel_label_status), 44, -8, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 6, 1, 14, 1 },  // scan_screen_main_panel_top_panel_label_status
+    { UI_TBL_IMAGE, 9, UI_TBL_SLOT(scan_screen_main_panel_top_panel_icon_ok), -9, -8, 38, 35, 7, 1, 15, 2 },  // scan_screen_main_panel_top_panel_icon_ok
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(scan_screen_main_panel_spool_panel), -3, 66, 706, 72, 8, 1, 17, 1 },  // scan_screen_main_panel_spool_panel
+    { UI_TBL_IMAGE, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_icon_spool), -7, -7, 32, 42, 9, 0, 18, 2 },  // scan_screen_main_panel_spool_panel_icon_spool
+    { UI_TBL_IMAGE, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_icon_spool_color), -7, -7, 32, 42, 9, 1, 20, 2 },  // scan_screen_main_panel_spool_panel_icon_spool_color
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_weight), 46, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 10, 1, 22, 1 },  // scan_screen_main_panel_spool_panel_label_weight
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_filament), 46, -11, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 11, 1, 23, 1 },  // scan_screen_main_panel_spool_panel_label_filament
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_filament_color), 46, 6, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 12, 1, 24, 1 },  // scan_screen_main_panel_spool_panel_label_filament_color
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_k_factor), 265, -11, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 13, 1, 25, 1 },  // scan_screen_main_panel_spool_panel_label_k_factor
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_k_factor_value), 266, 5, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 14, 1, 26, 1 },  // scan_screen_main_panel_spool_panel_label_k_factor_value
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_k_profile), 370, -11, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 15, 1, 27, 1 },  // scan_screen_main_panel_spool_panel_label_k_profile
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_k_profile_value), 371, 5, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 16, 1, 28, 1 },  // scan_screen_main_panel_spool_panel_label_k_profile_value
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(scan_screen_main_panel_spool_panel_label_weight_percentage), 93, 23, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 17, 1, 29, 1 },  // scan_screen_main_panel_spool_panel_label_weight_percentage
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(scan_screen_main_panel_ams_panel), -3, 150, 706, 178, 18, 1, 30, 1 },  // scan_screen_main_panel_ams_panel
+    { UI_TBL_LABEL, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_label), -9, -16, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 19, 0, 31, 1 },  // scan_screen_main_panel_ams_panel_label
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_a), 506, 3, 78, 64, 19, 1, 32, 1 },  // scan_screen_main_panel_ams_panel_ht_a
+    { UI_TBL_LABEL, 26, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_a_label_name), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 20, 1, 33, 1 },  // scan_screen_main_panel_ams_panel_ht_a_label_name
+    { UI_TBL_LABEL, 26, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_a_slot_color), 1, 2, 30, 30, 21, 1, 34, 1 },  // scan_screen_main_panel_ams_panel_ht_a_slot_color
+    { UI_TBL_LABEL, 26, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_a_indicator), 33, -15, 12, 12, 22, 1, 35, 1 },  // scan_screen_main_panel_ams_panel_ht_a_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a), -9, 3, 245, 65, 23, 1, 36, 1 },  // scan_screen_main_panel_ams_panel_ams_a
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_label_name), -11, -13, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 24, 1, 37, 1 },  // scan_screen_main_panel_ams_panel_ams_a_label_name
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_slot_1), 11, -13, 45, 45, 25, 1, 38, 1 },  // scan_screen_main_panel_ams_panel_ams_a_slot_1
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_slot_2), 64, -13, 45, 45, 26, 1, 39, 1 },  // scan_screen_main_panel_ams_panel_ams_a_slot_2
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_slot_3), 116, -13, 45, 45, 27, 1, 40, 1 },  // scan_screen_main_panel_ams_panel_ams_a_slot_3
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_slot_4), 169, -13, 45, 45, 28, 1, 41, 1 },  // scan_screen_main_panel_ams_panel_ams_a_slot_4
+    { UI_TBL_LABEL, 30, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_a_indicator), -12, 13, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 29, 1, 42, 1 },  // scan_screen_main_panel_ams_panel_ams_a_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b), 249, 2, 245, 65, 30, 1, 43, 1 },  // scan_screen_main_panel_ams_panel_ams_b
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_label_name), -11, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 31, 1, 44, 1 },  // scan_screen_main_panel_ams_panel_ams_b_label_name
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_slot_1), 11, -13, 45, 45, 32, 1, 45, 1 },  // scan_screen_main_panel_ams_panel_ams_b_slot_1
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_slot_2), 64, -13, 45, 45, 33, 1, 46, 1 },  // scan_screen_main_panel_ams_panel_ams_b_slot_2
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_slot_3), 116, -13, 45, 45, 34, 1, 47, 1 },  // scan_screen_main_panel_ams_panel_ams_b_slot_3
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_slot_4), 169, -13, 45, 45, 35, 1, 48, 1 },  // scan_screen_main_panel_ams_panel_ams_b_slot_4
+    { UI_TBL_LABEL, 37, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_b_indicator), -13, 14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 36, 1, 49, 1 },  // scan_screen_main_panel_ams_panel_ams_b_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c), -9, 80, 245, 65, 37, 1, 50, 1 },  // scan_screen_main_panel_ams_panel_ams_c
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_label_name), -11, -13, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 38, 1, 51, 1 },  // scan_screen_main_panel_ams_panel_ams_c_label_name
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_slot_1), 11, -13, 45, 45, 39, 1, 52, 1 },  // scan_screen_main_panel_ams_panel_ams_c_slot_1
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_slot_2), 64, -13, 45, 45, 40, 1, 53, 1 },  // scan_screen_main_panel_ams_panel_ams_c_slot_2
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_slot_3), 116, -13, 45, 45, 41, 1, 54, 1 },  // scan_screen_main_panel_ams_panel_ams_c_slot_3
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_slot_4), 169, -13, 45, 45, 42, 1, 55, 1 },  // scan_screen_main_panel_ams_panel_ams_c_slot_4
+    { UI_TBL_LABEL, 44, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_c_indicator), -13, 14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 43, 1, 56, 1 },  // scan_screen_main_panel_ams_panel_ams_c_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d), 249, 80, 245, 65, 44, 1, 57, 1 },  // scan_screen_main_panel_ams_panel_ams_d
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_label_name), -11, -13, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 45, 1, 58, 1 },  // scan_screen_main_panel_ams_panel_ams_d_label_name
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_slot_1), 11, -13, 45, 45, 46, 1, 59, 1 },  // scan_screen_main_panel_ams_panel_ams_d_slot_1
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_slot_2), 64, -13, 45, 45, 47, 1, 60, 1 },  // scan_screen_main_panel_ams_panel_ams_d_slot_2
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_slot_3), 116, -13, 45, 45, 48, 1, 61, 1 },  // scan_screen_main_panel_ams_panel_ams_d_slot_3
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_slot_4), 169, -13, 45, 45, 49, 1, 62, 1 },  // scan_screen_main_panel_ams_panel_ams_d_slot_4
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ams_d_indicator), -11, 14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 50, 1, 63, 1 },  // scan_screen_main_panel_ams_panel_ams_d_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_b), 507, 80, 78, 64, 51, 1, 64, 1 },  // scan_screen_main_panel_ams_panel_ht_b
+    { UI_TBL_LABEL, 58, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_b_label_name), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 52, 1, 65, 1 },  // scan_screen_main_panel_ams_panel_ht_b_label_name
+    { UI_TBL_LABEL, 58, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_b_slot), 1, 2, 30, 30, 53, 1, 66, 1 },  // scan_screen_main_panel_ams_panel_ht_b_slot
+    { UI_TBL_LABEL, 58, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ht_b_indicator), 30, -15, 15, 12, 54, 1, 67, 1 },  // scan_screen_main_panel_ams_panel_ht_b_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_l), 594, 3, 78, 64, 55, 1, 68, 1 },  // scan_screen_main_panel_ams_panel_ext_l
+    { UI_TBL_LABEL, 62, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_l_label_name), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 56, 1, 69, 1 },  // scan_screen_main_panel_ams_panel_ext_l_label_name
+    { UI_TBL_LABEL, 62, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_l_slot), 1, 2, 30, 30, 57, 1, 70, 1 },  // scan_screen_main_panel_ams_panel_ext_l_slot
+    { UI_TBL_LABEL, 62, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_l_indicator), 33, -15, 12, 12, 58, 1, 71, 1 },  // scan_screen_main_panel_ams_panel_ext_l_indicator
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_r), 594, 80, 78, 64, 59, 1, 72, 1 },  // scan_screen_main_panel_ams_panel_ext_r
+    { UI_TBL_LABEL, 66, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_r_label_name), -14, -17, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 60, 1, 73, 1 },  // scan_screen_main_panel_ams_panel_ext_r_label_name
+    { UI_TBL_LABEL, 66, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_r_slot), 1, 2, 30, 30, 61, 1, 74, 1 },  // scan_screen_main_panel_ams_panel_ext_r_slot
+    { UI_TBL_LABEL, 66, UI_TBL_SLOT(scan_screen_main_panel_ams_panel_ext_r_indicator), 28, -15, 17, 12, 62, 1, 75, 1 },  // scan_screen_main_panel_ams_panel_ext_r_indicator
+    { UI_TBL_BUTTON, 8, UI_TBL_SLOT(scan_screen_button_assign_save), 2, 338, 706, 50, 63, 1, 76, 0 },  // scan_screen_button_assign_save
+    { UI_TBL_LABEL, 70, UI_TBL_SLOT(scan_screen_button_assign_save_label), 0, 0, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 64, 1, 76, 2 },  // scan_screen_button_assign_save_label
+};
+
+static const ui_tbl_style_ref_t scan_result_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_44, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_45, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_46, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_48, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_49, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_51, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_53, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_48, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_24, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_54, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_55, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_56, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_57, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_24, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_55, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_56, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_57, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_24, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_55, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_56, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_57, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_24, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_55, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_13, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_14, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_15, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_56, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_57, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_9, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_10, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_11, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_7, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_58, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_59, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t scan_result_ops[] = {
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "NFC tag read successfully" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Spool Detected" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_ok },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(255), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(300), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(300), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "K Factor" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "K Profile" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Assign to AMS slot" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "A" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "C" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "D" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "HT-B" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "EXT-L" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), " " },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "EXT-R" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "    " },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Assign & Save" },
+};
+
+const ui_screen_table_t ui_screen_table_scan_result = {
+    "scan_result",
+    scan_result_nodes,
+    sizeof(scan_result_nodes) / sizeof(scan_result_nodes[0]),
+    scan_result_styles,
+    scan_result_ops,
+};
+
+// =============================================================================
+// spool_details (46 objects)
+// =============================================================================
+
+static const ui_tbl_node_t spool_details_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(spool_details), 0, 0, 800, 480, 0, 1, 0, 0 },  // spool_details
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(spool_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 0 },  // spool_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(spool_screen_top_bar_icon_back), 5, 1, 48, 42, 2, 0, 0, 2 },  // spool_screen_top_bar_icon_back
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(spool_screen_top_bar_logo), 37, 1, 173, 43, 2, 0, 2, 3 },  // spool_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(spool_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 5, 2 },  // spool_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(spool_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 7, 1 },  // spool_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(spool_screen_top_bar_icon_notifiastion_bell), 662, 11, 24, 24, 3, 0, 8, 2 },  // spool_screen_top_bar_icon_notifiastion_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(spool_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 10, 1 },  // spool_screen_top_bar_label_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(spool_screen_main_panel), 29, 66, 751, 380, 4, 1, 11, 0 },  // spool_screen_main_panel
+    { UI_TBL_BUTTON, 8, UI_TBL_SLOT(spool_screen_main_panel_button_edit), 236, 295, 230, 50, 5, 1, 11, 0 },  // spool_screen_main_panel_button_edit
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(spool_screen_main_panel_button_edit_label), 0, 0, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 6, 1, 11, 2 },  // spool_screen_main_panel_button_edit_label
+    { UI_TBL_BUTTON, 8, UI_TBL_SLOT(spool_screen_main_panel_button_remove), 473, 295, 230, 50, 7, 1, 13, 0 },  // spool_screen_main_panel_button_remove
+    { UI_TBL_LABEL, 11, UI_TBL_SLOT(spool_screen_main_panel_button_remove_label), 0, 0, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 8, 1, 13, 2 },  // spool_screen_main_panel_button_remove_label
+    { UI_TBL_BUTTON, 8, UI_TBL_SLOT(spool_screen_main_panel_button_assign), -3, 295, 230, 50, 9, 1, 15, 0 },  // spool_screen_main_panel_button_assign
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(spool_screen_main_panel_button_assign_label), 0, 0, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 10, 1, 15, 2 },  // spool_screen_main_panel_button_assign_label
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(spool_screen_main_panel_middle_panel), -3, 66, 706, 77, 11, 1, 17, 1 },  // spool_screen_main_panel_middle_panel
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_name), -7, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 12, 1, 18, 1 },  // spool_screen_main_panel_middle_panel_label_name
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_nozzle), -8, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 13, 1, 19, 1 },  // spool_screen_main_panel_middle_panel_label_nozzle
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_bed), 103, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 14, 1, 20, 1 },  // spool_screen_main_panel_middle_panel_label_bed
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_speed), 195, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 15, 1, 21, 1 },  // spool_screen_main_panel_middle_panel_label_speed
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_nozzle_label), -7, 25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 16, 1, 22, 1 },  // spool_screen_main_panel_middle_panel_label_nozzle_label
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_bed_value), 103, 25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 17, 1, 23, 1 },  // spool_screen_main_panel_middle_panel_label_bed_value
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_speed_value), 195, 25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 18, 1, 24, 1 },  // spool_screen_main_panel_middle_panel_label_speed_value
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_k_profile), 318, 9, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 19, 1, 25, 1 },  // spool_screen_main_panel_middle_panel_label_k_profile
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(spool_screen_main_panel_middle_panel_label_k_profile_value), 319, 25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 20, 1, 26, 1 },  // spool_screen_main_panel_middle_panel_label_k_profile_value
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(spool_screen_main_panel_top), -3, -9, 706, 66, 21, 1, 27, 1 },  // spool_screen_main_panel_top
+    { UI_TBL_IMAGE, 25, UI_TBL_SLOT(spool_screen_main_panel_top_icon_spool), -8, -10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 22, 0, 28, 1 },  // spool_screen_main_panel_top_icon_spool
+    { UI_TBL_IMAGE, 25, UI_TBL_SLOT(spool_screen_main_panel_top_icon_spool_color), -8, -10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 22, 1, 29, 1 },  // spool_screen_main_panel_top_icon_spool_color
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(spool_screen_main_panel_top_label_weight), 38, -10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 23, 1, 30, 1 },  // spool_screen_main_panel_top_label_weight
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(spool_screen_main_panel_top_label_spool_material), 186, -10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 24, 1, 31, 1 },  // spool_screen_main_panel_top_label_spool_material
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(spool_screen_main_panel_top_label_color), 99, 16, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 25, 1, 32, 1 },  // spool_screen_main_panel_top_label_color
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(spool_screen_main_panel_top_label_spool_vendor), 99, -10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 26, 1, 33, 1 },  // spool_screen_main_panel_top_label_spool_vendor
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(spool_screen_main_panel_top_label_spool_fill_level), 38, 16, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 27, 1, 34, 1 },  // spool_screen_main_panel_top_label_spool_fill_level
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(spool_screen_main_panel_bottom), -3, 154, 706, 130, 28, 1, 35, 1 },  // spool_screen_main_panel_bottom
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_name), -8, -14, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 29, 1, 36, 1 },  // spool_screen_main_panel_bottom_label_name
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_tag_id), -8, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 30, 1, 37, 1 },  // spool_screen_main_panel_bottom_label_tag_id
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_weight), 180, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 31, 1, 38, 1 },  // spool_screen_main_panel_bottom_label_weight
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_used), 180, 54, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 32, 1, 39, 1 },  // spool_screen_main_panel_bottom_label_used
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_last_weighed), 439, 7, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 33, 1, 40, 1 },  // spool_screen_main_panel_bottom_label_last_weighed
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_added), -7, 56, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 34, 1, 41, 1 },  // spool_screen_main_panel_bottom_label_added
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_tag_value), -8, 27, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 35, 1, 42, 1 },  // spool_screen_main_panel_bottom_label_tag_value
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_weight_value), 180, 27, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 36, 1, 43, 1 },  // spool_screen_main_panel_bottom_label_weight_value
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_used_value), 180, 74, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 37, 1, 44, 1 },  // spool_screen_main_panel_bottom_label_used_value
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_last_weighed_value), 439, 27, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 38, 1, 45, 1 },  // spool_screen_main_panel_bottom_label_last_weighed_value
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_added_value), -7, 74, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 39, 1, 46, 1 },  // spool_screen_main_panel_bottom_label_added_value
+    { UI_TBL_LABEL, 33, UI_TBL_SLOT(spool_screen_main_panel_bottom_label_used_value_percentage), 221, 74, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 40, 1, 47, 1 },  // spool_screen_main_panel_bottom_label_used_value_percentage
+};
+
+static const ui_tbl_style_ref_t spool_details_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_44, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_60, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_59, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_61, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_59, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_60, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_59, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_62, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_62, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_39, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_49, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_51, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_53, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_63, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_52, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_50, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_53, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t spool_details_ops[] = {
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Edit" },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Remove" },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Assign Slot" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Print Settings" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Nozzle" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Bed" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Max. Speed" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "K Profile" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_clean },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spool_fill },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Spool Information" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Tag ID" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Initial Weight" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Used" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Last Weighed" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Added" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+};
+
+const ui_screen_table_t ui_screen_table_spool_details = {
+    "spool_details",
+    spool_details_nodes,
+    sizeof(spool_details_nodes) / sizeof(spool_details_nodes[0]),
+    spool_details_styles,
+    spool_details_ops,
+};
+
+// =============================================================================
+// settings_screen (64 objects)
+// =============================================================================
+
+static const ui_tbl_node_t settings_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(settings_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // settings_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_top_bar_), 0, 0, 800, 44, 1, 1, 0, 1 },  // settings_screen_top_bar_
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_screen_top_bar_logo), 55, 1, 173, 43, 2, 0, 1, 3 },  // settings_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(settings_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 4, 2 },  // settings_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 6, 1 },  // settings_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 7, 2 },  // settings_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(settings_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 9, 1 },  // settings_screen_top_bar_label_clock
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_network_screen_top_bar_icon_back), 5, 1, 48, 42, 4, 0, 10, 2 },  // settings_network_screen_top_bar_icon_back
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_tabs), 0, 44, 800, 40, 4, 1, 12, 1 },  // settings_screen_tabs
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_screen_tabs_network), 0, 0, 200, 40, 5, 1, 13, 1 },  // settings_screen_tabs_network
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_screen_tabs_network_label), 60, 10, 80, 20, 6, 1, 14, 3 },  // settings_screen_tabs_network_label
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_screen_tabs_printers), 200, 0, 200, 40, 7, 1, 17, 1 },  // settings_screen_tabs_printers
+    { UI_TBL_LABEL, 11, UI_TBL_SLOT(settings_screen_tabs_printers_label), 60, 10, 80, 20, 8, 1, 18, 3 },  // settings_screen_tabs_printers_label
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_screen_tabs_hardware), 400, 0, 200, 40, 9, 1, 21, 1 },  // settings_screen_tabs_hardware
+    { UI_TBL_LABEL, 13, UI_TBL_SLOT(settings_screen_tabs_hardware_label), 60, 10, 80, 20, 10, 1, 22, 3 },  // settings_screen_tabs_hardware_label
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_screen_tabs_system), 600, 0, 200, 40, 11, 1, 25, 1 },  // settings_screen_tabs_system
+    { UI_TBL_LABEL, 15, UI_TBL_SLOT(settings_screen_tabs_system_label), 60, 10, 80, 20, 12, 1, 26, 3 },  // settings_screen_tabs_system_label
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_tabs_network_content), 0, 84, 800, 396, 13, 1, 29, 1 },  // settings_screen_tabs_network_content
+    { UI_TBL_OBJ, 17, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi), 15, 10, 770, 50, 14, 1, 30, 1 },  // settings_screen_tabs_network_content_wifi
+    { UI_TBL_LABEL, 18, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi_label_name), 45, 15, 200, 20, 15, 1, 31, 3 },  // settings_screen_tabs_network_content_wifi_label_name
+    { UI_TBL_LABEL, 18, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi_label_ssid), 550, 7, 150, 20, 16, 1, 34, 3 },  // settings_screen_tabs_network_content_wifi_label_ssid
+    { UI_TBL_LABEL, 18, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi_icon_select), 725, 15, 20, 24, 17, 1, 37, 3 },  // settings_screen_tabs_network_content_wifi_icon_select
+    { UI_TBL_IMAGE, 18, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi_icon_wifi), -23, -9, 70, 69, 18, 1, 40, 2 },  // settings_screen_tabs_network_content_wifi_icon_wifi
+    { UI_TBL_LABEL, 18, UI_TBL_SLOT(settings_screen_tabs_network_content_wifi_label_ip_address), 550, 27, 150, 20, 19, 1, 42, 3 },  // settings_screen_tabs_network_content_wifi_label_ip_address
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_tabs_printers_content), 0, 84, 800, 396, 20, 1, 45, 1 },  // settings_screen_tabs_printers_content
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(settings_screen_tabs_printers_content_add_printer), 15, 10, 770, 50, 21, 1, 46, 1 },  // settings_screen_tabs_printers_content_add_printer
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(settings_screen_tabs_printers_content_add_printer_label), 45, 15, 200, 20, 22, 1, 47, 3 },  // settings_screen_tabs_printers_content_add_printer_label
+    { UI_TBL_LABEL, 25, UI_TBL_SLOT(settings_screen_tabs_printers_content_add_printer_label_select), 725, 15, 20, 24, 23, 1, 50, 3 },  // settings_screen_tabs_printers_content_add_printer_label_select
+    { UI_TBL_IMAGE, 25, UI_TBL_SLOT(settings_screen_tabs_printers_content_add_printer_icon_add), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 24, 1, 53, 2 },  // settings_screen_tabs_printers_content_add_printer_icon_add
+    { UI_TBL_OBJ, 24, UI_TBL_SLOT(settings_screen_tabs_printers_content_printer_1), 15, 70, 770, 50, 25, 1, 55, 1 },  // settings_screen_tabs_printers_content_printer_1
+    { UI_TBL_LABEL, 29, UI_TBL_SLOT(settings_screen_tabs_printers_content_printer_1_label), 45, 16, 200, 20, 26, 1, 56, 3 },  // settings_screen_tabs_printers_content_printer_1_label
+    { UI_TBL_LABEL, 29, UI_TBL_SLOT(settings_screen_tabs_printers_content_printer_1_label_online), 641, 17, 67, 20, 27, 1, 59, 3 },  // settings_screen_tabs_printers_content_printer_1_label_online
+    { UI_TBL_LABEL, 29, UI_TBL_SLOT(settings_screen_tabs_printers_content_printer_1_label_select), 725, 15, 20, 24, 28, 1, 62, 3 },  // settings_screen_tabs_printers_content_printer_1_label_select
+    { UI_TBL_IMAGE, 29, UI_TBL_SLOT(settings_screen_tabs_printers_content_printer_1_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 29, 1, 65, 2 },  // settings_screen_tabs_printers_content_printer_1_icon
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_tabs_hardware_content), 0, 84, 800, 396, 30, 1, 67, 1 },  // settings_screen_tabs_hardware_content
+    { UI_TBL_OBJ, 34, UI_TBL_SLOT(settings_screen_tabs_hardware_content_nfc), 15, 10, 770, 50, 31, 1, 68, 1 },  // settings_screen_tabs_hardware_content_nfc
+    { UI_TBL_LABEL, 35, UI_TBL_SLOT(settings_screen_tabs_hardware_content_nfc_label), 45, 15, 200, 20, 32, 1, 69, 3 },  // settings_screen_tabs_hardware_content_nfc_label
+    { UI_TBL_LABEL, 35, UI_TBL_SLOT(settings_screen_tabs_hardware_content_nfc_label_type), 550, 15, 150, 20, 33, 1, 72, 3 },  // settings_screen_tabs_hardware_content_nfc_label_type
+    { UI_TBL_LABEL, 35, UI_TBL_SLOT(settings_screen_tabs_hardware_content_nfc_label_select), 725, 15, 20, 24, 34, 1, 75, 3 },  // settings_screen_tabs_hardware_content_nfc_label_select
+    { UI_TBL_IMAGE, 35, UI_TBL_SLOT(settings_screen_tabs_hardware_content_nfc_icon_nfc), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 35, 1, 78, 2 },  // settings_screen_tabs_hardware_content_nfc_icon_nfc
+    { UI_TBL_OBJ, 34, UI_TBL_SLOT(settings_screen_tabs_hardware_content_scale), 15, 70, 770, 50, 36, 1, 80, 1 },  // settings_screen_tabs_hardware_content_scale
+    { UI_TBL_LABEL, 40, UI_TBL_SLOT(settings_screen_tabs_hardware_content_scale_label), 45, 15, 200, 20, 37, 1, 81, 3 },  // settings_screen_tabs_hardware_content_scale_label
+    { UI_TBL_LABEL, 40, UI_TBL_SLOT(settings_screen_tabs_hardware_content_scale_label_type), 550, 15, 150, 20, 38, 1, 84, 3 },  // settings_screen_tabs_hardware_content_scale_label_type
+    { UI_TBL_LABEL, 40, UI_TBL_SLOT(settings_screen_tabs_hardware_content_scale_label_select), 725, 15, 20, 24, 39, 1, 87, 3 },  // settings_screen_tabs_hardware_content_scale_label_select
+    { UI_TBL_IMAGE, 40, UI_TBL_SLOT(settings_screen_tabs_hardware_content_scale_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 40, 1, 90, 2 },  // settings_screen_tabs_hardware_content_scale_icon
+    { UI_TBL_OBJ, 34, UI_TBL_SLOT(settings_screen_tabs_display_content), 15, 130, 770, 50, 41, 1, 92, 1 },  // settings_screen_tabs_display_content
+    { UI_TBL_LABEL, 45, UI_TBL_SLOT(settings_screen_tabs_display_content_label), 45, 15, 200, 20, 42, 1, 93, 3 },  // settings_screen_tabs_display_content_label
+    { UI_TBL_LABEL, 45, UI_TBL_SLOT(settings_screen_tabs_display_content_label_resolution), 550, 15, 150, 20, 43, 1, 96, 3 },  // settings_screen_tabs_display_content_label_resolution
+    { UI_TBL_LABEL, 45, UI_TBL_SLOT(settings_screen_tabs_display_content_label_select), 725, 15, 20, 24, 44, 1, 99, 3 },  // settings_screen_tabs_display_content_label_select
+    { UI_TBL_IMAGE, 45, UI_TBL_SLOT(settings_screen_tabs_display_content_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 45, 1, 102, 2 },  // settings_screen_tabs_display_content_icon
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_screen_tabs_system_content), 0, 84, 800, 396, 46, 1, 104, 1 },  // settings_screen_tabs_system_content
+    { UI_TBL_OBJ, 50, UI_TBL_SLOT(settings_screen_tabs_system_content_firmware), 15, 10, 770, 50, 47, 1, 105, 1 },  // settings_screen_tabs_system_content_firmware
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(settings_screen_tabs_system_content_firmware_label), 37, 15, 200, 20, 48, 1, 106, 3 },  // settings_screen_tabs_system_content_firmware_label
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(settings_screen_tabs_system_content_firmware_label_version), 602, 17, 79, 20, 49, 1, 109, 3 },  // settings_screen_tabs_system_content_firmware_label_version
+    { UI_TBL_LABEL, 51, UI_TBL_SLOT(settings_screen_tabs_system_content_firmware_label_select), 715, 15, 20, 24, 50, 1, 112, 3 },  // settings_screen_tabs_system_content_firmware_label_select
+    { UI_TBL_IMAGE, 51, UI_TBL_SLOT(settings_screen_tabs_system_content_firmware_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 51, 1, 115, 2 },  // settings_screen_tabs_system_content_firmware_icon
+    { UI_TBL_OBJ, 50, UI_TBL_SLOT(settings_screen_tabs_system_content_reset), 15, 70, 770, 50, 52, 1, 117, 1 },  // settings_screen_tabs_system_content_reset
+    { UI_TBL_LABEL, 56, UI_TBL_SLOT(settings_screen_tabs_system_content_reset_label), 37, 15, 200, 20, 53, 1, 118, 3 },  // settings_screen_tabs_system_content_reset_label
+    { UI_TBL_LABEL, 56, UI_TBL_SLOT(settings_screen_tabs_system_content_reset_label_select), 715, 15, 20, 24, 54, 1, 121, 3 },  // settings_screen_tabs_system_content_reset_label_select
+    { UI_TBL_IMAGE, 56, UI_TBL_SLOT(settings_screen_tabs_system_content_reset_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 55, 1, 124, 2 },  // settings_screen_tabs_system_content_reset_icon
+    { UI_TBL_OBJ, 50, UI_TBL_SLOT(settings_screen_tabs_about_content), 15, 130, 770, 50, 56, 1, 126, 1 },  // settings_screen_tabs_about_content
+    { UI_TBL_LABEL, 60, UI_TBL_SLOT(settings_screen_tabs_about_content_label), 37, 15, 200, 20, 57, 1, 127, 3 },  // settings_screen_tabs_about_content_label
+    { UI_TBL_LABEL, 60, UI_TBL_SLOT(settings_screen_tabs_about_content_label_select), 715, 15, 20, 24, 58, 1, 130, 3 },  // settings_screen_tabs_about_content_label_select
+    { UI_TBL_IMAGE, 60, UI_TBL_SLOT(settings_screen_tabs_about_content_icon), -38, -25, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 59, 1, 133, 2 },  // settings_screen_tabs_about_content_icon
+};
+
+static const ui_tbl_style_ref_t settings_screen_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_64, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_65, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_66, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_67, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_67, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_67, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_68, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_70, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_71, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_72, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_47, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t settings_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Network" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Printers" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Hardware" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "System" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "WiFi Network" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "SpoolBuddy_5G" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_wifi },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(20), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "192.168.1.42" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Add Printer" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_add },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "H2D-1" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Online" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_3d_cube },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "NFC Reader" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "PN5180" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_nfc },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(75), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Scale" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "NAU7802" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_scale_2 },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(75), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Display" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "7.0\" 800x480" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_display },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(75), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Firmware Version" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_firmware },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Factory Reset" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_reset },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "About" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), ">" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_about },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+};
+
+const ui_screen_table_t ui_screen_table_settings_screen = {
+    "settings_screen",
+    settings_screen_nodes,
+    sizeof(settings_screen_nodes) / sizeof(settings_screen_nodes[0]),
+    settings_screen_styles,
+    settings_screen_ops,
+};
+
+// =============================================================================
+// settings_wifi_screen (20 objects)
+// =============================================================================
+
+static const ui_tbl_node_t settings_wifi_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(settings_wifi_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // settings_wifi_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_wifi_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 1 },  // settings_wifi_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_logo), 44, 1, 173, 43, 2, 0, 1, 3 },  // settings_wifi_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 4, 2 },  // settings_wifi_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 6, 1 },  // settings_wifi_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 7, 2 },  // settings_wifi_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 9, 1 },  // settings_wifi_screen_top_bar_label_clock
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_wifi_screen_top_bar_icon_back), 5, 1, 48, 42, 4, 0, 10, 2 },  // settings_wifi_screen_top_bar_icon_back
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_wifi_screen_content_), 0, 44, 800, 436, 4, 1, 12, 1 },  // settings_wifi_screen_content_
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_wifi_screen_content_panel_), 0, 10, 765, 343, 5, 1, 13, 1 },  // settings_wifi_screen_content_panel_
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_label_wifi), 16, -7, 300, 30, 6, 1, 14, 3 },  // settings_wifi_screen_content_panel_label_wifi
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_label_ssid), 16, 24, 100, 25, 7, 0, 17, 3 },  // settings_wifi_screen_content_panel_label_ssid
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_input_ssid), 16, 54, 400, 42, 7, 1, 20, 5 },  // settings_wifi_screen_content_panel_input_ssid
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_label_password), 16, 114, 100, 25, 8, 0, 25, 3 },  // settings_wifi_screen_content_panel_label_password
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_input_password), 16, 144, 400, 42, 8, 1, 28, 5 },  // settings_wifi_screen_content_panel_input_password
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_label_status), 16, 214, 300, 25, 9, 0, 33, 3 },  // settings_wifi_screen_content_panel_label_status
+    { UI_TBL_BUTTON, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_button_connect_), 213, 250, 150, 50, 9, 1, 36, 1 },  // settings_wifi_screen_content_panel_button_connect_
+    { UI_TBL_LABEL, 16, UI_TBL_SLOT(settings_wifi_screen_content_panel_button_connect_label), -1, 1, 68, 18, 10, 0, 37, 4 },  // settings_wifi_screen_content_panel_button_connect_label
+    { UI_TBL_BUTTON, 9, UI_TBL_SLOT(settings_wifi_screen_content_panel_button_scan_), 16, 250, 180, 50, 10, 1, 41, 1 },  // settings_wifi_screen_content_panel_button_scan_
+    { UI_TBL_LABEL, 18, UI_TBL_SLOT(settings_wifi_screen_content_panel_button_scan_label), 11, 6, 118, 16, 11, 0, 42, 3 },  // settings_wifi_screen_content_panel_button_scan_label
+};
+
+static const ui_tbl_style_ref_t settings_wifi_screen_styles[] = {
+    { &style_73, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_74, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_75, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_76, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_76, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_77, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_77, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t settings_wifi_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "WiFi Network" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "SSID" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "Enter network name" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Password" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "Enter password" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Status: Connected" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_CENTER), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Connect" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Scan Networks" },
+};
+
+const ui_screen_table_t ui_screen_table_settings_wifi_screen = {
+    "settings_wifi_screen",
+    settings_wifi_screen_nodes,
+    sizeof(settings_wifi_screen_nodes) / sizeof(settings_wifi_screen_nodes[0]),
+    settings_wifi_screen_styles,
+    settings_wifi_screen_ops,
+};
+
+// =============================================================================
+// settings_printer_add_screen (23 objects)
+// =============================================================================
+
+static const ui_tbl_node_t settings_printer_add_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(settings_printer_add_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // settings_printer_add_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_printer_add_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 1 },  // settings_printer_add_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_logo), 55, 1, 173, 43, 2, 0, 1, 3 },  // settings_printer_add_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 4, 2 },  // settings_printer_add_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 6, 1 },  // settings_printer_add_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 7, 2 },  // settings_printer_add_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 9, 1 },  // settings_printer_add_screen_top_bar_label_clock
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_printer_add_screen_top_bar_icon_back), 5, 1, 48, 42, 4, 0, 10, 2 },  // settings_printer_add_screen_top_bar_icon_back
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_printer_add_screen_panel), 0, 44, 800, 436, 4, 1, 12, 1 },  // settings_printer_add_screen_panel
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_printer_add_screen_panel_panel), 0, 10, 765, 339, 5, 1, 13, 1 },  // settings_printer_add_screen_panel_panel
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_label_add), 16, -6, 300, 30, 6, 1, 14, 3 },  // settings_printer_add_screen_panel_panel_label_add
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_label_name), 18, 69, 150, 25, 7, 0, 17, 3 },  // settings_printer_add_screen_panel_panel_label_name
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_input_name), 18, 94, 200, 42, 7, 1, 20, 5 },  // settings_printer_add_screen_panel_panel_input_name
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_label_serial), 18, 158, 150, 25, 8, 0, 25, 3 },  // settings_printer_add_screen_panel_panel_label_serial
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_input_serial), 18, 184, 200, 42, 8, 1, 28, 5 },  // settings_printer_add_screen_panel_panel_input_serial
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_label_code), 243, 158, 150, 25, 9, 0, 33, 3 },  // settings_printer_add_screen_panel_panel_label_code
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_input_code), 243, 184, 197, 42, 9, 1, 36, 5 },  // settings_printer_add_screen_panel_panel_input_code
+    { UI_TBL_BUTTON, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_button_add), 18, 247, 180, 50, 10, 1, 41, 1 },  // settings_printer_add_screen_panel_panel_button_add
+    { UI_TBL_LABEL, 17, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_button_add_label), 27, 6, 87, 16, 11, 0, 42, 3 },  // settings_printer_add_screen_panel_panel_button_add_label
+    { UI_TBL_BUTTON, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_button_scan), 16, 24, 100, 30, 11, 1, 45, 1 },  // settings_printer_add_screen_panel_panel_button_scan
+    { UI_TBL_LABEL, 19, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_button_scan_label), -4, -3, 71, 13, 12, 0, 46, 3 },  // settings_printer_add_screen_panel_panel_button_scan_label
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_label_ip_address), 243, 69, 150, 25, 12, 0, 49, 3 },  // settings_printer_add_screen_panel_panel_label_ip_address
+    { UI_TBL_TEXTAREA, 9, UI_TBL_SLOT(settings_printer_add_screen_panel_panel_input_ip_address), 243, 94, 200, 42, 12, 1, 52, 5 },  // settings_printer_add_screen_panel_panel_input_ip_address
+};
+
+static const ui_tbl_style_ref_t settings_printer_add_screen_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_74, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_75, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_78, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_78, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_78, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_58, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_58, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_78, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t settings_printer_add_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Add Printer" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Printer Name" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "e.g. X1C-1" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Serial Number" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "Enter serial number" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Access Code" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "8-digit code" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Add Printer" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Discover" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "IP Address" },
+    { UI_TBL_OP_TEXTAREA_MAX_LENGTH, (int32_t)(128), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PLACEHOLDER, (int32_t)(0), (int32_t)(0), "e.g. 192.168.1.100" },
+    { UI_TBL_OP_TEXTAREA_ONE_LINE, (int32_t)(true), (int32_t)(0), NULL },
+    { UI_TBL_OP_TEXTAREA_PASSWORD, (int32_t)(false), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+};
+
+const ui_screen_table_t ui_screen_table_settings_printer_add_screen = {
+    "settings_printer_add_screen",
+    settings_printer_add_screen_nodes,
+    sizeof(settings_printer_add_screen_nodes) / sizeof(settings_printer_add_screen_nodes[0]),
+    settings_printer_add_screen_styles,
+    settings_printer_add_screen_ops,
+};
+
+// =============================================================================
+// settings_display_screen (19 objects)
+// =============================================================================
+
+static const ui_tbl_node_t settings_display_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(settings_display_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // settings_display_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_display_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 1 },  // settings_display_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_display_screen_top_bar_icon_back), 5, 1, 48, 42, 2, 0, 1, 2 },  // settings_display_screen_top_bar_icon_back
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_display_screen_top_bar_logo), 55, 1, 173, 43, 2, 0, 3, 3 },  // settings_display_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(settings_display_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 6, 2 },  // settings_display_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_display_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 8, 1 },  // settings_display_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_display_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 9, 2 },  // settings_display_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(settings_display_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 11, 1 },  // settings_display_screen_top_bar_label_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_display_screen_content), 0, 44, 800, 436, 4, 1, 12, 1 },  // settings_display_screen_content
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_display_screen_content_panel), 0, 10, 765, 217, 5, 1, 13, 1 },  // settings_display_screen_content_panel
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label), 18, -7, 300, 30, 6, 1, 14, 3 },  // settings_display_screen_content_panel_label
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_resolution), 18, 32, 87, 25, 7, 0, 17, 3 },  // settings_display_screen_content_panel_label_resolution
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_panel), 18, 63, 87, 25, 7, 0, 20, 3 },  // settings_display_screen_content_panel_label_panel
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_brightness), 18, 94, 150, 25, 7, 0, 23, 3 },  // settings_display_screen_content_panel_label_brightness
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_timeout), 16, 139, 150, 25, 7, 0, 26, 3 },  // settings_display_screen_content_panel_label_timeout
+    { UI_TBL_SLIDER, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_brightness_slider), 18, 119, 150, 10, 7, 1, 29, 1 },  // settings_display_screen_content_panel_label_brightness_slider
+    { UI_TBL_SLIDER, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_timeout_slider), 16, 164, 150, 10, 8, 1, 30, 2 },  // settings_display_screen_content_panel_label_timeout_slider
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_resolution_value), 105, 32, 87, 25, 9, 0, 32, 3 },  // settings_display_screen_content_panel_label_resolution_value
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_display_screen_content_panel_label_panel_value), 105, 63, 87, 25, 9, 0, 35, 3 },  // settings_display_screen_content_panel_label_panel_value
+};
+
+static const ui_tbl_style_ref_t settings_display_screen_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_74, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_75, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_79, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_79, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t settings_display_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "H2D-1\nX1C-1\nX1C-2" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "10:23" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Display Settings" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Resolution:" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Panel:" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Brightness" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Screen Timeout" },
+    { UI_TBL_OP_SLIDER_VALUE, (int32_t)(25), (int32_t)(0), NULL },
+    { UI_TBL_OP_SLIDER_RANGE, (int32_t)(0), (int32_t)(900), NULL },
+    { UI_TBL_OP_SLIDER_VALUE, (int32_t)(300), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "" },
+};
+
+const ui_screen_table_t ui_screen_table_settings_display_screen = {
+    "settings_display_screen",
+    settings_display_screen_nodes,
+    sizeof(settings_display_screen_nodes) / sizeof(settings_display_screen_nodes[0]),
+    settings_display_screen_styles,
+    settings_display_screen_ops,
+};
+
+// =============================================================================
+// settings_update_screen (19 objects)
+// =============================================================================
+
+static const ui_tbl_node_t settings_update_screen_nodes[] = {
+    { UI_TBL_OBJ, -1, UI_TBL_SLOT(settings_update_screen), 0, 0, 800, 480, 0, 1, 0, 0 },  // settings_update_screen
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_update_screen_top_bar), 0, 0, 800, 44, 1, 1, 0, 1 },  // settings_update_screen_top_bar
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_update_screen_top_bar_icon_back), 5, 1, 48, 42, 2, 0, 1, 2 },  // settings_update_screen_top_bar_icon_back
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_update_screen_top_bar_logo), 55, 1, 173, 43, 2, 0, 3, 3 },  // settings_update_screen_top_bar_logo
+    { UI_TBL_DROPDOWN, 1, UI_TBL_SLOT(settings_update_screen_top_bar_printer_select), 325, 2, 150, 39, 2, 0, 6, 2 },  // settings_update_screen_top_bar_printer_select
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_update_screen_top_bar_icon_wifi_signal), 698, 10, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 2, 1, 8, 1 },  // settings_update_screen_top_bar_icon_wifi_signal
+    { UI_TBL_IMAGE, 1, UI_TBL_SLOT(settings_update_screen_top_bar_icon_notification_bell), 662, 11, 24, 24, 3, 0, 9, 2 },  // settings_update_screen_top_bar_icon_notification_bell
+    { UI_TBL_LABEL, 1, UI_TBL_SLOT(settings_update_screen_top_bar_label_clock), 737, 12, UI_TBL_SIZE_CONTENT, UI_TBL_SIZE_CONTENT, 3, 1, 11, 1 },  // settings_update_screen_top_bar_label_clock
+    { UI_TBL_OBJ, 0, UI_TBL_SLOT(settings_update_screen_top_bar_content), 0, 44, 800, 436, 4, 1, 12, 1 },  // settings_update_screen_top_bar_content
+    { UI_TBL_OBJ, 8, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel), 0, 10, 765, 232, 5, 1, 13, 1 },  // settings_update_screen_top_bar_content_panel
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label), 18, -9, 300, 30, 6, 0, 14, 3 },  // settings_update_screen_top_bar_content_panel_label
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_version), 18, 41, 136, 25, 6, 0, 17, 3 },  // settings_update_screen_top_bar_content_panel_label_version
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_latest), 18, 66, 136, 25, 6, 0, 20, 3 },  // settings_update_screen_top_bar_content_panel_label_latest
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_status), 18, 95, 138, 25, 6, 0, 23, 3 },  // settings_update_screen_top_bar_content_panel_label_status
+    { UI_TBL_BUTTON, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_button_check), 16, 136, 152, 50, 6, 1, 26, 1 },  // settings_update_screen_top_bar_content_panel_button_check
+    { UI_TBL_LABEL, 14, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_button_check_label), -14, 7, 140, 14, 7, 1, 27, 3 },  // settings_update_screen_top_bar_content_panel_button_check_label
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_version_value), 156, 41, 220, 25, 8, 0, 30, 3 },  // settings_update_screen_top_bar_content_panel_label_version_value
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_latest_value), 156, 66, 220, 25, 8, 0, 33, 3 },  // settings_update_screen_top_bar_content_panel_label_latest_value
+    { UI_TBL_LABEL, 9, UI_TBL_SLOT(settings_update_screen_top_bar_content_panel_label_status_value), 156, 95, 220, 25, 8, 0, 36, 3 },  // settings_update_screen_top_bar_content_panel_label_status_value
+};
+
+static const ui_tbl_style_ref_t settings_update_screen_styles[] = {
+    { &style_0, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_1, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_2, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_3, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_69, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_74, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_58, LV_PART_MAIN | LV_STATE_DEFAULT },
+    { &style_59, LV_PART_MAIN | LV_STATE_DEFAULT },
+};
+
+static const ui_tbl_op_t settings_update_screen_ops[] = {
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_back },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(80), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_spoolbuddy_logo_dark },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(200), (int32_t)(0), NULL },
+    { UI_TBL_OP_STYLE_ALIGN, (int32_t)(LV_ALIGN_TOP_LEFT), (int32_t)(LV_PART_MAIN | LV_STATE_DEFAULT), NULL },
+    { UI_TBL_OP_DROPDOWN_OPTIONS, (int32_t)(0), (int32_t)(0), "H2D-1\nX1C-1\nX1C-2" },
+    { UI_TBL_OP_DROPDOWN_SELECTED, (int32_t)(0), (int32_t)(0), NULL },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_signal },
+    { UI_TBL_OP_IMAGE_SRC, (int32_t)(0), (int32_t)(0), &img_bell },
+    { UI_TBL_OP_IMAGE_SCALE, (int32_t)(50), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "10:23" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_SCROLLABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Firmware Update" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Current Version:" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Latest Version:" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Status:" },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_ON_FOCUS|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Check for Updates" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "0.1b" },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Checking..." },
+    { UI_TBL_OP_LABEL_LONG_MODE, (int32_t)(LV_LABEL_LONG_WRAP), (int32_t)(0), NULL },
+    { UI_TBL_OP_CLEAR_FLAG, (int32_t)(LV_OBJ_FLAG_CLICK_FOCUSABLE|LV_OBJ_FLAG_GESTURE_BUBBLE|LV_OBJ_FLAG_PRESS_LOCK|LV_OBJ_FLAG_SCROLLABLE|LV_OBJ_FLAG_SCROLL_CHAIN_HOR|LV_OBJ_FLAG_SCROLL_CHAIN_VER|LV_OBJ_FLAG_SCROLL_ELASTIC|LV_OBJ_FLAG_SCROLL_MOMENTUM|LV_OBJ_FLAG_SCROLL_WITH_ARROW|LV_OBJ_FLAG_SNAPPABLE), (int32_t)(0), NULL },
+    { UI_TBL_OP_LABEL_TEXT, (int32_t)(0), (int32_t)(0), "Up to date" },
+};
+
+const ui_screen_table_t ui_screen_table_settings_update_screen = {
+    "settings_update_screen",
+    settings_update_screen_nodes,
+    sizeof(settings_update_screen_nodes) / sizeof(settings_update_screen_nodes[0]),
+    settings_update_screen_styles,
+    settings_update_screen_ops,
+};
+
+const ui_screen_table_t *ui_screen_table_get(enum ScreensEnum screen_id) {
+    switch (screen_id) {
+        case SCREEN_ID_MAIN_SCREEN: return &ui_screen_table_main_screen;
+        case SCREEN_ID_AMS_OVERVIEW: return &ui_screen_table_ams_overview;
+        case SCREEN_ID_SCAN_RESULT: return &ui_screen_table_scan_result;
+        case SCREEN_ID_SPOOL_DETAILS: return &ui_screen_table_spool_details;
+        case SCREEN_ID_SETTINGS_SCREEN: return &ui_screen_table_settings_screen;
+        case SCREEN_ID_SETTINGS_WIFI_SCREEN: return &ui_screen_table_settings_wifi_screen;
+        case SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN: return &ui_screen_table_settings_printer_add_screen;
+        case SCREEN_ID_SETTINGS_DISPLAY_SCREEN: return &ui_screen_table_settings_display_screen;
+        case SCREEN_ID_SETTINGS_UPDATE_SCREEN: return &ui_screen_table_settings_update_screen;
+        default: return NULL;
+    }
+}
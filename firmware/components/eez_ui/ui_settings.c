@@ -6,13 +6,137 @@
 
 #include "ui_internal.h"
 #include "screens.h"
+#ifdef UI_SCREEN_TABLES
+#include "ui_screen_table.h"
+#endif
 #include <string.h>
 
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+#define SETTINGS_TAB_COUNT 4
+
+// Hidden tabs are released when free heap drops below this
+#define SETTINGS_LOW_MEM_BYTES (32 * 1024)
+
+static void wire_content_rows(lv_obj_t *content);
+static void add_keyboard_row_to_hardware_tab(void);
+static lv_obj_t *keyboard_settings_row = NULL;
+
+// =============================================================================
+// Lazy Tab Construction
+// =============================================================================
+// With UI_SCREEN_TABLES the settings screen is created with empty tab
+// content containers; each tab's rows are built from the screen table the
+// first time it is selected. Without it the EEZ code builds every tab up
+// front and only the wiring is deferred.
+
+#ifdef UI_SCREEN_TABLES
+static const int16_t settings_tab_slots[SETTINGS_TAB_COUNT] = {
+    UI_TBL_SLOT(settings_screen_tabs_network_content),
+    UI_TBL_SLOT(settings_screen_tabs_printers_content),
+    UI_TBL_SLOT(settings_screen_tabs_hardware_content),
+    UI_TBL_SLOT(settings_screen_tabs_system_content),
+};
+#endif
+
+static bool settings_tab_ready[SETTINGS_TAB_COUNT] = {false};
+
+static lv_obj_t *settings_tab_content(int tab) {
+    lv_obj_t *contents[SETTINGS_TAB_COUNT] = {
+        objects.settings_screen_tabs_network_content,
+        objects.settings_screen_tabs_printers_content,
+        objects.settings_screen_tabs_hardware_content,
+        objects.settings_screen_tabs_system_content,
+    };
+    return contents[tab];
+}
+
+void create_settings_screen(void) {
+#ifdef UI_SCREEN_TABLES
+    const ui_screen_table_t *table = ui_screen_table_get(SCREEN_ID_SETTINGS_SCREEN);
+    if (table) {
+        ui_screen_table_create_deferred(table, settings_tab_slots, SETTINGS_TAB_COUNT);
+        return;
+    }
+#endif
+    create_screen_settings_screen();
+}
+
+#ifdef UI_SCREEN_TABLES
+static size_t settings_free_heap(void) {
+#ifdef ESP_PLATFORM
+    return heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size ? mon.free_size : SIZE_MAX;
+#endif
+}
+#endif
+
+// Build (if needed) and wire one tab's content
+static void settings_tab_ensure(int tab) {
+    if (settings_tab_ready[tab]) return;
+
+    lv_obj_t *content = settings_tab_content(tab);
+    if (!content) return;
+
+#ifdef UI_SCREEN_TABLES
+    // Without a table the EEZ code already built everything
+    if (lv_obj_get_child_count(content) == 0) {
+        ui_screen_table_create_children(ui_screen_table_get(SCREEN_ID_SETTINGS_SCREEN), settings_tab_slots[tab]);
+    }
+#endif
+
+    wire_content_rows(content);
+    switch (tab) {
+        case 0:
+            update_wifi_ui_state();
+            break;
+        case 1:
+            wire_printers_tab();
+            update_printers_list();
+            break;
+        case 2:
+            add_keyboard_row_to_hardware_tab();
+            break;
+        default:
+            break;
+    }
+    settings_tab_ready[tab] = true;
+}
+
+// Under memory pressure, drop the rows of hidden tabs (rebuilt on next selection)
+static void settings_release_hidden_tabs(int visible_tab) {
+#ifdef UI_SCREEN_TABLES
+    const ui_screen_table_t *table = ui_screen_table_get(SCREEN_ID_SETTINGS_SCREEN);
+    if (!table || settings_free_heap() >= SETTINGS_LOW_MEM_BYTES) return;
+
+    for (int i = 0; i < SETTINGS_TAB_COUNT; i++) {
+        if (i == visible_tab || !settings_tab_ready[i]) continue;
+        if (i == 1) ui_printer_cleanup();           // Dynamic printer rows live in the tab
+        if (i == 2) keyboard_settings_row = NULL;
+        ui_screen_table_release_children(table, settings_tab_slots[i]);
+        settings_tab_ready[i] = false;
+    }
+#else
+    // EEZ-built tabs can't be rebuilt, so they stay
+    (void)visible_tab;
+#endif
+}
+
 // =============================================================================
 // Tab Switching
 // =============================================================================
 
 void select_settings_tab(int tab_index) {
+    if (tab_index >= 0 && tab_index < SETTINGS_TAB_COUNT) {
+        settings_release_hidden_tabs(tab_index);
+        settings_tab_ensure(tab_index);
+    }
+
     // Tab button objects
     lv_obj_t *tabs[] = {
         objects.settings_screen_tabs_network,
@@ -122,11 +246,10 @@ static void settings_detail_back_handler(lv_event_t *e) {
 // Add Keyboard Row to Hardware Tab
 // =============================================================================
 
-static lv_obj_t *keyboard_settings_row = NULL;
-
-// Reset keyboard row pointer when screens are deleted
+// Reset tab state when screens are deleted
 void ui_settings_cleanup(void) {
     keyboard_settings_row = NULL;
+    memset(settings_tab_ready, 0, sizeof(settings_tab_ready));
 }
 
 // Direct click handler for keyboard row (avoids label search issues)
@@ -229,17 +352,10 @@ void wire_settings_buttons(void) {
         }
     }
 
-    // Wire menu rows in each tab content
-    wire_content_rows(objects.settings_screen_tabs_network_content);
-    wire_content_rows(objects.settings_screen_tabs_printers_content);
-    wire_content_rows(objects.settings_screen_tabs_hardware_content);
-    wire_content_rows(objects.settings_screen_tabs_system_content);
-
-    // Add keyboard row to hardware tab (not in EEZ design)
-    add_keyboard_row_to_hardware_tab();
-
-    // Initialize with first tab selected, hide others
-    select_settings_tab(0);
+    // Select the requested tab (first by default); only its content is built
+    // and wired here, the others on first selection
+    select_settings_tab(pending_settings_tab >= 0 ? pending_settings_tab : 0);
+    pending_settings_tab = -1;
 }
 
 void wire_settings_detail_buttons(void) {
@@ -0,0 +1,181 @@
+/**
+ * @file ui_slot_stripes.c
+ * @brief Lightweight widget that paints the color slots of one AMS unit
+ *
+ * See ui_slot_stripes.h.
+ */
+
+#include "ui_slot_stripes.h"
+#include <string.h>
+
+// Accent green color - matches progress bar (#00FF00)
+#define ACCENT_GREEN 0x00FF00
+
+#define SLOT_F_SET    0x01  // Slot has been assigned (unset slots are not drawn)
+#define SLOT_F_ACTIVE 0x02
+
+typedef struct {
+    lv_area_t area;      // Relative to the widget
+    uint32_t rgba;       // 0 = empty
+    uint8_t flags;
+} slot_state_t;
+
+typedef struct {
+    uint8_t mode;
+    slot_state_t slots[UI_SLOT_STRIPES_MAX];
+} stripes_state_t;
+
+// Stripe geometry per mode: first stripe's left end, spacing, rise across the slot
+typedef struct {
+    uint32_t color;
+    int16_t first_y;
+    int16_t spacing;
+    int16_t rise;
+} stripe_style_t;
+
+static const stripe_style_t stripe_styles[] = {
+    [UI_SLOT_STRIPES_SWATCH]  = { 0x3a3a3a, 6, 8, 1 },    // Near-flat bars on 23x24 swatches
+    [UI_SLOT_STRIPES_OVERLAY] = { 0x4a4a4a, 12, 12, 8 },  // Diagonals on 32x42 spool images
+};
+
+#define STRIPE_COUNT 3
+#define STRIPE_WIDTH 3
+
+static void slot_abs_area(lv_obj_t *obj, const slot_state_t *slot, lv_area_t *out) {
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_copy(out, &slot->area);
+    lv_area_move(out, coords.x1, coords.y1);
+}
+
+// Stripe positions are chosen so that every stripe lies inside the slot
+static void draw_stripes(lv_layer_t *layer, const lv_area_t *area, const stripe_style_t *style) {
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = lv_color_hex(style->color);
+    line.width = STRIPE_WIDTH;
+    line.opa = LV_OPA_COVER;
+
+    for (int i = 0; i < STRIPE_COUNT; i++) {
+        int32_t y = area->y1 + style->first_y + i * style->spacing;
+        if (y > area->y2 - STRIPE_WIDTH / 2) break;
+        line.p1.x = area->x1;
+        line.p1.y = y;
+        line.p2.x = area->x2;
+        line.p2.y = y - style->rise;
+        lv_draw_line(layer, &line);
+    }
+}
+
+static void draw_swatch(lv_layer_t *layer, const lv_area_t *area, const slot_state_t *slot) {
+    bool empty = (slot->rgba == 0);
+    bool active = (slot->flags & SLOT_F_ACTIVE) != 0;
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = 5;
+    rect.bg_opa = LV_OPA_COVER;
+    rect.bg_color = empty ? lv_color_hex(0x0a0a0a) : lv_color_hex(slot->rgba >> 8);
+    rect.border_width = 0;
+    lv_draw_rect(layer, &rect, area);
+
+    if (empty) {
+        draw_stripes(layer, area, &stripe_styles[UI_SLOT_STRIPES_SWATCH]);
+    }
+
+    // Border on top of the stripes
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = 5;
+    rect.bg_opa = LV_OPA_TRANSP;
+    rect.border_opa = LV_OPA_COVER;
+    rect.border_color = lv_color_hex(active ? ACCENT_GREEN : 0xbab1b1);
+    rect.border_width = active ? 3 : 2;
+    lv_draw_rect(layer, &rect, area);
+}
+
+static void stripes_draw_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    stripes_state_t *st = lv_obj_get_user_data(obj);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    if (!st || !layer) return;
+
+    for (int i = 0; i < UI_SLOT_STRIPES_MAX; i++) {
+        const slot_state_t *slot = &st->slots[i];
+        if (!(slot->flags & SLOT_F_SET)) continue;
+
+        lv_area_t area;
+        slot_abs_area(obj, slot, &area);
+        if (st->mode == UI_SLOT_STRIPES_SWATCH) {
+            draw_swatch(layer, &area, slot);
+        } else if (slot->rgba == 0) {
+            draw_stripes(layer, &area, &stripe_styles[UI_SLOT_STRIPES_OVERLAY]);
+        }
+    }
+}
+
+// Never the target of input, so slots underneath stay clickable
+static void stripes_hit_test_cb(lv_event_t *e) {
+    lv_hit_test_info_t *info = lv_event_get_param(e);
+    info->res = false;
+}
+
+static void stripes_delete_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_free(lv_obj_get_user_data(obj));
+    lv_obj_set_user_data(obj, NULL);
+}
+
+static void invalidate_slot(lv_obj_t *obj, const slot_state_t *slot) {
+    lv_area_t area;
+    slot_abs_area(obj, slot, &area);
+    lv_obj_invalidate_area(obj, &area);
+}
+
+lv_obj_t *ui_slot_stripes_create(lv_obj_t *parent, ui_slot_stripes_mode_t mode) {
+    stripes_state_t *st = lv_malloc(sizeof(stripes_state_t));
+    if (!st) return NULL;
+    memset(st, 0, sizeof(*st));
+    st->mode = (uint8_t)mode;
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
+    lv_obj_set_user_data(obj, st);
+
+    lv_obj_add_event_cb(obj, stripes_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, stripes_hit_test_cb, LV_EVENT_HIT_TEST, NULL);
+    lv_obj_add_event_cb(obj, stripes_delete_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+void ui_slot_stripes_set_geometry(lv_obj_t *obj, uint8_t slot, int32_t x, int32_t y, int32_t w, int32_t h) {
+    stripes_state_t *st = obj ? lv_obj_get_user_data(obj) : NULL;
+    if (!st || slot >= UI_SLOT_STRIPES_MAX) return;
+
+    slot_state_t *s = &st->slots[slot];
+    lv_area_t area = { x, y, x + w - 1, y + h - 1 };
+    if (lv_area_is_equal(&s->area, &area)) return;
+
+    if (s->flags & SLOT_F_SET) invalidate_slot(obj, s);
+    s->area = area;
+    if (s->flags & SLOT_F_SET) invalidate_slot(obj, s);
+}
+
+void ui_slot_stripes_set_slot(lv_obj_t *obj, uint8_t slot, uint32_t rgba, bool active) {
+    stripes_state_t *st = obj ? lv_obj_get_user_data(obj) : NULL;
+    if (!st || slot >= UI_SLOT_STRIPES_MAX) return;
+
+    slot_state_t *s = &st->slots[slot];
+    uint8_t flags = SLOT_F_SET | (active ? SLOT_F_ACTIVE : 0);
+    if (st->mode == UI_SLOT_STRIPES_OVERLAY) {
+        // Overlay only draws stripes; color and highlight come from the slot widget
+        rgba = rgba ? 1 : 0;
+        flags = SLOT_F_SET;
+    }
+    if (s->rgba == rgba && s->flags == flags) return;
+
+    s->rgba = rgba;
+    s->flags = flags;
+    invalidate_slot(obj, s);
+}
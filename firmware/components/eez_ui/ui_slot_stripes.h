@@ -0,0 +1,52 @@
+/**
+ * @file ui_slot_stripes.h
+ * @brief Lightweight widget that paints the color slots of one AMS unit
+ *
+ * One object per unit instead of an object per slot plus an object per
+ * empty-slot stripe. All slots are drawn from a packed color array in a
+ * single draw callback, and changing a slot only invalidates that slot.
+ *
+ * The widget is transparent to input: clicks go to whatever is below it.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#ifndef UI_SLOT_STRIPES_H
+#define UI_SLOT_STRIPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_SLOT_STRIPES_MAX 4
+
+typedef enum {
+    UI_SLOT_STRIPES_SWATCH = 0,  // Rounded color swatch per slot, striped when empty (main screen)
+    UI_SLOT_STRIPES_OVERLAY,     // Only the stripes of empty slots, over existing slot widgets (AMS overview)
+} ui_slot_stripes_mode_t;
+
+/**
+ * Create the widget. Position and size it to cover all of its slots.
+ */
+lv_obj_t *ui_slot_stripes_create(lv_obj_t *parent, ui_slot_stripes_mode_t mode);
+
+/**
+ * Set a slot's rectangle, relative to the widget.
+ */
+void ui_slot_stripes_set_geometry(lv_obj_t *obj, uint8_t slot, int32_t x, int32_t y, int32_t w, int32_t h);
+
+/**
+ * Set a slot's color (RGBA as reported by the backend, 0 = empty) and
+ * whether it is the active tray. Only redraws the slot if something changed.
+ */
+void ui_slot_stripes_set_slot(lv_obj_t *obj, uint8_t slot, uint32_t rgba, bool active);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_SLOT_STRIPES_H */
@@ -0,0 +1,264 @@
+/**
+ * @file ui_spool_gauge.c
+ * @brief Precomposed spool images (fill color + fill level + frame)
+ *
+ * See ui_spool_gauge.h.
+ */
+
+#include "ui_spool_gauge.h"
+#include "images.h"
+#include "ui_mem_arena.h"
+#include <string.h>
+
+// Color of the part of the fill window above the filament level
+#define GAUGE_EMPTY_COLOR 0x2a2a2a
+
+typedef struct {
+    lv_image_dsc_t dsc;   // Image source handed to LVGL - must stay first
+    uint32_t color;       // 0xRRGGBB
+    uint16_t w;
+    uint16_t h;
+    uint8_t level;        // 0..UI_SPOOL_GAUGE_LEVELS
+    uint16_t refs;        // Images currently showing this composition
+    uint32_t last_use;
+} gauge_entry_t;
+
+static gauge_entry_t *gauge_cache[UI_SPOOL_GAUGE_CACHE_SIZE];
+static uint32_t gauge_clock = 0;
+
+// Fill window rows (source coordinates), from img_spool_mask
+static int16_t window_top = -1;
+static int16_t window_bottom = -1;
+
+// =============================================================================
+// Composition
+// =============================================================================
+
+// Source images are ARGB8888 (B, G, R, A in memory)
+static inline const uint8_t *src_px(const lv_image_dsc_t *img, int x, int y) {
+    return img->data + y * img->header.stride + x * 4;
+}
+
+static void find_fill_window(void) {
+    if (window_top >= 0) return;
+    window_top = 0;
+    window_bottom = UI_SPOOL_GAUGE_SRC_H - 1;
+    bool found = false;
+    for (int y = 0; y < UI_SPOOL_GAUGE_SRC_H; y++) {
+        for (int x = 0; x < UI_SPOOL_GAUGE_SRC_W; x++) {
+            if (src_px(&img_spool_mask, x, y)[2] > 127) {
+                if (!found) window_top = y;
+                window_bottom = y;
+                found = true;
+                break;
+            }
+        }
+    }
+}
+
+static inline uint16_t to_rgb565(uint32_t r, uint32_t g, uint32_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+/**
+ * @brief Compose recolored fill, level and frame into e->dsc (RGB565A8)
+ * Nearest-neighbour sampling when w/h differ from the source size.
+ */
+static void gauge_compose(gauge_entry_t *e, uint8_t *data) {
+    find_fill_window();
+
+    uint32_t fr = (e->color >> 16) & 0xFF, fg = (e->color >> 8) & 0xFF, fb = e->color & 0xFF;
+    uint32_t er = (GAUGE_EMPTY_COLOR >> 16) & 0xFF, eg = (GAUGE_EMPTY_COLOR >> 8) & 0xFF, eb = GAUGE_EMPTY_COLOR & 0xFF;
+
+    // Rows of the window above level_y are empty
+    int window_h = window_bottom - window_top + 1;
+    int level_y = window_bottom + 1 - (window_h * e->level) / UI_SPOOL_GAUGE_LEVELS;
+
+    uint16_t *rgb = (uint16_t *)data;
+    uint8_t *alpha = data + (size_t)e->w * e->h * 2;
+
+    for (int y = 0; y < e->h; y++) {
+        int sy = y * UI_SPOOL_GAUGE_SRC_H / e->h;
+        for (int x = 0; x < e->w; x++) {
+            int sx = x * UI_SPOOL_GAUGE_SRC_W / e->w;
+            const uint8_t *fill = src_px(&img_spool_fill, sx, sy);
+            const uint8_t *frame = src_px(&img_spool_frame, sx, sy);
+            bool empty = sy < level_y && src_px(&img_spool_mask, sx, sy)[2] > 127;
+
+            // Fill layer (recolored like lv_image recolor at full opacity)
+            uint32_t a = fill[3];
+            uint32_t r = empty ? er : fr, g = empty ? eg : fg, b = empty ? eb : fb;
+
+            // Frame over fill
+            uint32_t fa = frame[3];
+            if (fa) {
+                uint32_t under = a * (255 - fa) / 255;
+                uint32_t out_a = fa + under;
+                r = (frame[2] * fa + r * under) / out_a;
+                g = (frame[1] * fa + g * under) / out_a;
+                b = (frame[0] * fa + b * under) / out_a;
+                a = out_a;
+            }
+
+            size_t i = (size_t)y * e->w + x;
+            rgb[i] = to_rgb565(r, g, b);
+            alpha[i] = (uint8_t)a;
+        }
+    }
+
+    e->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    e->dsc.header.cf = LV_COLOR_FORMAT_RGB565A8;
+    e->dsc.header.w = e->w;
+    e->dsc.header.h = e->h;
+    e->dsc.header.stride = e->w * 2;
+    e->dsc.data_size = (uint32_t)e->w * e->h * 3;
+    e->dsc.data = data;
+}
+
+// =============================================================================
+// Cache
+// =============================================================================
+
+static void gauge_entry_free(int index) {
+    gauge_entry_t *e = gauge_cache[index];
+    gauge_cache[index] = NULL;
+    if (!e) return;
+    lv_image_cache_drop(&e->dsc);
+    lv_free((void *)e->dsc.data);
+    lv_free(e);
+}
+
+static gauge_entry_t *gauge_acquire(uint32_t color, uint8_t level, uint16_t w, uint16_t h) {
+    int free_index = -1;
+    int lru_index = -1;
+
+    for (int i = 0; i < UI_SPOOL_GAUGE_CACHE_SIZE; i++) {
+        gauge_entry_t *e = gauge_cache[i];
+        if (!e) {
+            if (free_index < 0) free_index = i;
+            continue;
+        }
+        if (e->color == color && e->level == level && e->w == w && e->h == h) {
+            e->refs++;
+            e->last_use = ++gauge_clock;
+            return e;
+        }
+        if (e->refs == 0 && (lru_index < 0 || e->last_use < gauge_cache[lru_index]->last_use)) {
+            lru_index = i;
+        }
+    }
+
+    int index = free_index >= 0 ? free_index : lru_index;
+    if (index < 0) return NULL;  // Every composition is on screen
+    gauge_entry_free(index);
+
+    // Cached across screens, so keep it out of the screen's arena
+    ui_mem_arena_t *arena = ui_mem_arena_suspend();
+    gauge_entry_t *e = lv_malloc(sizeof(gauge_entry_t));
+    uint8_t *data = lv_malloc((size_t)w * h * 3);
+    ui_mem_arena_end(arena);
+    if (!e || !data) {
+        lv_free(e);
+        lv_free(data);
+        return NULL;
+    }
+    memset(e, 0, sizeof(*e));
+    e->color = color;
+    e->level = level;
+    e->w = w;
+    e->h = h;
+    gauge_compose(e, data);
+
+    e->refs = 1;
+    e->last_use = ++gauge_clock;
+    gauge_cache[index] = e;
+    return e;
+}
+
+static void gauge_release(gauge_entry_t *e) {
+    if (e && e->refs > 0) {
+        e->refs--;
+    }
+}
+
+// The image's reference is held by this callback's user_data, not by its
+// src, so it is released even if the src was replaced behind our back
+static void gauge_image_delete_cb(lv_event_t *e) {
+    gauge_release(lv_event_get_user_data(e));
+}
+
+// Composition an image holds a reference to, or NULL
+static gauge_entry_t *gauge_bound_entry(lv_obj_t *img) {
+    uint32_t count = lv_obj_get_event_count(img);
+    for (uint32_t i = 0; i < count; i++) {
+        lv_event_dsc_t *dsc = lv_obj_get_event_dsc(img, i);
+        if (lv_event_dsc_get_cb(dsc) == gauge_image_delete_cb) {
+            return lv_event_dsc_get_user_data(dsc);
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+bool ui_spool_gauge_set(lv_obj_t *img, uint32_t color_hex, int fill_pct, int32_t w, int32_t h) {
+    if (!img || w <= 0 || h <= 0) return false;
+
+    uint8_t level = UI_SPOOL_GAUGE_LEVELS;
+    if (fill_pct >= 0 && fill_pct <= 100) {
+        // Round to nearest step, but never show a non-empty spool as empty
+        level = (uint8_t)((fill_pct * UI_SPOOL_GAUGE_LEVELS + 50) / 100);
+        if (level == 0 && fill_pct > 0) level = 1;
+    }
+
+    gauge_entry_t *cur = gauge_bound_entry(img);
+    if (cur && lv_image_get_src(img) == &cur->dsc &&
+        cur->color == (color_hex & 0xFFFFFF) && cur->level == level && cur->w == w && cur->h == h) {
+        return true;
+    }
+
+    gauge_entry_t *entry = gauge_acquire(color_hex & 0xFFFFFF, level, (uint16_t)w, (uint16_t)h);
+    if (!entry) return false;
+
+    if (cur) {
+        lv_obj_remove_event_cb_with_user_data(img, gauge_image_delete_cb, cur);
+        gauge_release(cur);
+    }
+    lv_obj_add_event_cb(img, gauge_image_delete_cb, LV_EVENT_DELETE, entry);
+
+    // Composition already has the spool color - no recoloring at draw time
+    lv_obj_set_style_image_recolor_opa(img, 0, 0);
+    lv_image_set_src(img, &entry->dsc);
+    return true;
+}
+
+lv_obj_t *ui_spool_gauge_create(lv_obj_t *parent, uint32_t color_hex, int fill_pct, int32_t w, int32_t h) {
+    lv_obj_t *img = lv_image_create(parent);
+    lv_obj_set_size(img, w, h);
+    lv_obj_remove_flag(img, LV_OBJ_FLAG_SCROLLABLE);
+    ui_spool_gauge_set(img, color_hex, fill_pct, w, h);
+    return img;
+}
+
+void ui_spool_gauge_cache_trim(void) {
+    for (int i = 0; i < UI_SPOOL_GAUGE_CACHE_SIZE; i++) {
+        if (gauge_cache[i] && gauge_cache[i]->refs == 0) {
+            gauge_entry_free(i);
+        }
+    }
+}
+
+int ui_spool_gauge_cache_stats(size_t *bytes) {
+    int count = 0;
+    size_t total = 0;
+    for (int i = 0; i < UI_SPOOL_GAUGE_CACHE_SIZE; i++) {
+        if (gauge_cache[i]) {
+            count++;
+            total += gauge_cache[i]->dsc.data_size;
+        }
+    }
+    if (bytes) *bytes = total;
+    return count;
+}
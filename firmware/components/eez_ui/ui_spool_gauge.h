@@ -0,0 +1,75 @@
+/**
+ * @file ui_spool_gauge.h
+ * @brief Precomposed spool images (fill color + fill level + frame)
+ *
+ * The spool visual used to be two or three stacked lv_image objects (outline,
+ * recolored fill, ...), each blended - and usually scaled - on every redraw.
+ * A gauge composes img_spool_fill (recolored), the img_spool_mask fill window
+ * and img_spool_frame into one RGB565A8 image at the final size, so a spool
+ * is a single untransformed blit.
+ *
+ * Compositions are cached, keyed by color, fill level (quantized to
+ * UI_SPOOL_GAUGE_LEVELS steps) and size, and shared between all images
+ * showing the same spool state.
+ *
+ * This file is shared between firmware and simulator.
+ */
+
+#ifndef UI_SPOOL_GAUGE_H
+#define UI_SPOOL_GAUGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fill level steps (10 = 10% granularity)
+#define UI_SPOOL_GAUGE_LEVELS 10
+
+// Compositions kept around, including the ones currently shown
+#define UI_SPOOL_GAUGE_CACHE_SIZE 32
+
+// Size of the spool source images
+#define UI_SPOOL_GAUGE_SRC_W 32
+#define UI_SPOOL_GAUGE_SRC_H 42
+
+// Pass as fill level when it is not known (drawn full)
+#define UI_SPOOL_GAUGE_LEVEL_UNKNOWN -1
+
+/**
+ * Show a spool on an lv_image.
+ * @param img Any lv_image; its previous source is replaced. Once set, change
+ *            its source only through this function: the image keeps its
+ *            composition referenced until it is deleted or set again here,
+ *            so an lv_image_set_src() in between pins the old composition
+ * @param color_hex Filament color (0xRRGGBB)
+ * @param fill_pct Remaining filament 0-100, or UI_SPOOL_GAUGE_LEVEL_UNKNOWN
+ * @param w Width to compose at (UI_SPOOL_GAUGE_SRC_W = native)
+ * @param h Height to compose at
+ * @return false if the cache is full of images in use (image left unchanged)
+ */
+bool ui_spool_gauge_set(lv_obj_t *img, uint32_t color_hex, int fill_pct, int32_t w, int32_t h);
+
+/**
+ * Create an lv_image sized w x h showing a spool.
+ */
+lv_obj_t *ui_spool_gauge_create(lv_obj_t *parent, uint32_t color_hex, int fill_pct, int32_t w, int32_t h);
+
+/**
+ * Drop cached compositions no image is using (e.g. on low memory).
+ */
+void ui_spool_gauge_cache_trim(void);
+
+/**
+ * Number of compositions currently held, and their total pixel bytes.
+ */
+int ui_spool_gauge_cache_stats(size_t *bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_SPOOL_GAUGE_H */
@@ -5,6 +5,7 @@
 // =============================================================================
 
 #include "ui_internal.h"
+#include "ui_keyboard.h"
 #include "screens.h"
 #include <stdio.h>
 #include <string.h>
@@ -18,8 +19,6 @@ static const char *TAG = "ui_wifi";
 // Module State
 // =============================================================================
 
-static lv_obj_t *wifi_keyboard = NULL;
-static lv_obj_t *wifi_focused_ta = NULL;
 static lv_obj_t *wifi_scan_list = NULL;
 
 // Static storage for scan results (must persist for button callbacks)
@@ -29,35 +28,12 @@ static WifiScanResult wifi_scan_results_storage[16];
 // Internal Helpers
 // =============================================================================
 
-static void wifi_hide_keyboard(void) {
-    if (wifi_keyboard) {
-        lv_obj_add_flag(wifi_keyboard, LV_OBJ_FLAG_HIDDEN);
-    }
-    if (objects.settings_wifi_screen) {
-        lv_obj_scroll_to_y(objects.settings_wifi_screen, 0, LV_ANIM_ON);
-    }
-    wifi_focused_ta = NULL;
-}
-
-static void wifi_keyboard_event_cb(lv_event_t *e) {
-    lv_event_code_t code = lv_event_get_code(e);
-    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
-        wifi_hide_keyboard();
-    }
-}
-
-static void ensure_wifi_keyboard(void) {
-    if (wifi_keyboard) return;
+// Scroll the focused field into view above the keyboard, and back
+static void wifi_keyboard_toggle(lv_obj_t *ta, bool visible, void *user_data) {
+    (void)user_data;
     if (!objects.settings_wifi_screen) return;
-
-    wifi_keyboard = lv_keyboard_create(objects.settings_wifi_screen);
-    if (!wifi_keyboard) return;
-
-    lv_obj_set_size(wifi_keyboard, 800, 220);
-    lv_obj_align(wifi_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_add_flag(wifi_keyboard, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_event_cb(wifi_keyboard, wifi_keyboard_event_cb, LV_EVENT_ALL, NULL);
-    apply_keyboard_layout(wifi_keyboard);
+    int32_t y = visible ? lv_obj_get_y(ta) - 20 : 0;
+    lv_obj_scroll_to_y(objects.settings_wifi_screen, y, LV_ANIM_ON);
 }
 
 // =============================================================================
@@ -134,27 +110,9 @@ static void wifi_textarea_value_changed_handler(lv_event_t *e) {
     update_wifi_connect_btn_state();
 }
 
-static void wifi_textarea_click_handler(lv_event_t *e) {
-    lv_obj_t *ta = lv_event_get_target(e);
-    if (!ta) return;
-
-    ensure_wifi_keyboard();
-
-    if (wifi_keyboard) {
-        wifi_focused_ta = ta;
-        lv_keyboard_set_textarea(wifi_keyboard, ta);
-        lv_obj_remove_flag(wifi_keyboard, LV_OBJ_FLAG_HIDDEN);
-
-        if (objects.settings_wifi_screen) {
-            int32_t ta_y = lv_obj_get_y(ta);
-            lv_obj_scroll_to_y(objects.settings_wifi_screen, ta_y - 20, LV_ANIM_ON);
-        }
-    }
-}
-
 static void wifi_connect_click_handler(lv_event_t *e) {
     // Hide keyboard first
-    wifi_hide_keyboard();
+    ui_keyboard_hide();
 
     // Check if already connected - disconnect instead
     WifiStatus status;
@@ -215,7 +173,7 @@ static void wifi_scan_list_btn_handler(lv_event_t *e) {
 }
 
 static void wifi_scan_click_handler(lv_event_t *e) {
-    wifi_hide_keyboard();
+    ui_keyboard_hide();
 
     // Close existing scan list if open
     if (wifi_scan_list) {
@@ -486,8 +444,6 @@ update_settings_tab:
 // =============================================================================
 
 void ui_wifi_cleanup(void) {
-    wifi_keyboard = NULL;
-    wifi_focused_ta = NULL;
     wifi_scan_list = NULL;
 }
 
@@ -498,20 +454,16 @@ void ui_wifi_cleanup(void) {
 void wire_wifi_settings_buttons(void) {
     if (!objects.settings_wifi_screen) return;
 
-    // Reset module state when screen is created
-    wifi_keyboard = NULL;
-    wifi_focused_ta = NULL;
-
-    // Wire textarea click events to show keyboard
+    // Open the shared keyboard when a textarea is clicked
     if (objects.settings_wifi_screen_content_panel_input_ssid) {
-        lv_obj_add_flag(objects.settings_wifi_screen_content_panel_input_ssid, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(objects.settings_wifi_screen_content_panel_input_ssid, wifi_textarea_click_handler, LV_EVENT_CLICKED, NULL);
+        ui_keyboard_register_textarea(objects.settings_wifi_screen_content_panel_input_ssid,
+                                      LV_KEYBOARD_MODE_TEXT_LOWER, wifi_keyboard_toggle, NULL);
         // Update connect button when SSID changes
         lv_obj_add_event_cb(objects.settings_wifi_screen_content_panel_input_ssid, wifi_textarea_value_changed_handler, LV_EVENT_VALUE_CHANGED, NULL);
     }
     if (objects.settings_wifi_screen_content_panel_input_password) {
-        lv_obj_add_flag(objects.settings_wifi_screen_content_panel_input_password, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(objects.settings_wifi_screen_content_panel_input_password, wifi_textarea_click_handler, LV_EVENT_CLICKED, NULL);
+        ui_keyboard_register_textarea(objects.settings_wifi_screen_content_panel_input_password,
+                                      LV_KEYBOARD_MODE_TEXT_LOWER, wifi_keyboard_toggle, NULL);
         lv_textarea_set_password_mode(objects.settings_wifi_screen_content_panel_input_password, true);
     }
 
@@ -10,6 +10,9 @@ use std::ffi::{c_char, c_int};
 use std::sync::Mutex;
 use embedded_svc::http::client::Client as HttpClient;
 
+use crate::nfc_bridge_manager::NfcInventoryTag;
+use crate::preset_store::{self, CatalogPreset};
+
 /// Maximum number of printers to cache (reduced for memory)
 const MAX_PRINTERS: usize = 4;
 
@@ -270,10 +273,10 @@ pub fn poll_backend() {
     // Send heartbeat to indicate display is connected
     send_heartbeat(&base_url);
 
-    // Send current scale weight to backend (so other clients can see it)
+    // Send current scale weight to backend if it changed (so other clients can see it)
     let weight = crate::scale_manager::scale_get_weight();
     let stable = crate::scale_manager::scale_is_stable();
-    send_device_state(None, weight, stable);
+    send_weight_state(weight, stable);
 
     // Fetch printers
     let printers_url = format!("{}/api/printers", base_url);
@@ -393,6 +396,13 @@ fn send_heartbeat(base_url: &str) {
     if let Ok(n) = response.read(&mut buf) {
         if n > 0 {
             let body = String::from_utf8_lossy(&buf[..n]);
+            // Flash preset catalog is refreshed only when the backend's version changes
+            if let Some(start) = body.find("\"presets_version\":\"") {
+                let after = &body[start + 19..];
+                if let Some(end) = after.find('"') {
+                    sync_preset_catalog(base_url, &after[..end]);
+                }
+            }
             // Check for update command (triggers OTA)
             if body.contains("\"command\":\"update\"") || body.contains("\"command\": \"update\"") {
                 log::info!("Received update command from backend - starting OTA");
@@ -442,13 +452,94 @@ fn send_heartbeat(base_url: &str) {
                 let result = crate::scale_manager::scale_reset_calibration();
                 log::info!("Scale reset result: {}", result);
             }
+            // Check for state report deadband command (e.g., "state_deadband:2.0")
+            else if let Some(start) = body.find("state_deadband:") {
+                let after_cmd = &body[start + 15..];
+                let end = after_cmd.find(|c: char| c == '"' || c.is_whitespace()).unwrap_or(after_cmd.len());
+                match after_cmd[..end].parse::<f32>() {
+                    Ok(grams) => set_weight_deadband(grams),
+                    Err(_) => log::warn!("Failed to parse deadband value: '{}'", &after_cmd[..end]),
+                }
+            }
+        }
+    }
+}
+
+/// Weight change (grams) that counts as a new reading; smaller moves are scale noise
+const DEFAULT_WEIGHT_DEADBAND_G: f32 = 1.0;
+
+/// Device state is re-sent this often even when nothing changed, so the backend
+/// can resync after a restart (kept below its 30s tag staging timeout)
+const STATE_KEEPALIVE_MS: u64 = 10_000;
+
+/// What the backend last heard from us. Reports only carry fields that changed;
+/// the backend merges them into the state it already has.
+struct StateReporter {
+    weight_deadband: f32,
+    /// Tag currently on the reader (set by the NFC manager)
+    tag: Option<String>,
+    sent_weight: Option<f32>,
+    sent_stable: Option<bool>,
+    /// Outer None = never reported
+    sent_tag: Option<Option<String>>,
+    /// UID whose decoded data was sent; decoded data goes out once per tag
+    tag_data_sent_for: Option<String>,
+    sent_wifi: Option<String>,
+    last_sent: Option<std::time::Instant>,
+}
+
+impl StateReporter {
+    const fn new() -> Self {
+        Self {
+            weight_deadband: DEFAULT_WEIGHT_DEADBAND_G,
+            tag: None,
+            sent_weight: None,
+            sent_stable: None,
+            sent_tag: None,
+            tag_data_sent_for: None,
+            sent_wifi: None,
+            last_sent: None,
         }
     }
 }
 
-/// Send device state to backend (weight, tag, WiFi) and receive decoded tag data
-/// Returns true if tag data was received and set
+static STATE_REPORTER: Mutex<StateReporter> = Mutex::new(StateReporter::new());
+
+/// Fields included in a report, committed to StateReporter once the backend accepted it
+#[derive(Default)]
+struct StateReport {
+    weight: Option<f32>,
+    stable: Option<bool>,
+    tag: Option<Option<String>>,
+    tag_data_for: Option<String>,
+    wifi: Option<String>,
+    /// A different tag than the one last reported
+    tag_arrived: bool,
+}
+
+/// Set the weight deadband for device state reports (backend "state_deadband:<grams>" command)
+pub fn set_weight_deadband(grams: f32) {
+    if grams.is_finite() && grams >= 0.0 {
+        STATE_REPORTER.lock().unwrap().weight_deadband = grams;
+        info!("Device state weight deadband set to {:.1}g", grams);
+    }
+}
+
+/// Report a tag arrival (Some) or departure (None) along with the current weight.
+/// Returns true if decoded tag data was received back from the backend.
 pub fn send_device_state(tag_uid_hex: Option<&str>, weight: f32, stable: bool) -> bool {
+    STATE_REPORTER.lock().unwrap().tag = tag_uid_hex.map(|s| s.to_string());
+    report_device_state(weight, stable)
+}
+
+/// Report the current weight; only sends if it moved beyond the deadband,
+/// stability flipped, WiFi changed or the keepalive is due
+pub fn send_weight_state(weight: f32, stable: bool) {
+    report_device_state(weight, stable);
+}
+
+/// Send whatever changed since the last accepted report to /api/display/state
+fn report_device_state(weight: f32, stable: bool) -> bool {
     let manager = BACKEND_MANAGER.lock().unwrap();
     if manager.server_url.is_empty() {
         return false;
@@ -456,48 +547,62 @@ pub fn send_device_state(tag_uid_hex: Option<&str>, weight: f32, stable: bool) -
     let base_url = manager.server_url.clone();
     drop(manager);
 
-    // Get WiFi status to include in state update
     let wifi_params = get_wifi_params();
-
-    // Build URL with query params, including decoded tag data if available
-    let url = if let Some(tag_id) = tag_uid_hex {
-        // Get decoded tag data from NFC manager
-        let vendor = crate::nfc_bridge_manager::get_tag_vendor();
-        let material = crate::nfc_bridge_manager::get_tag_material();
-        let subtype = crate::nfc_bridge_manager::get_tag_subtype();
-        let color = crate::nfc_bridge_manager::get_tag_color_name();
-        let color_rgba = crate::nfc_bridge_manager::get_tag_color_rgba();
-        let spool_weight = crate::nfc_bridge_manager::get_tag_spool_weight();
-        let tag_type = crate::nfc_bridge_manager::get_tag_type();
-
-        if !vendor.is_empty() {
-            // Include decoded tag data (simple URL encoding - replace spaces with %20)
-            let encode = |s: &str| s.replace(' ', "%20").replace('#', "%23");
-            format!(
-                "{}/api/display/state?weight={:.1}&stable={}&tag_id={}&tag_vendor={}&tag_material={}&tag_subtype={}&tag_color={}&tag_color_rgba={}&tag_weight={}&tag_type={}{}",
-                base_url, weight, stable, tag_id,
-                encode(&vendor),
-                encode(&material),
-                encode(&subtype),
-                encode(&color),
-                color_rgba,
-                spool_weight,
-                encode(&tag_type),
-                wifi_params
-            )
-        } else {
-            // Just send tag_id without decoded data
-            format!(
-                "{}/api/display/state?weight={:.1}&stable={}&tag_id={}{}",
-                base_url, weight, stable, tag_id, wifi_params
-            )
+    let encode = |s: &str| s.replace(' ', "%20").replace('#', "%23");
+
+    let mut report = StateReport::default();
+    let mut query = String::new();
+    {
+        let reporter = STATE_REPORTER.lock().unwrap();
+        let keepalive = reporter
+            .last_sent
+            .map_or(true, |t| t.elapsed() >= std::time::Duration::from_millis(STATE_KEEPALIVE_MS));
+
+        if keepalive || reporter.sent_weight.map_or(true, |w| (weight - w).abs() >= reporter.weight_deadband) {
+            query.push_str(&format!("&weight={:.1}", weight));
+            report.weight = Some(weight);
+        }
+        if keepalive || reporter.sent_stable != Some(stable) {
+            query.push_str(&format!("&stable={}", stable));
+            report.stable = Some(stable);
+        }
+        let tag_changed = reporter.sent_tag.as_ref() != Some(&reporter.tag);
+        if keepalive || tag_changed {
+            // Empty tag_id tells the backend the tag is gone
+            query.push_str(&format!("&tag_id={}", reporter.tag.as_deref().unwrap_or("")));
+            report.tag = Some(reporter.tag.clone());
+            report.tag_arrived = tag_changed && reporter.tag.is_some();
+        }
+        if let Some(ref tag_id) = reporter.tag {
+            let vendor = crate::nfc_bridge_manager::get_tag_vendor();
+            if !vendor.is_empty() && reporter.tag_data_sent_for.as_deref() != Some(tag_id.as_str()) {
+                if report.tag.is_none() {
+                    query.push_str(&format!("&tag_id={}", tag_id));
+                }
+                query.push_str(&format!(
+                    "&tag_vendor={}&tag_material={}&tag_subtype={}&tag_color={}&tag_color_rgba={}&tag_weight={}&tag_type={}",
+                    encode(&vendor),
+                    encode(&crate::nfc_bridge_manager::get_tag_material()),
+                    encode(&crate::nfc_bridge_manager::get_tag_subtype()),
+                    encode(&crate::nfc_bridge_manager::get_tag_color_name()),
+                    crate::nfc_bridge_manager::get_tag_color_rgba(),
+                    crate::nfc_bridge_manager::get_tag_spool_weight(),
+                    encode(&crate::nfc_bridge_manager::get_tag_type()),
+                ));
+                report.tag_data_for = Some(tag_id.clone());
+            }
         }
-    } else {
-        format!(
-            "{}/api/display/state?weight={:.1}&stable={}{}",
-            base_url, weight, stable, wifi_params
-        )
-    };
+        if keepalive || reporter.sent_wifi.as_deref() != Some(wifi_params.as_str()) {
+            query.push_str(&wifi_params);
+            report.wifi = Some(wifi_params);
+        }
+    }
+
+    if query.is_empty() {
+        return false;
+    }
+
+    let url = format!("{}/api/display/state?partial=1{}", base_url, query);
 
     let config = HttpConfig {
         timeout: Some(std::time::Duration::from_millis(3000)),
@@ -526,8 +631,33 @@ pub fn send_device_state(tag_uid_hex: Option<&str>, weight: f32, stable: bool) -
         return false;
     }
 
-    // If we have a tag, fetch decoded data from display/status
-    if tag_uid_hex.is_some() {
+    // Only fields the backend accepted count as sent; anything else is retried next call
+    let announced_tag = report.tag_arrived || report.tag_data_for.is_some();
+    {
+        let mut reporter = STATE_REPORTER.lock().unwrap();
+        reporter.last_sent = Some(std::time::Instant::now());
+        if report.weight.is_some() {
+            reporter.sent_weight = report.weight;
+        }
+        if report.stable.is_some() {
+            reporter.sent_stable = report.stable;
+        }
+        if let Some(tag) = report.tag {
+            if tag.is_none() {
+                reporter.tag_data_sent_for = None;
+            }
+            reporter.sent_tag = Some(tag);
+        }
+        if report.tag_data_for.is_some() {
+            reporter.tag_data_sent_for = report.tag_data_for;
+        }
+        if report.wifi.is_some() {
+            reporter.sent_wifi = report.wifi;
+        }
+    }
+
+    // New tag or new decoded data - fetch the backend's enriched view from display/status
+    if announced_tag {
         fetch_decoded_tag_data(&base_url);
         return true;
     }
@@ -1890,6 +2020,97 @@ pub extern "C" fn spool_exists_by_tag(tag_id: *const c_char) -> bool {
     false
 }
 
+/// Check several tag ids against the inventory with one request
+/// (GET /api/spools/known-tags), e.g. all tags of an NFC inventory round.
+/// Sets known[i] for tag_ids[i]. Returns 0 on success, -1 on error
+#[no_mangle]
+pub extern "C" fn spool_tags_known(
+    tag_ids: *const *const c_char,
+    count: c_int,
+    known: *mut bool,
+) -> c_int {
+    if tag_ids.is_null() || known.is_null() || count <= 0 {
+        return -1;
+    }
+
+    let ids: Vec<String> = unsafe { std::slice::from_raw_parts(tag_ids, count as usize) }
+        .iter()
+        .map(|&id| {
+            if id.is_null() {
+                String::new()
+            } else {
+                unsafe { std::ffi::CStr::from_ptr(id).to_string_lossy().into_owned() }
+            }
+        })
+        .collect();
+    let known = unsafe { std::slice::from_raw_parts_mut(known, count as usize) };
+    known.fill(false);
+
+    let manager = BACKEND_MANAGER.lock().unwrap();
+    let base_url = manager.server_url.clone();
+    drop(manager);
+
+    if base_url.is_empty() {
+        return -1;
+    }
+
+    let url = format!("{}/api/spools/known-tags?tag_ids={}", base_url, ids.join(","));
+
+    let config = HttpConfig {
+        timeout: Some(std::time::Duration::from_millis(HTTP_TIMEOUT_MS)),
+        ..Default::default()
+    };
+
+    let connection = match EspHttpConnection::new(&config) {
+        Ok(c) => c,
+        Err(_) => return -1,
+    };
+
+    let mut client = HttpClient::wrap(connection);
+    let request = match client.get(&url) {
+        Ok(r) => r,
+        Err(_) => return -1,
+    };
+
+    let mut response = match request.submit() {
+        Ok(r) => r,
+        Err(_) => return -1,
+    };
+
+    if response.status() != 200 {
+        warn!("spool_tags_known failed with status {}", response.status());
+        return -1;
+    }
+
+    // Only the known tag ids come back
+    let mut buf = vec![0u8; 2048];
+    let mut total = 0;
+    loop {
+        match response.read(&mut buf[total..]) {
+            Ok(0) => break,
+            Ok(n) => total += n,
+            Err(_) => break,
+        }
+        if total >= buf.len() {
+            break;
+        }
+    }
+
+    let found: Vec<String> = match serde_json::from_slice(&buf[..total]) {
+        Ok(f) => f,
+        Err(e) => {
+            warn!("spool_tags_known: JSON parse error: {:?}", e);
+            return -1;
+        }
+    };
+
+    for (i, id) in ids.iter().enumerate() {
+        known[i] = found.contains(id);
+    }
+    info!("spool_tags_known: {} of {} tags in inventory", found.len(), count);
+    0
+}
+
 /// Add a new spool to inventory
 #[no_mangle]
 pub extern "C" fn spool_add_to_inventory(
@@ -2005,6 +2226,155 @@ pub extern "C" fn spool_add_to_inventory(
     true
 }
 
+/// API response for POST /api/spools/batch (ids of the created spools)
+#[derive(Debug, Deserialize)]
+struct ApiSpoolBatchResult {
+    created: Vec<String>,
+    #[serde(default)]
+    skipped: Vec<String>,
+}
+
+/// Add one spool per inventory tag in a single request (bulk registration)
+/// Tags already in the inventory are skipped by the backend and counted in `skipped`.
+/// Returns the number of spools created, -1 on error.
+#[no_mangle]
+pub extern "C" fn spool_add_batch_to_inventory(
+    tags: *const NfcInventoryTag,
+    count: c_int,
+    data_origin: *const c_char,
+    skipped: *mut c_int,
+) -> c_int {
+    if tags.is_null() || count <= 0 {
+        return -1;
+    }
+
+    let data_origin_str = if data_origin.is_null() {
+        String::new()
+    } else {
+        unsafe { std::ffi::CStr::from_ptr(data_origin).to_str().unwrap_or("").to_string() }
+    };
+
+    let manager = BACKEND_MANAGER.lock().unwrap();
+    let base_url = manager.server_url.clone();
+    drop(manager);
+
+    if base_url.is_empty() {
+        return -1;
+    }
+
+    let tags = unsafe { std::slice::from_raw_parts(tags, count as usize) };
+    let spools: Vec<serde_json::Value> = tags
+        .iter()
+        .map(|tag| {
+            let label_weight = if tag.spool_weight > 0 { tag.spool_weight } else { 1000 };
+            let bambu = tag.decoded
+                && (tag.tag_type == crate::nfc::i2c_bridge::TAG_TYPE_MIFARE_1K
+                    || tag.tag_type == crate::nfc::i2c_bridge::TAG_TYPE_MIFARE_4K);
+            serde_json::json!({
+                "tag_id": feed_str(&tag.uid_hex),
+                "brand": feed_str(&tag.vendor),
+                "material": feed_str(&tag.material),
+                "subtype": feed_str(&tag.subtype),
+                "color_name": feed_str(&tag.color_name),
+                "rgba": format!("{:08X}", tag.color_rgba),
+                "label_weight": label_weight,
+                "weight_new": label_weight,
+                "data_origin": data_origin_str,
+                "tag_type": if bambu { "bambu" } else { "generic" },
+            })
+        })
+        .collect();
+    let body = serde_json::json!({ "spools": spools }).to_string();
+
+    // POST /api/spools/batch
+    let url = format!("{}/api/spools/batch", base_url);
+    info!("spool_add_batch_to_inventory: POST {} ({} tags)", url, count);
+
+    let config = HttpConfig {
+        timeout: Some(std::time::Duration::from_millis(HTTP_TIMEOUT_MS)),
+        ..Default::default()
+    };
+
+    let connection = match EspHttpConnection::new(&config) {
+        Ok(c) => c,
+        Err(e) => {
+            warn!("Failed to create HTTP connection: {:?}", e);
+            return -1;
+        }
+    };
+
+    let mut client = HttpClient::wrap(connection);
+
+    let headers = [
+        ("Content-Type", "application/json"),
+        ("Content-Length", &body.len().to_string()),
+    ];
+
+    let mut request = match client.request(embedded_svc::http::Method::Post, &url, &headers) {
+        Ok(r) => r,
+        Err(e) => {
+            warn!("Failed to create POST request: {:?}", e);
+            return -1;
+        }
+    };
+
+    if let Err(e) = request.write(body.as_bytes()) {
+        warn!("Failed to write request body: {:?}", e);
+        return -1;
+    }
+
+    if let Err(e) = request.flush() {
+        warn!("Failed to flush request: {:?}", e);
+        return -1;
+    }
+
+    let mut response = match request.submit() {
+        Ok(r) => r,
+        Err(e) => {
+            warn!("Failed to submit request: {:?}", e);
+            return -1;
+        }
+    };
+
+    let status = response.status();
+    if status != 201 {
+        warn!("spool_add_batch_to_inventory failed with status {}", status);
+        return -1;
+    }
+
+    // Only ids and skipped tag ids come back - ~40 bytes per tag
+    let mut buf = Vec::with_capacity(1024);
+    let mut chunk = [0u8; 512];
+    loop {
+        match response.read(&mut chunk) {
+            Ok(0) => break,
+            Ok(n) => buf.extend_from_slice(&chunk[..n]),
+            Err(_) => break,
+        }
+        if buf.len() >= 16 * 1024 {
+            break;
+        }
+    }
+
+    let result: ApiSpoolBatchResult = match serde_json::from_slice(&buf) {
+        Ok(r) => r,
+        Err(e) => {
+            warn!("spool_add_batch_to_inventory: bad response: {}", e);
+            return -1;
+        }
+    };
+
+    if !skipped.is_null() {
+        unsafe { *skipped = result.skipped.len() as c_int };
+    }
+    info!(
+        "spool_add_batch_to_inventory: {} created, {} skipped",
+        result.created.len(),
+        result.skipped.len()
+    );
+    result.created.len() as c_int
+}
+
 /// Untagged spool info for FFI
 #[repr(C)]
 pub struct UntaggedSpoolInfo {
@@ -2538,26 +2908,6 @@ pub extern "C" fn backend_assign_spool_to_tray(
 // AMS Slot Configuration API (for Configure Slot modal)
 // =============================================================================
 
-/// Slicer preset from cloud API
-#[derive(Debug, Clone, Deserialize, Default)]
-struct ApiSlicerPreset {
-    setting_id: String,
-    name: String,
-    #[serde(rename = "type")]
-    preset_type: Option<String>,
-    is_custom: Option<bool>,
-}
-
-/// Slicer settings response from cloud API
-#[derive(Debug, Clone, Deserialize, Default)]
-struct ApiSlicerSettingsResponse {
-    filament: Option<Vec<ApiSlicerPreset>>,
-    #[allow(dead_code)]
-    printer: Option<Vec<ApiSlicerPreset>>,
-    #[allow(dead_code)]
-    process: Option<Vec<ApiSlicerPreset>>,
-}
-
 /// Preset detail from cloud API
 #[derive(Debug, Clone, Deserialize, Default)]
 struct ApiPresetDetail {
@@ -2603,6 +2953,10 @@ pub struct SlicerPreset {
     pub name: [c_char; 64],
     pub preset_type: [c_char; 16],  // Called 'type' in C, but 'type' is reserved in Rust
     pub is_custom: bool,
+    pub brand: [c_char; 24],
+    pub material: [c_char; 8],
+    pub temp_min: i16,
+    pub temp_max: i16,
 }
 
 /// Preset detail (C-compatible, matches ui_internal.h PresetDetail)
@@ -2636,68 +2990,91 @@ pub struct ColorCatalogEntry {
     pub material: [c_char; 32],
 }
 
-/// Get slicer filament presets from Bambu Cloud (via backend)
-/// Returns number of presets found (up to max_count), -1 on error
-#[no_mangle]
-pub extern "C" fn backend_get_slicer_presets(
-    presets: *mut SlicerPreset,
-    max_count: c_int,
-) -> c_int {
-    info!("backend_get_slicer_presets called");
-
-    if presets.is_null() || max_count <= 0 {
-        return -1;
-    }
-
-    let manager = BACKEND_MANAGER.lock().unwrap();
-    let base_url = manager.server_url.clone();
-    let is_connected = matches!(manager.state, BackendState::Connected { .. });
-    drop(manager);
-
-    if base_url.is_empty() {
-        info!("backend_get_slicer_presets: no server URL configured");
-        return 0;  // Return 0 presets instead of -1 if not configured
-    }
-
-    if !is_connected {
-        info!("backend_get_slicer_presets: backend not connected, skipping");
-        return 0;  // Don't block UI if backend not connected
-    }
+/// Compact preset feed layout (backend services/preset_feed.py)
+const FEED_MAGIC: &[u8; 4] = b"SBPF";
+const FEED_FORMAT: u8 = 1;
+const FEED_HEADER_SIZE: usize = 12;
+const FEED_RECORD_SIZE: usize = 104;
+const FEED_BRAND_SIZE: usize = 24;
+const FEED_MATERIAL_SIZE: usize = 8;
+const FEED_FLAG_CUSTOM: u8 = 0x01;
+
+/// Read a NUL-padded string field from the feed
+fn feed_str(field: &[u8]) -> String {
+    let end = field.iter().position(|&b| b == 0).unwrap_or(field.len());
+    String::from_utf8_lossy(&field[..end]).into_owned()
+}
+
+/// Unpack the fixed-width records of a compact preset feed
+fn parse_preset_feed(feed: &[u8]) -> Result<Vec<CatalogPreset>, String> {
+    if feed.len() < FEED_HEADER_SIZE || &feed[0..4] != FEED_MAGIC || feed[4] != FEED_FORMAT {
+        return Err("not a preset feed".into());
+    }
+    let brand_count = feed[5] as usize;
+    let material_count = feed[6] as usize;
+    let count = u16::from_le_bytes([feed[8], feed[9]]) as usize;
+    let record_size = u16::from_le_bytes([feed[10], feed[11]]) as usize;
+
+    let records_start = FEED_HEADER_SIZE + brand_count * FEED_BRAND_SIZE + material_count * FEED_MATERIAL_SIZE;
+    if record_size < FEED_RECORD_SIZE || feed.len() < records_start + count * record_size {
+        return Err("truncated preset feed".into());
+    }
+
+    let brands: Vec<String> = (0..brand_count)
+        .map(|i| feed_str(&feed[FEED_HEADER_SIZE + i * FEED_BRAND_SIZE..][..FEED_BRAND_SIZE]))
+        .collect();
+    let materials_start = FEED_HEADER_SIZE + brand_count * FEED_BRAND_SIZE;
+    let materials: Vec<String> = (0..material_count)
+        .map(|i| feed_str(&feed[materials_start + i * FEED_MATERIAL_SIZE..][..FEED_MATERIAL_SIZE]))
+        .collect();
+
+    Ok(feed[records_start..records_start + count * record_size]
+        .chunks_exact(record_size)
+        .map(|r| CatalogPreset {
+            setting_id: feed_str(&r[0..32]),
+            name: feed_str(&r[32..96]),
+            preset_type: "filament".into(),
+            is_custom: r[98] & FEED_FLAG_CUSTOM != 0,
+            brand: brands.get(r[96] as usize).cloned().unwrap_or_default(),
+            material: materials.get(r[97] as usize).cloned().unwrap_or_default(),
+            temp_min: u16::from_le_bytes([r[100], r[101]]),
+            temp_max: u16::from_le_bytes([r[102], r[103]]),
+        })
+        .collect())
+}
 
-    // GET /api/cloud/settings
-    let url = format!("{}/api/cloud/settings", base_url);
+/// Download the filament preset catalog: GET /api/cloud/filaments/compact
+/// The backend resolves, sorts and packs the presets; the ETag is
+/// "<version>.<format>.<limit>" and the catalog keeps the version part.
+/// Returns Ok(None) if the backend is not logged in to Bambu Cloud
+fn fetch_preset_catalog(base_url: &str) -> Result<Option<(String, Vec<CatalogPreset>)>, String> {
+    let url = format!("{}/api/cloud/filaments/compact?limit={}", base_url, preset_store::MAX_CATALOG_PRESETS);
 
     let config = HttpConfig {
         timeout: Some(std::time::Duration::from_millis(HTTP_TIMEOUT_MS)),
         ..Default::default()
     };
 
-    let connection = match EspHttpConnection::new(&config) {
-        Ok(c) => c,
-        Err(_) => return -1,
-    };
-
+    let connection = EspHttpConnection::new(&config).map_err(|e| format!("{:?}", e))?;
     let mut client = HttpClient::wrap(connection);
-    let request = match client.get(&url) {
-        Ok(r) => r,
-        Err(_) => return -1,
-    };
-
-    let mut response = match request.submit() {
-        Ok(r) => r,
-        Err(_) => return -1,
-    };
+    let request = client.get(&url).map_err(|e| format!("{:?}", e))?;
+    let mut response = request.submit().map_err(|e| format!("{:?}", e))?;
 
     if response.status() != 200 {
-        // Might be 401 (not authenticated) - return 0 presets
+        // Might be 401 (not authenticated)
         if response.status() == 401 {
-            return 0;
+            return Ok(None);
         }
-        return -1;
+        return Err(format!("HTTP {}", response.status()));
     }
 
-    // Read response body
-    let mut buf = vec![0u8; 262144]; // 256KB buffer for presets list
+    let version = response
+        .header("ETag")
+        .map(|v| v.trim_matches('"').split('.').next().unwrap_or_default().to_string())
+        .unwrap_or_default();
+
+    // 100 fixed-width records plus tables is ~12KB
+    let mut buf = vec![0u8; 32768];
     let mut total = 0;
     loop {
         match response.read(&mut buf[total..]) {
@@ -2711,42 +3088,122 @@ pub extern "C" fn backend_get_slicer_presets(
     }
 
     if total == 0 {
-        return 0;
+        return Ok(None);
     }
 
-    // Parse response
-    let body = String::from_utf8_lossy(&buf[..total]);
-    let settings: ApiSlicerSettingsResponse = match serde_json::from_str(&body) {
-        Ok(s) => s,
-        Err(e) => {
-            warn!("Failed to parse slicer presets: {:?}", e);
-            return -1;
+    let presets = parse_preset_feed(&buf[..total])?;
+    Ok(Some((version, presets)))
+}
+
+static PRESET_SYNC_RUNNING: std::sync::atomic::AtomicBool = std::sync::atomic::AtomicBool::new(false);
+
+/// Re-download the flash preset catalog in the background if the backend
+/// reports a different version than the one stored
+fn sync_preset_catalog(base_url: &str, remote_version: &str) {
+    use std::sync::atomic::Ordering;
+
+    if preset_store::version().as_deref() == Some(remote_version) {
+        return;
+    }
+    if PRESET_SYNC_RUNNING.swap(true, Ordering::AcqRel) {
+        return;
+    }
+
+    info!("Preset catalog version changed ({:?} -> {}), syncing", preset_store::version(), remote_version);
+    let base_url = base_url.to_string();
+
+    // Larger stack for HTTP + JSON parsing
+    let spawned = std::thread::Builder::new()
+        .name("preset_sync".into())
+        .stack_size(16384)
+        .spawn(move || {
+            match fetch_preset_catalog(&base_url) {
+                Ok(Some((version, presets))) => preset_store::store(&version, presets),
+                Ok(None) => info!("Preset sync: backend has no presets"),
+                Err(e) => warn!("Preset sync failed: {}", e),
+            }
+            PRESET_SYNC_RUNNING.store(false, Ordering::Release);
+        });
+
+    if spawned.is_err() {
+        warn!("Failed to spawn preset sync thread");
+        PRESET_SYNC_RUNNING.store(false, Ordering::Release);
+    }
+}
+
+/// Get slicer filament presets from Bambu Cloud (via backend)
+/// Served from the flash catalog (kept in sync on heartbeat); only downloads
+/// when there is no catalog yet.
+/// Returns number of presets found (up to max_count), -1 on error
+#[no_mangle]
+pub extern "C" fn backend_get_slicer_presets(
+    presets: *mut SlicerPreset,
+    max_count: c_int,
+) -> c_int {
+    info!("backend_get_slicer_presets called");
+
+    if presets.is_null() || max_count <= 0 {
+        return -1;
+    }
+
+    let copy_out = |catalog: &[CatalogPreset]| -> c_int {
+        let count = catalog.len().min(max_count as usize);
+        for (i, preset) in catalog.iter().take(count).enumerate() {
+            let preset_ref = unsafe { &mut *presets.add(i) };
+
+            // Initialize with zeros
+            preset_ref.setting_id = [0; 64];
+            preset_ref.name = [0; 64];
+            preset_ref.preset_type = [0; 16];
+            preset_ref.is_custom = preset.is_custom;
+            preset_ref.brand = [0; 24];
+            preset_ref.material = [0; 8];
+            preset_ref.temp_min = preset.temp_min as i16;
+            preset_ref.temp_max = preset.temp_max as i16;
+
+            // Copy strings
+            copy_to_c_buf_signed(&preset.setting_id, &mut preset_ref.setting_id);
+            copy_to_c_buf_signed(&preset.name, &mut preset_ref.name);
+            copy_to_c_buf_signed(&preset.preset_type, &mut preset_ref.preset_type);
+            copy_to_c_buf_signed(&preset.brand, &mut preset_ref.brand);
+            copy_to_c_buf_signed(&preset.material, &mut preset_ref.material);
         }
+        count as c_int
     };
 
-    // Extract filament presets only
-    let filaments = settings.filament.unwrap_or_default();
-    let count = filaments.len().min(max_count as usize);
+    if let Some(count) = preset_store::with_presets(|catalog| copy_out(catalog)) {
+        info!("backend_get_slicer_presets: returning {} presets from catalog", count);
+        return count;
+    }
 
-    for (i, preset) in filaments.iter().take(count).enumerate() {
-        let preset_ref = unsafe { &mut *presets.add(i) };
+    let manager = BACKEND_MANAGER.lock().unwrap();
+    let base_url = manager.server_url.clone();
+    let is_connected = matches!(manager.state, BackendState::Connected { .. });
+    drop(manager);
 
-        // Initialize with zeros
-        preset_ref.setting_id = [0; 64];
-        preset_ref.name = [0; 64];
-        preset_ref.preset_type = [0; 16];
-        preset_ref.is_custom = preset.is_custom.unwrap_or(false);
+    if base_url.is_empty() {
+        info!("backend_get_slicer_presets: no server URL configured");
+        return 0;  // Return 0 presets instead of -1 if not configured
+    }
 
-        // Copy strings
-        copy_to_c_buf_signed(&preset.setting_id, &mut preset_ref.setting_id);
-        copy_to_c_buf_signed(&preset.name, &mut preset_ref.name);
-        if let Some(ref t) = preset.preset_type {
-            copy_to_c_buf_signed(t, &mut preset_ref.preset_type);
-        }
+    if !is_connected {
+        info!("backend_get_slicer_presets: backend not connected, skipping");
+        return 0;  // Don't block UI if backend not connected
     }
 
-    info!("backend_get_slicer_presets: returning {} presets", count);
-    count as c_int
+    match fetch_preset_catalog(&base_url) {
+        Ok(Some((version, catalog))) => {
+            let count = copy_out(&catalog);
+            preset_store::store(&version, catalog);
+            info!("backend_get_slicer_presets: returning {} presets", count);
+            count
+        }
+        Ok(None) => 0,
+        Err(e) => {
+            warn!("Failed to fetch slicer presets: {}", e);
+            -1
+        }
+    }
 }
 
 /// Get detailed preset info including filament_id and base_id
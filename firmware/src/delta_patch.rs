@@ -0,0 +1,395 @@
+//! Binary delta firmware patches
+//!
+//! The backend precomputes deltas between stored firmware versions
+//! (backend/services/firmware_delta.py). A delta rebuilds the new image from
+//! the image the device is running, so an update only transfers what changed.
+//!
+//! Layout, little-endian:
+//!   header  "SBD1", source_size u32, target_size u32,
+//!           source_sha256 [32], target_sha256 [32]
+//!   COPY    0x01, source_offset u32, length u32   (bytes from the running image)
+//!   INSERT  0x02, length u32, bytes[length]        (literal bytes)
+//!   END     0x00
+//!
+//! No ESP-IDF dependencies: the running image is read through a callback, so
+//! this builds and tests on the host against image files:
+//!   rustc --edition 2021 --test src/delta_patch.rs -o /tmp/delta_patch && /tmp/delta_patch
+//! With SPOOLBUDDY_DELTA_SOURCE / _DELTA / _TARGET set to image and delta
+//! files, the tests also rebuild a real image.
+
+#![allow(dead_code)]
+
+const MAGIC: &[u8; 4] = b"SBD1";
+pub const HEADER_SIZE: usize = 76;
+const OP_END: u8 = 0x00;
+const OP_COPY: u8 = 0x01;
+const OP_INSERT: u8 = 0x02;
+
+/// Source reads are done in chunks of this size (hashing and COPY)
+const READ_CHUNK: usize = 4096;
+
+#[derive(Debug, Clone, PartialEq)]
+pub struct DeltaHeader {
+    pub source_size: u32,
+    pub target_size: u32,
+    pub source_sha256: [u8; 32],
+    pub target_sha256: [u8; 32],
+}
+
+fn read_u32(data: &[u8], offset: usize) -> Result<u32, String> {
+    data.get(offset..offset + 4)
+        .map(|b| u32::from_le_bytes([b[0], b[1], b[2], b[3]]))
+        .ok_or_else(|| "Delta truncated".to_string())
+}
+
+/// Parse and check the delta header
+pub fn parse_header(delta: &[u8]) -> Result<DeltaHeader, String> {
+    if delta.len() < HEADER_SIZE + 1 {
+        return Err("Delta too short".to_string());
+    }
+    if &delta[0..4] != MAGIC {
+        return Err("Bad delta magic".to_string());
+    }
+    let mut source_sha256 = [0u8; 32];
+    let mut target_sha256 = [0u8; 32];
+    source_sha256.copy_from_slice(&delta[12..44]);
+    target_sha256.copy_from_slice(&delta[44..76]);
+    Ok(DeltaHeader {
+        source_size: read_u32(delta, 4)?,
+        target_size: read_u32(delta, 8)?,
+        source_sha256,
+        target_sha256,
+    })
+}
+
+/// SHA-256 of the first `size` bytes of the source, read in chunks
+pub fn source_sha256<F>(size: u32, mut read_source: F) -> Result<[u8; 32], String>
+where
+    F: FnMut(usize, &mut [u8]) -> Result<(), String>,
+{
+    let mut hasher = Sha256::new();
+    let mut buf = vec![0u8; READ_CHUNK];
+    let mut offset = 0usize;
+    while offset < size as usize {
+        let n = READ_CHUNK.min(size as usize - offset);
+        read_source(offset, &mut buf[..n])?;
+        hasher.update(&buf[..n]);
+        offset += n;
+    }
+    Ok(hasher.finish())
+}
+
+/// Rebuild the target image from the source and a delta.
+///
+/// `read_source(offset, buf)` fills buf from the running image. The result is
+/// checked against the header's size and SHA-256 before it is returned; the
+/// caller is expected to have checked the source hash (source_sha256) first.
+/// `progress` is called with the percentage of the target rebuilt.
+pub fn apply<F, P>(delta: &[u8], mut read_source: F, mut progress: P) -> Result<Vec<u8>, String>
+where
+    F: FnMut(usize, &mut [u8]) -> Result<(), String>,
+    P: FnMut(u8),
+{
+    let header = parse_header(delta)?;
+    let target_size = header.target_size as usize;
+
+    // One allocation for the whole image (PSRAM on the device)
+    let mut target: Vec<u8> = Vec::new();
+    target
+        .try_reserve_exact(target_size)
+        .map_err(|_| format!("Cannot allocate {} bytes for image", target_size))?;
+    let mut hasher = Sha256::new();
+    let mut pos = HEADER_SIZE;
+
+    loop {
+        let op = *delta.get(pos).ok_or_else(|| "Delta truncated".to_string())?;
+        let before = target.len();
+        match op {
+            OP_END => break,
+            OP_COPY => {
+                let offset = read_u32(delta, pos + 1)? as usize;
+                let length = read_u32(delta, pos + 5)? as usize;
+                pos += 9;
+                if offset + length > header.source_size as usize || before + length > target_size {
+                    return Err("COPY out of range".to_string());
+                }
+                target.resize(before + length, 0);
+                let mut done = 0;
+                while done < length {
+                    let n = READ_CHUNK.min(length - done);
+                    read_source(offset + done, &mut target[before + done..before + done + n])?;
+                    done += n;
+                }
+            }
+            OP_INSERT => {
+                let length = read_u32(delta, pos + 1)? as usize;
+                pos += 5;
+                let bytes = delta
+                    .get(pos..pos + length)
+                    .ok_or_else(|| "Delta truncated".to_string())?;
+                if before + length > target_size {
+                    return Err("INSERT out of range".to_string());
+                }
+                target.extend_from_slice(bytes);
+                pos += length;
+            }
+            other => return Err(format!("Unknown delta operation 0x{:02X} at {}", other, pos)),
+        }
+        hasher.update(&target[before..]);
+        if target_size > 0 {
+            progress(((target.len() * 100) / target_size).min(100) as u8);
+        }
+    }
+
+    if target.len() != target_size {
+        return Err(format!("Rebuilt {} bytes, expected {}", target.len(), target_size));
+    }
+    if hasher.finish() != header.target_sha256 {
+        return Err("Rebuilt image failed SHA-256 verification".to_string());
+    }
+    Ok(target)
+}
+
+// ============================================================================
+// SHA-256 (FIPS 180-4), incremental
+// ============================================================================
+
+const K: [u32; 64] = [
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+];
+
+pub struct Sha256 {
+    state: [u32; 8],
+    block: [u8; 64],
+    block_len: usize,
+    total_len: u64,
+}
+
+impl Sha256 {
+    pub fn new() -> Self {
+        Self {
+            state: [
+                0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+            ],
+            block: [0u8; 64],
+            block_len: 0,
+            total_len: 0,
+        }
+    }
+
+    pub fn update(&mut self, mut data: &[u8]) {
+        self.total_len += data.len() as u64;
+        if self.block_len > 0 {
+            let n = (64 - self.block_len).min(data.len());
+            self.block[self.block_len..self.block_len + n].copy_from_slice(&data[..n]);
+            self.block_len += n;
+            data = &data[n..];
+            if self.block_len < 64 {
+                return;
+            }
+            let block = self.block;
+            self.compress(&block);
+            self.block_len = 0;
+        }
+        let mut chunks = data.chunks_exact(64);
+        for chunk in &mut chunks {
+            self.compress(chunk);
+        }
+        let rest = chunks.remainder();
+        self.block[..rest.len()].copy_from_slice(rest);
+        self.block_len = rest.len();
+    }
+
+    pub fn finish(mut self) -> [u8; 32] {
+        let bit_len = self.total_len.wrapping_mul(8);
+        let mut pad = [0u8; 72];
+        pad[0] = 0x80;
+        let pad_len = if self.block_len < 56 { 56 - self.block_len } else { 120 - self.block_len };
+        pad[pad_len..pad_len + 8].copy_from_slice(&bit_len.to_be_bytes());
+        let total = self.total_len;
+        self.update(&pad[..pad_len + 8]);
+        self.total_len = total;
+
+        let mut out = [0u8; 32];
+        for (i, word) in self.state.iter().enumerate() {
+            out[i * 4..i * 4 + 4].copy_from_slice(&word.to_be_bytes());
+        }
+        out
+    }
+
+    fn compress(&mut self, block: &[u8]) {
+        let mut w = [0u32; 64];
+        for i in 0..16 {
+            w[i] = u32::from_be_bytes([block[i * 4], block[i * 4 + 1], block[i * 4 + 2], block[i * 4 + 3]]);
+        }
+        for i in 16..64 {
+            let s0 = w[i - 15].rotate_right(7) ^ w[i - 15].rotate_right(18) ^ (w[i - 15] >> 3);
+            let s1 = w[i - 2].rotate_right(17) ^ w[i - 2].rotate_right(19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16].wrapping_add(s0).wrapping_add(w[i - 7]).wrapping_add(s1);
+        }
+
+        let [mut a, mut b, mut c, mut d, mut e, mut f, mut g, mut h] = self.state;
+        for i in 0..64 {
+            let s1 = e.rotate_right(6) ^ e.rotate_right(11) ^ e.rotate_right(25);
+            let ch = (e & f) ^ (!e & g);
+            let t1 = h.wrapping_add(s1).wrapping_add(ch).wrapping_add(K[i]).wrapping_add(w[i]);
+            let s0 = a.rotate_right(2) ^ a.rotate_right(13) ^ a.rotate_right(22);
+            let maj = (a & b) ^ (a & c) ^ (b & c);
+            let t2 = s0.wrapping_add(maj);
+            h = g;
+            g = f;
+            f = e;
+            e = d.wrapping_add(t1);
+            d = c;
+            c = b;
+            b = a;
+            a = t1.wrapping_add(t2);
+        }
+        for (state, value) in self.state.iter_mut().zip([a, b, c, d, e, f, g, h]) {
+            *state = state.wrapping_add(value);
+        }
+    }
+}
+
+pub fn sha256(data: &[u8]) -> [u8; 32] {
+    let mut hasher = Sha256::new();
+    hasher.update(data);
+    hasher.finish()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn hex(bytes: &[u8]) -> String {
+        bytes.iter().map(|b| format!("{:02x}", b)).collect()
+    }
+
+    fn slice_reader(source: &[u8]) -> impl FnMut(usize, &mut [u8]) -> Result<(), String> + '_ {
+        move |offset, buf| {
+            let end = offset + buf.len();
+            buf.copy_from_slice(source.get(offset..end).ok_or("read past source")?);
+            Ok(())
+        }
+    }
+
+    fn build(source: &[u8], target: &[u8], ops: &[u8]) -> Vec<u8> {
+        let mut delta = Vec::new();
+        delta.extend_from_slice(MAGIC);
+        delta.extend_from_slice(&(source.len() as u32).to_le_bytes());
+        delta.extend_from_slice(&(target.len() as u32).to_le_bytes());
+        delta.extend_from_slice(&sha256(source));
+        delta.extend_from_slice(&sha256(target));
+        delta.extend_from_slice(ops);
+        delta
+    }
+
+    fn copy(offset: u32, length: u32) -> Vec<u8> {
+        let mut op = vec![OP_COPY];
+        op.extend_from_slice(&offset.to_le_bytes());
+        op.extend_from_slice(&length.to_le_bytes());
+        op
+    }
+
+    fn insert(bytes: &[u8]) -> Vec<u8> {
+        let mut op = vec![OP_INSERT];
+        op.extend_from_slice(&(bytes.len() as u32).to_le_bytes());
+        op.extend_from_slice(bytes);
+        op
+    }
+
+    #[test]
+    fn sha256_vectors() {
+        assert_eq!(hex(&sha256(b"")), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        assert_eq!(hex(&sha256(b"abc")), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        let million_a = vec![b'a'; 1_000_000];
+        assert_eq!(hex(&sha256(&million_a)), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+        // Chunked updates match one-shot hashing across block boundaries
+        let data: Vec<u8> = (0..1000u32).map(|i| (i * 7) as u8).collect();
+        for step in [1, 3, 63, 64, 65, 500] {
+            let mut hasher = Sha256::new();
+            for chunk in data.chunks(step) {
+                hasher.update(chunk);
+            }
+            assert_eq!(hasher.finish(), sha256(&data));
+        }
+    }
+
+    #[test]
+    fn apply_copy_and_insert() {
+        let source: Vec<u8> = (0..10_000u32).map(|i| (i % 251) as u8).collect();
+        let mut target = source[..5000].to_vec();
+        target.extend_from_slice(b"new code");
+        target.extend_from_slice(&source[6000..]);
+
+        let mut ops = copy(0, 5000);
+        ops.extend(insert(b"new code"));
+        ops.extend(copy(6000, 4000));
+        ops.push(OP_END);
+        let delta = build(&source, &target, &ops);
+
+        let header = parse_header(&delta).unwrap();
+        assert_eq!(header.source_sha256, source_sha256(header.source_size, slice_reader(&source)).unwrap());
+        let mut last_progress = 0;
+        let rebuilt = apply(&delta, slice_reader(&source), |p| last_progress = p).unwrap();
+        assert_eq!(rebuilt, target);
+        assert_eq!(last_progress, 100);
+    }
+
+    #[test]
+    fn apply_rejects_bad_deltas() {
+        let source = vec![1u8; 100];
+        let target = vec![1u8; 50];
+
+        let mut ops = copy(0, 50);
+        ops.push(OP_END);
+        let delta = build(&source, &target, &ops);
+        assert!(apply(&delta, slice_reader(&source), |_| {}).is_ok());
+
+        // Wrong target hash
+        let mut corrupt = delta.clone();
+        corrupt[50] ^= 0xFF;
+        assert!(apply(&corrupt, slice_reader(&source), |_| {}).is_err());
+
+        // Different source bytes
+        let other = vec![2u8; 100];
+        assert!(apply(&delta, slice_reader(&other), |_| {}).is_err());
+
+        // COPY past the source, truncated delta, unknown op, bad magic
+        let mut ops = copy(90, 50);
+        ops.push(OP_END);
+        assert!(apply(&build(&source, &target, &ops), slice_reader(&source), |_| {}).is_err());
+        assert!(apply(&delta[..delta.len() - 1], slice_reader(&source), |_| {}).is_err());
+        assert!(apply(&build(&source, &target, &[0x7F]), slice_reader(&source), |_| {}).is_err());
+        let mut bad_magic = delta.clone();
+        bad_magic[0] = b'X';
+        assert!(parse_header(&bad_magic).is_err());
+    }
+
+    #[test]
+    fn apply_image_files() {
+        // Delta produced by the backend for real images, when provided
+        let (Ok(source), Ok(delta), Ok(target)) = (
+            std::env::var("SPOOLBUDDY_DELTA_SOURCE"),
+            std::env::var("SPOOLBUDDY_DELTA_DELTA"),
+            std::env::var("SPOOLBUDDY_DELTA_TARGET"),
+        ) else {
+            return;
+        };
+        let source = std::fs::read(source).unwrap();
+        let delta = std::fs::read(delta).unwrap();
+        let target = std::fs::read(target).unwrap();
+
+        let header = parse_header(&delta).unwrap();
+        assert_eq!(header.source_sha256, source_sha256(header.source_size, slice_reader(&source)).unwrap());
+        assert_eq!(apply(&delta, slice_reader(&source), |_| {}).unwrap(), target);
+    }
+}
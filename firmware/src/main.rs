@@ -34,12 +34,18 @@ mod wifi_manager;
 // Backend client for server communication
 mod backend_client;
 
+// Slicer preset catalog persisted to flash
+mod preset_store;
+
 // Time manager for NTP sync
 mod time_manager;
 
 // OTA update manager
 mod ota_manager;
 
+// Binary delta patches for OTA updates
+mod delta_patch;
+
 // Direct SPI NFC disabled - now using I2C bridge via Pico
 const NFC_ENABLED: bool = false;
 
@@ -166,8 +172,9 @@ fn main() {
     let sysloop = EspSystemEventLoop::take().expect("Failed to take system event loop");
     let nvs = EspDefaultNvsPartition::take().ok();
 
-    // Clone NVS partition for scale calibration persistence
+    // Clone NVS partition for scale calibration and preset catalog persistence
     let nvs_for_scale = nvs.clone();
+    let nvs_for_presets = nvs.clone();
 
     match wifi_manager::init_wifi_system(peripherals.modem, sysloop, nvs) {
         Ok(_) => info!("WiFi subsystem ready"),
@@ -177,6 +184,9 @@ fn main() {
     // Initialize scale NVS (for calibration persistence)
     scale_manager::init_nvs(nvs_for_scale);
 
+    // Load the slicer preset catalog (AMS slot modal lists it without a download)
+    preset_store::init_nvs(nvs_for_presets);
+
     // Initialize backend client (for server communication)
     backend_client::init();
 
@@ -1121,10 +1131,10 @@ fn main() {
             // Regular polling every 2 seconds (full sync: printers, commands, etc.)
             backend_client::poll_backend();
         } else if loop_count % 100 == 0 {
-            // Weight-only update every 500ms for faster UI feedback
+            // Weight check every 500ms for faster UI feedback (sent only when it changed)
             let weight = scale_manager::scale_get_weight();
             let stable = scale_manager::scale_is_stable();
-            backend_client::send_device_state(None, weight, stable);
+            backend_client::send_weight_state(weight, stable);
         }
 
         // OTA check on startup (once, after WiFi init) - check but don't auto-install
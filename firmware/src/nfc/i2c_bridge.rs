@@ -10,6 +10,9 @@
 //!   - 0x01: Get version (returns 3 bytes: status, major, minor)
 //!   - 0x10: Scan tag (returns: status, uid_len, uid[0..uid_len])
 //!   - 0x20: Read tag data (returns: status, tag_type, uid_len, uid, block_data...)
+//!   - 0x30: Inventory round, all tags in the field (returns: status, count)
+//!   - 0x31: Get inventory tag [cmd, seq, index] (returns: status, index, tag_type,
+//!     data_status, uid_len, uid, block_data...)
 
 use esp_idf_hal::i2c::I2cDriver;
 use log::{debug, info, warn};
@@ -31,6 +34,11 @@ const CMD_GET_STATUS: u8 = 0x00;
 const CMD_GET_VERSION: u8 = 0x01;
 const CMD_SCAN_TAG: u8 = 0x10;
 const CMD_READ_TAG_DATA: u8 = 0x20;
+const CMD_INVENTORY: u8 = 0x30;
+const CMD_INVENTORY_GET: u8 = 0x31;
+
+/// Inventory data status (matches Pico INV_DATA_*)
+const INV_DATA_BLOCKS: u8 = 1;
 
 /// Tag types (matches Pico definitions)
 pub const TAG_TYPE_UNKNOWN: u8 = 0;
@@ -50,6 +58,15 @@ pub struct DecodedTagInfo {
     pub tag_type_name: String,
 }
 
+/// One tag found by an inventory round
+#[derive(Debug, Clone)]
+pub struct InventoryTag {
+    pub uid: [u8; 10],
+    pub uid_len: u8,
+    pub tag_type: u8,
+    pub decoded_info: Option<DecodedTagInfo>,
+}
+
 /// NFC Bridge state
 #[derive(Debug, Clone)]
 pub struct NfcBridgeState {
@@ -249,6 +266,87 @@ pub fn read_tag_data(i2c: &mut I2cDriver<'_>, state: &mut NfcBridgeState) -> Res
     }
 }
 
+/// Run an inventory round: every tag in the field, each with its decoded data
+pub fn inventory(i2c: &mut I2cDriver<'_>) -> Result<Vec<InventoryTag>, &'static str> {
+    let seq = next_seq();
+
+    info!("[#{}] TX: INVENTORY", seq);
+    let cmd = [CMD_INVENTORY, seq];
+    if i2c.write(PICO_NFC_ADDR, &cmd, 100).is_err() {
+        warn!("[#{}] I2C write failed", seq);
+        return Err("I2C write failed");
+    }
+
+    // The round takes anticollision plus auth+read of every Bambu tag, so its
+    // length depends on the number of tags. Until it is done the Pico answers
+    // 0xFF (no response yet) - poll instead of one long fixed wait.
+    // Response: [status, count]
+    let mut resp = [0u8; 2];
+    let mut done = false;
+    for _ in 0..40 {
+        std::thread::sleep(std::time::Duration::from_millis(150));
+        if i2c.read(PICO_NFC_ADDR, &mut resp, 100).is_err() {
+            warn!("[#{}] I2C read failed", seq);
+            return Err("I2C read failed");
+        }
+        if resp[0] != 0xFF {
+            done = true;
+            break;
+        }
+    }
+    if !done {
+        warn!("[#{}] Inventory timed out", seq);
+        return Err("Inventory timeout");
+    }
+    if resp[0] != 0 {
+        warn!("[#{}] Inventory failed, status: {}", seq, resp[0]);
+        return Err("Inventory failed");
+    }
+
+    let count = resp[1];
+    info!("[#{}] Inventory: {} tags", seq, count);
+
+    let mut tags = Vec::with_capacity(count as usize);
+    for index in 0..count {
+        let cmd = [CMD_INVENTORY_GET, seq, index];
+        if i2c.write(PICO_NFC_ADDR, &cmd, 100).is_err() {
+            return Err("I2C write failed");
+        }
+        std::thread::sleep(std::time::Duration::from_millis(10));
+
+        // [status, index, tag_type, data_status, uid_len, uid..., 64 block bytes]
+        let mut resp = [0u8; 80];
+        if i2c.read(PICO_NFC_ADDR, &mut resp, 100).is_err() {
+            return Err("I2C read failed");
+        }
+        if resp[0] != 0 || resp[1] != index {
+            warn!("[#{}] Inventory tag {} unavailable (status={})", seq, index, resp[0]);
+            continue;
+        }
+
+        let tag_type = resp[2];
+        let uid_len = resp[4].min(10);
+        let mut uid = [0u8; 10];
+        uid[..uid_len as usize].copy_from_slice(&resp[5..5 + uid_len as usize]);
+        let data_offset = 5 + uid_len as usize;
+
+        let decoded_info = if resp[3] == INV_DATA_BLOCKS {
+            Some(decode_bambu_tag(&resp[data_offset..data_offset + 64]))
+        } else if tag_type == TAG_TYPE_NTAG {
+            Some(DecodedTagInfo {
+                tag_type_name: "NTAG".to_string(),
+                ..Default::default()
+            })
+        } else {
+            None
+        };
+
+        tags.push(InventoryTag { uid, uid_len, tag_type, decoded_info });
+    }
+
+    Ok(tags)
+}
+
 /// Decode Bambu Lab tag data from raw blocks
 fn decode_bambu_tag(block_data: &[u8]) -> DecodedTagInfo {
     // Block layout (each 16 bytes):
@@ -4,14 +4,33 @@
 //! Uses the Pico NFC bridge over I2C.
 
 use log::{info, warn};
+use std::sync::atomic::{AtomicBool, Ordering};
 use std::sync::Mutex;
 
-use crate::nfc::i2c_bridge::{self, NfcBridgeState};
+use crate::nfc::i2c_bridge::{self, InventoryTag, NfcBridgeState};
 use crate::shared_i2c;
 
 /// Global NFC state protected by mutex
 static NFC_STATE: Mutex<Option<NfcBridgeState>> = Mutex::new(None);
 
+/// Bulk inventory mode: poll_nfc() runs inventory rounds instead of single-tag scans
+static INVENTORY_ACTIVE: AtomicBool = AtomicBool::new(false);
+
+/// Consecutive empty scans (~500ms apart) before a tag counts as removed;
+/// a single failed RF poll must not drop the loaded spool
+const TAG_REMOVAL_MISSES: u8 = 3;
+
+/// Result of the last inventory round
+struct InventoryState {
+    round: u32,
+    tags: Vec<InventoryTag>,
+}
+
+static INVENTORY: Mutex<InventoryState> = Mutex::new(InventoryState {
+    round: 0,
+    tags: Vec::new(),
+});
+
 /// NFC status for C code
 #[repr(C)]
 pub struct NfcStatus {
@@ -47,10 +66,42 @@ pub fn init_nfc_manager() -> bool {
     }
 }
 
+/// Run one inventory round (poll_nfc() while inventory mode is active)
+fn poll_inventory() {
+    let mut result = None;
+    {
+        let guard = NFC_STATE.lock().unwrap();
+        if let Some(ref state) = *guard {
+            if state.initialized {
+                result = shared_i2c::with_i2c(|i2c| i2c_bridge::inventory(i2c));
+            }
+        }
+    }
+
+    match result {
+        Some(Ok(tags)) => {
+            let mut inventory = INVENTORY.lock().unwrap();
+            // Mode may have been left while the round ran
+            if INVENTORY_ACTIVE.load(Ordering::Relaxed) {
+                inventory.tags = tags;
+                inventory.round = inventory.round.wrapping_add(1);
+            }
+        }
+        Some(Err(e)) => warn!("NFC inventory error: {}", e),
+        None => {}
+    }
+}
+
 /// Poll the NFC bridge (call from main loop)
 pub fn poll_nfc() {
     static mut LAST_TAG_PRESENT: bool = false;
     static mut TAG_DATA_READ: bool = false;
+    static mut TAG_MISSES: u8 = 0;
+
+    if INVENTORY_ACTIVE.load(Ordering::Relaxed) {
+        poll_inventory();
+        return;
+    }
 
     // Collect data from I2C, then release locks before HTTP calls
     let mut tag_just_appeared = false;
@@ -68,6 +119,10 @@ pub fn poll_nfc() {
                     match i2c_bridge::scan_tag(i2c, state) {
                         Ok(found) => {
                             unsafe {
+                                if found {
+                                    TAG_MISSES = 0;
+                                }
+
                                 if found && !LAST_TAG_PRESENT {
                                     // Tag just appeared
                                     uid_hex = get_uid_hex_string(state);
@@ -115,13 +170,18 @@ pub fn poll_nfc() {
                                 }
 
                                 if !found && LAST_TAG_PRESENT {
-                                    // Tag just removed
-                                    info!("NFC TAG REMOVED");
-                                    clear_decoded_tag_data();
-                                    TAG_DATA_READ = false;
-                                    tag_just_removed = true;
+                                    TAG_MISSES = TAG_MISSES.saturating_add(1);
+                                    if TAG_MISSES >= TAG_REMOVAL_MISSES {
+                                        // Tag removed (debounced)
+                                        info!("NFC TAG REMOVED");
+                                        clear_decoded_tag_data();
+                                        TAG_DATA_READ = false;
+                                        tag_just_removed = true;
+                                        LAST_TAG_PRESENT = false;
+                                    }
+                                } else {
+                                    LAST_TAG_PRESENT = found;
                                 }
-                                LAST_TAG_PRESENT = found;
                             }
                         }
                         Err(e) => {
@@ -147,14 +207,18 @@ pub fn poll_nfc() {
     }
 }
 
+/// Format UID bytes as "XX:XX:XX:XX"
+fn uid_to_hex(uid: &[u8]) -> String {
+    uid.iter()
+        .map(|b| format!("{:02X}", b))
+        .collect::<Vec<_>>()
+        .join(":")
+}
+
 /// Get UID as hex string (internal helper)
 fn get_uid_hex_string(state: &NfcBridgeState) -> String {
     if state.tag_present && state.tag_uid_len > 0 {
-        state.tag_uid[..state.tag_uid_len as usize]
-            .iter()
-            .map(|b| format!("{:02X}", b))
-            .collect::<Vec<_>>()
-            .join(":")
+        uid_to_hex(&state.tag_uid[..state.tag_uid_len as usize])
     } else {
         String::new()
     }
@@ -489,3 +553,91 @@ pub extern "C" fn nfc_get_tag_type() -> *const std::ffi::c_char {
         TYPE_BUF.as_ptr() as *const std::ffi::c_char
     }
 }
+
+// =============================================================================
+// Bulk Inventory FFI Functions
+// =============================================================================
+
+/// One tag of the last inventory round (matches NfcInventoryTag in ui_internal.h)
+#[repr(C)]
+pub struct NfcInventoryTag {
+    pub uid_hex: [u8; 32],
+    pub tag_type: u8,
+    pub decoded: bool,
+    pub vendor: [u8; 32],
+    pub material: [u8; 32],
+    pub subtype: [u8; 32],
+    pub color_name: [u8; 32],
+    pub color_rgba: u32,
+    pub spool_weight: i32,
+}
+
+/// Enter or leave bulk inventory mode. Entering clears the previous result.
+#[no_mangle]
+pub extern "C" fn nfc_inventory_set_active(active: bool) {
+    let mut inventory = INVENTORY.lock().unwrap();
+    if active && !INVENTORY_ACTIVE.load(Ordering::Relaxed) {
+        inventory.tags.clear();
+        inventory.round = 0;
+    }
+    INVENTORY_ACTIVE.store(active, Ordering::Relaxed);
+    info!("NFC inventory mode {}", if active { "on" } else { "off" });
+}
+
+/// Check if bulk inventory mode is active
+#[no_mangle]
+pub extern "C" fn nfc_inventory_is_active() -> bool {
+    INVENTORY_ACTIVE.load(Ordering::Relaxed)
+}
+
+/// Number of completed inventory rounds since the mode was entered
+#[no_mangle]
+pub extern "C" fn nfc_inventory_get_round() -> u32 {
+    INVENTORY.lock().unwrap().round
+}
+
+/// Number of tags found by the last inventory round
+#[no_mangle]
+pub extern "C" fn nfc_inventory_get_count() -> i32 {
+    INVENTORY.lock().unwrap().tags.len() as i32
+}
+
+/// Copy tag `index` of the last inventory round (false if out of range)
+#[no_mangle]
+pub extern "C" fn nfc_inventory_get_tag(index: i32, tag: *mut NfcInventoryTag) -> bool {
+    if tag.is_null() || index < 0 {
+        return false;
+    }
+
+    let inventory = INVENTORY.lock().unwrap();
+    let src = match inventory.tags.get(index as usize) {
+        Some(t) => t,
+        None => return false,
+    };
+
+    let tag = unsafe { &mut *tag };
+    *tag = NfcInventoryTag {
+        uid_hex: [0; 32],
+        tag_type: src.tag_type,
+        decoded: false,
+        vendor: [0; 32],
+        material: [0; 32],
+        subtype: [0; 32],
+        color_name: [0; 32],
+        color_rgba: 0,
+        spool_weight: 0,
+    };
+    copy_str_to_buf(&uid_to_hex(&src.uid[..src.uid_len as usize]), &mut tag.uid_hex);
+
+    if let Some(ref info) = src.decoded_info {
+        // NTAG without spool data only carries a type name
+        tag.decoded = !info.material.is_empty();
+        copy_str_to_buf(&info.vendor, &mut tag.vendor);
+        copy_str_to_buf(&info.material, &mut tag.material);
+        copy_str_to_buf(&info.material_subtype, &mut tag.subtype);
+        copy_str_to_buf(&info.color_name, &mut tag.color_name);
+        tag.color_rgba = info.color_rgba;
+        tag.spool_weight = info.spool_weight;
+    }
+    true
+}
@@ -1,7 +1,8 @@
 //! OTA Firmware Update Manager
 //!
 //! Implements PSRAM-buffered OTA for single-partition systems:
-//! 1. Download firmware to PSRAM
+//! 1. Download firmware to PSRAM - as a delta against the running image when
+//!    the backend has one (rebuilt and SHA-256 verified in PSRAM), else in full
 //! 2. Validate checksum
 //! 3. Erase and write to factory partition
 //! 4. Reboot
@@ -13,17 +14,19 @@
 
 use esp_idf_svc::http::client::{Configuration as HttpConfig, EspHttpConnection};
 use esp_idf_sys::{
-    esp_partition_find, esp_partition_erase_range, esp_partition_write,
+    esp_partition_find, esp_partition_erase_range, esp_partition_read, esp_partition_write,
     esp_partition_t, esp_partition_type_t_ESP_PARTITION_TYPE_APP,
     esp_partition_subtype_t_ESP_PARTITION_SUBTYPE_APP_FACTORY,
     esp_partition_iterator_t, esp_partition_get, esp_partition_iterator_release,
     esp_restart,
 };
 use embedded_svc::http::client::Client as HttpClient;
-use log::info;
+use log::{info, warn};
 use std::ptr;
 use std::sync::Mutex;
 
+use crate::delta_patch;
+
 // External C function to shutdown display before reboot
 extern "C" {
     fn display_shutdown();
@@ -158,9 +161,17 @@ pub fn check_for_update(server_url: &str) -> Result<UpdateInfo, String> {
 pub fn perform_update(server_url: &str) -> Result<(), String> {
     info!("Starting OTA update from {}", server_url);
 
-    // Step 1: Download to PSRAM
+    // Step 1: Download to PSRAM (delta against the running image if available)
     set_state(OtaState::Downloading { progress: 0 });
-    let firmware_data = download_firmware(server_url)?;
+    let firmware_data = match download_delta_update(server_url) {
+        Ok(Some(image)) => image,
+        Ok(None) => download_firmware(server_url)?,
+        Err(e) => {
+            warn!("Delta update failed ({}), downloading full image", e);
+            set_state(OtaState::Downloading { progress: 0 });
+            download_firmware(server_url)?
+        }
+    };
 
     // Step 2: Validate
     set_state(OtaState::Validating);
@@ -247,6 +258,109 @@ fn download_firmware(server_url: &str) -> Result<Vec<u8>, String> {
     Ok(firmware_data)
 }
 
+/// Download a delta from the running version and rebuild the new image in PSRAM.
+/// Ok(None) when the backend has no delta for this version.
+fn download_delta_update(server_url: &str) -> Result<Option<Vec<u8>>, String> {
+    let url = format!("{}/api/firmware/ota/delta?from_version={}", server_url, CURRENT_VERSION);
+    info!("Requesting firmware delta: {}", url);
+
+    let config = HttpConfig {
+        timeout: Some(std::time::Duration::from_secs(120)),
+        ..Default::default()
+    };
+
+    let connection = EspHttpConnection::new(&config)
+        .map_err(|e| format!("HTTP connection failed: {:?}", e))?;
+    let mut client = HttpClient::wrap(connection);
+
+    let request = client.get(&url)
+        .map_err(|e| format!("HTTP request failed: {:?}", e))?;
+    let mut response = request.submit()
+        .map_err(|e| format!("HTTP submit failed: {:?}", e))?;
+
+    let status = response.status();
+    if status == 404 {
+        info!("No delta available, using full image");
+        return Ok(None);
+    }
+    if status != 200 {
+        return Err(format!("HTTP error: {}", status));
+    }
+
+    let content_length: usize = response.header("Content-Length")
+        .and_then(|s| s.parse().ok())
+        .unwrap_or(0);
+
+    let mut delta = Vec::with_capacity(content_length);
+    let mut buf = vec![0u8; 4096];
+    loop {
+        match response.read(&mut buf) {
+            Ok(0) => break,
+            Ok(n) => {
+                delta.extend_from_slice(&buf[..n]);
+                if content_length > 0 {
+                    let progress = ((delta.len() * 100) / content_length).min(100) as u8;
+                    set_state(OtaState::Downloading { progress });
+                }
+            }
+            Err(e) => return Err(format!("Download error: {:?}", e)),
+        }
+    }
+    info!("Delta downloaded: {} bytes", delta.len());
+
+    // Rebuild from the running image before anything is erased
+    set_state(OtaState::Validating);
+    let header = delta_patch::parse_header(&delta)?;
+    let partition = find_factory_partition()?;
+
+    let running_sha = delta_patch::source_sha256(header.source_size, |offset, buf| {
+        read_partition(partition, offset, buf)
+    })?;
+    if running_sha != header.source_sha256 {
+        return Err("Running image does not match delta source".to_string());
+    }
+
+    let image = delta_patch::apply(
+        &delta,
+        |offset, buf| read_partition(partition, offset, buf),
+        |_| {},
+    )?;
+    info!("Rebuilt {} byte image from {} byte delta (SHA-256 verified)", image.len(), delta.len());
+    Ok(Some(image))
+}
+
+/// Find the factory app partition
+fn find_factory_partition() -> Result<*const esp_partition_t, String> {
+    unsafe {
+        let iterator: esp_partition_iterator_t = esp_partition_find(
+            esp_partition_type_t_ESP_PARTITION_TYPE_APP,
+            esp_partition_subtype_t_ESP_PARTITION_SUBTYPE_APP_FACTORY,
+            ptr::null(),
+        );
+
+        if iterator.is_null() {
+            return Err("Factory partition not found".to_string());
+        }
+
+        let partition: *const esp_partition_t = esp_partition_get(iterator);
+        esp_partition_iterator_release(iterator);
+
+        if partition.is_null() {
+            return Err("Failed to get partition".to_string());
+        }
+        Ok(partition)
+    }
+}
+
+/// Read bytes of the running image from flash
+fn read_partition(partition: *const esp_partition_t, offset: usize, buf: &mut [u8]) -> Result<(), String> {
+    let ret = unsafe { esp_partition_read(partition, offset, buf.as_mut_ptr() as *mut _, buf.len()) };
+    if ret != 0 {
+        return Err(format!("Flash read failed at offset {}: {}", offset, ret));
+    }
+    Ok(())
+}
+
 /// Validate firmware binary
 fn validate_firmware(data: &[u8]) -> Result<(), String> {
     info!("Validating firmware ({} bytes)", data.len());
@@ -276,25 +390,9 @@ fn flash_firmware(data: &[u8]) -> Result<(), String> {
     info!("Flashing {} bytes to factory partition", data.len());
     set_state(OtaState::Flashing { progress: 0 });
 
-    unsafe {
-        // Find factory partition
-        let iterator: esp_partition_iterator_t = esp_partition_find(
-            esp_partition_type_t_ESP_PARTITION_TYPE_APP,
-            esp_partition_subtype_t_ESP_PARTITION_SUBTYPE_APP_FACTORY,
-            ptr::null(),
-        );
-
-        if iterator.is_null() {
-            return Err("Factory partition not found".to_string());
-        }
-
-        let partition: *const esp_partition_t = esp_partition_get(iterator);
-        esp_partition_iterator_release(iterator);
-
-        if partition.is_null() {
-            return Err("Failed to get partition".to_string());
-        }
+    let partition = find_factory_partition()?;
 
+    unsafe {
         let part = &*partition;
         let part_size = part.size as usize;
 
@@ -0,0 +1,232 @@
+//! Slicer preset catalog persisted to NVS flash
+//!
+//! The AMS slot modal lists filament presets from Bambu Cloud (via backend).
+//! Instead of downloading them every time the modal opens, the catalog is
+//! kept in flash together with the backend's content version and served from
+//! memory. The backend reports its current version on heartbeat; the catalog
+//! is only re-downloaded (in the background) when that version changes.
+
+use esp_idf_svc::nvs::{EspDefaultNvsPartition, EspNvs, NvsDefault};
+use log::{info, warn};
+use std::sync::Mutex;
+
+/// NVS namespace for the preset catalog
+const NVS_NAMESPACE: &str = "presets";
+const NVS_KEY_VERSION: &str = "ver";
+const NVS_KEY_CATALOG: &str = "cat";
+
+/// Blob layout version - bump when the encoding changes (old blobs are ignored)
+const CATALOG_FORMAT: u8 = 2;
+
+/// Presets kept (matches MAX_PRESETS in ui_ams_slot_modal.c)
+pub const MAX_CATALOG_PRESETS: usize = 100;
+
+/// Largest blob written. The NVS partition is 24KB and shared with WiFi and
+/// scale settings, so presets past this budget are dropped.
+const MAX_CATALOG_BYTES: usize = 8192;
+
+/// Longest string stored (C buffers are 64 bytes including the terminator)
+const MAX_FIELD_LEN: usize = 63;
+
+const FLAG_CUSTOM: u8 = 0x01;
+
+/// One catalog entry (mirrors the C SlicerPreset)
+#[derive(Clone, Default)]
+pub struct CatalogPreset {
+    pub setting_id: String,
+    pub name: String,
+    pub preset_type: String,
+    pub is_custom: bool,
+    pub brand: String,
+    pub material: String,
+    pub temp_min: u16,
+    pub temp_max: u16,
+}
+
+struct Catalog {
+    version: String,
+    presets: Vec<CatalogPreset>,
+}
+
+/// Global NVS partition for catalog persistence
+static NVS_PARTITION: Mutex<Option<EspDefaultNvsPartition>> = Mutex::new(None);
+
+/// Catalog in memory (loaded from flash at init)
+static CATALOG: Mutex<Option<Catalog>> = Mutex::new(None);
+
+/// Initialize NVS and load the stored catalog
+pub fn init_nvs(nvs: Option<EspDefaultNvsPartition>) {
+    *NVS_PARTITION.lock().unwrap() = nvs;
+
+    if let Some(catalog) = load_catalog_from_nvs() {
+        info!("Loaded preset catalog: {} presets, version {}", catalog.presets.len(), catalog.version);
+        *CATALOG.lock().unwrap() = Some(catalog);
+    } else {
+        info!("No stored preset catalog");
+    }
+}
+
+/// Version of the catalog in memory, if any
+pub fn version() -> Option<String> {
+    CATALOG.lock().unwrap().as_ref().map(|c| c.version.clone())
+}
+
+/// Run f over the cached presets; None if there is no catalog yet
+pub fn with_presets<R>(f: impl FnOnce(&[CatalogPreset]) -> R) -> Option<R> {
+    CATALOG.lock().unwrap().as_ref().map(|c| f(&c.presets))
+}
+
+/// Replace the catalog in memory and in flash
+pub fn store(version: &str, mut presets: Vec<CatalogPreset>) {
+    presets.truncate(MAX_CATALOG_PRESETS);
+    let blob = encode(&mut presets);
+
+    save_catalog_to_nvs(version, &blob);
+    info!("Preset catalog updated: {} presets ({} bytes), version {}", presets.len(), blob.len(), version);
+
+    *CATALOG.lock().unwrap() = Some(Catalog {
+        version: version.to_string(),
+        presets,
+    });
+}
+
+// =============================================================================
+// Encoding: [format][count] then per preset [flags][len][setting_id][len][name][len][type]
+//           [len][brand][len][material][temp_min u16][temp_max u16]
+// =============================================================================
+
+fn push_field(buf: &mut Vec<u8>, s: &str) {
+    let mut end = s.len().min(MAX_FIELD_LEN);
+    while !s.is_char_boundary(end) {
+        end -= 1;
+    }
+    buf.push(end as u8);
+    buf.extend_from_slice(&s.as_bytes()[..end]);
+}
+
+/// Encode presets, dropping any that do not fit MAX_CATALOG_BYTES
+fn encode(presets: &mut Vec<CatalogPreset>) -> Vec<u8> {
+    let mut buf = Vec::with_capacity(MAX_CATALOG_BYTES);
+    buf.push(CATALOG_FORMAT);
+    buf.push(0);
+
+    let mut count = 0;
+    for preset in presets.iter() {
+        let start = buf.len();
+        buf.push(if preset.is_custom { FLAG_CUSTOM } else { 0 });
+        push_field(&mut buf, &preset.setting_id);
+        push_field(&mut buf, &preset.name);
+        push_field(&mut buf, &preset.preset_type);
+        push_field(&mut buf, &preset.brand);
+        push_field(&mut buf, &preset.material);
+        buf.extend_from_slice(&preset.temp_min.to_le_bytes());
+        buf.extend_from_slice(&preset.temp_max.to_le_bytes());
+        if buf.len() > MAX_CATALOG_BYTES {
+            buf.truncate(start);
+            break;
+        }
+        count += 1;
+    }
+
+    presets.truncate(count);
+    buf[1] = count as u8;
+    buf
+}
+
+fn read_field(buf: &[u8], pos: &mut usize) -> Option<String> {
+    let len = *buf.get(*pos)? as usize;
+    let bytes = buf.get(*pos + 1..*pos + 1 + len)?;
+    *pos += 1 + len;
+    Some(String::from_utf8_lossy(bytes).into_owned())
+}
+
+fn read_u16(buf: &[u8], pos: &mut usize) -> Option<u16> {
+    let bytes = buf.get(*pos..*pos + 2)?;
+    *pos += 2;
+    Some(u16::from_le_bytes([bytes[0], bytes[1]]))
+}
+
+fn decode(buf: &[u8]) -> Option<Vec<CatalogPreset>> {
+    if buf.len() < 2 || buf[0] != CATALOG_FORMAT {
+        return None;
+    }
+    let count = buf[1] as usize;
+    let mut presets = Vec::with_capacity(count);
+    let mut pos = 2;
+    for _ in 0..count {
+        let flags = *buf.get(pos)?;
+        pos += 1;
+        presets.push(CatalogPreset {
+            setting_id: read_field(buf, &mut pos)?,
+            name: read_field(buf, &mut pos)?,
+            preset_type: read_field(buf, &mut pos)?,
+            is_custom: flags & FLAG_CUSTOM != 0,
+            brand: read_field(buf, &mut pos)?,
+            material: read_field(buf, &mut pos)?,
+            temp_min: read_u16(buf, &mut pos)?,
+            temp_max: read_u16(buf, &mut pos)?,
+        });
+    }
+    Some(presets)
+}
+
+// =============================================================================
+// NVS
+// =============================================================================
+
+fn open_nvs() -> Option<EspNvs<NvsDefault>> {
+    let nvs_guard = NVS_PARTITION.lock().unwrap();
+    let nvs_partition = nvs_guard.as_ref()?;
+    match EspNvs::new(nvs_partition.clone(), NVS_NAMESPACE, true) {
+        Ok(nvs) => Some(nvs),
+        Err(e) => {
+            warn!("Failed to open NVS namespace for presets: {:?}", e);
+            None
+        }
+    }
+}
+
+fn load_catalog_from_nvs() -> Option<Catalog> {
+    let nvs = open_nvs()?;
+
+    let mut ver_buf = [0u8; 64];
+    let version = match nvs.get_str(NVS_KEY_VERSION, &mut ver_buf) {
+        Ok(Some(v)) => v.to_string(),
+        Ok(None) => return None,
+        Err(e) => {
+            warn!("Failed to read preset catalog version: {:?}", e);
+            return None;
+        }
+    };
+
+    let mut buf = vec![0u8; MAX_CATALOG_BYTES];
+    let presets = match nvs.get_blob(NVS_KEY_CATALOG, &mut buf) {
+        Ok(Some(data)) => decode(data),
+        Ok(None) => None,
+        Err(e) => {
+            warn!("Failed to read preset catalog: {:?}", e);
+            None
+        }
+    }?;
+
+    Some(Catalog { version, presets })
+}
+
+fn save_catalog_to_nvs(version: &str, blob: &[u8]) -> bool {
+    let Some(nvs) = open_nvs() else {
+        warn!("No NVS partition available for saving preset catalog");
+        return false;
+    };
+
+    // Blob first: if the version write is lost, the old version just makes
+    // the next heartbeat sync again
+    if let Err(e) = nvs.set_blob(NVS_KEY_CATALOG, blob) {
+        warn!("Failed to save preset catalog to NVS: {:?}", e);
+        return false;
+    }
+    if let Err(e) = nvs.set_str(NVS_KEY_VERSION, version) {
+        warn!("Failed to save preset catalog version to NVS: {:?}", e);
+        return false;
+    }
+    true
+}
@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+"""
+SpoolBuddy EEZ Screen Table Generator
+
+Post-processes the EEZ Studio output (eez/src/ui/screens.c) into compact
+const descriptor tables that ui_screen_table.c instantiates at runtime:
+
+- one node per widget (type, parent, `objects` slot, geometry)
+- shared const styles (LV_STYLE_CONST_INIT), deduplicated across all screens,
+  replacing the ~2000 inline lv_obj_set_style_*() calls that each allocate a
+  local style property at runtime
+- a few widget setup ops (label text, image source, dropdown options, ...)
+
+Run after exporting from EEZ Studio (update_eez_screens.sh does this).
+Unknown statements in screens.c are an error, so an EEZ upgrade that emits
+something new cannot be dropped silently.
+
+Usage:
+    python eez_screen_tables.py
+    python eez_screen_tables.py --screens ../../eez/src/ui/screens.c --output ../components/eez_ui/ui_screen_tables.c
+    python eez_screen_tables.py --stats   # Print counts only
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+DEFAULT_SCREENS = SCRIPT_DIR.parent.parent / "eez" / "src" / "ui" / "screens.c"
+DEFAULT_OUTPUT = SCRIPT_DIR.parent / "components" / "eez_ui" / "ui_screen_tables.c"
+
+WIDGETS = {
+    "lv_obj_create": "UI_TBL_OBJ",
+    "lv_label_create": "UI_TBL_LABEL",
+    "lv_image_create": "UI_TBL_IMAGE",
+    "lv_button_create": "UI_TBL_BUTTON",
+    "lv_dropdown_create": "UI_TBL_DROPDOWN",
+    "lv_textarea_create": "UI_TBL_TEXTAREA",
+    "lv_slider_create": "UI_TBL_SLIDER",
+    "lv_bar_create": "UI_TBL_BAR",
+    "lv_led_create": "UI_TBL_LED",
+}
+
+# Setter -> (op code, fields). Fields name which op member each argument fills.
+OPS = {
+    "lv_label_set_text": ("UI_TBL_OP_LABEL_TEXT", ("p",)),
+    "lv_label_set_long_mode": ("UI_TBL_OP_LABEL_LONG_MODE", ("a",)),
+    "lv_image_set_src": ("UI_TBL_OP_IMAGE_SRC", ("p",)),
+    "lv_image_set_scale": ("UI_TBL_OP_IMAGE_SCALE", ("a",)),
+    "lv_dropdown_set_options": ("UI_TBL_OP_DROPDOWN_OPTIONS", ("p",)),
+    "lv_dropdown_set_selected": ("UI_TBL_OP_DROPDOWN_SELECTED", ("a",)),
+    "lv_textarea_set_max_length": ("UI_TBL_OP_TEXTAREA_MAX_LENGTH", ("a",)),
+    "lv_textarea_set_placeholder_text": ("UI_TBL_OP_TEXTAREA_PLACEHOLDER", ("p",)),
+    "lv_textarea_set_one_line": ("UI_TBL_OP_TEXTAREA_ONE_LINE", ("a",)),
+    "lv_textarea_set_password_mode": ("UI_TBL_OP_TEXTAREA_PASSWORD", ("a",)),
+    "lv_slider_set_range": ("UI_TBL_OP_SLIDER_RANGE", ("a", "b")),
+    "lv_slider_set_value": ("UI_TBL_OP_SLIDER_VALUE", ("a", None)),
+    "lv_led_set_color": ("UI_TBL_OP_LED_COLOR", ("a",)),
+    "lv_led_set_brightness": ("UI_TBL_OP_LED_BRIGHTNESS", ("a",)),
+    "lv_obj_add_flag": ("UI_TBL_OP_ADD_FLAG", ("a",)),
+    "lv_obj_clear_flag": ("UI_TBL_OP_CLEAR_FLAG", ("a",)),
+    "lv_obj_add_state": ("UI_TBL_OP_ADD_STATE", ("a",)),
+    # Align stays a local property: ui_backend.c removes it when reparenting panels
+    "lv_obj_set_style_align": ("UI_TBL_OP_STYLE_ALIGN", ("a", "b")),
+}
+
+# LVGL 9 renamed some style properties; EEZ still emits the v8 setter names
+STYLE_PROP_RENAMES = {
+    "SHADOW_OFS_X": "SHADOW_OFFSET_X",
+    "SHADOW_OFS_Y": "SHADOW_OFFSET_Y",
+}
+
+INT16_MIN, INT16_MAX = -32768, 32767
+
+RE_FUNC = re.compile(r"^void create_screen_(\w+)\(\) \{$")
+RE_CREATE = re.compile(r"^lv_obj_t \*obj = (lv_\w+_create)\((parent_obj|0)\);$")
+RE_SLOT = re.compile(r"^objects\.(\w+) = obj;$")
+RE_CALL = re.compile(r"^(lv_\w+)\(obj(?:, (.*))?\);$")
+RE_COLOR = re.compile(r"^lv_color_hex\(0x([0-9a-fA-F]{2})?([0-9a-fA-F]{6})\)$")
+
+
+class GeneratorError(Exception):
+    pass
+
+
+def split_args(text: str) -> list:
+    """Split a C argument list on top-level commas (strings and parens aware)."""
+    args, depth, cur, in_str, esc = [], 0, "", False, False
+    for ch in text:
+        if in_str:
+            cur += ch
+            if esc:
+                esc = False
+            elif ch == "\\":
+                esc = True
+            elif ch == '"':
+                in_str = False
+            continue
+        if ch == '"':
+            in_str = True
+        elif ch == "(":
+            depth += 1
+        elif ch == ")":
+            depth -= 1
+        elif ch == "," and depth == 0:
+            args.append(cur.strip())
+            cur = ""
+            continue
+        cur += ch
+    if cur.strip():
+        args.append(cur.strip())
+    return args
+
+
+def color_rgb(value: str) -> int:
+    m = RE_COLOR.match(value)
+    if not m:
+        raise GeneratorError(f"Unsupported color expression: {value}")
+    return int(m.group(2), 16)
+
+
+def style_value(value: str) -> str:
+    """Convert a runtime style argument into a constant initializer."""
+    if value.startswith("lv_color_hex("):
+        rgb = color_rgb(value)
+        return f"LV_COLOR_MAKE(0x{(rgb >> 16) & 0xFF:02x}, 0x{(rgb >> 8) & 0xFF:02x}, 0x{rgb & 0xFF:02x})"
+    return value
+
+
+def coord(value: str, line_no: int) -> str:
+    if value == "LV_SIZE_CONTENT":
+        return "UI_TBL_SIZE_CONTENT"
+    try:
+        v = int(value)
+    except ValueError:
+        raise GeneratorError(f"line {line_no}: unsupported coordinate '{value}'")
+    if not INT16_MIN < v <= INT16_MAX:
+        raise GeneratorError(f"line {line_no}: coordinate {v} out of range")
+    return str(v)
+
+
+class Node:
+    def __init__(self, widget: str, parent: int, line_no: int):
+        self.widget = widget
+        self.parent = parent
+        self.line_no = line_no
+        self.slot = None
+        self.name = None
+        self.pos = ("0", "0")
+        self.size = ("0", "0")
+        self.styles = {}  # selector -> {prop: value}
+        self.ops = []  # (op, a, b, p)
+
+
+def parse_screens(source: str) -> dict:
+    """Parse create_screen_*() functions into {screen_name: [Node]}."""
+    screens = {}
+    lines = source.splitlines()
+    i = 0
+    while i < len(lines):
+        m = RE_FUNC.match(lines[i].strip())
+        if not m:
+            i += 1
+            continue
+        name = m.group(1)
+        nodes = []
+        depth = 1
+        obj_stack = []  # (brace depth, node index) - innermost `obj` in scope
+        parent_stack = []  # (brace depth, node index) - innermost `parent_obj`
+        i += 1
+        while i < len(lines):
+            line_no = i + 1
+            stmt = lines[i].strip()
+            i += 1
+            if not stmt or stmt.startswith("//"):
+                continue
+            if stmt == "{":
+                depth += 1
+                continue
+            if stmt == "}":
+                depth -= 1
+                obj_stack = [e for e in obj_stack if e[0] <= depth]
+                parent_stack = [e for e in parent_stack if e[0] <= depth]
+                if depth == 0:
+                    break
+                continue
+            if stmt == "lv_obj_t *parent_obj = obj;":
+                parent_stack.append((depth, obj_stack[-1][1]))
+                continue
+            if stmt == f"tick_screen_{name}();":
+                continue
+
+            m = RE_CREATE.match(stmt)
+            if m:
+                func, parent_arg = m.groups()
+                if func not in WIDGETS:
+                    raise GeneratorError(f"line {line_no}: unsupported widget {func}")
+                parent = -1 if parent_arg == "0" else parent_stack[-1][1]
+                nodes.append(Node(WIDGETS[func], parent, line_no))
+                obj_stack.append((depth, len(nodes) - 1))
+                continue
+
+            if not obj_stack:
+                raise GeneratorError(f"line {line_no}: statement outside of an object: {stmt}")
+            node = nodes[obj_stack[-1][1]]
+
+            m = RE_SLOT.match(stmt)
+            if m:
+                node.slot = m.group(1)
+                node.name = m.group(1)
+                continue
+
+            m = RE_CALL.match(stmt)
+            if not m:
+                raise GeneratorError(f"line {line_no}: unsupported statement: {stmt}")
+            func, argtext = m.group(1), m.group(2) or ""
+            args = split_args(argtext)
+
+            if func == "lv_obj_set_pos":
+                node.pos = (coord(args[0], line_no), coord(args[1], line_no))
+            elif func == "lv_obj_set_size":
+                node.size = (coord(args[0], line_no), coord(args[1], line_no))
+            elif func in OPS:
+                op, fields = OPS[func]
+                a, b, p = "0", "0", "NULL"
+                for field, arg in zip(fields, args):
+                    if field == "a":
+                        a = f"0x{color_rgb(arg):06x}" if arg.startswith("lv_color_hex(") else arg
+                    elif field == "b":
+                        b = arg
+                    elif field == "p":
+                        p = arg
+                node.ops.append((op, a, b, p))
+            elif func.startswith("lv_obj_set_style_"):
+                prop = func[len("lv_obj_set_style_"):].upper()
+                prop = STYLE_PROP_RENAMES.get(prop, prop)
+                value, selector = args
+                node.styles.setdefault(selector, {})[prop] = style_value(value)
+            else:
+                raise GeneratorError(f"line {line_no}: unsupported call {func}")
+        screens[name] = nodes
+    return screens
+
+
+def c_string_comment(text: str) -> str:
+    return text.replace("*/", "* /")
+
+
+def generate(screens: dict, source_name: str) -> tuple:
+    """Emit the C source. Returns (text, stats)."""
+    style_ids = {}  # key -> id
+    style_defs = []  # (id, props)
+    out_screens = []
+    stats = {"nodes": 0, "style_calls": 0, "style_refs": 0, "ops": 0}
+
+    for name, nodes in screens.items():
+        refs, ops, rows = [], [], []
+        for idx, node in enumerate(nodes):
+            style_first = len(refs)
+            for selector, props in node.styles.items():
+                key = (selector, tuple(sorted(props.items())))
+                if key not in style_ids:
+                    style_ids[key] = len(style_defs)
+                    style_defs.append((len(style_defs), sorted(props.items())))
+                refs.append((style_ids[key], selector))
+                stats["style_calls"] += len(props)
+            op_first = len(ops)
+            ops.extend(node.ops)
+            if len(node.styles) > 255 or len(node.ops) > 255:
+                raise GeneratorError(f"{name}: node {idx} has too many styles/ops")
+            slot = f"UI_TBL_SLOT({node.slot})" if node.slot else "-1"
+            rows.append(
+                f"    {{ {node.widget}, {node.parent}, {slot}, {node.pos[0]}, {node.pos[1]}, "
+                f"{node.size[0]}, {node.size[1]}, {style_first}, {len(node.styles)}, "
+                f"{op_first}, {len(node.ops)} }},"
+                + (f"  // {node.name}" if node.name else "")
+            )
+        stats["nodes"] += len(nodes)
+        stats["style_refs"] += len(refs)
+        stats["ops"] += len(ops)
+        out_screens.append((name, rows, refs, ops))
+
+    lines = [
+        f"// Generated by firmware/tools/eez_screen_tables.py from {source_name} - do not edit.",
+        "// Regenerate after every EEZ Studio export (update_eez_screens.sh runs it).",
+        "",
+        '#include "ui_screen_table.h"',
+        '#include "images.h"',
+        '#include "fonts.h"',
+        "",
+        "// =============================================================================",
+        f"// Shared styles ({len(style_defs)} unique, from {stats['style_calls']} inline style calls)",
+        "// =============================================================================",
+        "",
+    ]
+    for sid, props in style_defs:
+        lines.append(f"static const lv_style_const_prop_t style_{sid}_props[] = {{")
+        for prop, value in props:
+            lines.append(f"    LV_STYLE_CONST_{prop}({value}),")
+        lines.append("    LV_STYLE_CONST_PROPS_END")
+        lines.append("};")
+        lines.append(f"static LV_STYLE_CONST_INIT(style_{sid}, style_{sid}_props);")
+        lines.append("")
+
+    for name, rows, refs, ops in out_screens:
+        lines += [
+            "// =============================================================================",
+            f"// {name} ({len(rows)} objects)",
+            "// =============================================================================",
+            "",
+            f"static const ui_tbl_node_t {name}_nodes[] = {{",
+            *rows,
+            "};",
+            "",
+        ]
+        if refs:
+            lines.append(f"static const ui_tbl_style_ref_t {name}_styles[] = {{")
+            lines += [f"    {{ &style_{sid}, {sel} }}," for sid, sel in refs]
+            lines += ["};", ""]
+        if ops:
+            lines.append(f"static const ui_tbl_op_t {name}_ops[] = {{")
+            lines += [f"    {{ {op}, (int32_t)({a}), (int32_t)({b}), {p} }}," for op, a, b, p in ops]
+            lines += ["};", ""]
+        lines += [
+            f"const ui_screen_table_t ui_screen_table_{name} = {{",
+            f'    "{name}",',
+            f"    {name}_nodes,",
+            f"    sizeof({name}_nodes) / sizeof({name}_nodes[0]),",
+            f"    {name + '_styles' if refs else 'NULL'},",
+            f"    {name + '_ops' if ops else 'NULL'},",
+            "};",
+            "",
+        ]
+
+    lines += [
+        "const ui_screen_table_t *ui_screen_table_get(enum ScreensEnum screen_id) {",
+        "    switch (screen_id) {",
+    ]
+    for name, *_ in out_screens:
+        lines.append(f"        case SCREEN_ID_{name.upper()}: return &ui_screen_table_{name};")
+    lines += [
+        "        default: return NULL;",
+        "    }",
+        "}",
+        "",
+    ]
+    stats["styles"] = len(style_defs)
+    stats["screens"] = len(out_screens)
+    return "\n".join(lines), stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate const screen descriptor tables from EEZ screens.c")
+    parser.add_argument("--screens", type=Path, default=DEFAULT_SCREENS, help="EEZ-generated screens.c")
+    parser.add_argument("--output", type=Path, default=DEFAULT_OUTPUT, help="Output C file")
+    parser.add_argument("--stats", action="store_true", help="Print statistics only, don't write")
+    args = parser.parse_args()
+
+    try:
+        screens = parse_screens(args.screens.read_text())
+        text, stats = generate(screens, "eez/src/ui/screens.c")
+    except GeneratorError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    print(
+        f"{stats['screens']} screens, {stats['nodes']} objects, "
+        f"{stats['style_calls']} style calls -> {stats['styles']} shared styles "
+        f"({stats['style_refs']} refs), {stats['ops']} ops"
+    )
+    if not args.stats:
+        args.output.write_text(text)
+        print(f"Wrote {args.output}")
+
+
+if __name__ == "__main__":
+    main()
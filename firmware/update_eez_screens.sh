@@ -64,6 +64,12 @@ sed_inplace '/objects.encode_tag = obj;/,/objects.catalog = obj;/{s/objects.sett
 
 echo "  - Applied fixes to EEZ source files"
 
+# Regenerate screen descriptor tables from the fixed screens.c
+python3 "$SCRIPT_DIR/tools/eez_screen_tables.py" \
+    --screens "$EEZ_DIR/screens.c" \
+    --output "$FIRMWARE_UI_DIR/ui_screen_tables.c"
+echo "  - Regenerated ui_screen_tables.c"
+
 # ============================================================
 # Step 2: Create firmware symlinks
 # ============================================================
@@ -144,6 +150,21 @@ CUSTOM_FILES=(
     "ui_status_bar.c"
     "ui_status_bar.h"
     "ui_internal.h"
+    "ui_screen_table.c"
+    "ui_screen_table.h"
+    "ui_screen_tables.c"
+    "ui_slot_stripes.c"
+    "ui_slot_stripes.h"
+    "ui_spool_gauge.c"
+    "ui_spool_gauge.h"
+    "ui_keyboard.c"
+    "ui_keyboard.h"
+    "ui_mem_arena.c"
+    "ui_mem_arena.h"
+    "ui_log.c"
+    "ui_log.h"
+    "ui_nfc_inventory.c"
+    "ui_nfc_inventory.h"
 )
 
 for file in "${CUSTOM_FILES[@]}"; do
@@ -209,6 +209,9 @@ export function SerialTerminal() {
         try {
           const msg = JSON.parse(event.data);
           if (msg.type === 'data') {
+            if (msg.dropped) {
+              appendOutput(`\n--- ${msg.dropped} bytes dropped (output too fast) ---\n`);
+            }
             appendOutput(msg.data);
           } else if (msg.type === 'error') {
             appendOutput(`--- Error: ${msg.message} ---\n`);
@@ -258,6 +258,8 @@ export interface ESP32ConnectionStatus {
 export interface ESP32DiscoveryResult {
   devices: ESP32DeviceInfo[];
   scan_duration_ms: number;
+  cached?: boolean;
+  partial?: boolean;
 }
 
 export interface ESP32RecoveryInfo {
@@ -4,9 +4,12 @@
  */
 
 #include "backend_client.h"
+#include "sim_control.h"
+#include "ui/ui_log.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <time.h>
 #include <pthread.h>
 #include <curl/curl.h>
@@ -18,6 +21,8 @@
 #include "cJSON.h"
 #endif
 
+static const char *TAG = "backend";
+
 // Backend state
 static BackendState g_state = {0};
 static char g_base_url[256] = BACKEND_DEFAULT_URL;
@@ -89,7 +94,7 @@ static size_t write_callback(void *contents, size_t size, size_t nmemb, void *us
 
     char *ptr = realloc(buf->data, buf->size + realsize + 1);
     if (!ptr) {
-        fprintf(stderr, "[backend] realloc failed\n");
+        UI_LOGE("realloc failed");
         return 0;
     }
 
@@ -110,12 +115,12 @@ int backend_init(const char *base_url) {
     g_curl = curl_easy_init();
 
     if (!g_curl) {
-        fprintf(stderr, "[backend] Failed to init curl\n");
+        UI_LOGE("Failed to init curl");
         return -1;
     }
 
     memset(&g_state, 0, sizeof(g_state));
-    printf("[backend] Initialized with URL: %s\n", g_base_url);
+    UI_LOGI("Initialized with URL: %s", g_base_url);
     return 0;
 }
 
@@ -125,13 +130,13 @@ void backend_cleanup(void) {
         g_curl = NULL;
     }
     curl_global_cleanup();
-    printf("[backend] Cleanup complete\n");
+    UI_LOGI("Cleanup complete");
 }
 
 void backend_set_url(const char *base_url) {
     if (base_url) {
         strncpy(g_base_url, base_url, sizeof(g_base_url) - 1);
-        printf("[backend] URL set to: %s\n", g_base_url);
+        UI_LOGI("URL set to: %s", g_base_url);
     }
 }
 
@@ -174,8 +179,8 @@ static void parse_ams_tray(cJSON *tray_json, BackendAmsTray *tray) {
     tray->nozzle_temp_max = item ? item->valueint : 0;
 
     // Debug: Log tray parsing
-    printf("[backend] Tray %d.%d: type='%s' color='%s' sub_brands='%s'\n",
-           tray->ams_id, tray->tray_id, tray->tray_type, tray->tray_color, tray->tray_sub_brands);
+    UI_LOGD("Tray %d.%d: type='%s' color='%s' sub_brands='%s'",
+            tray->ams_id, tray->tray_id, tray->tray_type, tray->tray_color, tray->tray_sub_brands);
 }
 
 // Parse AMS unit from JSON
@@ -254,8 +259,8 @@ static void parse_printer_state(cJSON *state_json, BackendPrinterState *printer)
     printer->tray_now_right = item && !cJSON_IsNull(item) ? item->valueint : -1;
 
     // Debug: Log tray_now values
-    printf("[backend] Parsed tray_now=%d, left=%d, right=%d\n",
-           printer->tray_now, printer->tray_now_left, printer->tray_now_right);
+    UI_LOGD("Parsed tray_now=%d, left=%d, right=%d",
+            printer->tray_now, printer->tray_now_left, printer->tray_now_right);
 
     item = cJSON_GetObjectItem(state_json, "active_extruder");
     printer->active_extruder = item && !cJSON_IsNull(item) ? item->valueint : -1;
@@ -310,12 +315,19 @@ static cJSON *fetch_json(const char *url) {
     return json;
 }
 
+static void sync_preset_catalog(const char *remote_version);
+
 int backend_send_heartbeat(void) {
     char url[512];
     snprintf(url, sizeof(url), "%s/api/display/heartbeat", g_base_url);
 
     cJSON *json = fetch_json(url);
     if (json) {
+        // Preset catalog is re-downloaded only when the backend's version changes
+        cJSON *presets_version = cJSON_GetObjectItem(json, "presets_version");
+        if (presets_version && cJSON_IsString(presets_version)) {
+            sync_preset_catalog(presets_version->valuestring);
+        }
         cJSON_Delete(json);
         return 0;
     }
@@ -421,17 +433,17 @@ int backend_poll(void) {
         if (item && cJSON_IsNumber(item)) {
             g_scale_weight = (float)item->valuedouble;
             g_state.device.last_weight = g_scale_weight;
-            printf("[backend] Scale weight from backend: %.1f g\n", g_scale_weight);
+            UI_LOGD("Scale weight from backend: %.1f g", g_scale_weight);
         } else {
-            printf("[backend] No scale weight from backend (null or not a number)\n");
+            UI_LOGD("No scale weight from backend (null or not a number)");
         }
         item = cJSON_GetObjectItem(json, "weight_stable");
         if (item) {
             g_scale_stable = cJSON_IsTrue(item);
             g_state.device.weight_stable = g_scale_stable;
-            printf("[backend] Scale stable: %s\n", g_scale_stable ? "yes" : "no");
+            UI_LOGD("Scale stable: %s", g_scale_stable ? "yes" : "no");
         } else {
-            printf("[backend] No weight_stable field in response\n");
+            UI_LOGD("No weight_stable field in response");
         }
 
         // Parse WiFi status from device (but respect local disconnect holdoff)
@@ -492,8 +504,8 @@ int backend_poll(void) {
             time_t now = time(NULL);
             if (difftime(now, g_staging_cleared_time) < STAGING_CLEAR_HOLDOFF_SEC) {
                 // Within holdoff period - don't overwrite cleared state
-                printf("[backend] Ignoring staging update (holdoff active: %.0fs remaining)\n",
-                       STAGING_CLEAR_HOLDOFF_SEC - difftime(now, g_staging_cleared_time));
+                UI_LOGD("Ignoring staging update (holdoff active: %.0fs remaining)",
+                        STAGING_CLEAR_HOLDOFF_SEC - difftime(now, g_staging_cleared_time));
             } else {
                 // Holdoff expired - resume normal updates
                 g_staging_cleared_locally = false;
@@ -505,15 +517,15 @@ int backend_poll(void) {
             g_staging_remaining = remaining;
         }
 
-        printf("[backend] Staging: remaining=%.1fs, has_staged_tag=%s\n",
-               remaining, has_staged_tag ? "YES" : "no");
+        UI_LOGD("Staging: remaining=%.1fs, has_staged_tag=%s",
+                remaining, has_staged_tag ? "YES" : "no");
 
         if (has_staged_tag) {
             // Real device has a tag - sync to simulator
             bool was_present = g_nfc_tag_present;
             g_nfc_tag_present = true;
             if (!was_present) {
-                printf("[backend] NFC tag synced from device - popup should appear\n");
+                UI_LOGI("NFC tag synced from device - popup should appear");
                 // Clear "just added" flag when a NEW tag is placed
                 // (so we don't show stale message from previous spool)
                 g_spool_just_added = false;
@@ -543,7 +555,7 @@ int backend_poll(void) {
                 } else {
                     // Holdoff expired
                     g_tag_cache_updated_locally = false;
-                    printf("[backend] Tag cache holdoff expired, allowing poll updates\n");
+                    UI_LOGD("Tag cache holdoff expired, allowing poll updates");
                 }
             }
 
@@ -575,7 +587,7 @@ int backend_poll(void) {
         } else {
             // Staging expired or no tag - clear simulator NFC state
             if (g_nfc_tag_present) {
-                printf("[backend] Staging expired (remaining=%.1fs) - closing popup\n", remaining);
+                UI_LOGI("Staging expired (remaining=%.1fs) - closing popup", remaining);
                 g_nfc_tag_present = false;
                 g_tag_vendor[0] = '\0';
                 g_tag_material[0] = '\0';
@@ -655,7 +667,7 @@ const char *backend_fetch_cover_image(const char *serial) {
 
     FILE *fp = fopen(g_cover_path, "wb");
     if (!fp) {
-        fprintf(stderr, "[backend] Failed to open temp file for cover image\n");
+        UI_LOGE("Failed to open temp file for cover image");
         return NULL;
     }
 
@@ -671,7 +683,7 @@ const char *backend_fetch_cover_image(const char *serial) {
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
 
     if (res != CURLE_OK) {
-        fprintf(stderr, "[backend] Failed to fetch cover image: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Failed to fetch cover image: %s", curl_easy_strerror(res));
         remove(g_cover_path);
         g_cover_serial[0] = '\0';
         return NULL;
@@ -681,14 +693,14 @@ const char *backend_fetch_cover_image(const char *serial) {
     long http_code = 0;
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
     if (http_code != 200) {
-        fprintf(stderr, "[backend] Cover image HTTP error: %ld\n", http_code);
+        UI_LOGE("Cover image HTTP error: %ld", http_code);
         remove(g_cover_path);
         g_cover_serial[0] = '\0';
         return NULL;
     }
 
     strncpy(g_cover_serial, serial, sizeof(g_cover_serial) - 1);
-    printf("[backend] Fetched cover image for %s\n", serial);
+    UI_LOGI("Fetched cover image for %s", serial);
     return g_cover_path;
 }
 
@@ -903,6 +915,50 @@ bool spool_exists_by_tag(const char *tag_id) {
     return found;
 }
 
+int spool_tags_known(const char **tag_ids, int count, bool *known) {
+    if (!tag_ids || !known || count <= 0 || !g_curl) return -1;
+
+    // GET /api/spools/known-tags?tag_ids=a,b,c
+    char url[1024];
+    int len = snprintf(url, sizeof(url), "%s/api/spools/known-tags?tag_ids=", g_base_url);
+    for (int i = 0; i < count && len < (int)sizeof(url); i++) {
+        known[i] = false;
+        len += snprintf(url + len, sizeof(url) - len, "%s%s", i ? "," : "", tag_ids[i]);
+    }
+    if (len >= (int)sizeof(url)) return -1;
+
+    ResponseBuffer response = {0};
+
+    curl_easy_reset(g_curl);
+    curl_easy_setopt(g_curl, CURLOPT_URL, url);
+    curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(g_curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 5L);
+
+    CURLcode res = curl_easy_perform(g_curl);
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    int result = -1;
+    cJSON *json = (res == CURLE_OK && http_code == 200 && response.data) ? cJSON_Parse(response.data) : NULL;
+    if (json && cJSON_IsArray(json)) {
+        cJSON *tid;
+        cJSON_ArrayForEach(tid, json) {
+            if (!cJSON_IsString(tid)) continue;
+            for (int i = 0; i < count; i++) {
+                if (strcmp(tid->valuestring, tag_ids[i]) == 0) known[i] = true;
+            }
+        }
+        result = 0;
+    } else {
+        UI_LOGW("spool_tags_known: request failed (res=%d, http=%ld)", res, http_code);
+    }
+    cJSON_Delete(json);
+
+    free(response.data);
+    return result;
+}
+
 bool spool_get_by_tag_full(const char *tag_id, SpoolInfo *info) {
     if (!tag_id || !info || !g_curl) {
         if (info) info->valid = false;
@@ -964,8 +1020,8 @@ bool spool_get_by_tag_full(const char *tag_id, SpoolInfo *info) {
                             strcat(rgba_padded, "FF");
                         }
                         info->color_rgba = (uint32_t)strtoul(rgba_padded, NULL, 16);
-                        printf("[backend] spool_get_by_tag: rgba string='%s' (padded='%s') -> color_rgba=0x%08X\n",
-                               field->valuestring, rgba_padded, info->color_rgba);
+                        UI_LOGD("spool_get_by_tag: rgba string='%s' (padded='%s') -> color_rgba=0x%08X",
+                                field->valuestring, rgba_padded, info->color_rgba);
                     }
 
                     field = cJSON_GetObjectItem(spool, "label_weight");
@@ -1055,7 +1111,7 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
                             int label_weight, int weight_current, const char *data_origin,
                             const char *tag_type, const char *slicer_filament) {
     if (!g_curl) {
-        printf("[backend] spool_add_to_inventory: curl not initialized\n");
+        UI_LOGW("spool_add_to_inventory: curl not initialized");
         return false;
     }
 
@@ -1088,7 +1144,7 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
     cJSON_Delete(json);
 
     if (!body) {
-        printf("[backend] spool_add_to_inventory: failed to create JSON\n");
+        UI_LOGE("spool_add_to_inventory: failed to create JSON");
         return false;
     }
 
@@ -1116,11 +1172,11 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
     bool success = (res == CURLE_OK && http_code == 201);
 
     if (success) {
-        printf("[backend] Spool added to inventory: tag=%s\n", tag_id);
+        UI_LOGI("Spool added to inventory: tag=%s", tag_id);
     } else {
-        printf("[backend] Failed to add spool: HTTP %ld, curl %d\n", http_code, res);
+        UI_LOGE("Failed to add spool: HTTP %ld, curl %d", http_code, res);
         if (response.data) {
-            printf("[backend] Response: %s\n", response.data);
+            UI_LOGD("Response: %s", response.data);
         }
     }
 
@@ -1128,6 +1184,95 @@ bool spool_add_to_inventory(const char *tag_id, const char *vendor, const char *
     return success;
 }
 
+// Add one spool per inventory tag in a single request
+int spool_add_batch_to_inventory(const NfcInventoryTag *tags, int count,
+                                 const char *data_origin, int *skipped) {
+    if (skipped) *skipped = 0;
+    if (!tags || count <= 0) return 0;
+    if (!g_curl) {
+        UI_LOGW("spool_add_batch_to_inventory: curl not initialized");
+        return -1;
+    }
+
+    char url[512];
+    snprintf(url, sizeof(url), "%s/api/spools/batch", g_base_url);
+
+    cJSON *json = cJSON_CreateObject();
+    cJSON *spools = cJSON_CreateArray();
+    cJSON_AddItemToObject(json, "spools", spools);
+    for (int i = 0; i < count; i++) {
+        const NfcInventoryTag *tag = &tags[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "tag_id", tag->uid_hex);
+        cJSON_AddStringToObject(item, "material", tag->material[0] ? tag->material : "Unknown");
+        if (tag->subtype[0]) cJSON_AddStringToObject(item, "subtype", tag->subtype);
+        if (tag->vendor[0]) cJSON_AddStringToObject(item, "brand", tag->vendor);
+        if (tag->color_name[0]) cJSON_AddStringToObject(item, "color_name", tag->color_name);
+
+        char rgba_hex[16];
+        snprintf(rgba_hex, sizeof(rgba_hex), "%08X", tag->color_rgba);
+        cJSON_AddStringToObject(item, "rgba", rgba_hex);
+
+        int label_weight = tag->spool_weight > 0 ? tag->spool_weight : 1000;
+        cJSON_AddNumberToObject(item, "label_weight", label_weight);
+        cJSON_AddNumberToObject(item, "weight_new", label_weight);
+        if (data_origin && data_origin[0]) cJSON_AddStringToObject(item, "data_origin", data_origin);
+        cJSON_AddStringToObject(item, "tag_type", tag->decoded && tag->tag_type == 2 ? "bambu" : "generic");
+        cJSON_AddItemToArray(spools, item);
+    }
+
+    char *body = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+
+    if (!body) {
+        UI_LOGE("spool_add_batch_to_inventory: failed to create JSON");
+        return -1;
+    }
+
+    ResponseBuffer response = {0};
+
+    struct curl_slist *headers = NULL;
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+
+    curl_easy_reset(g_curl);
+    curl_easy_setopt(g_curl, CURLOPT_URL, url);
+    curl_easy_setopt(g_curl, CURLOPT_POSTFIELDS, body);
+    curl_easy_setopt(g_curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(g_curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 10L);
+
+    CURLcode res = curl_easy_perform(g_curl);
+
+    long http_code = 0;
+    curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
+
+    curl_slist_free_all(headers);
+    free(body);
+
+    int created = -1;
+    if (res == CURLE_OK && http_code == 201 && response.data) {
+        cJSON *result = cJSON_Parse(response.data);
+        if (result) {
+            created = cJSON_GetArraySize(cJSON_GetObjectItem(result, "created"));
+            if (skipped) *skipped = cJSON_GetArraySize(cJSON_GetObjectItem(result, "skipped"));
+            cJSON_Delete(result);
+        }
+    }
+
+    if (created >= 0) {
+        UI_LOGI("Batch added %d spools (%d already known)", created, skipped ? *skipped : 0);
+    } else {
+        UI_LOGE("Failed to batch add spools: HTTP %ld, curl %d", http_code, res);
+        if (response.data) {
+            UI_LOGD("Response: %s", response.data);
+        }
+    }
+
+    free(response.data);
+    return created;
+}
+
 // Get K-profiles for a spool by spool ID
 int spool_get_k_profiles(const char *spool_id, SpoolKProfile *profiles, int max_profiles) {
     if (!spool_id || !profiles || max_profiles <= 0 || !g_curl) {
@@ -1196,34 +1341,34 @@ int spool_get_k_profiles(const char *spool_id, SpoolKProfile *profiles, int max_
     }
 
     free(response.data);
-    printf("[backend] spool_get_k_profiles(%s): found %d profiles\n", spool_id, count);
+    UI_LOGI("spool_get_k_profiles(%s): found %d profiles", spool_id, count);
     return count;
 }
 
 // Get K-profile for a spool matching a specific printer
 bool spool_get_k_profile_for_printer_full(const char *spool_id, const char *printer_serial, SpoolKProfile *profile) {
     if (!spool_id || !printer_serial || !profile) {
-        printf("[backend] spool_get_k_profile_for_printer: invalid params (spool=%s, serial=%s)\n",
-               spool_id ? spool_id : "NULL", printer_serial ? printer_serial : "NULL");
+        UI_LOGW("spool_get_k_profile_for_printer: invalid params (spool=%s, serial=%s)",
+                spool_id ? spool_id : "NULL", printer_serial ? printer_serial : "NULL");
         return false;
     }
 
-    printf("[backend] Looking for K-profile: spool=%s, printer=%s\n", spool_id, printer_serial);
+    UI_LOGD("Looking for K-profile: spool=%s, printer=%s", spool_id, printer_serial);
 
     SpoolKProfile profiles[16];
     int count = spool_get_k_profiles(spool_id, profiles, 16);
 
     for (int i = 0; i < count; i++) {
-        printf("[backend] K-profile %d: printer_serial='%s', cali_idx=%d, k_value=%s\n",
-               i, profiles[i].printer_serial, profiles[i].cali_idx, profiles[i].k_value);
+        UI_LOGD("K-profile %d: printer_serial='%s', cali_idx=%d, k_value=%s",
+                i, profiles[i].printer_serial, profiles[i].cali_idx, profiles[i].k_value);
         if (strcmp(profiles[i].printer_serial, printer_serial) == 0) {
             memcpy(profile, &profiles[i], sizeof(SpoolKProfile));
-            printf("[backend] Found matching K-profile: cali_idx=%d\n", profile->cali_idx);
+            UI_LOGI("Found matching K-profile: cali_idx=%d", profile->cali_idx);
             return true;
         }
     }
 
-    printf("[backend] No matching K-profile found for printer %s\n", printer_serial);
+    UI_LOGI("No matching K-profile found for printer %s", printer_serial);
     return false;
 }
 
@@ -1316,7 +1461,7 @@ int spool_get_untagged_list(UntaggedSpoolInfo *spools, int max_count) {
     }
 
     free(response.data);
-    printf("[backend] spool_get_untagged_list: found %d untagged spools\n", count);
+    UI_LOGI("spool_get_untagged_list: found %d untagged spools", count);
     return count;
 }
 
@@ -1334,7 +1479,7 @@ int spool_get_untagged_count(void) {
 // Link an NFC tag to an existing spool
 bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_type) {
     if (!spool_id || !tag_id || !g_curl) {
-        printf("[backend] spool_link_tag: invalid params\n");
+        UI_LOGW("spool_link_tag: invalid params");
         return false;
     }
 
@@ -1353,12 +1498,12 @@ bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_ty
     cJSON_Delete(json);
 
     if (!body) {
-        printf("[backend] spool_link_tag: failed to create JSON\n");
+        UI_LOGE("spool_link_tag: failed to create JSON");
         return false;
     }
 
-    printf("[backend] spool_link_tag: PATCH %s\n", url);
-    printf("[backend] payload: %s\n", body);
+    UI_LOGD("spool_link_tag: PATCH %s", url);
+    UI_LOGD("payload: %s", body);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -1384,11 +1529,11 @@ bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_ty
     bool success = (res == CURLE_OK && http_code == 200);
 
     if (success) {
-        printf("[backend] Tag linked to spool: %s\n", spool_id);
+        UI_LOGI("Tag linked to spool: %s", spool_id);
     } else {
-        printf("[backend] Failed to link tag: HTTP %ld, curl %d\n", http_code, res);
+        UI_LOGE("Failed to link tag: HTTP %ld, curl %d", http_code, res);
         if (response.data) {
-            printf("[backend] Response: %s\n", response.data);
+            UI_LOGD("Response: %s", response.data);
         }
     }
 
@@ -1399,7 +1544,7 @@ bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_ty
 // Sync spool weight from scale to inventory
 bool spool_sync_weight(const char *spool_id, int weight) {
     if (!spool_id || !g_curl) {
-        printf("[backend] spool_sync_weight: invalid params\n");
+        UI_LOGW("spool_sync_weight: invalid params");
         return false;
     }
 
@@ -1412,12 +1557,12 @@ bool spool_sync_weight(const char *spool_id, int weight) {
     cJSON_Delete(json);
 
     if (!body) {
-        printf("[backend] spool_sync_weight: failed to create JSON\n");
+        UI_LOGE("spool_sync_weight: failed to create JSON");
         return false;
     }
 
-    printf("[backend] spool_sync_weight: POST %s\n", url);
-    printf("[backend] payload: %s\n", body);
+    UI_LOGD("spool_sync_weight: POST %s", url);
+    UI_LOGD("payload: %s", body);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -1443,9 +1588,9 @@ bool spool_sync_weight(const char *spool_id, int weight) {
     bool success = (res == CURLE_OK && http_code == 200);
 
     if (success) {
-        printf("[backend] Weight synced for spool %s: %dg\n", spool_id, weight);
+        UI_LOGI("Weight synced for spool %s: %dg", spool_id, weight);
     } else {
-        printf("[backend] Failed to sync weight: HTTP %ld, curl %d\n", http_code, res);
+        UI_LOGE("Failed to sync weight: HTTP %ld, curl %d", http_code, res);
     }
 
     free(response.data);
@@ -1459,7 +1604,7 @@ bool spool_sync_weight(const char *spool_id, int weight) {
 AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id, int tray_id,
                                            const char *spool_id) {
     if (!printer_serial || !spool_id || !g_curl) {
-        printf("[backend] assign_spool_to_tray: invalid params\n");
+        UI_LOGW("assign_spool_to_tray: invalid params");
         return ASSIGN_RESULT_ERROR;
     }
 
@@ -1475,12 +1620,12 @@ AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id
     cJSON_Delete(json);
 
     if (!json_str) {
-        printf("[backend] assign_spool_to_tray: failed to create JSON\n");
+        UI_LOGE("assign_spool_to_tray: failed to create JSON");
         return ASSIGN_RESULT_ERROR;
     }
 
-    printf("[backend] assign_spool_to_tray: POST %s\n", url);
-    printf("[backend] payload: %s\n", json_str);
+    UI_LOGD("assign_spool_to_tray: POST %s", url);
+    UI_LOGD("payload: %s", json_str);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -1505,8 +1650,8 @@ AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id
 
     AssignResult result = ASSIGN_RESULT_ERROR;
 
-    printf("[backend] assign_spool_to_tray: curl_res=%d, http_code=%ld, response=%s\n",
-           res, http_code, response.data ? response.data : "(null)");
+    UI_LOGI("assign_spool_to_tray: curl_res=%d, http_code=%ld, response=%s",
+            res, http_code, response.data ? response.data : "(null)");
 
     if (res == CURLE_OK && http_code == 200 && response.data) {
         // Parse JSON response: {"status": "configured"|"staged", "message": "...", "needs_replacement": bool}
@@ -1532,15 +1677,15 @@ AssignResult backend_assign_spool_to_tray(const char *printer_serial, int ams_id
 
     if (response.data) free(response.data);
 
-    printf("[backend] assign_spool_to_tray: result=%d, http=%ld, assign_result=%d\n",
-           res, http_code, result);
+    UI_LOGI("assign_spool_to_tray: result=%d, http=%ld, assign_result=%d",
+            res, http_code, result);
 
     return result;
 }
 
 bool backend_cancel_staged_assignment(const char *printer_serial, int ams_id, int tray_id) {
     if (!printer_serial || !g_curl) {
-        printf("[backend] cancel_staged_assignment: invalid params\n");
+        UI_LOGW("cancel_staged_assignment: invalid params");
         return false;
     }
 
@@ -1549,7 +1694,7 @@ bool backend_cancel_staged_assignment(const char *printer_serial, int ams_id, in
     snprintf(url, sizeof(url), "%s/api/printers/%s/ams/%d/tray/%d/cancel-staged",
              g_base_url, printer_serial, ams_id, tray_id);
 
-    printf("[backend] cancel_staged_assignment: POST %s\n", url);
+    UI_LOGD("cancel_staged_assignment: POST %s", url);
 
     ResponseBuffer response = {0};
     curl_easy_reset(g_curl);
@@ -1568,8 +1713,8 @@ bool backend_cancel_staged_assignment(const char *printer_serial, int ams_id, in
     if (response.data) free(response.data);
 
     bool success = (res == CURLE_OK && http_code == 204);
-    printf("[backend] cancel_staged_assignment: result=%d, http=%ld, success=%d\n",
-           res, http_code, success);
+    UI_LOGI("cancel_staged_assignment: result=%d, http=%ld, success=%d",
+            res, http_code, success);
 
     return success;
 }
@@ -1590,7 +1735,7 @@ int backend_poll_assignment_completions(double since_timestamp, AssignmentComple
     poll_count++;
 
     if (should_log) {
-        printf("[backend] Polling for completions since %.3f\n", since_timestamp);
+        UI_LOGD("Polling for completions since %.3f", since_timestamp);
     }
 
     ResponseBuffer response = {0};
@@ -1640,10 +1785,10 @@ int backend_poll_assignment_completions(double since_timestamp, AssignmentComple
     }
 
     if (count > 0) {
-        printf("[backend] Found %d assignment completion(s)!\n", count);
+        UI_LOGI("Found %d assignment completion(s)!", count);
         for (int i = 0; i < count; i++) {
-            printf("[backend]   Completion %d: serial=%s, ams=%d, tray=%d, success=%d\n",
-                   i, events[i].serial, events[i].ams_id, events[i].tray_id, events[i].success);
+            UI_LOGI("  Completion %d: serial=%s, ams=%d, tray=%d, success=%d",
+                    i, events[i].serial, events[i].ams_id, events[i].tray_id, events[i].success);
         }
     }
 
@@ -1655,7 +1800,7 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
                                    int cali_idx, const char *filament_id,
                                    const char *nozzle_diameter) {
     if (!printer_serial || !g_curl) {
-        printf("[backend] set_tray_calibration: invalid params\n");
+        UI_LOGW("set_tray_calibration: invalid params");
         return false;
     }
 
@@ -1673,12 +1818,12 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
     cJSON_Delete(json);
 
     if (!json_str) {
-        printf("[backend] set_tray_calibration: failed to create JSON\n");
+        UI_LOGE("set_tray_calibration: failed to create JSON");
         return false;
     }
 
-    printf("[backend] set_tray_calibration: POST %s\n", url);
-    printf("[backend] payload: %s\n", json_str);
+    UI_LOGD("set_tray_calibration: POST %s", url);
+    UI_LOGD("payload: %s", json_str);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -1703,8 +1848,8 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
     if (response.data) free(response.data);
 
     bool success = (res == CURLE_OK && (http_code == 200 || http_code == 204));
-    printf("[backend] set_tray_calibration: result=%d, http=%ld, success=%d\n",
-           res, http_code, success);
+    UI_LOGI("set_tray_calibration: result=%d, http=%ld, success=%d",
+            res, http_code, success);
 
     return success;
 }
@@ -1716,17 +1861,52 @@ bool backend_set_tray_calibration(const char *printer_serial, int ams_id, int tr
 // Static buffer for preset filament_id lookup result
 static char g_preset_filament_id[64] = {0};
 
-int backend_get_slicer_presets(SlicerPreset *presets, int max_count) {
-    if (!presets || max_count <= 0 || !g_curl) {
-        printf("[backend] get_slicer_presets: invalid params\n");
-        return -1;
+// Compact preset feed layout (backend services/preset_feed.py)
+#define FEED_HEADER_SIZE 12
+#define FEED_BRAND_SIZE 24
+#define FEED_MATERIAL_SIZE 8
+#define FEED_RECORD_SIZE 104
+#define FEED_FORMAT 1
+#define FEED_FLAG_CUSTOM 0x01
+
+typedef struct {
+    char *etag;
+    size_t etag_len;
+} EtagCapture;
+
+static size_t etag_header_callback(char *buffer, size_t size, size_t nitems, void *userp) {
+    size_t len = size * nitems;
+    EtagCapture *cap = (EtagCapture *)userp;
+    if (len > 6 && strncasecmp(buffer, "etag:", 5) == 0) {
+        const char *v = buffer + 5;
+        const char *end = buffer + len;
+        while (v < end && (*v == ' ' || *v == '"')) v++;
+        while (end > v && (end[-1] == '\r' || end[-1] == '\n' || end[-1] == '"' || end[-1] == ' ')) end--;
+        size_t n = (size_t)(end - v);
+        if (n >= cap->etag_len) n = cap->etag_len - 1;
+        memcpy(cap->etag, v, n);
+        cap->etag[n] = '\0';
     }
+    return len;
+}
+
+static uint16_t feed_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Download filament presets (GET /api/cloud/filaments/compact) with the catalog version
+// The backend resolves, sorts and packs the presets into fixed-width records.
+// The ETag is "<version>.<format>.<limit>"; the catalog keeps the version part.
+// Returns number of presets, -1 on error
+static int fetch_preset_catalog(SlicerPreset *presets, int max_count, char *version, size_t version_len) {
+    if (!g_curl) return -1;
 
-    // GET /api/cloud/settings
     char url[256];
-    snprintf(url, sizeof(url), "%s/api/cloud/settings", g_base_url);
+    snprintf(url, sizeof(url), "%s/api/cloud/filaments/compact?limit=%d", g_base_url, max_count);
 
     ResponseBuffer response = {0};
+    version[0] = '\0';
+    EtagCapture etag = { version, version_len };
 
     // Lock mutex for curl operations
     pthread_mutex_lock(&g_curl_mutex);
@@ -1735,6 +1915,8 @@ int backend_get_slicer_presets(SlicerPreset *presets, int max_count) {
     curl_easy_setopt(g_curl, CURLOPT_URL, url);
     curl_easy_setopt(g_curl, CURLOPT_WRITEFUNCTION, write_callback);
     curl_easy_setopt(g_curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(g_curl, CURLOPT_HEADERFUNCTION, etag_header_callback);
+    curl_easy_setopt(g_curl, CURLOPT_HEADERDATA, &etag);
     curl_easy_setopt(g_curl, CURLOPT_TIMEOUT, 10L);
 
     CURLcode res = curl_easy_perform(g_curl);
@@ -1745,69 +1927,180 @@ int backend_get_slicer_presets(SlicerPreset *presets, int max_count) {
     pthread_mutex_unlock(&g_curl_mutex);
 
     if (res != CURLE_OK || http_code != 200) {
-        printf("[backend] get_slicer_presets: request failed (res=%d, http=%ld)\n", res, http_code);
+        UI_LOGE("get_slicer_presets: request failed (res=%d, http=%ld)", res, http_code);
         if (response.data) free(response.data);
         return -1;
     }
 
-    if (!response.data) {
-        printf("[backend] get_slicer_presets: empty response\n");
+    const uint8_t *feed = (const uint8_t *)response.data;
+    if (!feed || response.size < FEED_HEADER_SIZE || memcmp(feed, "SBPF", 4) != 0 || feed[4] != FEED_FORMAT) {
+        UI_LOGW("get_slicer_presets: not a preset feed");
+        free(response.data);
         return -1;
     }
 
-    cJSON *json = cJSON_Parse(response.data);
+    size_t count = feed_u16(feed + 8);
+    size_t record_size = feed_u16(feed + 10);
+    size_t records = FEED_HEADER_SIZE + feed[5] * FEED_BRAND_SIZE + feed[6] * FEED_MATERIAL_SIZE;
+    if (record_size < FEED_RECORD_SIZE || response.size < records + count * record_size) {
+        UI_LOGW("get_slicer_presets: truncated feed");
+        free(response.data);
+        return -1;
+    }
+    if (count > (size_t)max_count) count = max_count;
+
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *r = feed + records + i * record_size;
+        memset(&presets[i], 0, sizeof(presets[i]));
+        memcpy(presets[i].setting_id, r, 32);
+        presets[i].setting_id[sizeof(presets[i].setting_id) - 1] = '\0';
+        memcpy(presets[i].name, r + 32, 63);
+        strcpy(presets[i].type, "filament");
+        presets[i].is_custom = (r[98] & FEED_FLAG_CUSTOM) != 0;
+        if (r[96] < feed[5]) {
+            memcpy(presets[i].brand, feed + FEED_HEADER_SIZE + r[96] * FEED_BRAND_SIZE, sizeof(presets[i].brand) - 1);
+        }
+        if (r[97] < feed[6]) {
+            memcpy(presets[i].material, feed + FEED_HEADER_SIZE + feed[5] * FEED_BRAND_SIZE + r[97] * FEED_MATERIAL_SIZE,
+                   sizeof(presets[i].material) - 1);
+        }
+        presets[i].temp_min = (int16_t)feed_u16(r + 100);
+        presets[i].temp_max = (int16_t)feed_u16(r + 102);
+    }
+
+    char *dot = strchr(version, '.');
+    if (dot) *dot = '\0';
+
     free(response.data);
+    UI_LOGI("get_slicer_presets: found %d presets", (int)count);
+    return (int)count;
+}
 
-    if (!json) {
-        printf("[backend] get_slicer_presets: JSON parse failed\n");
+// =============================================================================
+// Preset catalog (file stands in for the device's NVS catalog)
+// =============================================================================
+
+#define PRESET_CATALOG_MAX 100
+#define PRESET_CATALOG_MAGIC 0x53425032  // "SBP2" (bump when SlicerPreset changes)
+
+static SlicerPreset g_preset_catalog[PRESET_CATALOG_MAX];
+static int g_preset_catalog_count = -1;  // -1 = no catalog
+static char g_preset_catalog_version[40] = {0};
+static bool g_preset_catalog_loaded = false;
+static pthread_mutex_t g_preset_mutex = PTHREAD_MUTEX_INITIALIZER;
+static const char *g_preset_catalog_path = "/tmp/spoolbuddy_presets.bin";
+
+// Call with g_preset_mutex held
+static void preset_catalog_load(void) {
+    if (g_preset_catalog_loaded) return;
+    g_preset_catalog_loaded = true;
+
+    FILE *fp = fopen(g_preset_catalog_path, "rb");
+    if (!fp) return;
+
+    uint32_t magic = 0;
+    int32_t count = 0;
+    char version[sizeof(g_preset_catalog_version)];
+    bool ok = fread(&magic, sizeof(magic), 1, fp) == 1 && magic == PRESET_CATALOG_MAGIC &&
+              fread(version, sizeof(version), 1, fp) == 1 &&
+              fread(&count, sizeof(count), 1, fp) == 1 && count >= 0 && count <= PRESET_CATALOG_MAX &&
+              fread(g_preset_catalog, sizeof(SlicerPreset), count, fp) == (size_t)count;
+    fclose(fp);
+
+    if (ok) {
+        memcpy(g_preset_catalog_version, version, sizeof(version));
+        g_preset_catalog_version[sizeof(g_preset_catalog_version) - 1] = '\0';
+        g_preset_catalog_count = count;
+        UI_LOGI("Preset catalog loaded: %d presets, version %s", count, g_preset_catalog_version);
+    }
+}
+
+// Call with g_preset_mutex held
+static void preset_catalog_store(const SlicerPreset *presets, int count, const char *version) {
+    if (count > PRESET_CATALOG_MAX) count = PRESET_CATALOG_MAX;
+    memcpy(g_preset_catalog, presets, sizeof(SlicerPreset) * count);
+    g_preset_catalog_count = count;
+    memset(g_preset_catalog_version, 0, sizeof(g_preset_catalog_version));
+    strncpy(g_preset_catalog_version, version, sizeof(g_preset_catalog_version) - 1);
+
+    FILE *fp = fopen(g_preset_catalog_path, "wb");
+    if (!fp) return;
+    uint32_t magic = PRESET_CATALOG_MAGIC;
+    int32_t n = count;
+    fwrite(&magic, sizeof(magic), 1, fp);
+    fwrite(g_preset_catalog_version, sizeof(g_preset_catalog_version), 1, fp);
+    fwrite(&n, sizeof(n), 1, fp);
+    fwrite(g_preset_catalog, sizeof(SlicerPreset), count, fp);
+    fclose(fp);
+}
+
+// Runs on the backend poll thread, so the modal never waits for the download
+static void sync_preset_catalog(const char *remote_version) {
+    pthread_mutex_lock(&g_preset_mutex);
+    preset_catalog_load();
+    bool current = g_preset_catalog_count >= 0 && strcmp(g_preset_catalog_version, remote_version) == 0;
+    pthread_mutex_unlock(&g_preset_mutex);
+    if (current) return;
+
+    UI_LOGI("Preset catalog version changed (%s -> %s), syncing",
+            g_preset_catalog_version[0] ? g_preset_catalog_version : "none", remote_version);
+
+    static SlicerPreset fetched[PRESET_CATALOG_MAX];
+    char version[sizeof(g_preset_catalog_version)];
+    int count = fetch_preset_catalog(fetched, PRESET_CATALOG_MAX, version, sizeof(version));
+    if (count < 0) return;
+
+    pthread_mutex_lock(&g_preset_mutex);
+    preset_catalog_store(fetched, count, version);
+    pthread_mutex_unlock(&g_preset_mutex);
+}
+
+int backend_get_slicer_presets(SlicerPreset *presets, int max_count) {
+    if (!presets || max_count <= 0 || !g_curl) {
+        UI_LOGW("get_slicer_presets: invalid params");
         return -1;
     }
 
-    int count = 0;
-
-    // Extract filament presets only
-    cJSON *filament = cJSON_GetObjectItem(json, "filament");
-    if (filament && cJSON_IsArray(filament)) {
-        int arr_size = cJSON_GetArraySize(filament);
-        for (int i = 0; i < arr_size && count < max_count; i++) {
-            cJSON *item = cJSON_GetArrayItem(filament, i);
-            if (!item) continue;
-
-            cJSON *setting_id = cJSON_GetObjectItem(item, "setting_id");
-            cJSON *name = cJSON_GetObjectItem(item, "name");
-            cJSON *type = cJSON_GetObjectItem(item, "type");
-            cJSON *is_custom = cJSON_GetObjectItem(item, "is_custom");
-
-            if (setting_id && setting_id->valuestring && name && name->valuestring) {
-                strncpy(presets[count].setting_id, setting_id->valuestring, sizeof(presets[count].setting_id) - 1);
-                strncpy(presets[count].name, name->valuestring, sizeof(presets[count].name) - 1);
-                if (type && type->valuestring) {
-                    strncpy(presets[count].type, type->valuestring, sizeof(presets[count].type) - 1);
-                } else {
-                    strcpy(presets[count].type, "filament");
-                }
-                presets[count].is_custom = is_custom ? cJSON_IsTrue(is_custom) : false;
-                count++;
-            }
-        }
+    // Serve from the catalog (kept in sync on heartbeat)
+    pthread_mutex_lock(&g_preset_mutex);
+    preset_catalog_load();
+    int count = g_preset_catalog_count;
+    if (count >= 0) {
+        if (count > max_count) count = max_count;
+        memcpy(presets, g_preset_catalog, sizeof(SlicerPreset) * count);
+    }
+    pthread_mutex_unlock(&g_preset_mutex);
+    if (count >= 0) {
+        UI_LOGD("get_slicer_presets: %d presets from catalog", count);
+        return count;
     }
 
-    cJSON_Delete(json);
-    printf("[backend] get_slicer_presets: found %d presets\n", count);
+    // No catalog yet - download it now
+    static SlicerPreset fetched[PRESET_CATALOG_MAX];
+    char version[sizeof(g_preset_catalog_version)];
+    count = fetch_preset_catalog(fetched, PRESET_CATALOG_MAX, version, sizeof(version));
+    if (count < 0) return -1;
+
+    pthread_mutex_lock(&g_preset_mutex);
+    preset_catalog_store(fetched, count, version);
+    pthread_mutex_unlock(&g_preset_mutex);
+
+    if (count > max_count) count = max_count;
+    memcpy(presets, fetched, sizeof(SlicerPreset) * count);
     return count;
 }
 
 const char *backend_get_preset_filament_id(const char *setting_id) {
-    printf("[backend] get_preset_filament_id: looking up '%s'\n", setting_id ? setting_id : "(null)");
+    UI_LOGD("get_preset_filament_id: looking up '%s'", setting_id ? setting_id : "(null)");
     if (!setting_id || !g_curl) {
-        printf("[backend] get_preset_filament_id: invalid params\n");
+        UI_LOGW("get_preset_filament_id: invalid params");
         return NULL;
     }
 
     // GET /api/cloud/settings/{setting_id}
     char url[512];
     snprintf(url, sizeof(url), "%s/api/cloud/settings/%s", g_base_url, setting_id);
-    printf("[backend] get_preset_filament_id: GET %s\n", url);
+    UI_LOGD("get_preset_filament_id: GET %s", url);
 
     ResponseBuffer response = {0};
 
@@ -1823,8 +2116,8 @@ const char *backend_get_preset_filament_id(const char *setting_id) {
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
 
     if (res != CURLE_OK || http_code != 200) {
-        printf("[backend] get_preset_filament_id(%s): request failed (res=%d, http=%ld)\n",
-               setting_id, res, http_code);
+        UI_LOGE("get_preset_filament_id(%s): request failed (res=%d, http=%ld)",
+                setting_id, res, http_code);
         if (response.data) free(response.data);
         return NULL;
     }
@@ -1854,11 +2147,11 @@ const char *backend_get_preset_filament_id(const char *setting_id) {
         strncpy(g_preset_filament_id, filament_id->valuestring, sizeof(g_preset_filament_id) - 1);
         g_preset_filament_id[sizeof(g_preset_filament_id) - 1] = '\0';
         cJSON_Delete(json);
-        printf("[backend] get_preset_filament_id(%s): %s\n", setting_id, g_preset_filament_id);
+        UI_LOGI("get_preset_filament_id(%s): %s", setting_id, g_preset_filament_id);
         return g_preset_filament_id;
     }
 
-    printf("[backend] get_preset_filament_id(%s): filament_id not found in response\n", setting_id);
+    UI_LOGW("get_preset_filament_id(%s): filament_id not found in response", setting_id);
     cJSON_Delete(json);
     return NULL;
 }
@@ -1873,7 +2166,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
     // GET /api/cloud/settings/{setting_id}
     char url[512];
     snprintf(url, sizeof(url), "%s/api/cloud/settings/%s", g_base_url, setting_id);
-    printf("[backend] get_preset_detail: GET %s\n", url);
+    UI_LOGD("get_preset_detail: GET %s", url);
 
     ResponseBuffer response = {0};
 
@@ -1889,8 +2182,8 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
     curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
 
     if (res != CURLE_OK || http_code != 200) {
-        printf("[backend] get_preset_detail(%s): request failed (res=%d, http=%ld)\n",
-               setting_id, res, http_code);
+        UI_LOGE("get_preset_detail(%s): request failed (res=%d, http=%ld)",
+                setting_id, res, http_code);
         if (response.data) free(response.data);
         return false;
     }
@@ -1917,7 +2210,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
     if (filament_id && filament_id->valuestring && filament_id->valuestring[0]) {
         strncpy(detail->filament_id, filament_id->valuestring, sizeof(detail->filament_id) - 1);
         detail->has_filament_id = true;
-        printf("[backend] get_preset_detail(%s): filament_id=%s\n", setting_id, detail->filament_id);
+        UI_LOGI("get_preset_detail(%s): filament_id=%s", setting_id, detail->filament_id);
     }
 
     // Try to get base_id
@@ -1931,7 +2224,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
     if (base_id && base_id->valuestring && base_id->valuestring[0]) {
         strncpy(detail->base_id, base_id->valuestring, sizeof(detail->base_id) - 1);
         detail->has_base_id = true;
-        printf("[backend] get_preset_detail(%s): base_id=%s\n", setting_id, detail->base_id);
+        UI_LOGI("get_preset_detail(%s): base_id=%s", setting_id, detail->base_id);
     }
 
     cJSON_Delete(json);
@@ -1941,7 +2234,7 @@ bool backend_get_preset_detail(const char *setting_id, PresetDetail *detail) {
 int backend_get_k_profiles(const char *printer_serial, const char *nozzle_diameter,
                            KProfileInfo *profiles, int max_count) {
     if (!printer_serial || !profiles || max_count <= 0 || !g_curl) {
-        printf("[backend] get_k_profiles: invalid params\n");
+        UI_LOGW("get_k_profiles: invalid params");
         return -1;
     }
 
@@ -1969,8 +2262,8 @@ int backend_get_k_profiles(const char *printer_serial, const char *nozzle_diamet
     pthread_mutex_unlock(&g_curl_mutex);
 
     if (res != CURLE_OK || http_code != 200) {
-        printf("[backend] get_k_profiles(%s): request failed (res=%d, http=%ld)\n",
-               printer_serial, res, http_code);
+        UI_LOGE("get_k_profiles(%s): request failed (res=%d, http=%ld)",
+                printer_serial, res, http_code);
         if (response.data) free(response.data);
         return -1;
     }
@@ -2026,7 +2319,7 @@ int backend_get_k_profiles(const char *printer_serial, const char *nozzle_diamet
     }
 
     cJSON_Delete(json);
-    printf("[backend] get_k_profiles(%s): found %d profiles\n", printer_serial, count);
+    UI_LOGI("get_k_profiles(%s): found %d profiles", printer_serial, count);
     return count;
 }
 
@@ -2035,7 +2328,7 @@ bool backend_set_slot_filament(const char *printer_serial, int ams_id, int tray_
                                 const char *tray_type, const char *tray_sub_brands,
                                 const char *tray_color, int nozzle_temp_min, int nozzle_temp_max) {
     if (!printer_serial || !g_curl) {
-        printf("[backend] set_slot_filament: invalid params\n");
+        UI_LOGW("set_slot_filament: invalid params");
         return false;
     }
 
@@ -2061,8 +2354,8 @@ bool backend_set_slot_filament(const char *printer_serial, int ams_id, int tray_
         return false;
     }
 
-    printf("[backend] set_slot_filament: POST %s\n", url);
-    printf("[backend] payload: %s\n", json_str);
+    UI_LOGD("set_slot_filament: POST %s", url);
+    UI_LOGD("payload: %s", json_str);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -2087,8 +2380,8 @@ bool backend_set_slot_filament(const char *printer_serial, int ams_id, int tray_
     if (response.data) free(response.data);
 
     bool success = (res == CURLE_OK && (http_code == 200 || http_code == 204));
-    printf("[backend] set_slot_filament: result=%d, http=%ld, success=%d\n",
-           res, http_code, success);
+    UI_LOGI("set_slot_filament: result=%d, http=%ld, success=%d",
+            res, http_code, success);
 
     return success;
 }
@@ -2097,7 +2390,7 @@ bool backend_set_slot_calibration(const char *printer_serial, int ams_id, int tr
                                    int cali_idx, const char *filament_id, const char *setting_id,
                                    const char *nozzle_diameter, float k_value, int nozzle_temp) {
     if (!printer_serial || !g_curl) {
-        printf("[backend] set_slot_calibration: invalid params\n");
+        UI_LOGW("set_slot_calibration: invalid params");
         return false;
     }
 
@@ -2122,8 +2415,8 @@ bool backend_set_slot_calibration(const char *printer_serial, int ams_id, int tr
         return false;
     }
 
-    printf("[backend] set_slot_calibration: POST %s\n", url);
-    printf("[backend] payload: %s\n", json_str);
+    UI_LOGD("set_slot_calibration: POST %s", url);
+    UI_LOGD("payload: %s", json_str);
 
     ResponseBuffer response = {0};
     struct curl_slist *headers = NULL;
@@ -2148,15 +2441,15 @@ bool backend_set_slot_calibration(const char *printer_serial, int ams_id, int tr
     if (response.data) free(response.data);
 
     bool success = (res == CURLE_OK && (http_code == 200 || http_code == 204));
-    printf("[backend] set_slot_calibration: result=%d, http=%ld, success=%d\n",
-           res, http_code, success);
+    UI_LOGI("set_slot_calibration: result=%d, http=%ld, success=%d",
+            res, http_code, success);
 
     return success;
 }
 
 bool backend_reset_slot(const char *printer_serial, int ams_id, int tray_id) {
     if (!printer_serial || !g_curl) {
-        printf("[backend] reset_slot: invalid params\n");
+        UI_LOGW("reset_slot: invalid params");
         return false;
     }
 
@@ -2165,7 +2458,7 @@ bool backend_reset_slot(const char *printer_serial, int ams_id, int tray_id) {
     snprintf(url, sizeof(url), "%s/api/printers/%s/ams/%d/tray/%d/reset",
              g_base_url, printer_serial, ams_id, tray_id);
 
-    printf("[backend] reset_slot: POST %s\n", url);
+    UI_LOGD("reset_slot: POST %s", url);
 
     ResponseBuffer response = {0};
 
@@ -2185,8 +2478,8 @@ bool backend_reset_slot(const char *printer_serial, int ams_id, int tray_id) {
     if (response.data) free(response.data);
 
     bool success = (res == CURLE_OK && (http_code == 200 || http_code == 204));
-    printf("[backend] reset_slot: result=%d, http=%ld, success=%d\n",
-           res, http_code, success);
+    UI_LOGI("reset_slot: result=%d, http=%ld, success=%d",
+            res, http_code, success);
 
     return success;
 }
@@ -2221,7 +2514,7 @@ void staging_clear(void) {
     g_staging_cleared_locally = true;
     g_staging_cleared_time = time(NULL);
     // NOTE: Don't clear "just added" flag here - let message persist
-    printf("[backend] Staging cleared locally (holdoff active)\n");
+    UI_LOGI("Staging cleared locally (holdoff active)");
 
     // Now send clear request to backend using a separate curl handle
     // (g_curl is used by poll thread and not thread-safe)
@@ -2238,9 +2531,9 @@ void staging_clear(void) {
 
     CURLcode res = curl_easy_perform(curl);
     if (res == CURLE_OK) {
-        printf("[backend] Staging cleared via API\n");
+        UI_LOGI("Staging cleared via API");
     } else {
-        printf("[backend] Warning: API clear failed (%d), but local state already cleared\n", res);
+        UI_LOGE("API clear failed (%d), but local state already cleared", res);
     }
     curl_easy_cleanup(curl);
 }
@@ -2274,7 +2567,7 @@ static void fetch_tag_data_from_backend(const char *tag_uid_hex) {
     if (g_tag_cache_updated_locally) {
         time_t now = time(NULL);
         if (difftime(now, g_tag_cache_update_time) < TAG_CACHE_HOLDOFF_SEC) {
-            printf("[backend] Skipping tag fetch - holdoff active\n");
+            UI_LOGD("Skipping tag fetch - holdoff active");
             return;
         }
         g_tag_cache_updated_locally = false;
@@ -2320,7 +2613,7 @@ static void fetch_tag_data_from_backend(const char *tag_uid_hex) {
             if (item && item->valuestring) strncpy(g_tag_type, item->valuestring, sizeof(g_tag_type) - 1);
 
             cJSON_Delete(json);
-            printf("[backend] Tag data fetched: %s %s %s\n", g_tag_vendor, g_tag_material, g_tag_color_name);
+            UI_LOGI("Tag data fetched: %s %s %s", g_tag_vendor, g_tag_material, g_tag_color_name);
         }
     }
 
@@ -2330,7 +2623,7 @@ static void fetch_tag_data_from_backend(const char *tag_uid_hex) {
 void sim_set_nfc_tag_present(bool present) {
     bool was_present = g_nfc_tag_present;
     g_nfc_tag_present = present;
-    printf("[sim] NFC tag %s\n", present ? "DETECTED" : "REMOVED");
+    UI_LOGI("NFC tag %s", present ? "DETECTED" : "REMOVED");
 
     if (present && !was_present) {
         // Tag just appeared - fetch decoded data from backend
@@ -2359,6 +2652,92 @@ bool sim_get_nfc_tag_present(void) {
     return g_nfc_tag_present;
 }
 
+// =============================================================================
+// NFC Bulk Inventory Simulation ('I' key puts several tags in the field)
+// =============================================================================
+
+#define SIM_NFC_FIELD_MAX 16
+
+static SimNfcTag g_sim_field[SIM_NFC_FIELD_MAX];
+static int g_sim_field_count = 0;
+static bool g_inv_active = false;
+static uint32_t g_inv_round = 0;
+static NfcInventoryTag g_inv_tags[SIM_NFC_FIELD_MAX];
+static int g_inv_count = 0;
+
+// One inventory round over the simulated field (the bridge reports them all at once)
+static void sim_inventory_round(void) {
+    g_inv_count = 0;
+    for (int i = 0; i < g_sim_field_count; i++) {
+        const SimNfcTag *src = &g_sim_field[i];
+        NfcInventoryTag *tag = &g_inv_tags[g_inv_count++];
+        memset(tag, 0, sizeof(*tag));
+
+        int pos = 0;
+        for (int b = 0; b < src->uid_len && pos < (int)sizeof(tag->uid_hex) - 3; b++) {
+            if (b > 0) tag->uid_hex[pos++] = ':';
+            pos += snprintf(&tag->uid_hex[pos], sizeof(tag->uid_hex) - pos, "%02X", src->uid[b]);
+        }
+
+        tag->decoded = src->vendor != NULL;
+        tag->tag_type = tag->decoded ? 2 : 1;  // Bambu tags are MIFARE 1K
+        if (tag->decoded) {
+            snprintf(tag->vendor, sizeof(tag->vendor), "%s", src->vendor);
+            snprintf(tag->material, sizeof(tag->material), "%s", src->material ? src->material : "");
+            snprintf(tag->subtype, sizeof(tag->subtype), "%s", src->subtype ? src->subtype : "");
+            snprintf(tag->color_name, sizeof(tag->color_name), "%s", src->color_name ? src->color_name : "");
+            tag->color_rgba = src->color_rgba;
+            tag->spool_weight = src->spool_weight;
+        }
+    }
+    g_inv_round++;
+    UI_LOGD("NFC inventory round %u: %d tags", g_inv_round, g_inv_count);
+}
+
+void sim_set_nfc_tags(const SimNfcTag *tags, int count) {
+    g_sim_field_count = count < SIM_NFC_FIELD_MAX ? count : SIM_NFC_FIELD_MAX;
+    if (g_sim_field_count > 0) {
+        memcpy(g_sim_field, tags, g_sim_field_count * sizeof(SimNfcTag));
+    }
+    UI_LOGD("%d NFC tags in field", g_sim_field_count);
+    if (g_inv_active) {
+        sim_inventory_round();
+    }
+}
+
+int sim_get_nfc_tag_count(void) {
+    return g_sim_field_count;
+}
+
+void nfc_inventory_set_active(bool active) {
+    if (active == g_inv_active) return;
+    g_inv_active = active;
+    g_inv_round = 0;
+    g_inv_count = 0;
+    UI_LOGI("NFC inventory mode %s", active ? "ON" : "OFF");
+    if (active) {
+        sim_inventory_round();
+    }
+}
+
+bool nfc_inventory_is_active(void) {
+    return g_inv_active;
+}
+
+uint32_t nfc_inventory_get_round(void) {
+    return g_inv_round;
+}
+
+int nfc_inventory_get_count(void) {
+    return g_inv_active ? g_inv_count : 0;
+}
+
+bool nfc_inventory_get_tag(int index, NfcInventoryTag *tag) {
+    if (!g_inv_active || !tag || index < 0 || index >= g_inv_count) return false;
+    *tag = g_inv_tags[index];
+    return true;
+}
+
 // Decoded tag data getters
 const char* nfc_get_tag_vendor(void) {
     return g_nfc_tag_present ? g_tag_vendor : "";
@@ -2420,8 +2799,8 @@ void nfc_update_tag_cache(const char *vendor, const char *material, const char *
     g_tag_cache_updated_locally = true;
     g_tag_cache_update_time = time(NULL);
 
-    printf("[nfc] Tag cache updated locally: %s %s %s (holdoff %ds)\n",
-           g_tag_vendor, g_tag_material, g_tag_color_name, TAG_CACHE_HOLDOFF_SEC);
+    UI_LOGI("Tag cache updated locally: %s %s %s (holdoff %ds)",
+            g_tag_vendor, g_tag_material, g_tag_color_name, TAG_CACHE_HOLDOFF_SEC);
 }
 
 // Set "just added" flag for status bar message
@@ -2458,8 +2837,8 @@ void nfc_set_spool_just_added(const char *tag_id, const char *vendor, const char
         nfc_update_tag_cache(g_just_added_vendor, g_just_added_material, NULL, NULL, 0);
     }
 
-    printf("[nfc] Spool just added: tag=%s vendor=%s material=%s\n",
-           g_just_added_tag_id, g_just_added_vendor, g_just_added_material);
+    UI_LOGI("Spool just added: tag=%s vendor=%s material=%s",
+            g_just_added_tag_id, g_just_added_vendor, g_just_added_material);
 }
 
 // Check if a spool was just added
@@ -2528,7 +2907,7 @@ int wifi_get_ssid(char *buf, int buf_len) {
 
 int wifi_connect(const char *ssid, const char *password) {
     (void)password;
-    printf("[sim] WiFi connect: %s\n", ssid);
+    UI_LOGI("WiFi connect: %s", ssid);
     strncpy(g_wifi_ssid, ssid, sizeof(g_wifi_ssid) - 1);
     g_wifi_state = 3;
 
@@ -2538,7 +2917,7 @@ int wifi_connect(const char *ssid, const char *password) {
 }
 
 int wifi_disconnect(void) {
-    printf("[sim] WiFi disconnect\n");
+    UI_LOGI("WiFi disconnect");
     g_wifi_state = 1;
     g_wifi_ssid[0] = '\0';
     g_wifi_ip[0] = g_wifi_ip[1] = g_wifi_ip[2] = g_wifi_ip[3] = 0;
@@ -2547,7 +2926,7 @@ int wifi_disconnect(void) {
     // Set holdoff to prevent poll from overwriting
     g_wifi_disconnected_locally = true;
     g_wifi_disconnect_time = time(NULL);
-    printf("[sim] WiFi disconnect holdoff active for %d seconds\n", WIFI_DISCONNECT_HOLDOFF_SEC);
+    UI_LOGD("WiFi disconnect holdoff active for %d seconds", WIFI_DISCONNECT_HOLDOFF_SEC);
     return 0;
 }
 
@@ -2609,12 +2988,12 @@ int backend_update_printer(const char *serial, const char *name, const char *ip,
         curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 200) {
             result = 0;
-            printf("[backend] Printer %s updated successfully\n", serial);
+            UI_LOGI("Printer %s updated successfully", serial);
         } else {
-            printf("[backend] Update printer failed: HTTP %ld\n", http_code);
+            UI_LOGE("Update printer failed: HTTP %ld", http_code);
         }
     } else {
-        printf("[backend] Update printer request failed: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Update printer request failed: %s", curl_easy_strerror(res));
     }
 
     free(response.data);
@@ -2644,12 +3023,12 @@ int backend_delete_printer(const char *serial) {
         curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 204) {
             result = 0;
-            printf("[backend] Printer %s deleted successfully\n", serial);
+            UI_LOGI("Printer %s deleted successfully", serial);
         } else {
-            printf("[backend] Delete printer failed: HTTP %ld\n", http_code);
+            UI_LOGE("Delete printer failed: HTTP %ld", http_code);
         }
     } else {
-        printf("[backend] Delete printer request failed: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Delete printer request failed: %s", curl_easy_strerror(res));
     }
 
     free(response.data);
@@ -2698,12 +3077,12 @@ int backend_add_printer(const char *serial, const char *name, const char *ip, co
         curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 201 || http_code == 200) {
             result = 0;
-            printf("[backend] Printer %s added successfully\n", serial);
+            UI_LOGI("Printer %s added successfully", serial);
         } else {
-            printf("[backend] Add printer failed: HTTP %ld\n", http_code);
+            UI_LOGE("Add printer failed: HTTP %ld", http_code);
         }
     } else {
-        printf("[backend] Add printer request failed: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Add printer request failed: %s", curl_easy_strerror(res));
     }
 
     free(response.data);
@@ -2734,12 +3113,12 @@ int backend_connect_printer(const char *serial) {
         curl_easy_getinfo(g_curl, CURLINFO_RESPONSE_CODE, &http_code);
         if (http_code == 204 || http_code == 200) {
             result = 0;
-            printf("[backend] Printer %s connect initiated\n", serial);
+            UI_LOGI("Printer %s connect initiated", serial);
         } else {
-            printf("[backend] Connect printer failed: HTTP %ld\n", http_code);
+            UI_LOGE("Connect printer failed: HTTP %ld", http_code);
         }
     } else {
-        printf("[backend] Connect printer request failed: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Connect printer request failed: %s", curl_easy_strerror(res));
     }
 
     free(response.data);
@@ -2770,10 +3149,10 @@ int backend_discovery_start(void) {
     free(response.data);
 
     if (res == CURLE_OK) {
-        printf("[backend] Discovery started\n");
+        UI_LOGI("Discovery started");
         return 0;
     }
-    printf("[backend] Discovery start failed: %s\n", curl_easy_strerror(res));
+    UI_LOGE("Discovery start failed: %s", curl_easy_strerror(res));
     return -1;
 }
 
@@ -2797,7 +3176,7 @@ int backend_discovery_stop(void) {
     free(response.data);
 
     if (res == CURLE_OK) {
-        printf("[backend] Discovery stopped\n");
+        UI_LOGI("Discovery stopped");
         return 0;
     }
     return -1;
@@ -2884,7 +3263,7 @@ int backend_discovery_get_printers(PrinterDiscoveryResult *results, int max_resu
     }
 
     free(response.data);
-    printf("[backend] Discovery found %d printers\n", count);
+    UI_LOGI("Discovery found %d printers", count);
     return count;
 }
 
@@ -2940,10 +3319,10 @@ int backend_scale_tare(void) {
 
     CURLcode res = curl_easy_perform(g_curl);
     if (res == CURLE_OK) {
-        printf("[backend] Scale tare command sent\n");
+        UI_LOGI("Scale tare command sent");
         return 0;
     }
-    printf("[backend] Scale tare command failed: %s\n", curl_easy_strerror(res));
+    UI_LOGE("Scale tare command failed: %s", curl_easy_strerror(res));
     return -1;
 }
 
@@ -2962,10 +3341,10 @@ int backend_scale_calibrate(float known_weight_grams) {
 
     CURLcode res = curl_easy_perform(g_curl);
     if (res == CURLE_OK) {
-        printf("[backend] Scale calibrate command sent (known weight: %.1f g)\n", known_weight_grams);
+        UI_LOGI("Scale calibrate command sent (known weight: %.1f g)", known_weight_grams);
         return 0;
     }
-    printf("[backend] Scale calibrate command failed: %s\n", curl_easy_strerror(res));
+    UI_LOGE("Scale calibrate command failed: %s", curl_easy_strerror(res));
     return -1;
 }
 
@@ -3014,7 +3393,7 @@ int backend_search_colors(const char *manufacturer, const char *material,
 
     CURLcode res = curl_easy_perform(g_curl);
     if (res != CURLE_OK) {
-        printf("[backend] Color search failed: %s\n", curl_easy_strerror(res));
+        UI_LOGE("Color search failed: %s", curl_easy_strerror(res));
         free(response.data);
         return -1;
     }
@@ -3054,7 +3433,7 @@ int backend_search_colors(const char *manufacturer, const char *material,
     }
 
     cJSON_Delete(json);
-    printf("[backend] Found %d colors for manufacturer='%s' material='%s'\n",
-           count, manufacturer ? manufacturer : "", material ? material : "");
+    UI_LOGI("Found %d colors for manufacturer='%s' material='%s'",
+            count, manufacturer ? manufacturer : "", material ? material : "");
     return count;
 }
@@ -251,6 +251,10 @@ typedef struct {
 // Check if a spool with given tag_id exists in inventory
 bool spool_exists_by_tag(const char *tag_id);
 
+// Check several tag ids with one request (e.g. one NFC inventory round)
+// Sets known[i] for tag_ids[i]. Returns 0 on success, -1 on error
+int spool_tags_known(const char **tag_ids, int count, bool *known);
+
 // Get spool details from inventory by tag_id
 // Returns true if found, false otherwise
 // Fills in the SpoolInfo struct with data
@@ -313,6 +317,31 @@ int spool_get_untagged_count(void);
 // Returns true on success, false on failure (tag already assigned or spool not found)
 bool spool_link_tag(const char *spool_id, const char *tag_id, const char *tag_type);
 
+// One tag of the last NFC inventory round (matches ui_internal.h)
+typedef struct {
+    char uid_hex[32];       // "XX:XX:XX:XX"
+    uint8_t tag_type;       // 0=unknown, 1=NTAG, 2=MIFARE 1K, 3=MIFARE 4K
+    bool decoded;           // vendor..spool_weight read from the tag
+    char vendor[32];
+    char material[32];
+    char subtype[32];
+    char color_name[32];
+    uint32_t color_rgba;
+    int32_t spool_weight;
+} NfcInventoryTag;
+
+// Bulk inventory mode (simulated from the tags set with sim_set_nfc_tags())
+void nfc_inventory_set_active(bool active);
+bool nfc_inventory_is_active(void);
+uint32_t nfc_inventory_get_round(void);
+int nfc_inventory_get_count(void);
+bool nfc_inventory_get_tag(int index, NfcInventoryTag *tag);
+
+// Add one spool per tag in a single request (POST /api/spools/batch)
+// Returns spools created, -1 on error; skipped = tags already in inventory
+int spool_add_batch_to_inventory(const NfcInventoryTag *tags, int count,
+                                 const char *data_origin, int *skipped);
+
 // Update spool weight in inventory (sync from scale)
 // Returns true on success, false on failure
 bool spool_sync_weight(const char *spool_id, int weight);
@@ -445,9 +474,13 @@ typedef struct {
     char name[64];          // Preset name (e.g., "Bambu PLA Basic")
     char type[16];          // Type: "filament", "printer", "process"
     bool is_custom;         // true for user's custom presets
+    char brand[24];         // Brand parsed by the backend (e.g., "Devil Design"), empty if unknown
+    char material[8];       // Material type (e.g., "PETG")
+    int16_t temp_min;       // Nozzle temperature range for the material
+    int16_t temp_max;
 } SlicerPreset;
 
-// Get slicer filament presets from Bambu Cloud
+// Get slicer filament presets (from the local catalog; downloads only if there is none yet)
 // Returns number of presets found (up to max_count), fills array
 // Returns -1 if not authenticated or error
 int backend_get_slicer_presets(SlicerPreset *presets, int max_count);
@@ -602,23 +635,6 @@ int backend_discovery_get_printers(PrinterDiscoveryResult *results, int max_resu
 // Set tag ID before navigating to scan result screen
 void ui_scan_result_set_tag_id(const char *tag_id);
 
-// =============================================================================
-// Keyboard Layout Functions (stub for simulator)
-// =============================================================================
-
-// Keyboard layout types
-typedef enum {
-    KEYBOARD_LAYOUT_QWERTY = 0,
-    KEYBOARD_LAYOUT_QWERTZ = 1,
-    KEYBOARD_LAYOUT_AZERTY = 2,
-} KeyboardLayout;
-
-// Apply saved keyboard layout to a keyboard widget (no-op in simulator)
-static inline void apply_keyboard_layout(void *keyboard) { (void)keyboard; }
-
-// Get current keyboard layout setting (always QWERTY in simulator)
-static inline KeyboardLayout get_keyboard_layout(void) { return KEYBOARD_LAYOUT_QWERTY; }
-
 #ifdef __cplusplus
 }
 #endif
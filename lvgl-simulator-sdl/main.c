@@ -8,10 +8,13 @@
  * Usage:
  *   ./simulator                         # Uses default localhost:3000
  *   ./simulator http://192.168.1.10:3000  # Custom backend URL
+ *   ./simulator --bench-screens [N]       # Headless screen construction benchmark
+ *   ./simulator --bench-gauge [N]         # Headless spool rendering benchmark
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <time.h>
@@ -20,6 +23,9 @@
 #include "ui/ui.h"
 #include "ui/screens.h"
 #include "sim_control.h"
+#include "sim_bench.h"
+#include "ui/ui_log.h"
+#include "ui/ui_internal.h"
 
 #ifdef ENABLE_BACKEND_CLIENT
 #include "backend_client.h"
@@ -37,6 +43,7 @@ static lv_display_t *disp;
 static lv_indev_t *mouse_indev;
 
 static pthread_mutex_t lvgl_mutex = PTHREAD_MUTEX_INITIALIZER;
+static bool fb_dirty = false;  /* Set by flush, cleared when presented */
 
 /* Display flush callback */
 static void sdl_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
@@ -54,6 +61,7 @@ static void sdl_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *
             fb_pixels[y * DISP_HOR_RES + x] = 0xFF000000 | (r << 16) | (g << 8) | b;
         }
     }
+    fb_dirty = true;
 
     lv_display_flush_ready(display);
 }
@@ -125,15 +133,102 @@ static void sdl_deinit(void)
     SDL_Quit();
 }
 
-/* LVGL tick thread */
-static void *tick_thread(void *arg)
+/* Monotonic clock in microseconds */
+static uint64_t sim_now_us(void)
 {
-    (void)arg;
-    while (1) {
-        usleep(5000); /* 5ms */
-        lv_tick_inc(5);
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static uint64_t sim_start_us;
+
+/* LVGL tick source - read from the clock, so it cannot drift or lag */
+static uint32_t sim_tick_cb(void)
+{
+    return (uint32_t)((sim_now_us() - sim_start_us) / 1000u);
+}
+
+/*
+ * Main loop pacing: the loop sleeps until the next LVGL timer is due, ui_tick()
+ * has work (ui_tick_wait_ms(): a screen change or the 100ms UI poll) or an SDL
+ * event arrives. Idle, that is ~10 wakeups/s for the UI poll plus whatever
+ * LVGL timers are running. Lateness of every timed wakeup is recorded and
+ * printed on exit.
+ */
+#define JITTER_BUCKETS 8
+
+static const uint32_t jitter_limits_us[JITTER_BUCKETS - 1] = { 50, 100, 250, 500, 1000, 2000, 5000 };
+
+static struct {
+    uint64_t start_us;
+    uint32_t timed_wakes;
+    uint32_t event_wakes;
+    uint32_t ui_ticks;
+    uint32_t renders;
+    uint64_t late_total_us;
+    uint64_t late_max_us;
+    uint32_t buckets[JITTER_BUCKETS];
+} timing;
+
+static void timing_record_late(uint64_t late_us)
+{
+    int b = 0;
+    while (b < JITTER_BUCKETS - 1 && late_us >= jitter_limits_us[b]) b++;
+    timing.buckets[b]++;
+    timing.timed_wakes++;
+    timing.late_total_us += late_us;
+    if (late_us > timing.late_max_us) timing.late_max_us = late_us;
+}
+
+static void timing_report(void)
+{
+    double secs = (double)(sim_now_us() - timing.start_us) / 1e6;
+    uint32_t wakes = timing.timed_wakes + timing.event_wakes;
+
+    if (secs <= 0 || !timing.timed_wakes) return;
+    printf("\n[sim] Main loop over %.1fs: %.1f wakeups/s (%u timed, %u event), %.1f renders/s\n",
+           secs, wakes / secs, timing.timed_wakes, timing.event_wakes, timing.renders / secs);
+    printf("[sim] ui_tick: %u calls\n", timing.ui_ticks);
+    printf("[sim] Wakeup lateness: avg %.0fus, max %lluus\n",
+           (double)timing.late_total_us / timing.timed_wakes, (unsigned long long)timing.late_max_us);
+    for (int b = 0; b < JITTER_BUCKETS; b++) {
+        if (b < JITTER_BUCKETS - 1) {
+            printf("[sim]   < %5uus %8u %5.1f%%\n", jitter_limits_us[b], timing.buckets[b],
+                   100.0 * timing.buckets[b] / timing.timed_wakes);
+        } else {
+            printf("[sim]  >= %5uus %8u %5.1f%%\n", jitter_limits_us[b - 1], timing.buckets[b],
+                   100.0 * timing.buckets[b] / timing.timed_wakes);
+        }
     }
-    return NULL;
+}
+
+/*
+ * Sleep until deadline_us or the next SDL event. SDL waits have millisecond
+ * resolution, so it wakes up to 1ms early and the remainder is slept on the
+ * monotonic clock. Returns true and fills event if an event arrived.
+ */
+static bool sim_wait(uint64_t deadline_us, SDL_Event *event)
+{
+    uint64_t now = sim_now_us();
+
+    if (deadline_us <= now) return false;  /* Already due, nothing slept */
+    if (deadline_us > now + 2000) {
+        int wait_ms = (int)((deadline_us - now) / 1000u) - 1;
+        if (SDL_WaitEventTimeout(event, wait_ms)) {
+            timing.event_wakes++;
+            return true;
+        }
+        now = sim_now_us();
+    }
+    if (deadline_us > now) {
+        uint64_t left = deadline_us - now;
+        struct timespec ts = { (time_t)(left / 1000000u), (long)(left % 1000000u) * 1000 };
+        nanosleep(&ts, NULL);
+        now = sim_now_us();
+    }
+    timing_record_late(now > deadline_us ? now - deadline_us : 0);
+    return false;
 }
 
 #ifdef ENABLE_BACKEND_CLIENT
@@ -210,8 +305,18 @@ static void sdl_render(void)
 
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    if (argc > 1 && strcmp(argv[1], "--bench-screens") == 0) {
+        return sim_bench_screens(argc > 2 ? atoi(argv[2]) : 0);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-gauge") == 0) {
+        return sim_bench_spool_gauge(argc > 2 ? atoi(argv[2]) : 0);
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-log") == 0) {
+        return sim_bench_log(argc > 2 ? atoi(argv[2]) : 0);
+    }
+    if (argc > 1 && strcmp(argv[1], "--soak-nav") == 0) {
+        return sim_bench_soak_nav(argc > 2 ? atoi(argv[2]) : 0, !(argc > 3 && strcmp(argv[3], "off") == 0));
+    }
 
     printf("===========================================\n");
     printf("  SpoolBuddy LVGL 9 Simulator\n");
@@ -243,13 +348,11 @@ int main(int argc, char **argv)
 
     /* Initialize LVGL */
     lv_init();
+    sim_start_us = sim_now_us();
+    lv_tick_set_cb(sim_tick_cb);
     lvgl_display_init();
     lvgl_input_init();
 
-    /* Start tick thread */
-    pthread_t tick_tid;
-    pthread_create(&tick_tid, NULL, tick_thread, NULL);
-
 #ifdef ENABLE_BACKEND_CLIENT
     /* Start backend polling thread */
     pthread_t backend_tid;
@@ -263,25 +366,56 @@ int main(int argc, char **argv)
 
     /* Main loop */
     int running = 1;
+    SDL_Event event;
+    bool have_event = false;
+    timing.start_us = sim_now_us();
     while (running) {
-        SDL_Event event;
-        while (SDL_PollEvent(&event)) {
+        while (have_event || SDL_PollEvent(&event)) {
+            have_event = false;
             if (event.type == SDL_QUIT) {
                 running = 0;
             } else if (event.type == SDL_KEYDOWN) {
                 if (event.key.keysym.sym == SDLK_ESCAPE) {
                     running = 0;
+                } else if (event.key.keysym.sym == SDLK_n) {
+                    sim_set_nfc_tag_present(!sim_get_nfc_tag_present());
+                } else if (event.key.keysym.sym == SDLK_i) {
+                    /* Several spools on the reader at once (bulk inventory) */
+                    static const SimNfcTag demo_field[] = {
+                        {{0x04, 0xA1, 0x5B, 0x22}, 4, "Bambu", "PLA", "Basic", "Jade White", 0xFFFFFFFF, 1000},
+                        {{0x04, 0xB7, 0x19, 0x6E}, 4, "Bambu", "PETG", "HF", "Black", 0x000000FF, 1000},
+                        {{0x04, 0x3C, 0x88, 0x12, 0x5A, 0x61, 0x80}, 7, NULL, NULL, NULL, NULL, 0, 0},
+                    };
+                    int count = sim_get_nfc_tag_count() ? 0 : (int)(sizeof(demo_field) / sizeof(demo_field[0]));
+                    sim_set_nfc_tags(demo_field, count);
                 }
+            } else if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_EXPOSED) {
+                fb_dirty = true;  /* Window needs the last frame again */
             }
         }
 
         pthread_mutex_lock(&lvgl_mutex);
-        lv_task_handler();
-        ui_tick();  /* Process navigation and screen changes */
+        uint32_t lv_wait_ms = lv_timer_handler();
+        uint32_t ui_wait_ms = ui_tick_wait_ms();
+        if (ui_wait_ms == 0) {
+            ui_tick();  /* Process navigation and screen changes */
+            timing.ui_ticks++;
+            ui_wait_ms = ui_tick_wait_ms();
+        }
+        uint64_t now = sim_now_us();
         pthread_mutex_unlock(&lvgl_mutex);
 
-        sdl_render();
-        usleep(5000); /* ~200 fps max */
+        if (fb_dirty) {
+            fb_dirty = false;
+            sdl_render();
+            timing.renders++;
+        }
+        ui_log_drain(NULL, 0);  /* Format deferred log records outside the UI tick */
+
+        uint32_t wait_ms = ui_wait_ms;
+        if (lv_wait_ms != LV_NO_TIMER_READY && lv_wait_ms < wait_ms) wait_ms = lv_wait_ms;
+        uint64_t deadline = now + (uint64_t)wait_ms * 1000u;
+        have_event = sim_wait(deadline, &event);
     }
 
     /* Cleanup */
@@ -292,6 +426,8 @@ int main(int argc, char **argv)
 #endif
 
     sdl_deinit();
+    ui_log_dump();
+    timing_report();
     printf("Simulator exited.\n");
 
     return 0;
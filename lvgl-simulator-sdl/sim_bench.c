@@ -0,0 +1,517 @@
+/**
+ * Simulator Benchmarks
+ * See sim_bench.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "ui/screens.h"
+#include "ui/ui_screen_table.h"
+#include "ui/ui_spool_gauge.h"
+#include "ui/images.h"
+#include "ui/ui.h"
+#include "ui/ui_internal.h"
+#include "ui/ui_ams_slot_modal.h"
+#include "ui/ui_mem_arena.h"
+#define UI_LOG_TAG "bench"
+#include "ui/ui_log.h"
+#include "sim_bench.h"
+
+#define BENCH_HOR_RES 800
+#define BENCH_VER_RES 480
+
+static lv_display_t *bench_disp;
+static uint32_t bench_sim_ms;   /* Simulated time added to the tick (soak) */
+
+/* Monotonic microseconds */
+static uint64_t bench_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static uint32_t bench_tick_cb(void)
+{
+    return (uint32_t)(bench_now_us() / 1000u) + bench_sim_ms;
+}
+
+/* Discard rendered pixels - only the render work is measured */
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
+{
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(display);
+}
+
+static void bench_init(void)
+{
+    static uint8_t buf[BENCH_HOR_RES * 100 * 2]; /* Same 100 line buffer as the SDL display */
+
+    if (bench_disp) return;
+    lv_init();
+    lv_tick_set_cb(bench_tick_cb);
+    bench_disp = lv_display_create(BENCH_HOR_RES, BENCH_VER_RES);
+    lv_display_set_flush_cb(bench_disp, bench_flush_cb);
+    lv_display_set_buffers(bench_disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+}
+
+static size_t bench_heap_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static uint32_t bench_count_objects(lv_obj_t *obj)
+{
+    uint32_t count = 1;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        count += bench_count_objects(lv_obj_get_child(obj, i));
+    }
+    return count;
+}
+
+// =============================================================================
+// Screen construction: EEZ code vs descriptor tables
+// =============================================================================
+
+typedef struct {
+    enum ScreensEnum id;
+    const char *name;
+    void (*create_fn)(void);
+} bench_screen_t;
+
+static const bench_screen_t bench_screens[] = {
+    { SCREEN_ID_MAIN_SCREEN,                 "main_screen",          create_screen_main_screen },
+    { SCREEN_ID_AMS_OVERVIEW,                "ams_overview",         create_screen_ams_overview },
+    { SCREEN_ID_SCAN_RESULT,                 "scan_result",          create_screen_scan_result },
+    { SCREEN_ID_SPOOL_DETAILS,               "spool_details",        create_screen_spool_details },
+    { SCREEN_ID_SETTINGS_SCREEN,             "settings_screen",      create_screen_settings_screen },
+    { SCREEN_ID_SETTINGS_WIFI_SCREEN,        "settings_wifi",        create_screen_settings_wifi_screen },
+    { SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN, "settings_printer_add", create_screen_settings_printer_add_screen },
+    { SCREEN_ID_SETTINGS_DISPLAY_SCREEN,     "settings_display",     create_screen_settings_display_screen },
+    { SCREEN_ID_SETTINGS_UPDATE_SCREEN,      "settings_update",      create_screen_settings_update_screen },
+};
+
+typedef struct {
+    uint64_t create_us;
+    uint64_t render_us;
+    size_t heap_bytes;
+    uint32_t objects;
+} bench_result_t;
+
+/* Build one screen, render a full frame, tear it down again */
+static void bench_screen_once(const bench_screen_t *s, bool use_table, lv_obj_t *base, bench_result_t *out)
+{
+    size_t heap_before = bench_heap_used();
+
+    uint64_t t0 = bench_now_us();
+    lv_obj_t *scr;
+    if (use_table) {
+        scr = ui_screen_table_create(ui_screen_table_get(s->id));
+    } else {
+        s->create_fn();
+        scr = ((lv_obj_t **)&objects)[s->id - 1];
+    }
+    uint64_t t1 = bench_now_us();
+
+    out->heap_bytes += bench_heap_used() - heap_before;
+    out->objects = bench_count_objects(scr);
+
+    lv_screen_load(scr);
+    lv_obj_invalidate(scr);
+    lv_refr_now(bench_disp);
+    uint64_t t2 = bench_now_us();
+
+    out->create_us += t1 - t0;
+    out->render_us += t2 - t1;
+
+    lv_screen_load(base);
+    lv_obj_delete(scr);
+    memset(&objects, 0, sizeof(objects));
+}
+
+int sim_bench_screens(int iterations)
+{
+    if (iterations <= 0) iterations = 50;
+
+    bench_init();
+    lv_obj_t *base = lv_obj_create(NULL);
+    lv_screen_load(base);
+
+    printf("Screen construction benchmark (%d iterations, headless %dx%d)\n",
+           iterations, BENCH_HOR_RES, BENCH_VER_RES);
+    printf("%-22s %-6s %10s %10s %8s %10s\n", "screen", "path", "create_us", "render_us", "objects", "heap_B");
+
+    bench_result_t total[2] = {0};
+    for (size_t i = 0; i < sizeof(bench_screens) / sizeof(bench_screens[0]); i++) {
+        const bench_screen_t *s = &bench_screens[i];
+        if (!ui_screen_table_get(s->id)) continue;
+
+        for (int path = 0; path < 2; path++) {
+            bench_result_t r = {0};
+            for (int n = 0; n < iterations; n++) {
+                bench_screen_once(s, path == 1, base, &r);
+            }
+            printf("%-22s %-6s %10llu %10llu %8u %10zu\n", s->name, path ? "table" : "eez",
+                   (unsigned long long)(r.create_us / iterations),
+                   (unsigned long long)(r.render_us / iterations),
+                   r.objects, r.heap_bytes / iterations);
+            total[path].create_us += r.create_us / iterations;
+            total[path].render_us += r.render_us / iterations;
+            total[path].heap_bytes += r.heap_bytes / iterations;
+            total[path].objects += r.objects;
+        }
+    }
+
+    /* Settings screen as ui_settings.c builds it: tab containers only + first tab */
+    {
+        const ui_screen_table_t *table = ui_screen_table_get(SCREEN_ID_SETTINGS_SCREEN);
+        const int16_t tabs[] = {
+            UI_TBL_SLOT(settings_screen_tabs_network_content),
+            UI_TBL_SLOT(settings_screen_tabs_printers_content),
+            UI_TBL_SLOT(settings_screen_tabs_hardware_content),
+            UI_TBL_SLOT(settings_screen_tabs_system_content),
+        };
+        bench_result_t r = {0};
+        for (int n = 0; n < iterations; n++) {
+            size_t heap_before = bench_heap_used();
+            uint64_t t0 = bench_now_us();
+            lv_obj_t *scr = ui_screen_table_create_deferred(table, tabs, 4);
+            ui_screen_table_create_children(table, tabs[0]);
+            r.create_us += bench_now_us() - t0;
+            r.heap_bytes += bench_heap_used() - heap_before;
+            r.objects = bench_count_objects(scr);
+            lv_obj_delete(scr);
+            memset(&objects, 0, sizeof(objects));
+        }
+        printf("%-22s %-6s %10llu %10s %8u %10zu\n", "settings_screen", "lazy",
+               (unsigned long long)(r.create_us / iterations), "-", r.objects, r.heap_bytes / iterations);
+    }
+
+    for (int path = 0; path < 2; path++) {
+        printf("%-22s %-6s %10llu %10llu %8u %10zu\n", "TOTAL", path ? "table" : "eez",
+               (unsigned long long)total[path].create_us, (unsigned long long)total[path].render_us,
+               total[path].objects, total[path].heap_bytes);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("LVGL heap after run: used %zu B, max used %zu B, frag %u%%\n",
+           mon.total_size - mon.free_size, mon.max_used, mon.frag_pct);
+
+    return 0;
+}
+
+// =============================================================================
+// Spool rendering: layered recolored images vs precomposed gauge
+// =============================================================================
+
+#define BENCH_SPOOLS 18          /* AMS overview: 4 AMS x 4 slots + 2 HT */
+#define BENCH_SPOOL_SCALE 400    /* EEZ scale of the AMS overview spool images */
+
+enum { SPOOL_LAYERED, SPOOL_GAUGE_SCALED, SPOOL_GAUGE, SPOOL_MODES };
+
+static const char *spool_mode_names[SPOOL_MODES] = { "layered", "gauge+scale", "gauge" };
+
+static const uint32_t bench_colors[] = {
+    0xff0000, 0x00ff00, 0x0000ff, 0xffff00, 0xff00ff, 0x00ffff, 0xffffff, 0x202020,
+};
+
+/* Update every spool (color and fill level) and render one frame */
+static uint64_t bench_spool_frame(int mode, lv_obj_t *outline[], lv_obj_t *fill[], int frame)
+{
+    int gauge_w = UI_SPOOL_GAUGE_SRC_W * BENCH_SPOOL_SCALE / 256;
+    int gauge_h = UI_SPOOL_GAUGE_SRC_H * BENCH_SPOOL_SCALE / 256;
+
+    uint64_t t0 = bench_now_us();
+    for (int i = 0; i < BENCH_SPOOLS; i++) {
+        uint32_t color = bench_colors[(i + frame) % (sizeof(bench_colors) / sizeof(bench_colors[0]))];
+        int pct = (i * 7 + frame * 10) % 101;
+        if (mode == SPOOL_LAYERED) {
+            lv_obj_set_style_image_recolor(fill[i], lv_color_hex(color), 0);
+        } else if (mode == SPOOL_GAUGE_SCALED) {
+            ui_spool_gauge_set(outline[i], color, pct, UI_SPOOL_GAUGE_SRC_W, UI_SPOOL_GAUGE_SRC_H);
+        } else {
+            ui_spool_gauge_set(outline[i], color, pct, gauge_w, gauge_h);
+        }
+    }
+    lv_refr_now(bench_disp);
+    return bench_now_us() - t0;
+}
+
+int sim_bench_spool_gauge(int iterations)
+{
+    if (iterations <= 0) iterations = 200;
+
+    bench_init();
+
+    printf("Spool rendering benchmark (%d spools, %d frames, headless %dx%d)\n",
+           BENCH_SPOOLS, iterations, BENCH_HOR_RES, BENCH_VER_RES);
+    printf("%-12s %10s %10s %10s %12s\n", "mode", "frame_us", "first_us", "objects", "cache_B");
+
+    for (int mode = 0; mode < SPOOL_MODES; mode++) {
+        lv_obj_t *scr = lv_obj_create(NULL);
+        lv_obj_set_style_bg_color(scr, lv_color_hex(0x1a1a1a), 0);
+        lv_screen_load(scr);
+
+        lv_obj_t *outline[BENCH_SPOOLS] = {0};
+        lv_obj_t *fill[BENCH_SPOOLS] = {0};
+        int gauge_w = UI_SPOOL_GAUGE_SRC_W * BENCH_SPOOL_SCALE / 256;
+        int gauge_h = UI_SPOOL_GAUGE_SRC_H * BENCH_SPOOL_SCALE / 256;
+        for (int i = 0; i < BENCH_SPOOLS; i++) {
+            int x = 40 + (i % 6) * 120;
+            int y = 40 + (i / 6) * 140;
+            outline[i] = lv_image_create(scr);
+            lv_obj_set_pos(outline[i], x, y);
+            if (mode == SPOOL_GAUGE) {
+                lv_obj_set_size(outline[i], gauge_w, gauge_h);
+                continue;
+            }
+            lv_obj_set_size(outline[i], UI_SPOOL_GAUGE_SRC_W, UI_SPOOL_GAUGE_SRC_H);
+            lv_image_set_src(outline[i], &img_spool_clean);
+            lv_image_set_scale(outline[i], BENCH_SPOOL_SCALE);
+            if (mode == SPOOL_LAYERED) {
+                fill[i] = lv_image_create(scr);
+                lv_obj_set_pos(fill[i], x, y);
+                lv_obj_set_size(fill[i], UI_SPOOL_GAUGE_SRC_W, UI_SPOOL_GAUGE_SRC_H);
+                lv_image_set_src(fill[i], &img_spool_fill);
+                lv_image_set_scale(fill[i], BENCH_SPOOL_SCALE);
+                lv_obj_set_style_image_recolor_opa(fill[i], 255, 0);
+            }
+        }
+
+        /* First frame includes composing every gauge */
+        uint64_t first_us = bench_spool_frame(mode, outline, fill, 0);
+        uint64_t total_us = 0;
+        for (int n = 1; n <= iterations; n++) {
+            total_us += bench_spool_frame(mode, outline, fill, n);
+        }
+
+        size_t cache_bytes = 0;
+        ui_spool_gauge_cache_stats(&cache_bytes);
+        printf("%-12s %10llu %10llu %10u %12zu\n", spool_mode_names[mode],
+               (unsigned long long)(total_us / iterations), (unsigned long long)first_us,
+               bench_count_objects(scr) - 1, mode == SPOOL_LAYERED ? (size_t)0 : cache_bytes);
+
+        lv_obj_t *base = lv_obj_create(NULL);
+        lv_screen_load(base);
+        lv_obj_delete(scr);
+        ui_spool_gauge_cache_trim();
+    }
+
+    return 0;
+}
+
+// =============================================================================
+// Navigation soak: per-screen arenas vs general LVGL heap
+// =============================================================================
+
+#define SOAK_SECONDS_PER_STEP 10    /* One navigation every 10 s of simulated use */
+#define SOAK_WARMUP_STEPS 50        /* Caches filled, splash gone */
+#define SOAK_SAMPLE_STEPS 360       /* Heap sample every simulated hour */
+
+/* Typical use: main <-> AMS (with the slot modal), details, settings pages */
+static const int soak_route[] = {
+    SCREEN_ID_MAIN_SCREEN, SCREEN_ID_AMS_OVERVIEW, SCREEN_ID_MAIN_SCREEN, SCREEN_ID_SPOOL_DETAILS,
+    SCREEN_ID_MAIN_SCREEN, SCREEN_ID_SCAN_RESULT, SCREEN_ID_AMS_OVERVIEW, SCREEN_ID_SETTINGS_SCREEN,
+    SCREEN_ID_SETTINGS_WIFI_SCREEN, SCREEN_ID_SETTINGS_SCREEN, SCREEN_ID_SETTINGS_DISPLAY_SCREEN,
+    SCREEN_ID_KEYBOARD_LAYOUT_SCREEN, SCREEN_ID_SETTINGS_SCREEN, SCREEN_ID_SCALE_CALIBRATION_SCREEN,
+    SCREEN_ID_SETTINGS_SCREEN, SCREEN_ID_NFC_SCREEN, SCREEN_ID_SETTINGS_UPDATE_SCREEN,
+    SCREEN_ID_SETTINGS_PRINTER_ADD_SCREEN, SCREEN_ID_MAIN_SCREEN,
+};
+
+/* Advance simulated time and run LVGL timers and rendering */
+static void soak_advance(uint32_t ms)
+{
+    bench_sim_ms += ms;
+    lv_timer_handler();
+    lv_refr_now(bench_disp);
+}
+
+static void soak_print_heap(const char *label, const lv_mem_monitor_t *mon)
+{
+    printf("%-8s used %8zu B  max used %8zu B  free %8zu B  biggest free %8zu B  frag %3u%%\n",
+           label, mon->total_size - mon->free_size, mon->max_used, mon->free_size,
+           mon->free_biggest_size, mon->frag_pct);
+}
+
+int sim_bench_soak_nav(int hours, bool arenas)
+{
+    if (hours <= 0) hours = 24;
+    int steps = hours * 3600 / SOAK_SECONDS_PER_STEP;
+    int route_len = (int)(sizeof(soak_route) / sizeof(soak_route[0]));
+
+    bench_init();
+    ui_mem_arena_set_enabled(arenas);
+    ui_init();
+    soak_advance(1000);
+
+    printf("Navigation soak: %d simulated hours, %d transitions, arenas %s\n",
+           hours, steps, arenas ? "on" : "off");
+
+    lv_mem_monitor_t warm = {0}, mon;
+    uint64_t total_us = 0, max_us = 0;
+    size_t min_biggest = SIZE_MAX;
+    uint8_t max_frag = 0;
+    int modals = 0;
+
+    for (int n = 0; n < steps; n++) {
+        int screen = soak_route[n % route_len];
+        pendingScreen = (enum ScreensEnum)screen;
+
+        uint64_t t0 = bench_now_us();
+        ui_tick();
+        uint64_t us = bench_now_us() - t0;
+        total_us += us;
+        if (us > max_us) max_us = us;
+        soak_advance(SOAK_SECONDS_PER_STEP * 1000 / 2);
+
+        /* Configure a slot on every AMS visit; content is built by the modal's load timer */
+        if (screen == SCREEN_ID_AMS_OVERVIEW) {
+            ui_ams_slot_modal_open("SOAK", n % 4, n % 4, 4, -1, "PLA", "FF0000FF", NULL);
+            soak_advance(200);
+            ui_ams_slot_modal_close();
+            modals++;
+        }
+        soak_advance(SOAK_SECONDS_PER_STEP * 1000 / 2);
+
+        lv_mem_monitor(&mon);
+        if (n == SOAK_WARMUP_STEPS) warm = mon;
+        if (n >= SOAK_WARMUP_STEPS) {
+            if (mon.free_biggest_size < min_biggest) min_biggest = mon.free_biggest_size;
+            if (mon.frag_pct > max_frag) max_frag = mon.frag_pct;
+        }
+        if (n > 0 && n % SOAK_SAMPLE_STEPS == 0) {
+            char label[16];
+            snprintf(label, sizeof(label), "%4dh", n / SOAK_SAMPLE_STEPS);
+            soak_print_heap(label, &mon);
+        }
+    }
+
+    printf("\nLVGL heap (%s):\n", arenas ? "arena allocations excluded" : "all allocations");
+    soak_print_heap("warm", &warm);
+    soak_print_heap("end", &mon);
+    printf("worst    biggest free %zu B, frag %u%%\n", min_biggest, max_frag);
+    printf("transition build: avg %llu us, max %llu us (%d modals)\n",
+           (unsigned long long)(total_us / (steps ? steps : 1)), (unsigned long long)max_us, modals);
+
+    int count = ui_mem_arena_get_stats(0, NULL);
+    for (int i = 0; i < count; i++) {
+        ui_mem_arena_stats_t st;
+        ui_mem_arena_get_stats(i, &st);
+        printf("arena %d %-6s capacity %7zu B  high water %7zu B  in use %7zu B  resets %u  fallbacks %u\n",
+               i, st.kind == UI_MEM_ARENA_SCREEN ? "screen" : "modal", st.capacity, st.high_water,
+               st.used, st.resets, st.fallbacks);
+    }
+
+    return 0;
+}
+
+// =============================================================================
+// Logging: printf vs deferred ui_log records
+// =============================================================================
+
+#define LOG_BENCH_BATCH 100     /* Records written between drains */
+
+static void log_null_sink(int level, const char *tag, uint32_t time_ms, const char *line)
+{
+    (void)level;
+    (void)tag;
+    (void)time_ms;
+    (void)line;
+}
+
+static double log_ns_per_call(uint64_t us, int calls)
+{
+    return calls ? (double)us * 1000.0 / calls : 0.0;
+}
+
+int sim_bench_log(int iterations)
+{
+    if (iterations <= 0) iterations = 100000;
+
+    FILE *null_out = fopen("/dev/null", "w");
+    if (!null_out) {
+        perror("/dev/null");
+        return 1;
+    }
+    const char *type = "PLA";
+    const char *color = "FF8800FF";
+    char line[256];
+    volatile size_t sink = 0;
+
+    printf("Logging benchmark (%d calls of a 4-argument message)\n", iterations);
+    printf("%-24s %10s\n", "path", "ns/call");
+
+    uint64_t t0 = bench_now_us();
+    for (int i = 0; i < iterations; i++) {
+        fprintf(null_out, "[backend] Tray %d.%d: type='%s' color='%s'\n", i & 3, i & 7, type, color);
+    }
+    printf("%-24s %10.1f\n", "printf (to /dev/null)", log_ns_per_call(bench_now_us() - t0, iterations));
+
+    t0 = bench_now_us();
+    for (int i = 0; i < iterations; i++) {
+        sink += (size_t)snprintf(line, sizeof(line), "Tray %d.%d: type='%s' color='%s'", i & 3, i & 7, type, color);
+    }
+    printf("%-24s %10.1f\n", "snprintf only", log_ns_per_call(bench_now_us() - t0, iterations));
+
+    /* Write and drain in batches so the ring never overflows */
+    uint64_t write_us = 0, drain_us = 0;
+    for (int done = 0; done < iterations; done += LOG_BENCH_BATCH) {
+        t0 = bench_now_us();
+        for (int i = done; i < done + LOG_BENCH_BATCH; i++) {
+            UI_LOGI("Tray %d.%d: type='%s' color='%s'", i & 3, i & 7, type, color);
+        }
+        uint64_t t1 = bench_now_us();
+        ui_log_drain(log_null_sink, 0);
+        write_us += t1 - t0;
+        drain_us += bench_now_us() - t1;
+    }
+    int written = (iterations + LOG_BENCH_BATCH - 1) / LOG_BENCH_BATCH * LOG_BENCH_BATCH;
+    printf("%-24s %10.1f\n", "UI_LOGI record", log_ns_per_call(write_us, written));
+    printf("%-24s %10.1f\n", "  drain + format", log_ns_per_call(drain_us, written));
+
+    t0 = bench_now_us();
+    for (int i = 0; i < iterations; i++) {
+        UI_LOGV("Tray %d.%d: type='%s' color='%s'", i & 3, i & 7, type, color);
+        sink += (size_t)i;
+    }
+    printf("%-24s %10.1f\n", "UI_LOGV (compiled out)", log_ns_per_call(bench_now_us() - t0, iterations));
+    fclose(null_out);
+
+    /* The UI tick itself, on the main screen, with whatever it logs */
+    bench_init();
+    ui_init();
+    pendingScreen = SCREEN_ID_MAIN_SCREEN;
+    ui_tick();
+    ui_log_drain(log_null_sink, 0);
+
+    ui_log_stats_t before, after;
+    ui_log_get_stats(&before);
+    int ticks = iterations / 10 > 0 ? iterations / 10 : 1;
+    uint64_t tick_us = 0, tick_drain_us = 0;
+    for (int i = 0; i < ticks; i++) {
+        bench_sim_ms += 5;  /* Device loop period, so the 100ms UI poll runs as often as there */
+        lv_timer_handler();
+        t0 = bench_now_us();
+        ui_tick();
+        uint64_t t1 = bench_now_us();
+        ui_log_drain(log_null_sink, 0);
+        tick_us += t1 - t0;
+        tick_drain_us += bench_now_us() - t1;
+    }
+    ui_log_get_stats(&after);
+    printf("\nui_tick: %d ticks, avg %.2f us, %.2f records/tick, drain %.2f us/tick (off the tick)\n",
+           ticks, (double)tick_us / ticks, (double)(after.written - before.written) / ticks,
+           (double)tick_drain_us / ticks);
+    printf("ring: %zu B high water of %u B, %u dropped\n", after.high_water, (unsigned)UI_LOG_RING_SIZE,
+           after.dropped);
+
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,38 @@
+/**
+ * Simulator Benchmarks
+ * Headless (no SDL window) measurements of UI construction and rendering
+ *
+ * Usage:
+ *   ./simulator --bench-screens [iterations]
+ *   ./simulator --bench-gauge [frames]
+ *   ./simulator --soak-nav [hours] [on|off]
+ *   ./simulator --bench-log [calls]
+ */
+
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include <stdbool.h>
+
+// Compare EEZ create_screen_*() against the generated descriptor tables
+// (ui_screen_table.h): construction time, first-frame time, object count
+// and LVGL heap use per screen. Returns process exit code.
+int sim_bench_screens(int iterations);
+
+// Render AMS-overview-sized sets of spools with the layered EEZ images
+// (outline + recolored fill, scaled) and with precomposed ui_spool_gauge
+// images, changing every spool each frame. Returns process exit code.
+int sim_bench_spool_gauge(int iterations);
+
+// Drive the real UI through a fixed navigation route (one transition per
+// 10 s of simulated time, slot modal on every AMS visit) and report LVGL
+// heap fragmentation, largest free block and transition build time, with
+// per-screen arenas (ui_mem_arena.h) on or off. Returns process exit code.
+int sim_bench_soak_nav(int hours, bool arenas);
+
+// Per-call cost of printf, of a deferred ui_log record and of a
+// compiled-out call, the cost of draining, and the UI tick time with its
+// log records. Returns process exit code.
+int sim_bench_log(int iterations);
+
+#endif // SIM_BENCH_H
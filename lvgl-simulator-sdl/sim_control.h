@@ -14,6 +14,21 @@ void sim_set_nfc_tag_present(bool present);
 void sim_set_nfc_uid(uint8_t *uid, uint8_t len);
 bool sim_get_nfc_tag_present(void);
 
+// Tags in the reader field for bulk inventory mode (several spools at once)
+typedef struct {
+    uint8_t uid[10];
+    uint8_t uid_len;
+    const char *vendor;         // NULL = tag without decodable data
+    const char *material;
+    const char *subtype;
+    const char *color_name;
+    uint32_t color_rgba;
+    int spool_weight;
+} SimNfcTag;
+
+void sim_set_nfc_tags(const SimNfcTag *tags, int count);
+int sim_get_nfc_tag_count(void);
+
 // Scale Control (defined in ui/ui_scale.c)
 void sim_set_scale_weight(float weight);
 void sim_set_scale_initialized(bool initialized);
@@ -9,6 +9,7 @@
 // Test suite declarations
 extern void run_parsing_tests(void);
 extern void run_formatting_tests(void);
+extern void run_log_tests(void);
 
 void setUp(void) {
     // Called before each test
@@ -29,6 +30,7 @@ int main(int argc, char **argv) {
     // Run all test suites
     run_parsing_tests();
     run_formatting_tests();
+    run_log_tests();
 
     int result = UNITY_END();
 
@@ -0,0 +1,158 @@
+/**
+ * Unit Tests for Deferred Logging
+ * Tests argument capture, formatting on drain and ring overflow (ui_log.c)
+ */
+
+#include "unity.h"
+#include <string.h>
+#include <stdio.h>
+
+#define UI_LOG_LEVEL UI_LOG_LEVEL_DEBUG
+#include "ui_log.h"
+
+static const char *TAG = "test";
+
+static char last_line[256];
+static const char *last_tag;
+static int last_level;
+static int lines;
+
+static void capture_sink(int level, const char *tag, uint32_t time_ms, const char *line) {
+    (void)time_ms;
+    snprintf(last_line, sizeof(last_line), "%s", line);
+    last_tag = tag;
+    last_level = level;
+    lines++;
+}
+
+static void drain_all(void) {
+    lines = 0;
+    ui_log_drain(capture_sink, 0);
+}
+
+// ============================================================================
+// Capture and Formatting Tests
+// ============================================================================
+
+void test_log_formats_on_drain(void) {
+    drain_all();
+    UI_LOGI("Tray %d.%d: type='%s' weight=%.1f", 1, 2, "PLA", 998.5);
+
+    drain_all();
+    TEST_ASSERT_EQUAL(1, lines);
+    TEST_ASSERT_EQUAL_STRING("Tray 1.2: type='PLA' weight=998.5", last_line);
+    TEST_ASSERT_EQUAL_STRING("test", last_tag);
+    TEST_ASSERT_EQUAL(UI_LOG_LEVEL_INFO, last_level);
+}
+
+void test_log_copies_strings(void) {
+    char buf[16] = "before";
+    UI_LOGW("value %s", buf);
+    strcpy(buf, "after");
+
+    drain_all();
+    TEST_ASSERT_EQUAL_STRING("value before", last_line);
+    TEST_ASSERT_EQUAL(UI_LOG_LEVEL_WARN, last_level);
+}
+
+void test_log_integer_widths(void) {
+    uint8_t small = 200;
+    int16_t negative = -5;
+    size_t size = 123;
+    uint32_t rgba = 0xDEADBEEF;
+    UI_LOGD("%u %d %zu %08lX %c %%", small, negative, size, (unsigned long)rgba, 'Z');
+
+    drain_all();
+    TEST_ASSERT_EQUAL_STRING("200 -5 123 DEADBEEF Z %", last_line);
+}
+
+void test_log_flags_width_precision(void) {
+    UI_LOGI("[%-4d][%5.2f][%*d][%.*s]", 42, 3.14159, 3, 7, 2, "abcdef");
+
+    drain_all();
+    TEST_ASSERT_EQUAL_STRING("[42  ][ 3.14][  7][ab]", last_line);
+}
+
+void test_log_null_string(void) {
+    const char *missing = NULL;
+    UI_LOGI("name=%s", missing);
+
+    drain_all();
+    TEST_ASSERT_EQUAL_STRING("name=(null)", last_line);
+}
+
+void test_log_truncates_long_strings(void) {
+    char big[UI_LOG_MAX_STRING * 2];
+    memset(big, 'a', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    UI_LOGI("%s", big);
+
+    drain_all();
+    TEST_ASSERT_EQUAL(UI_LOG_MAX_STRING - 1, strlen(last_line));
+}
+
+void test_log_below_level_compiled_out(void) {
+    ui_log_stats_t before, after;
+    ui_log_get_stats(&before);
+    UI_LOGV("not recorded %d", 1);
+    ui_log_get_stats(&after);
+
+    TEST_ASSERT_EQUAL(before.written, after.written);
+}
+
+// ============================================================================
+// Ring Tests
+// ============================================================================
+
+void test_log_drain_limit(void) {
+    drain_all();
+    UI_LOGI("one");
+    UI_LOGI("two");
+    UI_LOGI("three");
+
+    lines = 0;
+    TEST_ASSERT_EQUAL(2, ui_log_drain(capture_sink, 2));
+    TEST_ASSERT_EQUAL_STRING("two", last_line);
+    drain_all();
+    TEST_ASSERT_EQUAL_STRING("three", last_line);
+}
+
+void test_log_overflow_drops_oldest(void) {
+    drain_all();
+    ui_log_stats_t before, after;
+    ui_log_get_stats(&before);
+
+    for (int i = 0; i < 5000; i++) {
+        UI_LOGI("record %d of %s", i, "overflow");
+    }
+    ui_log_get_stats(&after);
+    TEST_ASSERT_TRUE(after.dropped > before.dropped);
+    TEST_ASSERT_EQUAL(5000, after.pending + (after.dropped - before.dropped));
+
+    // Newest records survive, followed by the drop notice
+    lines = 0;
+    ui_log_drain(capture_sink, (int)after.pending);
+    TEST_ASSERT_EQUAL_STRING("record 4999 of overflow", last_line);
+
+    drain_all();
+    TEST_ASSERT_EQUAL(1, lines);
+    TEST_ASSERT_EQUAL(UI_LOG_LEVEL_WARN, last_level);
+    TEST_ASSERT_NOT_NULL(strstr(last_line, "dropped"));
+}
+
+// ============================================================================
+// Test Suite Runner
+// ============================================================================
+
+void run_log_tests(void) {
+    RUN_TEST(test_log_formats_on_drain);
+    RUN_TEST(test_log_copies_strings);
+    RUN_TEST(test_log_integer_widths);
+    RUN_TEST(test_log_flags_width_precision);
+    RUN_TEST(test_log_null_string);
+    RUN_TEST(test_log_truncates_long_strings);
+    RUN_TEST(test_log_below_level_compiled_out);
+
+    RUN_TEST(test_log_drain_limit);
+    RUN_TEST(test_log_overflow_drops_oldest);
+}
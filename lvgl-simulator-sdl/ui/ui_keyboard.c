@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_keyboard.c
\ No newline at end of file
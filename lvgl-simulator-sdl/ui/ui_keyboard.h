@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_keyboard.h
\ No newline at end of file
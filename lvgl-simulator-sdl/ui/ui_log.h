@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_log.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_nfc_inventory.c
\ No newline at end of file
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_nfc_inventory.h
\ No newline at end of file
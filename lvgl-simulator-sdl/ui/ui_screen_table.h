@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_screen_table.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_slot_stripes.h
\ No newline at end of file
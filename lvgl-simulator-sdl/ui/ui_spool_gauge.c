@@ -0,0 +1 @@
+../../firmware/components/eez_ui/ui_spool_gauge.c
\ No newline at end of file
@@ -5,6 +5,7 @@
  * Supports:
  * - MIFARE Classic 1K (Bambu Lab tags) with HKDF key derivation
  * - NTAG (SpoolEase/OpenPrintTag with NDEF)
+ * - Inventory of all tags in the field (bulk registration)
  */
 
 #include <SPI.h>
@@ -24,6 +25,8 @@
 #define CMD_GET_PRODUCT_VERSION 0x01
 #define CMD_SCAN_TAG            0x10
 #define CMD_READ_TAG_DATA       0x20  // New: Read tag blocks/pages
+#define CMD_INVENTORY           0x30  // Inventory round: every tag in the field
+#define CMD_INVENTORY_GET       0x31  // Get one tag of the last inventory round
 
 // Tag types (from SAK byte)
 #define TAG_TYPE_UNKNOWN        0
@@ -1128,6 +1131,257 @@ bool scanTag() {
     return false;
 }
 
+// ============================================================================
+// Inventory (all tags in the field)
+// ============================================================================
+//
+// scanTag() only ever sees one card: activateTypeA() stops at cascade level 1
+// and has no collision handling. An inventory round walks the ISO14443-3
+// anticollision tree instead: REQA, bit-level anticollision on every cascade
+// level, SELECT, read, HLTA - until REQA gets no answer. Halted cards ignore
+// REQA, so every card in the field is selected once per round.
+
+#define INVENTORY_MAX_TAGS      16
+#define INVENTORY_MAX_SELECTS   (INVENTORY_MAX_TAGS * 2 + 4)
+
+// Inventory data status
+#define INV_DATA_NONE           0   // UID only (NTAG / unknown type)
+#define INV_DATA_BLOCKS         1   // Bambu blocks 1, 2, 4, 5 read
+#define INV_DATA_READ_ERROR     2   // MIFARE, but auth/read failed
+
+struct InventoryTag {
+    uint8_t uid[10];
+    uint8_t uidLen;
+    uint8_t tagType;
+    uint8_t dataStatus;
+    uint8_t blocks[4][16];
+};
+
+InventoryTag inventoryTags[INVENTORY_MAX_TAGS];
+uint8_t inventoryCount = 0;
+
+// Anticollision + SELECT for one cascade level (sel = 0x93/0x95/0x97).
+// Returns the SAK, or -1 if no card answered. uidPart gets the 4 UID bytes
+// of this level (CT + 3 UID bytes if the SAK has the cascade bit).
+int anticollisionLevel(uint8_t sel, uint8_t *uidPart) {
+    uint8_t known[5] = {0};
+    uint8_t knownBits = 0;
+
+    // CRC off during anticollision
+    pn5180_writeRegisterAndMask(0x12, 0xFFFFFFFE);
+    pn5180_writeRegisterAndMask(0x19, 0xFFFFFFFE);
+
+    for (uint8_t attempt = 0; attempt < 40 && knownBits < 40; attempt++) {
+        uint8_t byteCount = knownBits / 8;
+        uint8_t bitCount = knownBits % 8;
+        uint8_t sendBytes = byteCount + (bitCount ? 1 : 0);
+
+        uint8_t cmd[7];
+        cmd[0] = sel;
+        cmd[1] = ((2 + byteCount) << 4) | bitCount;  // NVB
+        memcpy(&cmd[2], known, sendBytes);
+
+        // Answer continues where our last partial byte ends: RX_BIT_ALIGN (bits 6-8)
+        pn5180_writeRegisterAndMask(0x12, 0xFFFFFE3F);
+        pn5180_writeRegisterOrMask(0x12, (uint32_t)bitCount << 6);
+        pn5180_writeRegister(0x03, 0xFFFFFFFF);
+        pn5180_setTransceiveMode();
+        pn5180_sendData(cmd, 2 + sendBytes, bitCount);
+        delay(5);
+
+        uint32_t rxStatus = pn5180_readRegister(0x13);
+        uint16_t rxLen = rxStatus & 0x1FF;
+        if (rxLen == 0 || rxLen > 5) break;
+
+        uint8_t rx[5];
+        pn5180_readData(rx, rxLen);
+
+        // Bits below bitCount of the first byte are the ones we sent
+        uint8_t mask = (1 << bitCount) - 1;
+        known[byteCount] = (known[byteCount] & mask) | (rx[0] & ~mask);
+        for (uint8_t i = 1; i < rxLen && byteCount + i < 5; i++) {
+            known[byteCount + i] = rx[i];
+        }
+
+        if (!(rxStatus & (1UL << 18))) {  // RX_COLLISION_DETECTED
+            knownBits = 40;
+            break;
+        }
+
+        // RX_COLL_POS (bits 19-25) counts received bits. Both 0 and 1 were
+        // sent there: take the 1 branch, the 0 branch answers once it's halted.
+        uint8_t bit = knownBits + ((rxStatus >> 19) & 0x7F);
+        if (bit >= 40) break;
+        known[bit / 8] = (known[bit / 8] & ((1 << (bit % 8)) - 1)) | (1 << (bit % 8));
+        knownBits = bit + 1;
+    }
+
+    pn5180_writeRegisterAndMask(0x12, 0xFFFFFE3F);  // RX_BIT_ALIGN = 0
+    if (knownBits < 40) return -1;
+    if ((known[0] ^ known[1] ^ known[2] ^ known[3]) != known[4]) return -1;
+
+    // SELECT with CRC
+    pn5180_writeRegister(0x03, 0xFFFFFFFF);
+    pn5180_setTransceiveMode();
+    pn5180_writeRegisterOrMask(0x19, 0x01);
+    pn5180_writeRegisterOrMask(0x12, 0x01);
+
+    uint8_t selectCmd[7] = {sel, 0x70, known[0], known[1], known[2], known[3], known[4]};
+    pn5180_sendData(selectCmd, 7, 0x00);
+    delay(10);
+
+    uint16_t rxLen = pn5180_readRegister(0x13) & 0x1FF;
+    if (rxLen < 1 || rxLen > 3) return -1;
+
+    uint8_t sakBuf[3];
+    pn5180_readData(sakBuf, rxLen);
+    memcpy(uidPart, known, 4);
+    return sakBuf[0];
+}
+
+// REQA + anticollision over all cascade levels.
+// Returns: 0 = no idle card left, 4/7/10 = UID length of the selected card
+uint8_t inventorySelectNext(uint8_t *uid, uint8_t *sak) {
+    pn5180_writeRegisterAndMask(0x00, 0xFFFFFFBF);  // Crypto off
+    pn5180_writeRegisterAndMask(0x12, 0xFFFFFFFE);  // RX CRC off
+    pn5180_writeRegisterAndMask(0x19, 0xFFFFFFFE);  // TX CRC off
+    pn5180_writeRegister(0x03, 0xFFFFFFFF);
+    pn5180_setTransceiveMode();
+    delay(2);
+
+    // REQA, not WUPA: halted cards must stay quiet
+    uint8_t reqa = 0x26;
+    pn5180_sendData(&reqa, 1, 0x07);
+    delay(5);
+
+    uint16_t rxLen = pn5180_readRegister(0x13) & 0x1FF;
+    if (rxLen < 2 || rxLen > 64) return 0;
+
+    // ATQA of several cards collides - expected, only its presence matters
+    uint8_t atqa[2];
+    pn5180_readData(atqa, 2);
+
+    const uint8_t selCodes[3] = {0x93, 0x95, 0x97};
+    uint8_t uidLen = 0;
+    for (uint8_t level = 0; level < 3; level++) {
+        uint8_t part[4];
+        int levelSak = anticollisionLevel(selCodes[level], part);
+        if (levelSak < 0) return 0;
+
+        if (levelSak & 0x04) {
+            // Cascade bit: UID not complete, part[0] is the cascade tag (0x88)
+            memcpy(&uid[uidLen], &part[1], 3);
+            uidLen += 3;
+        } else {
+            memcpy(&uid[uidLen], part, 4);
+            uidLen += 4;
+            *sak = (uint8_t)levelSak;
+            return uidLen;
+        }
+    }
+    return 0;
+}
+
+// HLTA the selected card. An authenticated MIFARE card ignores a plain HLTA
+// and drops back to IDLE instead; the next REQA selects it again, it is found
+// in the inventory and halted then.
+void inventoryHalt() {
+    pn5180_writeRegisterAndMask(0x00, 0xFFFFFFBF);  // Crypto off
+    pn5180_writeRegister(0x03, 0xFFFFFFFF);
+    pn5180_setTransceiveMode();
+    pn5180_writeRegisterOrMask(0x19, 0x01);  // TX CRC on
+
+    uint8_t hlta[2] = {0x50, 0x00};
+    pn5180_sendData(hlta, 2, 0x00);
+    delay(2);
+}
+
+// Read Bambu blocks 1, 2, 4, 5 of the card that is selected right now
+// (no reactivation: an RF cycle would wake every halted card)
+bool inventoryReadBambuBlocks(uint8_t blocks[4][16]) {
+    const uint8_t blocksToRead[] = {1, 2, 4, 5};
+    int currentSector = -1;
+
+    for (int i = 0; i < 4; i++) {
+        uint8_t block = blocksToRead[i];
+        uint8_t sector = block / 4;
+        if (sector != currentSector) {
+            if (!mifare_authenticate(block, getSectorKey(sector))) return false;
+            currentSector = sector;
+        }
+        if (!mifare_readBlock(block, blocks[i])) return false;
+    }
+    return true;
+}
+
+// Run one inventory round. Returns the number of tags found.
+uint8_t inventoryRound() {
+    inventoryCount = 0;
+
+    // RF cycle: every card starts the round in IDLE
+    pn5180_rfOff();
+    delay(20);
+    pn5180_writeRegister(0x03, 0xFFFFFFFF);
+    pn5180_loadRfConfig(0x00, 0x80);
+    delay(10);
+    pn5180_rfOn();
+    delay(30);
+
+    for (uint8_t n = 0; n < INVENTORY_MAX_SELECTS; n++) {
+        uint8_t uid[10];
+        uint8_t sak = 0;
+        uint8_t uidLen = inventorySelectNext(uid, &sak);
+        if (uidLen == 0) break;
+
+        bool known = false;
+        for (uint8_t i = 0; i < inventoryCount; i++) {
+            if (inventoryTags[i].uidLen == uidLen && memcmp(inventoryTags[i].uid, uid, uidLen) == 0) {
+                known = true;
+                break;
+            }
+        }
+
+        if (!known && inventoryCount < INVENTORY_MAX_TAGS) {
+            InventoryTag *tag = &inventoryTags[inventoryCount++];
+            memcpy(tag->uid, uid, uidLen);
+            tag->uidLen = uidLen;
+            tag->tagType = getTagType(sak);
+            tag->dataStatus = INV_DATA_NONE;
+
+            if (tag->tagType == TAG_TYPE_MIFARE_1K || tag->tagType == TAG_TYPE_MIFARE_4K) {
+                // mifare_authenticate() takes the UID from tagUid
+                memcpy(tagUid, uid, uidLen);
+                tagUidLen = uidLen;
+                hkdf_derive_keys(uid, uidLen);
+                tag->dataStatus = inventoryReadBambuBlocks(tag->blocks) ? INV_DATA_BLOCKS : INV_DATA_READ_ERROR;
+            }
+
+            logSeqStart("Inventory tag ");
+            Serial.print(inventoryCount);
+            Serial.print(": type=");
+            Serial.print(tag->tagType);
+            Serial.print(" data=");
+            Serial.println(tag->dataStatus);
+        }
+
+        inventoryHalt();
+    }
+
+    // The round borrowed the single-tag state (UID, keys) and halted every
+    // card - make the next scanTag() start from scratch
+    tagUidLen = 0;
+    tagPresent = false;
+    tagDataValid = false;
+    keysGenerated = false;
+    tagDetectCount = 0;
+    tagMissCount = 0;
+
+    logSeqStart("Inventory round: ");
+    Serial.print(inventoryCount);
+    Serial.println(" tags");
+    return inventoryCount;
+}
+
 // ============================================================================
 // I2C Command Processing
 // ============================================================================
@@ -1238,6 +1492,44 @@ void processCommand() {
             }
             break;
 
+        case CMD_INVENTORY:
+            respBuffer[0] = 0;  // Success
+            respBuffer[1] = inventoryRound();
+            respLength = 2;
+            break;
+
+        case CMD_INVENTORY_GET: {
+            // Request: [cmd][seq][index]
+            // Response format:
+            // [0] = status (0 = success, 1 = no such tag)
+            // [1] = index
+            // [2] = tag type
+            // [3] = data status (INV_DATA_*)
+            // [4] = uid length
+            // [5..5+uidLen] = uid
+            // Then for INV_DATA_BLOCKS: blocks 1, 2, 4, 5 = 64 bytes
+            uint8_t index = (cmdLength >= 3) ? cmdBuffer[2] : 0xFF;
+            if (index >= inventoryCount) {
+                respBuffer[0] = 1;  // No such tag
+                respLength = 1;
+                break;
+            }
+            InventoryTag *tag = &inventoryTags[index];
+            respBuffer[0] = 0;  // Success
+            respBuffer[1] = index;
+            respBuffer[2] = tag->tagType;
+            respBuffer[3] = tag->dataStatus;
+            respBuffer[4] = tag->uidLen;
+            memcpy((void*)&respBuffer[5], tag->uid, tag->uidLen);
+            int offset = 5 + tag->uidLen;
+            if (tag->dataStatus == INV_DATA_BLOCKS) {
+                memcpy((void*)&respBuffer[offset], tag->blocks, 64);
+                offset += 64;
+            }
+            respLength = offset;
+            break;
+        }
+
         default:
             respBuffer[0] = 0xFF;
             respLength = 1;
@@ -1284,8 +1576,8 @@ void setup() {
     pinMode(LED_BUILTIN, OUTPUT);
     Serial.begin(115200);
     delay(2000);
-    Serial.println("Pico NFC Bridge v2.0 starting...");
-    Serial.println("Features: MIFARE Classic + NTAG + Bambu HKDF");
+    Serial.println("Pico NFC Bridge v2.1 starting...");
+    Serial.println("Features: MIFARE Classic + NTAG + Bambu HKDF + Inventory");
 
     pinMode(PN5180_NSS, OUTPUT);
     digitalWrite(PN5180_NSS, HIGH);
@@ -2,4 +2,5 @@
 
 cd backend
 python -m pytest tests/ -v           # All tests
+# python -m pytest tests/benchmark --benchmark-only -s   # MQTT load benchmarks (SPOOLBUDDY_BENCH_* to scale)
 cd ..